@@ -0,0 +1,23 @@
+#ifndef BLANK_SCAN_H
+#define BLANK_SCAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Check whether a buffer is entirely 0xFF, i.e. identical to erased NOR.
+ *
+ * Uses AVX2 or SSE2 on x86 and NEON on AArch64, with a word-at-a-time loop
+ * otherwise. Stops at the first block holding data, so typical (non-blank)
+ * chunks cost only a few loads. Any alignment is accepted. Thread-safe.
+ */
+bool blank_scan_is_erased(const uint8_t* data, size_t length);
+
+/**
+ * Name of the implementation selected for this CPU
+ * ("avx2", "sse2", "neon" or "word").
+ */
+const char* blank_scan_implementation(void);
+
+#endif // BLANK_SCAN_H
@@ -0,0 +1,28 @@
+#ifndef CRC32_H
+#define CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Update a standard (Ethernet/zlib, reflected 0xEDB88320) CRC32.
+ *
+ * Same semantics as zlib's crc32(): start with 0, feed the data in any
+ * number of pieces, and the result is the finished CRC of the concatenation:
+ *
+ *   uint32_t crc = 0;
+ *   crc = crc32_update(crc, part1, len1);
+ *   crc = crc32_update(crc, part2, len2);
+ *
+ * Uses PCLMULQDQ folding on x86 or the ARMv8 CRC32 instructions when the
+ * CPU supports them, and a slicing-by-8 table otherwise. Thread-safe.
+ */
+uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t length);
+
+/**
+ * Name of the implementation selected for this CPU
+ * ("pclmul", "armv8-crc" or "slice-by-8").
+ */
+const char* crc32_implementation(void);
+
+#endif // CRC32_H
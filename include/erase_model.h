@@ -0,0 +1,41 @@
+#ifndef ERASE_MODEL_H
+#define ERASE_MODEL_H
+
+#include "thingino.h"
+
+/**
+ * Learned chip-erase times, kept per SoC variant and flash size.
+ *
+ * Each measured erase (the burner visibly going from busy to ready) is
+ * folded into a small text file in the user's cache directory, one line
+ * per key: "<key> <samples> <min_ms> <mean_ms> <max_ms>". The model lets
+ * the erase wait report what to expect, and on A1 raise how long it waits
+ * before trusting a ready signal (from max_ms, which never goes down); it
+ * never extends a wait beyond the fixed upper bounds.
+ */
+
+typedef struct {
+    uint32_t samples;
+    uint32_t min_ms;
+    uint32_t mean_ms;   // Moving average over the last few erases
+    uint32_t max_ms;
+} erase_model_t;
+
+/**
+ * Model key for a device: "<variant>-<flash MB>" ("any" while the flash
+ * size is unknown), e.g. "t31x-16" or "a1-any". Devices behind a transport
+ * other than libusb get its name as a prefix ("sim-t31x-16").
+ */
+void erase_model_key(char* buffer, size_t size, const usb_device_t* device);
+
+/**
+ * Look up the model for a key. Returns false when nothing was learned yet.
+ */
+bool erase_model_lookup(const char* key, erase_model_t* model);
+
+/**
+ * Fold one measured erase time into the model and save it.
+ */
+thingino_error_t erase_model_record(const char* key, uint32_t erase_ms);
+
+#endif // ERASE_MODEL_H
@@ -2,6 +2,7 @@
 #define FLASH_DESCRIPTOR_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // Flash descriptor structure size
 #define FLASH_DESCRIPTOR_SIZE 972
@@ -56,6 +57,28 @@ int flash_descriptor_create_t31x_writer_full(uint8_t *buffer);
  */
 int flash_descriptor_create_a1_writer_full(uint8_t *buffer);
 
+/**
+ * Set the SFC "force_erase" policy of a writer descriptor.
+ *
+ * With force_erase set (as in the captured writer_full descriptors) the
+ * first SetDataAddress/SetDataLength of a write erases the whole chip.
+ * Cleared, the burner erases only the blocks each write covers, which is
+ * how range-scoped writes avoid a full-chip erase. The field is the 32-bit
+ * word 0x14 bytes into the "\0CFS" (SFC) block, located by comparing the
+ * captured descriptors with the force_erase values of their vendor
+ * configurations.
+ *
+ * @return 0 on success, -1 if the descriptor has no SFC block
+ */
+int flash_descriptor_set_force_erase(uint8_t *descriptor, bool force_erase);
+
+/**
+ * Read the SFC "force_erase" policy of a descriptor.
+ *
+ * @return 0 on success, -1 if the descriptor has no SFC block
+ */
+int flash_descriptor_get_force_erase(const uint8_t *descriptor, bool *force_erase);
+
 /**
  * Send flash partition marker ("ILOP" header, 172 bytes) to device.
  *
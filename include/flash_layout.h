@@ -0,0 +1,45 @@
+#ifndef FLASH_LAYOUT_H
+#define FLASH_LAYOUT_H
+
+#include "thingino.h"
+#include "image_source.h"
+
+#define FLASH_LAYOUT_MAX_PARTITIONS 16
+
+/**
+ * One partition of a flash image layout.
+ */
+typedef struct {
+    char name[32];
+    uint32_t offset;
+    uint32_t size;
+} flash_partition_t;
+
+/**
+ * Parse a size such as "0x40000", "256k" or "2M". Returns false unless the
+ * whole string is a valid size.
+ */
+bool flash_layout_parse_size(const char* text, uint32_t* value);
+
+/**
+ * Parse a Linux mtdparts partition list, with or without the leading
+ * "mtdparts=" and "<mtd-id>:" parts, e.g.
+ *   "jz_sfc:256k(boot),64k(env),-(firmware)"
+ * Sizes take k/m/g suffixes, "@offset" is honoured and "-" takes the rest
+ * of flash_size. Returns the number of partitions, or -1 if the list is
+ * malformed.
+ */
+int flash_layout_parse_mtdparts(const char* spec, uint32_t flash_size,
+                                flash_partition_t* partitions, int max_partitions);
+
+/**
+ * Find a named partition in the layout embedded in an image.
+ *
+ * The first megabyte of the image (bootloader and its environment) is
+ * searched for an "mtdparts=" definition, as Thingino U-Boot builds carry
+ * one in their environment and kernel command line.
+ */
+thingino_error_t flash_layout_find_partition(firmware_image_t* image, const char* name,
+                                             flash_partition_t* partition);
+
+#endif // FLASH_LAYOUT_H
@@ -0,0 +1,44 @@
+#ifndef IMAGE_SOURCE_H
+#define IMAGE_SOURCE_H
+
+#include "thingino.h"
+
+/**
+ * Read-only firmware image opened for writing to a device.
+ *
+ * The file is memory-mapped when possible (read-only, advised sequential),
+ * so chunks go to the USB layer straight from the page cache and parallel
+ * writers of the same image share one set of physical pages. Where mapping
+ * is unavailable the image is streamed from the file chunk by chunk
+ * instead of being loaded whole.
+ */
+typedef struct {
+    uint32_t size;
+    const uint8_t* data;   // Whole image when mapped, NULL when streaming
+    FILE* file;            // Streaming fallback
+    void* mapping;         // Platform mapping handle (Windows file mapping)
+} firmware_image_t;
+
+/**
+ * Open an image file. Fails on empty files and files over 4GB.
+ */
+thingino_error_t firmware_image_open(const char* path, firmware_image_t* image);
+
+/**
+ * Get the bytes [offset, offset + length) of the image.
+ *
+ * Returns a pointer into the mapping, or reads into scratch (at least
+ * length bytes) when streaming. Returns NULL on a read error. Streaming
+ * reads share the file position, so only one thread may call this at a time.
+ */
+const uint8_t* firmware_image_chunk(firmware_image_t* image, uint32_t offset, uint32_t length,
+                                    uint8_t* scratch);
+
+/**
+ * CRC32 of the whole image.
+ */
+thingino_error_t firmware_image_crc32(firmware_image_t* image, uint32_t* crc);
+
+void firmware_image_close(firmware_image_t* image);
+
+#endif // IMAGE_SOURCE_H
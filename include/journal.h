@@ -0,0 +1,94 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include "thingino.h"
+#include <limits.h>
+#include <stdio.h>
+
+/**
+ * On-disk progress journal for resumable reads and writes.
+ *
+ * A journal is a small text file: one header line identifying the operation
+ * (direction, device port, image CRC/size and chunk size) followed by one
+ * "<index> <crc32>" line per completed chunk, flushed as each chunk
+ * finishes. A journal whose header does not match the current operation is
+ * discarded, as is a torn last line left by a crash.
+ */
+
+typedef enum {
+    JOURNAL_OP_READ,
+    JOURNAL_OP_WRITE
+} journal_op_t;
+
+typedef struct {
+    journal_op_t op;
+    char port[32];         // usb_device_info_port_string()
+    uint32_t image_crc;    // CRC32 of the image being written (0 for reads)
+    uint32_t image_size;   // Image size in bytes (0 for reads)
+    uint32_t chunk_size;
+} journal_key_t;
+
+typedef struct {
+    FILE* file;
+    char path[PATH_MAX];
+    journal_key_t key;
+    uint8_t* done;         // Per chunk: completed flag
+    uint32_t* crc;         // Per chunk: CRC32 of the chunk data
+    uint32_t capacity;     // Entries allocated in done/crc
+    uint32_t done_count;
+} journal_t;
+
+/**
+ * Fill a journal key for a device.
+ */
+void journal_key_init(journal_key_t* key, journal_op_t op, const device_info_t* device,
+                      uint32_t image_crc, uint32_t image_size, uint32_t chunk_size);
+
+/**
+ * Open the journal at path.
+ *
+ * With resume set, the chunks recorded by an earlier run under the same key
+ * are loaded; otherwise (or when the key differs) the journal starts empty.
+ */
+thingino_error_t journal_open(journal_t* journal, const char* path, const journal_key_t* key,
+                              bool resume);
+
+/**
+ * Look up a chunk. Returns true and its CRC if it was completed.
+ */
+bool journal_lookup(const journal_t* journal, uint32_t index, uint32_t* crc);
+
+/**
+ * Index of the first chunk that has not been completed.
+ */
+uint32_t journal_first_incomplete(const journal_t* journal);
+
+/**
+ * Record a completed chunk and flush it to disk.
+ */
+thingino_error_t journal_record(journal_t* journal, uint32_t index, uint32_t crc);
+
+/**
+ * Forget every recorded chunk (the header is kept).
+ */
+thingino_error_t journal_reset(journal_t* journal);
+
+/**
+ * Close the journal. A finished operation removes the file; an unfinished
+ * one leaves it behind for --resume.
+ */
+void journal_close(journal_t* journal, bool finished);
+
+/**
+ * Journal path for a read into output_file: "<output_file>.journal".
+ */
+bool journal_path_for_read(char* buffer, size_t size, const char* output_file);
+
+/**
+ * Journal path for a write to the device on the given port. Kept per port
+ * (not per image) in the temporary directory, so starting any new write on
+ * a port invalidates the previous one.
+ */
+bool journal_path_for_write(char* buffer, size_t size, const device_info_t* device);
+
+#endif // JOURNAL_H
@@ -0,0 +1,97 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Leveled logging.
+ *
+ * LOG_ERROR() .. LOG_TRACE() take printf-style arguments. A message below
+ * the run-time level costs one compare: the arguments are not evaluated and
+ * nothing is formatted. Levels above THINGINO_LOG_MAX_LEVEL (a compile-time
+ * define, e.g. -DTHINGINO_LOG_MAX_LEVEL=LOG_LEVEL_INFO) fold to a constant
+ * false and are removed from the build altogether.
+ *
+ * By default messages are written straight to stdout (info and below) or
+ * stderr (warnings and errors). Once log_start_async() is called they go
+ * into a fixed ring instead and a background thread writes them out, so a
+ * slow terminal or serial console never stalls a transfer loop. The ring
+ * never blocks on info and below: when it is full such a message is dropped
+ * and counted. Errors and warnings that find it full are written directly
+ * instead, ahead of what is still queued. Async output can trail regular
+ * printf output by a few milliseconds.
+ *
+ * LOG_HEX() stores the raw bytes and leaves the hex formatting to the
+ * background thread.
+ */
+
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN  1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_DEBUG 3
+#define LOG_LEVEL_TRACE 4
+
+#ifndef THINGINO_LOG_MAX_LEVEL
+#define THINGINO_LOG_MAX_LEVEL LOG_LEVEL_TRACE
+#endif
+
+extern volatile int g_log_level;
+
+#define LOG_ENABLED(level) \
+    ((level) <= THINGINO_LOG_MAX_LEVEL && (level) <= g_log_level)
+
+#define LOG_AT(level, fmt, ...) \
+    do { \
+        if (LOG_ENABLED(level)) { \
+            log_write(level, fmt, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
+#define LOG_ERROR(fmt, ...) LOG_AT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#define LOG_WARN(fmt, ...)  LOG_AT(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)  LOG_AT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#define LOG_TRACE(fmt, ...) LOG_AT(LOG_LEVEL_TRACE, fmt, ##__VA_ARGS__)
+
+// "label:" followed by len bytes in hex, 8 per line (at most LOG_HEX_MAX)
+#define LOG_HEX(level, label, data, len) \
+    do { \
+        if (LOG_ENABLED(level)) { \
+            log_hex(level, label, data, len); \
+        } \
+    } while (0)
+
+#define LOG_HEX_MAX 128
+
+void log_set_level(int level);
+
+/**
+ * Level from its name ("error", "warn", "info", "debug", "trace"), -1 if
+ * unknown.
+ */
+int log_level_from_string(const char* name);
+
+void log_write(int level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+void log_hex(int level, const char* label, const void* data, size_t len);
+
+/**
+ * Route messages through a ring of slots entries drained by a background
+ * thread. Returns false (messages stay synchronous) if the ring or the
+ * thread cannot be created.
+ */
+bool log_start_async(size_t slots);
+
+/**
+ * Wait until every queued message has been written.
+ */
+void log_flush(void);
+
+/**
+ * Flush, stop the background thread and go back to synchronous output.
+ * Reports how many messages were dropped, if any.
+ */
+void log_stop_async(void);
+
+#endif // LOG_H
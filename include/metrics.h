@@ -0,0 +1,95 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "thingino.h"
+
+/**
+ * Transfer progress and latency metrics.
+ *
+ * A write, read or verify is an operation. While one is open on a thread,
+ * every control transfer (handshakes and status requests), every bulk
+ * transfer and the erase wait of that thread are recorded into HDR-style
+ * histograms: log2 buckets split into 16 linear sub-buckets, so any
+ * percentile is within 1/16 of the true value from 1 us to days, at a fixed
+ * size and O(1) per sample.
+ *
+ * The operation reports progress as it goes (done/total, instantaneous and
+ * average MB/s, ETA) and, when it ends, prints a one-line summary and
+ * optionally appends a JSON object to a file (one per line). Finished
+ * operations are also kept per USB port, so a run over several devices can
+ * end with a per-port and per-hub table that points out the slow ones.
+ */
+
+typedef enum {
+    METRICS_HANDSHAKE,      // Control transfers, in microseconds
+    METRICS_BULK,           // Bulk transfers, in microseconds
+    METRICS_ERASE_WAIT,     // Waits for the chip or block erase, in microseconds
+    METRICS_HIST_COUNT
+} metrics_hist_t;
+
+#define METRICS_HIST_GROUPS 40
+#define METRICS_HIST_SUB    16
+#define METRICS_HIST_SLOTS  (METRICS_HIST_GROUPS * METRICS_HIST_SUB)
+
+typedef struct {
+    uint32_t counts[METRICS_HIST_SLOTS];
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+} metrics_histogram_t;
+
+void metrics_histogram_record(metrics_histogram_t* histogram, uint64_t value);
+
+/**
+ * Value at percent (0-100) of the recorded samples, 0 when empty.
+ */
+uint64_t metrics_histogram_percentile(const metrics_histogram_t* histogram, double percent);
+
+struct metrics_op;
+
+/**
+ * Append the JSON summary of every operation to path ("-" for stdout).
+ * NULL stops it.
+ */
+void metrics_set_json_output(const char* path);
+
+/**
+ * Open an operation named op ("write", "read", "verify") on device for the
+ * calling thread. Returns NULL, recording nothing, if one is already open
+ * on this thread; the outer operation then keeps collecting.
+ */
+struct metrics_op* metrics_op_begin(const char* op, const usb_device_t* device);
+
+/**
+ * Close op (NULL is ignored): print its summary, emit its JSON and keep it
+ * for metrics_print_port_summary().
+ */
+void metrics_op_end(struct metrics_op* op, thingino_error_t result);
+
+/**
+ * Bytes the open operation of this thread will move, once known.
+ */
+void metrics_set_total(uint64_t total_bytes);
+
+/**
+ * Bytes done so far by the open operation of this thread. Prints the
+ * progress line at most once a second (every few seconds when the output is
+ * not a terminal or several operations run at once).
+ */
+void metrics_progress(uint64_t done_bytes);
+
+/**
+ * Record a sample into the open operation of this thread, if any. bytes is
+ * the payload of bulk transfers (0 otherwise).
+ */
+void metrics_record(metrics_hist_t hist, uint64_t microseconds, uint64_t bytes);
+
+/**
+ * Per-port and per-hub table of the operations finished so far, with ports
+ * and hubs well below the median bulk throughput marked as slow. Prints
+ * nothing unless at least two ports were used.
+ */
+void metrics_print_port_summary(void);
+
+#endif // METRICS_H
@@ -33,9 +33,13 @@ static inline int usleep(useconds_t microseconds) {
 static inline int thingino_strcasecmp(const char* a, const char* b) {
     return _stricmp(a, b);
 }
+static inline uint64_t thingino_monotonic_ms(void) {
+    return (uint64_t)GetTickCount64();
+}
 #else
 #include <unistd.h>
 #include <strings.h>
+#include <time.h>
 static inline void thingino_sleep_seconds(uint32_t seconds) {
     sleep(seconds);
 }
@@ -48,6 +52,11 @@ static inline void thingino_sleep_microseconds(uint32_t microseconds) {
 static inline int thingino_strcasecmp(const char* a, const char* b) {
     return strcasecmp(a, b);
 }
+static inline uint64_t thingino_monotonic_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000u + (uint64_t)(ts.tv_nsec / 1000000);
+}
 #endif
 
 #endif
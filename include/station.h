@@ -0,0 +1,61 @@
+#ifndef STATION_H
+#define STATION_H
+
+#include "thingino.h"
+#include <signal.h>
+
+// Upper bound on devices handled by one station run
+#define STATION_MAX_DEVICES 64
+
+/**
+ * Per-device job run by the station.
+ *
+ * Called on a worker thread with the manager shared by all workers. The job
+ * owns opening, bootstrapping and closing its device; `device` identifies it
+ * by physical port so the job can follow it across re-enumeration.
+ */
+typedef thingino_error_t (*station_job_fn)(usb_manager_t* manager,
+                                           const device_info_t* device,
+                                           void* user_data);
+
+/**
+ * Run a job on several devices at once, one worker thread per device.
+ *
+ * A dedicated libusb event thread services the shared context for the
+ * duration of the run. Blocks until every worker has finished.
+ *
+ * @param manager   Initialized USB manager (context shared by all workers)
+ * @param devices   Devices to operate on
+ * @param count     Number of devices (at most STATION_MAX_DEVICES)
+ * @param job       Job to run for each device
+ * @param user_data Passed unchanged to every job invocation
+ * @param results   Optional array of `count` entries receiving each job's result
+ * @return THINGINO_SUCCESS if every job succeeded, otherwise the first failure
+ */
+thingino_error_t station_run_parallel(usb_manager_t* manager,
+                                      const device_info_t* devices, int count,
+                                      station_job_fn job, void* user_data,
+                                      thingino_error_t* results);
+
+/**
+ * Long-running flashing station driven by libusb hotplug events.
+ *
+ * Starts `job` on its own worker thread the moment an Ingenic device (bootrom
+ * or firmware PID) appears on a port. Arrivals on a port whose job is still
+ * running are the device re-enumerating and are ignored; once a job has
+ * finished the port is re-armed when the device is unplugged, so an operator
+ * can keep plugging cameras in. Devices already connected at startup are
+ * picked up immediately.
+ *
+ * @param manager   Initialized USB manager
+ * @param job       Job to run for each arriving device
+ * @param user_data Passed unchanged to every job invocation
+ * @param stop      Polled; set non-zero (e.g. from SIGINT) to stop accepting
+ *                  devices. Jobs already running are waited for.
+ * @return THINGINO_SUCCESS, or THINGINO_ERROR_INIT_FAILED if hotplug is not
+ *         available on this platform
+ */
+thingino_error_t station_run_hotplug(usb_manager_t* manager, station_job_fn job, void* user_data,
+                                     volatile sig_atomic_t* stop);
+
+#endif // STATION_H
@@ -7,21 +7,17 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <pthread.h>
 #include "platform_compat.h"
+#include "trace.h"
+#include "log.h"
 
 // ============================================================================
-// GLOBAL DEBUG FLAG
+// DEBUG OUTPUT
 // ============================================================================
 
-extern bool g_debug_enabled;
-
-// Debug logging macro - only prints if debug is enabled
-#define DEBUG_PRINT(fmt, ...) \
-    do { \
-        if (g_debug_enabled) { \
-            printf("[DEBUG] " fmt, ##__VA_ARGS__); \
-        } \
-    } while(0)
+// Debug logging macro - only prints at --debug (see log.h)
+#define DEBUG_PRINT(fmt, ...) LOG_DEBUG(fmt, ##__VA_ARGS__)
 
 // ============================================================================
 // FORWARD DECLARATIONS
@@ -143,6 +139,9 @@ typedef enum {
     THINGINO_ERROR_TRANSFER_TIMEOUT = -10
 } thingino_error_t;
 
+// Maximum USB hub chain depth reported by libusb_get_port_numbers()
+#define USB_MAX_PORT_DEPTH 7
+
 // Device information structure
 typedef struct {
     uint8_t bus;
@@ -151,6 +150,8 @@ typedef struct {
     uint16_t product;
     device_stage_t stage;
     processor_variant_t variant;
+    uint8_t port_path[USB_MAX_PORT_DEPTH];  // Physical port chain, stable across re-enumeration
+    uint8_t port_depth;                     // 0 if the backend cannot report ports
 } device_info_t;
 
 // CPU information structure
@@ -221,19 +222,95 @@ typedef struct {
     char description[128];
 } bootstrap_progress_t;
 
+// VR_GET_CPU_INFO timeout of usb_device_get_cpu_info()
+#define USB_CPU_INFO_TIMEOUT_MS 5000
+
+// Asynchronous bulk OUT defaults (see src/usb/async.c)
+#define USB_ASYNC_DEFAULT_QUEUE_DEPTH 8           // URBs kept in flight
+#define USB_ASYNC_MAX_QUEUE_DEPTH     32
+#define USB_ASYNC_DEFAULT_URB_SIZE    (16 * 1024) // Bytes per URB
+
+// Pool of reusable libusb transfers, owned by the device (opaque)
+struct usb_bulk_queue;
+
+// Transport behind a usb_device_t other than libusb (e.g. the simulator in
+// usb_sim.h). Transfers take and return the same values as
+// libusb_control_transfer()/libusb_bulk_transfer(), so every caller keeps
+// its libusb error handling. ctx is the device's transport_ctx.
+typedef struct {
+    const char* name;
+    int (*control)(void* ctx, uint8_t request_type, uint8_t request, uint16_t value,
+                   uint16_t index, uint8_t* data, uint16_t length, unsigned int timeout);
+    int (*bulk)(void* ctx, uint8_t endpoint, uint8_t* data, int length, int* transferred,
+                unsigned int timeout);
+    int (*reopen)(void* ctx, device_info_t* info);  // After re-enumeration; updates the address
+    void (*close)(void* ctx);
+} usb_transport_t;
+
 // USB device structure
 typedef struct {
+    const usb_transport_t* transport;   // NULL: libusb on handle
+    void* transport_ctx;
     libusb_device_handle* handle;
     libusb_context* context;
     libusb_device* device;
     device_info_t info;
     bool closed;
+    int queue_depth;                    // Max in-flight bulk OUT URBs (1 = synchronous)
+    int urb_size;                       // Bytes per bulk OUT URB
+    struct usb_bulk_queue* bulk_queue;  // Lazily allocated transfer pool
+    uint32_t flash_size;                // Detected flash size in bytes (0 = not probed yet)
+    bool flash_size_probed;             // flash_size was detected, not assumed
+    bool read_mode;                     // Burner prepared for reads (firmware_read_prepare())
+    bool block_erase;                   // Write descriptor has force_erase cleared (range write)
 } usb_device_t;
 
+// How usb_device_vendor_request_retry() retries a failed control request.
+// Timeouts and stalls are retried with jittered exponential backoff until
+// max_attempts or the budget runs out, whichever comes first; each attempt's
+// timeout is cut to what is left of the budget. A vanished device fails at
+// once with THINGINO_ERROR_DEVICE_NOT_FOUND, other errors are not retried.
+typedef struct {
+    uint32_t budget_ms;           // Whole request, attempts and waits included (0 = none)
+    uint32_t attempt_timeout_ms;  // Control transfer timeout per attempt
+    uint32_t backoff_ms;          // Nominal wait before the second attempt, doubling
+    uint32_t backoff_max_ms;      // Cap of the nominal wait
+    int max_attempts;
+} usb_retry_policy_t;
+
+extern const usb_retry_policy_t usb_retry_default;  // usb_device_vendor_request(): 12s budget
+extern const usb_retry_policy_t usb_retry_probe;    // Identification of a device that may not answer
+
 // USB manager structure
+// Hotplug listener. Runs inside libusb event handling (on whichever thread
+// is handling events) and must not perform USB I/O.
+typedef void (*usb_hotplug_fn)(const device_info_t* info, bool arrived, void* user_data);
+
+// Simulated burners (usb_sim.h), opaque here
+struct usb_sim;
+
+// CPU magic answered on a physical port (manager.c), opaque here
+struct usb_probe_entry;
+
 typedef struct {
     libusb_context* context;
     bool initialized;
+    struct usb_sim* sim;  // When set, devices are listed and opened from the simulator
+    int queue_depth;   // Applied to every device opened through the manager
+    int urb_size;
+    pthread_t event_thread;        // Shared libusb event loop for multi-device runs
+    int event_thread_stop;
+    bool event_thread_running;
+    libusb_hotplug_callback_handle hotplug_handle;  // Valid while hotplug_enabled
+    bool hotplug_enabled;
+    usb_hotplug_fn hotplug_fn;
+    void* hotplug_user_data;
+    pthread_mutex_t hotplug_lock;  // Guards hotplug_generation
+    pthread_cond_t hotplug_cond;   // Broadcast on every Ingenic arrival/departure
+    unsigned int hotplug_generation;
+    pthread_mutex_t probe_lock;    // Guards the probe cache
+    struct usb_probe_entry* probe_cache;  // Stage/variant per port until it re-enumerates or leaves
+    int probe_cache_count;
 } usb_manager_t;
 
 // ============================================================================
@@ -245,27 +322,52 @@ thingino_error_t usb_manager_init(usb_manager_t* manager);
 thingino_error_t usb_manager_find_devices(usb_manager_t* manager, device_info_t** devices, int* count);
 thingino_error_t usb_manager_find_devices_fast(usb_manager_t* manager, device_info_t** devices, int* count);
 thingino_error_t usb_manager_open_device(usb_manager_t* manager, const device_info_t* info, usb_device_t** device);
+void usb_manager_forget_port(usb_manager_t* manager, const device_info_t* info);
 void usb_manager_cleanup(usb_manager_t* manager);
+thingino_error_t usb_manager_wait_for_device(usb_manager_t* manager, const device_info_t* target,
+                                             device_stage_t stage, int timeout_ms, int settle_ms,
+                                             device_info_t* found);
+thingino_error_t usb_manager_start_event_thread(usb_manager_t* manager);
+void usb_manager_stop_event_thread(usb_manager_t* manager);
+thingino_error_t usb_manager_enable_hotplug(usb_manager_t* manager, usb_hotplug_fn fn, void* user_data);
+void usb_manager_disable_hotplug(usb_manager_t* manager);
+bool usb_device_info_same_port(const device_info_t* a, const device_info_t* b);
+void usb_device_info_port_string(const device_info_t* info, char* buffer, size_t size);
 
 // Device functions
 thingino_error_t usb_device_init(usb_device_t* device, uint8_t bus, uint8_t address);
 thingino_error_t usb_device_close(usb_device_t* device);
-	thingino_error_t usb_device_reopen(usb_device_t* device);
+thingino_error_t usb_device_reopen(usb_device_t* device);
+bool usb_device_is_open(const usb_device_t* device);
 
 thingino_error_t usb_device_reset(usb_device_t* device);
 thingino_error_t usb_device_claim_interface(usb_device_t* device);
 thingino_error_t usb_device_release_interface(usb_device_t* device);
 thingino_error_t usb_device_get_cpu_info(usb_device_t* device, cpu_info_t* info);
+// Same with timeout_ms for the request and for its interface-claim fallback
+thingino_error_t usb_device_probe_cpu_info(usb_device_t* device, cpu_info_t* info,
+                                           unsigned int timeout_ms);
 
 // Transfer functions
+// Raw transfers through the device's transport, returning libusb codes
+int usb_device_raw_control(usb_device_t* device, uint8_t request_type, uint8_t request,
+    uint16_t value, uint16_t index, uint8_t* data, uint16_t length, unsigned int timeout);
+int usb_device_raw_bulk(usb_device_t* device, uint8_t endpoint, uint8_t* data, int length,
+    int* transferred, unsigned int timeout);
 thingino_error_t usb_device_control_transfer(usb_device_t* device, uint8_t request_type,
     uint8_t request, uint16_t value, uint16_t index, uint8_t* data, uint16_t length, int* transferred);
 thingino_error_t usb_device_bulk_transfer(usb_device_t* device, uint8_t endpoint,
     uint8_t* data, int length, int* transferred, int timeout);
+thingino_error_t usb_device_bulk_out_async(usb_device_t* device, uint8_t endpoint,
+    const uint8_t* data, int length, int* transferred, int timeout);
+void usb_device_release_async(usb_device_t* device);
 thingino_error_t usb_device_interrupt_transfer(usb_device_t* device, uint8_t endpoint,
     uint8_t* data, int length, int* transferred, int timeout);
 thingino_error_t usb_device_vendor_request(usb_device_t* device, uint8_t request_type,
     uint8_t request, uint16_t value, uint16_t index, uint8_t* data, uint16_t length, uint8_t* response, int* response_length);
+thingino_error_t usb_device_vendor_request_retry(usb_device_t* device,
+    const usb_retry_policy_t* policy, uint8_t request_type, uint8_t request, uint16_t value,
+    uint16_t index, uint8_t* data, uint16_t length, uint8_t* response, int* response_length);
 
 // Protocol functions
 thingino_error_t protocol_set_data_address(usb_device_t* device, uint32_t addr);
@@ -327,14 +429,30 @@ thingino_error_t protocol_proper_firmware_write(usb_device_t* device, uint32_t f
 // Firmware read functions
 thingino_error_t firmware_read_detect_size(usb_device_t* device, uint32_t* size);
 thingino_error_t firmware_read_init(usb_device_t* device, firmware_read_config_t* config);
+thingino_error_t firmware_read_prepare(usb_device_t* device);
 thingino_error_t firmware_read_bank(usb_device_t* device, uint32_t offset, uint32_t size, uint8_t** data);
 thingino_error_t firmware_read_full(usb_device_t* device, uint8_t** data, uint32_t* size);
+
+// Streaming read: each bank is handed to the sink as soon as it arrives.
+// The data pointer is only valid during the call.
+typedef thingino_error_t (*firmware_read_sink_fn)(uint32_t offset, const uint8_t* data,
+                                                  uint32_t length, void* user_data);
+// Optional: return true for banks that need not be read (e.g. already on disk).
+typedef bool (*firmware_read_skip_fn)(uint32_t offset, uint32_t length, void* user_data);
+thingino_error_t firmware_read_stream(usb_device_t* device, firmware_read_sink_fn sink,
+                                      firmware_read_skip_fn skip, void* user_data,
+                                      uint32_t* total_read);
+thingino_error_t firmware_read_to_file(usb_device_t* device, const char* path, bool resume,
+                                       uint32_t* total_read);
 thingino_error_t firmware_read_cleanup(firmware_read_config_t* config);
 
 // Firmware handshake protocol functions (40-byte chunk transfers)
 thingino_error_t firmware_handshake_read_chunk(usb_device_t* device, uint32_t chunk_index,
                                                uint32_t chunk_offset, uint32_t chunk_size,
                                                uint8_t** out_data, int* out_len);
+thingino_error_t firmware_handshake_read_chunk_into(usb_device_t* device, uint32_t chunk_index,
+                                                    uint32_t chunk_offset, uint32_t chunk_size,
+                                                    uint8_t* data_buffer, int* out_len);
 thingino_error_t firmware_handshake_write_chunk(usb_device_t* device, uint32_t chunk_index,
                                                 uint32_t chunk_offset, const uint8_t* data,
                                                 uint32_t data_size);
@@ -342,13 +460,80 @@ thingino_error_t firmware_handshake_write_chunk_a1(usb_device_t* device, uint32_
                                                    uint32_t chunk_offset, const uint8_t* data,
                                                    uint32_t data_size);
 thingino_error_t firmware_handshake_init(usb_device_t* device);
+thingino_error_t firmware_handshake_wait_ready(usb_device_t* device, uint8_t status_cmd,
+                                               int deadline_ms, uint32_t* status);
+
+// Split form of the write handshakes: build (CRC + layout, no I/O) and send
+#define FIRMWARE_HANDSHAKE_SIZE 40
+void firmware_handshake_build_write(const usb_device_t* device, uint32_t chunk_offset,
+                                    const uint8_t* data, uint32_t data_size,
+                                    uint8_t handshake_cmd[FIRMWARE_HANDSHAKE_SIZE]);
+void firmware_handshake_build_write_a1(uint32_t chunk_offset, const uint8_t* data,
+                                       uint32_t data_size,
+                                       uint8_t handshake_cmd[FIRMWARE_HANDSHAKE_SIZE]);
+thingino_error_t firmware_handshake_send_write(usb_device_t* device, uint32_t chunk_index,
+                                               const uint8_t handshake_cmd[FIRMWARE_HANDSHAKE_SIZE],
+                                               const uint8_t* data, uint32_t data_size);
+thingino_error_t firmware_handshake_send_write_a1(usb_device_t* device, uint32_t chunk_index,
+                                                  const uint8_t handshake_cmd[FIRMWARE_HANDSHAKE_SIZE],
+                                                  const uint8_t* data, uint32_t data_size);
 
 // Firmware writer functions
+
+// Part of the flash to program instead of the whole image; both fields are
+// multiples of FIRMWARE_RANGE_ALIGN (the erase block size)
+#define FIRMWARE_RANGE_ALIGN (64 * 1024)
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} firmware_write_range_t;
+
 thingino_error_t write_firmware_to_device(usb_device_t* device,
                                          const char* firmware_file,
                                          const firmware_binary_t* fw_binary,
                                          bool force_erase,
-                                         bool is_a1_board);
+                                         bool is_a1_board,
+                                         bool resume,
+                                         bool skip_blank,
+                                         const firmware_write_range_t* range);
+thingino_error_t firmware_write_prepare_burner(usb_device_t* device, bool is_a1, bool scoped);
+thingino_error_t firmware_write_resume_point(usb_device_t* device, const char* firmware_file,
+                                             bool is_a1_board, uint32_t* next_chunk);
+
+// Post-write verification and --delta: differing 64KB sectors, merged into runs
+#define FIRMWARE_VERIFY_MAX_RANGES 32
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} firmware_verify_range_t;
+
+typedef struct {
+    uint32_t sectors;             // Sectors compared
+    uint32_t mismatched_sectors;
+    uint32_t range_count;
+    bool truncated;               // More runs than FIRMWARE_VERIFY_MAX_RANGES
+    firmware_verify_range_t ranges[FIRMWARE_VERIFY_MAX_RANGES];
+} firmware_verify_report_t;
+
+thingino_error_t firmware_verify(usb_device_t* device, const char* firmware_file,
+                                 const firmware_write_range_t* range,
+                                 firmware_verify_report_t* report);
+thingino_error_t firmware_delta_check(usb_device_t* device, const char* firmware_file,
+                                      const firmware_write_range_t* range,
+                                      firmware_verify_report_t* report);
+
+// Erase-scope guard: a programmed sector outside the written ranges, read
+// before and after the first range write of a session
+typedef struct {
+    bool armed;
+    uint32_t offset;
+    uint32_t crc;                 // crc32_update(0, ...) of the sector before the write
+} firmware_range_guard_t;
+
+thingino_error_t firmware_range_guard_arm(usb_device_t* device,
+                                          const firmware_write_range_t* ranges, uint32_t count,
+                                          firmware_range_guard_t* guard);
+thingino_error_t firmware_range_guard_check(usb_device_t* device, firmware_range_guard_t* guard);
 thingino_error_t send_bulk_data(usb_device_t* device, uint8_t endpoint,
                                 const uint8_t* data, uint32_t size);
 
@@ -0,0 +1,111 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * USB transfer timeline tracer.
+ *
+ * When started (--trace), every control, vendor and bulk transfer and every
+ * deliberate sleep is recorded into a fixed-size ring of events: monotonic
+ * start time and duration in microseconds, request code or endpoint, byte
+ * count, result and the phase of the operation it belongs to. The ring keeps
+ * the most recent events and can be exported as Chrome trace-event JSON
+ * (chrome://tracing, Perfetto). Per-phase totals and per-site sleep totals
+ * are kept separately, so the summary stays exact when the ring wraps.
+ *
+ * Recording is lock-free; when tracing is off each hook is a single branch.
+ */
+
+typedef enum {
+    TRACE_PHASE_NONE,        // Outside any phase ("other")
+    TRACE_PHASE_BOOTSTRAP,   // DDR/SPL/U-Boot load and re-enumeration
+    TRACE_PHASE_DESCRIPTOR,  // Partition marker, flash descriptor, handshake init
+    TRACE_PHASE_ERASE,       // Waiting for the chip erase
+    TRACE_PHASE_CHUNKS,      // Firmware write chunks
+    TRACE_PHASE_VERIFY,      // Read-back compare (--verify, --delta)
+    TRACE_PHASE_READ,        // Flash dump to a file
+    TRACE_PHASE_COUNT
+} trace_phase_t;
+
+typedef enum {
+    TRACE_KIND_CONTROL,
+    TRACE_KIND_VENDOR,
+    TRACE_KIND_BULK_IN,
+    TRACE_KIND_BULK_OUT,
+    TRACE_KIND_SLEEP,
+    TRACE_KIND_PHASE
+} trace_kind_t;
+
+// Open phase, returned by trace_phase_begin() and closed by trace_phase_end()
+typedef struct {
+    uint8_t phase;
+    uint8_t previous;
+    uint64_t start_us;
+    uint64_t parent_child_us;
+} trace_scope_t;
+
+extern volatile bool g_trace_active;
+
+/**
+ * Start tracing into a ring of capacity events (rounded up to a power of
+ * two). Returns false if the ring cannot be allocated.
+ */
+bool trace_start(size_t capacity);
+
+/**
+ * Monotonic clock used for all events, in microseconds.
+ */
+uint64_t trace_now_us(void);
+
+/**
+ * Start time for a transfer about to be recorded with trace_transfer(),
+ * or 0 when tracing is off.
+ */
+static inline uint64_t trace_begin(void) {
+    return g_trace_active ? trace_now_us() : 0;
+}
+
+/**
+ * Record a finished transfer that started at start_us (trace_begin()).
+ * request is the bRequest for control/vendor transfers and the endpoint for
+ * bulk ones; result is the raw libusb return code.
+ */
+void trace_transfer(trace_kind_t kind, uint8_t request, uint64_t start_us, int bytes,
+                    int result);
+
+/**
+ * Sleep, recording the sleep and its call site when tracing. Use through
+ * trace_usleep()/trace_sleep_ms() so the site is filled in.
+ */
+void trace_sleep_us(uint64_t microseconds, const char* file, int line);
+
+#define trace_usleep(us)   trace_sleep_us((uint64_t)(us), __FILE__, __LINE__)
+#define trace_sleep_ms(ms) trace_sleep_us((uint64_t)(ms) * 1000, __FILE__, __LINE__)
+
+/**
+ * Enter a phase on the calling thread. Phases nest: the inner phase's time
+ * is not counted again in the outer one.
+ */
+trace_scope_t trace_phase_begin(trace_phase_t phase);
+void trace_phase_end(const trace_scope_t* scope);
+
+/**
+ * Write the events still in the ring as Chrome trace-event JSON.
+ */
+bool trace_write_chrome_json(const char* path);
+
+/**
+ * Print time per phase (wall, USB and sleep) and the sleep sites that cost
+ * the most.
+ */
+void trace_print_summary(void);
+
+/**
+ * Stop tracing and free the ring.
+ */
+void trace_stop(void);
+
+#endif // TRACE_H
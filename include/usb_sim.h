@@ -0,0 +1,132 @@
+#ifndef USB_SIM_H
+#define USB_SIM_H
+
+#include "thingino.h"
+#include <limits.h>
+
+/**
+ * Software burner simulator.
+ *
+ * Stands in for one or more cameras behind the usb_transport_t of a
+ * usb_device_t, so the bootstrap, write, read and verify paths run
+ * unchanged on any machine. It answers the bootrom requests
+ * (VR_GET_CPU_INFO, SET_DATA_ADDR/LEN, PROG_STAGE1/2, followed by a
+ * re-enumeration with the firmware PID) and the firmware-stage burner:
+ * partition marker and flash descriptor, VR_WRITE 40-byte handshakes with
+ * CRC-checked bulk chunks, read handshakes with bulk IN, and status
+ * requests.
+ *
+ * The flash is modelled as NOR: erase sets bytes to 0xFF, programming can
+ * only clear bits, and addresses past the end alias to the start. The
+ * descriptor's force_erase policy decides between a chip erase on the first
+ * SetDataAddress/SetDataLength and per-block erases as chunks arrive.
+ * While the burner erases or programs it does not answer control requests
+ * and NAKs bulk transfers, as the hardware does, so host-side polling and
+ * timeouts are exercised at realistic timing.
+ *
+ * Selected on the command line with --sim <spec> and attached to a manager
+ * by setting usb_manager_t.sim; devices are then listed and opened from the
+ * simulator instead of libusb.
+ */
+
+#define USB_SIM_MAX_DEVICES 64
+
+typedef enum {
+    USB_SIM_CHUNK_LOAD,            // Bootrom bulk OUT (DDR config, SPL, U-Boot)
+    USB_SIM_CHUNK_WRITE,           // Firmware chunk, handshake until programmed
+    USB_SIM_CHUNK_READ             // Read chunk, handshake until the bulk IN completes
+} usb_sim_chunk_kind_t;
+
+/**
+ * Called each time a simulated burner finishes a chunk, with the device
+ * locked: it must not call back into the simulator. Times are
+ * trace_now_us(); a write ends when programming does, so end_us can lie
+ * slightly in the future.
+ */
+typedef void (*usb_sim_chunk_fn)(void* user_data, int device, usb_sim_chunk_kind_t kind,
+                                 uint32_t bytes, uint64_t start_us, uint64_t end_us);
+
+typedef struct {
+    processor_variant_t variant;
+    device_stage_t stage;          // Stage the devices start in
+    int devices;                   // Number of simulated cameras
+    uint32_t flash_size;           // Bytes
+    char image[PATH_MAX];          // Initial flash contents ("" = blank)
+    char dump[PATH_MAX];           // Flash saved here on destroy ("" = not saved)
+    bool always_chip_erase;        // Write descriptors chip-erase even without force_erase
+
+    // Timing. Device-side delays are multiplied by time_scale (0 = none).
+    double time_scale;
+    uint32_t usb_bytes_per_ms;     // Bulk throughput on the wire
+    uint32_t control_us;           // Round trip of a control request
+    uint32_t spl_ms;               // PROG_STAGE1 until the SPL answers again
+    uint32_t reenumerate_ms;       // PROG_STAGE2 until the firmware PID appears
+    uint32_t chip_erase_ms;        // Whole chip (force_erase); 0 = 1.5s per MB
+    uint32_t block_erase_ms;       // Per 64KB block (range writes)
+    uint32_t program_ms;           // Per 64KB programmed
+    uint32_t read_ms;              // Per 1MB fetched before bulk IN
+
+    usb_sim_chunk_fn on_chunk;     // Optional, for benchmarks
+    void* on_chunk_data;
+} usb_sim_config_t;
+
+typedef struct {
+    uint32_t bootstraps;           // PROG_STAGE2 received
+    uint32_t chip_erases;
+    uint32_t block_erases;
+    uint32_t chunks_written;
+    uint64_t bytes_written;
+    uint32_t chunks_read;
+    uint64_t bytes_read;
+    uint32_t crc_errors;           // Chunks whose CRC did not match the handshake (not programmed)
+    uint32_t busy_rejections;      // Control requests that timed out while busy
+    uint32_t overruns;             // VR_WRITE handshakes lost while programming (T31 family)
+    uint32_t unknown_requests;     // Requests the simulator does not model
+} usb_sim_stats_t;
+
+struct usb_sim;
+
+/**
+ * Fill config with the defaults for a variant: one 16MB device in bootrom
+ * stage, real-time timing roughly matching a T31 burner over high-speed USB.
+ */
+void usb_sim_config_defaults(usb_sim_config_t* config, processor_variant_t variant);
+
+/**
+ * Parse "<variant>[,key=value...]", e.g. "t31x,flash=8M,scale=0.1".
+ * Keys: devices, stage (bootrom|firmware), flash, image, dump, scale, usb
+ * (MB/s), control-us, spl, reenumerate, erase, block-erase, program (ms per
+ * 64KB), read (ms per MB), erase-scope (descriptor|chip; chip models a
+ * burner that ignores the force_erase field we clear for range writes).
+ */
+thingino_error_t usb_sim_parse_spec(const char* spec, usb_sim_config_t* config);
+
+thingino_error_t usb_sim_create(const usb_sim_config_t* config, struct usb_sim** sim);
+
+/**
+ * Free the simulator, saving the flash of every device first if a dump
+ * file was configured ("<dump>" for one device, "<dump>.<n>" for several).
+ */
+void usb_sim_destroy(struct usb_sim* sim);
+
+/**
+ * List the simulated devices currently enumerated (a device is absent while
+ * it re-enumerates). The caller frees *devices.
+ */
+thingino_error_t usb_sim_list(struct usb_sim* sim, device_info_t** devices, int* count);
+
+/**
+ * Open a listed device: sets up device as usb_device_init() would, with
+ * the simulator as its transport. device->info must already hold the
+ * listed info.
+ */
+thingino_error_t usb_sim_open(struct usb_sim* sim, usb_device_t* device);
+
+/**
+ * Flash contents and counters of simulated device index.
+ */
+const uint8_t* usb_sim_flash(struct usb_sim* sim, int index, uint32_t* size);
+void usb_sim_get_stats(struct usb_sim* sim, int index, usb_sim_stats_t* stats);
+void usb_sim_print_stats(struct usb_sim* sim);
+
+#endif // USB_SIM_H
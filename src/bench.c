@@ -0,0 +1,732 @@
+/**
+ * Protocol benchmark
+ *
+ * Drives the bootstrap, write, verify and read flows against the simulated
+ * burner (usb_sim) and reports, per flow, the chunk stream throughput,
+ * per-chunk latency percentiles and the total cycle time. Chunk latency is
+ * measured device side: from the handshake that announces a chunk until the
+ * burner has programmed it (write) or sent it (read); bootstrap chunks are
+ * the DDR/SPL/U-Boot bulk transfers.
+ *
+ * The numbers can be saved (--save) and compared against a saved baseline
+ * with a tolerance (--baseline), or checked against absolute limits
+ * (--thresholds). Both files hold "<flow>.<metric> = <value>" lines; mbps is
+ * a lower bound, every other metric an upper bound. The exit status is 1 if
+ * any metric regressed.
+ */
+
+#include "thingino.h"
+#include "usb_sim.h"
+#include <limits.h>
+#if defined(_WIN32)
+#include <io.h>
+#include <process.h>
+#endif
+
+#define BENCH_DEFAULT_SIM       "t31x,flash=4M,scale=0.1"
+#define BENCH_DEFAULT_RUNS      3
+#define BENCH_DEFAULT_TOLERANCE 10.0
+#define BENCH_MAX_RUNS          100
+#define BENCH_REENUMERATE_MS    15000
+#define BENCH_NOISE_MS          1.0   // Latency change never counted as a regression
+
+typedef enum {
+    BENCH_BOOTSTRAP,
+    BENCH_WRITE,
+    BENCH_VERIFY,
+    BENCH_READ,
+    BENCH_FLOW_COUNT
+} bench_flow_t;
+
+static const char* const bench_flow_names[BENCH_FLOW_COUNT] = {
+    "bootstrap", "write", "verify", "read"
+};
+
+typedef enum {
+    BENCH_MBPS,
+    BENCH_P50,
+    BENCH_P90,
+    BENCH_P99,
+    BENCH_MAX,
+    BENCH_CYCLE,
+    BENCH_METRIC_COUNT
+} bench_metric_t;
+
+static const char* const bench_metric_names[BENCH_METRIC_COUNT] = {
+    "mbps", "p50_ms", "p90_ms", "p99_ms", "max_ms", "cycle_ms"
+};
+
+typedef struct {
+    uint32_t* latency_us;          // Every chunk of every measured run
+    size_t count;
+    size_t capacity;
+    double mbps[BENCH_MAX_RUNS];   // Chunk stream throughput per run
+    double cycle_ms[BENCH_MAX_RUNS];
+    // Current run
+    uint64_t bytes;
+    uint64_t first_start_us;
+    uint64_t last_end_us;
+} bench_samples_t;
+
+typedef struct {
+    pthread_mutex_t lock;          // Chunks may complete on writer threads
+    bench_flow_t flow;
+    bool recording;
+    bench_samples_t samples[BENCH_FLOW_COUNT];
+    bool failed;                   // Allocation failure while recording
+} bench_state_t;
+
+typedef struct {
+    const char* sim_spec;
+    int runs;
+    int warmup;
+    const char* save_file;
+    const char* baseline_file;
+    const char* thresholds_file;
+    double tolerance;              // Percent, for --baseline
+    bool verbose;                  // Keep the flows' own output
+} bench_options_t;
+
+// ============================================================================
+// RECORDING
+// ============================================================================
+
+static void bench_on_chunk(void* user_data, int device, usb_sim_chunk_kind_t kind,
+                           uint32_t bytes, uint64_t start_us, uint64_t end_us) {
+    bench_state_t* state = (bench_state_t*)user_data;
+    (void)device;
+    (void)kind;  // The flow being run decides where the chunk belongs
+
+    pthread_mutex_lock(&state->lock);
+    if (state->recording) {
+        bench_samples_t* s = &state->samples[state->flow];
+        if (s->count == s->capacity) {
+            size_t capacity = s->capacity ? s->capacity * 2 : 256;
+            uint32_t* grown = (uint32_t*)realloc(s->latency_us, capacity * sizeof(uint32_t));
+            if (!grown) {
+                state->failed = true;
+                pthread_mutex_unlock(&state->lock);
+                return;
+            }
+            s->latency_us = grown;
+            s->capacity = capacity;
+        }
+        uint64_t latency = end_us > start_us ? end_us - start_us : 0;
+        s->latency_us[s->count++] = latency > UINT32_MAX ? UINT32_MAX : (uint32_t)latency;
+        s->bytes += bytes;
+        if (s->first_start_us == 0 || start_us < s->first_start_us) {
+            s->first_start_us = start_us;
+        }
+        if (end_us > s->last_end_us) {
+            s->last_end_us = end_us;
+        }
+    }
+    pthread_mutex_unlock(&state->lock);
+}
+
+static void bench_flow_begin(bench_state_t* state, bench_flow_t flow, bool measured) {
+    pthread_mutex_lock(&state->lock);
+    state->flow = flow;
+    state->recording = measured;
+    bench_samples_t* s = &state->samples[flow];
+    s->bytes = 0;
+    s->first_start_us = 0;
+    s->last_end_us = 0;
+    pthread_mutex_unlock(&state->lock);
+}
+
+static void bench_flow_end(bench_state_t* state, int run, uint64_t start_us) {
+    pthread_mutex_lock(&state->lock);
+    if (state->recording) {
+        bench_samples_t* s = &state->samples[state->flow];
+        uint64_t span = s->last_end_us - s->first_start_us;
+        s->mbps[run] = span ? (double)s->bytes / (1024.0 * 1024.0) / (span / 1e6) : 0.0;
+        s->cycle_ms[run] = (trace_now_us() - start_us) / 1000.0;
+    }
+    state->recording = false;
+    pthread_mutex_unlock(&state->lock);
+}
+
+// ============================================================================
+// FLOWS
+// ============================================================================
+
+// The flows print their usual progress (stdout) and handshake dumps
+// (stderr); hide both unless --verbose
+typedef struct {
+    int saved[2];
+} bench_quiet_t;
+
+static void bench_quiet_begin(bench_quiet_t* quiet, bool verbose) {
+    FILE* streams[2] = {stdout, stderr};
+    quiet->saved[0] = quiet->saved[1] = -1;
+    if (verbose) {
+        return;
+    }
+    for (int i = 0; i < 2; i++) {
+        FILE* null = fopen(
+#if defined(_WIN32)
+            "NUL",
+#else
+            "/dev/null",
+#endif
+            "w");
+        fflush(streams[i]);
+        int saved = dup(fileno(streams[i]));
+        if (saved >= 0 && null && dup2(fileno(null), fileno(streams[i])) >= 0) {
+            quiet->saved[i] = saved;
+        } else if (saved >= 0) {
+            close(saved);
+        }
+        if (null) {
+            fclose(null);
+        }
+    }
+}
+
+static void bench_quiet_end(const bench_quiet_t* quiet) {
+    FILE* streams[2] = {stdout, stderr};
+    for (int i = 0; i < 2; i++) {
+        if (quiet->saved[i] >= 0) {
+            fflush(streams[i]);
+            dup2(quiet->saved[i], fileno(streams[i]));
+            close(quiet->saved[i]);
+        }
+    }
+}
+
+// Open simulated device 0 once it is listed in stage
+static thingino_error_t bench_open(struct usb_sim* sim, device_stage_t stage,
+                                   usb_device_t** out) {
+    uint64_t deadline = trace_now_us() + (uint64_t)BENCH_REENUMERATE_MS * 1000;
+    for (;;) {
+        device_info_t* devices = NULL;
+        int count = 0;
+        thingino_error_t result = usb_sim_list(sim, &devices, &count);
+        if (result != THINGINO_SUCCESS) {
+            return result;
+        }
+        if (count > 0 && devices[0].stage == stage) {
+            usb_device_t* device = (usb_device_t*)calloc(1, sizeof(usb_device_t));
+            if (!device) {
+                free(devices);
+                return THINGINO_ERROR_MEMORY;
+            }
+            device->info = devices[0];
+            free(devices);
+            result = usb_sim_open(sim, device);
+            if (result != THINGINO_SUCCESS) {
+                free(device);
+                return result;
+            }
+            *out = device;
+            return THINGINO_SUCCESS;
+        }
+        free(devices);
+        if (trace_now_us() >= deadline) {
+            return THINGINO_ERROR_DEVICE_NOT_FOUND;
+        }
+        thingino_sleep_milliseconds(10);
+    }
+}
+
+static void bench_close(usb_device_t* device) {
+    if (device) {
+        usb_device_close(device);
+        free(device);
+    }
+}
+
+static thingino_error_t bench_bootstrap(struct usb_sim* sim, usb_device_t** out) {
+    usb_device_t* device = NULL;
+    thingino_error_t result = bench_open(sim, STAGE_BOOTROM, &device);
+    if (result != THINGINO_SUCCESS) {
+        return result;
+    }
+
+    bootstrap_config_t config = {
+        .sdram_address = BOOTLOADER_ADDRESS_SDRAM,
+        .timeout = BOOTSTRAP_TIMEOUT_SECONDS,
+    };
+    result = bootstrap_device(device, &config);
+    bench_close(device);
+    if (result != THINGINO_SUCCESS) {
+        return result;
+    }
+
+    // Measured until the burner is open again, as a real session would be
+    return bench_open(sim, STAGE_FIRMWARE, out);
+}
+
+static thingino_error_t bench_write(usb_device_t* device, const char* image) {
+    bool is_a1 = device->info.variant == VARIANT_A1;
+    thingino_error_t result = firmware_write_prepare_burner(device, is_a1, false);
+    if (result != THINGINO_SUCCESS) {
+        return result;
+    }
+    return write_firmware_to_device(device, image, NULL, false, is_a1, false, false, NULL);
+}
+
+static thingino_error_t bench_verify(usb_device_t* device, const char* image) {
+    firmware_verify_report_t report;
+    thingino_error_t result = firmware_verify(device, image, NULL, &report);
+    if (result == THINGINO_SUCCESS && report.mismatched_sectors > 0) {
+        return THINGINO_ERROR_PROTOCOL;
+    }
+    return result;
+}
+
+static thingino_error_t bench_read(usb_device_t* device, const char* output,
+                                   const uint8_t* expected, uint32_t size) {
+    uint32_t total = 0;
+    thingino_error_t result = firmware_read_to_file(device, output, false, &total);
+    if (result != THINGINO_SUCCESS) {
+        return result;
+    }
+
+    FILE* file = fopen(output, "rb");
+    if (!file) {
+        return THINGINO_ERROR_FILE_IO;
+    }
+    uint8_t* data = (uint8_t*)malloc(size);
+    bool same = data && total == size && fread(data, 1, size, file) == size &&
+                memcmp(data, expected, size) == 0;
+    free(data);
+    fclose(file);
+    return same ? THINGINO_SUCCESS : THINGINO_ERROR_PROTOCOL;
+}
+
+/**
+ * One cycle on a fresh simulated camera: bootstrap it, write the image,
+ * verify it in the same session, then read the flash back. run < 0 is a
+ * warm-up run, which is not recorded.
+ */
+static thingino_error_t bench_run(const usb_sim_config_t* config, bench_state_t* state, int run,
+                                  const char* image, const char* readback,
+                                  const uint8_t* expected, const bench_options_t* options) {
+    struct usb_sim* sim = NULL;
+    thingino_error_t result = usb_sim_create(config, &sim);
+    if (result != THINGINO_SUCCESS) {
+        return result;
+    }
+
+    bool measured = run >= 0;
+    bench_quiet_t quiet;
+    bench_quiet_begin(&quiet, options->verbose);
+    usb_device_t* device = NULL;
+    bench_flow_t flow = BENCH_BOOTSTRAP;
+
+    for (; flow < BENCH_FLOW_COUNT && result == THINGINO_SUCCESS; flow++) {
+        uint64_t start_us = trace_now_us();
+        bench_flow_begin(state, flow, measured);
+        switch (flow) {
+        case BENCH_BOOTSTRAP:
+            result = bench_bootstrap(sim, &device);
+            break;
+        case BENCH_WRITE:
+            result = bench_write(device, image);
+            break;
+        case BENCH_VERIFY:
+            result = bench_verify(device, image);
+            break;
+        case BENCH_READ:
+            result = bench_read(device, readback, expected, config->flash_size);
+            break;
+        default:
+            break;
+        }
+        bench_flow_end(state, measured ? run : 0, start_us);
+        if (result != THINGINO_SUCCESS) {
+            break;
+        }
+    }
+
+    bench_close(device);
+    bench_quiet_end(&quiet);
+    usb_sim_destroy(sim);
+
+    if (result != THINGINO_SUCCESS) {
+        fprintf(stderr, "Error: %s failed in %s run: %s\n", bench_flow_names[flow],
+                measured ? "a measured" : "the warm-up", thingino_error_to_string(result));
+    }
+    return result;
+}
+
+// ============================================================================
+// REPORT
+// ============================================================================
+
+static int bench_compare_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+static int bench_compare_double(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+static double bench_median(const double* values, int count) {
+    double sorted[BENCH_MAX_RUNS];
+    memcpy(sorted, values, sizeof(double) * count);
+    qsort(sorted, count, sizeof(double), bench_compare_double);
+    return count % 2 ? sorted[count / 2] : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+}
+
+// Nearest-rank percentile of sorted samples, in ms
+static double bench_percentile(const uint32_t* sorted, size_t count, double percent) {
+    if (count == 0) {
+        return 0.0;
+    }
+    size_t rank = (size_t)(percent / 100.0 * count + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > count) {
+        rank = count;
+    }
+    return sorted[rank - 1] / 1000.0;
+}
+
+static void bench_summarize(bench_state_t* state, int runs,
+                            double metrics[BENCH_FLOW_COUNT][BENCH_METRIC_COUNT]) {
+    for (int f = 0; f < BENCH_FLOW_COUNT; f++) {
+        bench_samples_t* s = &state->samples[f];
+        qsort(s->latency_us, s->count, sizeof(uint32_t), bench_compare_u32);
+        metrics[f][BENCH_MBPS] = bench_median(s->mbps, runs);
+        metrics[f][BENCH_P50] = bench_percentile(s->latency_us, s->count, 50.0);
+        metrics[f][BENCH_P90] = bench_percentile(s->latency_us, s->count, 90.0);
+        metrics[f][BENCH_P99] = bench_percentile(s->latency_us, s->count, 99.0);
+        metrics[f][BENCH_MAX] = s->count ? s->latency_us[s->count - 1] / 1000.0 : 0.0;
+        metrics[f][BENCH_CYCLE] = bench_median(s->cycle_ms, runs);
+    }
+}
+
+static void bench_print(const bench_state_t* state, int runs,
+                        double metrics[BENCH_FLOW_COUNT][BENCH_METRIC_COUNT]) {
+    printf("\n%-10s %9s %7s %9s %9s %9s %9s %10s\n", "Flow", "MB/s", "Chunks",
+           "p50 ms", "p90 ms", "p99 ms", "max ms", "cycle ms");
+    for (int f = 0; f < BENCH_FLOW_COUNT; f++) {
+        printf("%-10s %9.2f %7zu %9.2f %9.2f %9.2f %9.2f %10.1f\n", bench_flow_names[f],
+               metrics[f][BENCH_MBPS], state->samples[f].count / (size_t)runs,
+               metrics[f][BENCH_P50], metrics[f][BENCH_P90], metrics[f][BENCH_P99],
+               metrics[f][BENCH_MAX], metrics[f][BENCH_CYCLE]);
+    }
+    printf("(MB/s and cycle: median of %d run%s; latencies: all chunks)\n",
+           runs, runs == 1 ? "" : "s");
+}
+
+static bool bench_save(const char* path, double metrics[BENCH_FLOW_COUNT][BENCH_METRIC_COUNT]) {
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "Error: cannot create %s\n", path);
+        return false;
+    }
+    fprintf(file, "# thingino-bench results\n");
+    for (int f = 0; f < BENCH_FLOW_COUNT; f++) {
+        for (int m = 0; m < BENCH_METRIC_COUNT; m++) {
+            fprintf(file, "%s.%s = %.3f\n", bench_flow_names[f], bench_metric_names[m],
+                    metrics[f][m]);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+static bool bench_parse_key(const char* key, int* flow, int* metric) {
+    const char* dot = strchr(key, '.');
+    if (!dot) {
+        return false;
+    }
+    for (int f = 0; f < BENCH_FLOW_COUNT; f++) {
+        size_t len = strlen(bench_flow_names[f]);
+        if ((size_t)(dot - key) != len || strncmp(key, bench_flow_names[f], len) != 0) {
+            continue;
+        }
+        for (int m = 0; m < BENCH_METRIC_COUNT; m++) {
+            if (strcmp(dot + 1, bench_metric_names[m]) == 0) {
+                *flow = f;
+                *metric = m;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Compare metrics against the values in path. With a baseline the limit is
+ * the saved value widened by tolerance percent (and for times by at least
+ * BENCH_NOISE_MS); with thresholds it is the value itself. Returns the number of regressions, or -1 if the file cannot
+ * be read.
+ */
+static int bench_check(const char* path, bool baseline, double tolerance,
+                       double metrics[BENCH_FLOW_COUNT][BENCH_METRIC_COUNT]) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Error: cannot open %s\n", path);
+        return -1;
+    }
+
+    printf("\n%s %s:\n", baseline ? "Against baseline" : "Against thresholds", path);
+    int regressions = 0;
+    int line_number = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file)) {
+        line_number++;
+        char key[64];
+        double value;
+        char* hash = strchr(line, '#');
+        if (hash) {
+            *hash = '\0';
+        }
+        if (sscanf(line, " %63[^= \t] = %lf", key, &value) != 2) {
+            if (sscanf(line, " %63s", key) == 1) {
+                fprintf(stderr, "Warning: %s:%d: expected <flow>.<metric> = <value>\n",
+                        path, line_number);
+            }
+            continue;
+        }
+        int f, m;
+        if (!bench_parse_key(key, &f, &m)) {
+            fprintf(stderr, "Warning: %s:%d: unknown metric '%s'\n", path, line_number, key);
+            continue;
+        }
+
+        bool higher_is_better = (m == BENCH_MBPS);
+        double limit = value;
+        if (baseline && higher_is_better) {
+            limit = value * (1.0 - tolerance / 100.0);
+        } else if (baseline) {
+            limit = value * (1.0 + tolerance / 100.0);
+            if (limit < value + BENCH_NOISE_MS) {
+                limit = value + BENCH_NOISE_MS;
+            }
+        }
+        double current = metrics[f][m];
+        bool regressed = higher_is_better ? current < limit : current > limit;
+        if (regressed) {
+            regressions++;
+        }
+        printf("  %-20s %10.2f %s %10.2f", key, current, higher_is_better ? ">=" : "<=", limit);
+        if (baseline && value != 0.0) {
+            printf("  (%+.1f%%)", (current - value) / value * 100.0);
+        }
+        printf("  %s\n", regressed ? "REGRESSED" : "ok");
+    }
+    fclose(file);
+    return regressions;
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+static void bench_usage(const char* program) {
+    printf("Usage: %s [options]\n\n", program);
+    printf("Runs bootstrap, write, verify and read against a simulated burner and\n");
+    printf("reports MB/s, per-chunk latency percentiles and cycle time per flow.\n\n");
+    printf("Options:\n");
+    printf("  --sim <spec>          Simulated device (default: %s, see thingino-cloner --sim)\n",
+           BENCH_DEFAULT_SIM);
+    printf("  --runs <n>            Measured runs (default: %d)\n", BENCH_DEFAULT_RUNS);
+    printf("  --warmup <n>          Unmeasured runs first (default: 1)\n");
+    printf("  --save <file>         Save the results as a baseline\n");
+    printf("  --baseline <file>     Fail if a metric is worse than the saved one by more\n");
+    printf("                        than the tolerance\n");
+    printf("  --tolerance <pct>     Allowed regression against --baseline (default: %.0f)\n",
+           BENCH_DEFAULT_TOLERANCE);
+    printf("  --thresholds <file>   Fail if a metric crosses an absolute limit\n");
+    printf("  --verbose             Show the output of the flows\n");
+    printf("  --debug               Enable debug output\n");
+    printf("\nRun from the source tree: bootstrap loads the SPL and U-Boot from references/.\n");
+}
+
+static bool bench_parse_arguments(int argc, char* argv[], bench_options_t* options) {
+    options->sim_spec = BENCH_DEFAULT_SIM;
+    options->runs = BENCH_DEFAULT_RUNS;
+    options->warmup = 1;
+    options->tolerance = BENCH_DEFAULT_TOLERANCE;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool takes_value = strcmp(arg, "--sim") == 0 || strcmp(arg, "--runs") == 0 ||
+                           strcmp(arg, "--warmup") == 0 || strcmp(arg, "--save") == 0 ||
+                           strcmp(arg, "--baseline") == 0 || strcmp(arg, "--tolerance") == 0 ||
+                           strcmp(arg, "--thresholds") == 0;
+        if (takes_value && !value) {
+            fprintf(stderr, "Error: %s requires a value\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--sim") == 0) {
+            options->sim_spec = value;
+        } else if (strcmp(arg, "--runs") == 0) {
+            options->runs = atoi(value);
+            if (options->runs < 1 || options->runs > BENCH_MAX_RUNS) {
+                fprintf(stderr, "Error: --runs must be 1-%d\n", BENCH_MAX_RUNS);
+                return false;
+            }
+        } else if (strcmp(arg, "--warmup") == 0) {
+            options->warmup = atoi(value);
+            if (options->warmup < 0) {
+                fprintf(stderr, "Error: --warmup must not be negative\n");
+                return false;
+            }
+        } else if (strcmp(arg, "--save") == 0) {
+            options->save_file = value;
+        } else if (strcmp(arg, "--baseline") == 0) {
+            options->baseline_file = value;
+        } else if (strcmp(arg, "--tolerance") == 0) {
+            options->tolerance = atof(value);
+            if (options->tolerance < 0) {
+                fprintf(stderr, "Error: --tolerance must not be negative\n");
+                return false;
+            }
+        } else if (strcmp(arg, "--thresholds") == 0) {
+            options->thresholds_file = value;
+        } else if (strcmp(arg, "--verbose") == 0) {
+            options->verbose = true;
+        } else if (strcmp(arg, "--debug") == 0) {
+            log_set_level(LOG_LEVEL_DEBUG);
+            options->verbose = true;
+        } else if (strcmp(arg, "-h") == 0 || strcmp(arg, "--help") == 0) {
+            bench_usage(argv[0]);
+            exit(0);
+        } else {
+            fprintf(stderr, "Error: unknown option %s\n", arg);
+            return false;
+        }
+        if (takes_value) {
+            i++;
+        }
+    }
+    return true;
+}
+
+// Deterministic, incompressible and never blank, so no chunk is skipped
+static void bench_fill_image(uint8_t* data, uint32_t size) {
+    uint32_t x = 0x2545F491;
+    for (uint32_t i = 0; i < size; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        data[i] = (uint8_t)x;
+    }
+}
+
+static bool bench_temp_path(char* buffer, size_t size, const char* name) {
+    const char* dir = getenv("TMPDIR");
+#if defined(_WIN32)
+    if (!dir || !*dir) {
+        dir = getenv("TEMP");
+    }
+    if (!dir || !*dir) {
+        dir = ".";
+    }
+#else
+    if (!dir || !*dir) {
+        dir = "/tmp";
+    }
+#endif
+    int written = snprintf(buffer, size, "%s/thingino-bench-%d-%s", dir, (int)getpid(), name);
+    return written > 0 && (size_t)written < size;
+}
+
+int main(int argc, char* argv[]) {
+    bench_options_t options;
+    memset(&options, 0, sizeof(options));
+    if (!bench_parse_arguments(argc, argv, &options)) {
+        bench_usage(argv[0]);
+        return 1;
+    }
+
+    usb_sim_config_t config;
+    if (usb_sim_parse_spec(options.sim_spec, &config) != THINGINO_SUCCESS) {
+        fprintf(stderr, "Error: invalid --sim spec '%s'\n", options.sim_spec);
+        return 1;
+    }
+    bench_state_t state;
+    memset(&state, 0, sizeof(state));
+    pthread_mutex_init(&state.lock, NULL);
+    config.devices = 1;
+    config.stage = STAGE_BOOTROM;
+    config.image[0] = '\0';
+    config.dump[0] = '\0';
+    config.on_chunk = bench_on_chunk;
+    config.on_chunk_data = &state;
+
+    char image[PATH_MAX];
+    char readback[PATH_MAX];
+    if (!bench_temp_path(image, sizeof(image), "image.bin") ||
+        !bench_temp_path(readback, sizeof(readback), "readback.bin")) {
+        fprintf(stderr, "Error: temporary path too long\n");
+        return 1;
+    }
+
+    uint8_t* expected = (uint8_t*)malloc(config.flash_size);
+    if (!expected) {
+        fprintf(stderr, "Error: cannot allocate %u bytes\n", config.flash_size);
+        return 1;
+    }
+    bench_fill_image(expected, config.flash_size);
+    FILE* file = fopen(image, "wb");
+    bool written = file && fwrite(expected, 1, config.flash_size, file) == config.flash_size;
+    if (!file || fclose(file) != 0 || !written) {
+        fprintf(stderr, "Error: cannot create %s\n", image);
+        free(expected);
+        return 1;
+    }
+
+    printf("thingino-bench: %s, %u MB image, %d warm-up + %d measured run%s\n",
+           options.sim_spec, config.flash_size / (1024 * 1024), options.warmup, options.runs,
+           options.runs == 1 ? "" : "s");
+
+    thingino_error_t result = THINGINO_SUCCESS;
+    for (int i = -options.warmup; i < options.runs && result == THINGINO_SUCCESS; i++) {
+        printf("  %s run %d...\n", i < 0 ? "warm-up" : "measured",
+               i < 0 ? i + options.warmup + 1 : i + 1);
+        fflush(stdout);
+        result = bench_run(&config, &state, i, image, readback, expected, &options);
+    }
+    remove(image);
+    remove(readback);
+    free(expected);
+
+    int status = 0;
+    if (result != THINGINO_SUCCESS) {
+        status = 1;
+    } else if (state.failed) {
+        fprintf(stderr, "Error: out of memory while recording chunk latencies\n");
+        status = 1;
+    } else {
+        double metrics[BENCH_FLOW_COUNT][BENCH_METRIC_COUNT];
+        bench_summarize(&state, options.runs, metrics);
+        bench_print(&state, options.runs, metrics);
+
+        if (options.save_file && !bench_save(options.save_file, metrics)) {
+            status = 1;
+        }
+        const char* checks[2] = {options.baseline_file, options.thresholds_file};
+        for (int c = 0; c < 2; c++) {
+            if (!checks[c]) {
+                continue;
+            }
+            int regressions = bench_check(checks[c], c == 0, options.tolerance, metrics);
+            if (regressions != 0) {
+                status = 1;
+            }
+        }
+        if (status == 0 && (options.baseline_file || options.thresholds_file)) {
+            printf("\nNo regressions.\n");
+        }
+    }
+
+    for (int f = 0; f < BENCH_FLOW_COUNT; f++) {
+        free(state.samples[f].latency_us);
+    }
+    pthread_mutex_destroy(&state.lock);
+    return status;
+}
@@ -0,0 +1,144 @@
+#include "blank_scan.h"
+#include <pthread.h>
+#include <string.h>
+
+// ============================================================================
+// ERASED (ALL-0xFF) BUFFER SCAN
+// ============================================================================
+//
+// Every kernel ANDs a block of input together and compares the result with
+// all-ones, so the inner loop has no branches; the block is small enough
+// (256 bytes) that a chunk with data is rejected almost immediately.
+
+#define BLANK_SCAN_BLOCK 256
+
+typedef bool (*blank_scan_kernel_fn)(const uint8_t* data, size_t length);
+
+static blank_scan_kernel_fn blank_scan_kernel;
+static const char* blank_scan_kernel_name;
+static pthread_once_t blank_scan_once = PTHREAD_ONCE_INIT;
+
+static bool blank_scan_word(const uint8_t* data, size_t length) {
+    while (length >= BLANK_SCAN_BLOCK) {
+        uint64_t acc = ~(uint64_t)0;
+        for (size_t i = 0; i < BLANK_SCAN_BLOCK; i += 8) {
+            uint64_t word;
+            memcpy(&word, data + i, sizeof(word));
+            acc &= word;
+        }
+        if (acc != ~(uint64_t)0) {
+            return false;
+        }
+        data += BLANK_SCAN_BLOCK;
+        length -= BLANK_SCAN_BLOCK;
+    }
+
+    uint8_t acc = 0xFF;
+    while (length--) {
+        acc &= *data++;
+    }
+    return acc == 0xFF;
+}
+
+// ----------------------------------------------------------------------------
+// x86 SSE2 / AVX2
+// ----------------------------------------------------------------------------
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define BLANK_SCAN_HAVE_X86 1
+#include <immintrin.h>
+
+__attribute__((target("sse2")))
+static bool blank_scan_sse2(const uint8_t* data, size_t length) {
+    const __m128i ones = _mm_set1_epi8((char)0xFF);
+
+    while (length >= BLANK_SCAN_BLOCK) {
+        __m128i acc = ones;
+        for (size_t i = 0; i < BLANK_SCAN_BLOCK; i += 16) {
+            acc = _mm_and_si128(acc, _mm_loadu_si128((const __m128i*)(data + i)));
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, ones)) != 0xFFFF) {
+            return false;
+        }
+        data += BLANK_SCAN_BLOCK;
+        length -= BLANK_SCAN_BLOCK;
+    }
+    return blank_scan_word(data, length);
+}
+
+__attribute__((target("avx2")))
+static bool blank_scan_avx2(const uint8_t* data, size_t length) {
+    const __m256i ones = _mm256_set1_epi8((char)0xFF);
+
+    while (length >= BLANK_SCAN_BLOCK) {
+        __m256i acc = ones;
+        for (size_t i = 0; i < BLANK_SCAN_BLOCK; i += 32) {
+            acc = _mm256_and_si256(acc, _mm256_loadu_si256((const __m256i*)(data + i)));
+        }
+        // testc: CF is set when (~acc & ones) == 0, i.e. acc is all-ones
+        if (!_mm256_testc_si256(acc, ones)) {
+            return false;
+        }
+        data += BLANK_SCAN_BLOCK;
+        length -= BLANK_SCAN_BLOCK;
+    }
+    return blank_scan_word(data, length);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// AArch64 NEON (always present)
+// ----------------------------------------------------------------------------
+#if defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define BLANK_SCAN_HAVE_NEON 1
+#include <arm_neon.h>
+
+static bool blank_scan_neon(const uint8_t* data, size_t length) {
+    while (length >= BLANK_SCAN_BLOCK) {
+        uint8x16_t acc = vdupq_n_u8(0xFF);
+        for (size_t i = 0; i < BLANK_SCAN_BLOCK; i += 16) {
+            acc = vandq_u8(acc, vld1q_u8(data + i));
+        }
+        if (vminvq_u8(acc) != 0xFF) {
+            return false;
+        }
+        data += BLANK_SCAN_BLOCK;
+        length -= BLANK_SCAN_BLOCK;
+    }
+    return blank_scan_word(data, length);
+}
+#endif
+
+static void blank_scan_init(void) {
+    blank_scan_kernel = blank_scan_word;
+    blank_scan_kernel_name = "word";
+
+#ifdef BLANK_SCAN_HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        blank_scan_kernel = blank_scan_avx2;
+        blank_scan_kernel_name = "avx2";
+    } else if (__builtin_cpu_supports("sse2")) {
+        blank_scan_kernel = blank_scan_sse2;
+        blank_scan_kernel_name = "sse2";
+    }
+#endif
+
+#ifdef BLANK_SCAN_HAVE_NEON
+    blank_scan_kernel = blank_scan_neon;
+    blank_scan_kernel_name = "neon";
+#endif
+}
+
+bool blank_scan_is_erased(const uint8_t* data, size_t length) {
+    if (!data) {
+        return false;
+    }
+
+    pthread_once(&blank_scan_once, blank_scan_init);
+    return blank_scan_kernel(data, length);
+}
+
+const char* blank_scan_implementation(void) {
+    pthread_once(&blank_scan_once, blank_scan_init);
+    return blank_scan_kernel_name;
+}
@@ -146,7 +146,7 @@ thingino_error_t bootstrap_device(usb_device_t* device, const bootstrap_config_t
 #ifdef _WIN32
     Sleep(wait_ms);
 #else
-    usleep(wait_ms * 1000);
+    trace_usleep(wait_ms * 1000);
 #endif
 
     DEBUG_PRINT("SPL should have completed, device handle remains valid\n");
@@ -169,7 +169,7 @@ thingino_error_t bootstrap_device(usb_device_t* device, const bootstrap_config_t
 #ifdef _WIN32
             Sleep(20);
 #else
-            usleep(20000);  // 20ms between polls
+            trace_usleep(20000);  // 20ms between polls
 #endif
         }
         if (!spl_ready) {
@@ -196,7 +196,7 @@ thingino_error_t bootstrap_device(usb_device_t* device, const bootstrap_config_t
 #ifdef _WIN32
         Sleep(5000);
 #else
-        usleep(5000000);
+        trace_usleep(5000000);
 #endif
     }
 
@@ -320,7 +320,7 @@ thingino_error_t bootstrap_program_stage2(usb_device_t* device,
 #ifdef _WIN32
     Sleep(500);
 #else
-    usleep(500000);
+    trace_usleep(500000);
 #endif
 #endif
 
@@ -347,12 +347,8 @@ thingino_error_t bootstrap_program_stage2(usb_device_t* device,
     // Instead, it transitions internally from bootrom to firmware stage
     DEBUG_PRINT("ProgStage2 completed - device should now be in firmware stage\n");
 
-    // Platform-specific sleep
-#ifdef _WIN32
-    Sleep(1000);
-#else
-    sleep(1);
-#endif
+    // Let U-Boot come up before the first firmware-stage request
+    trace_usleep(1000000);
 
     return THINGINO_SUCCESS;
 }
@@ -434,7 +430,7 @@ thingino_error_t bootstrap_transfer_data(usb_device_t* device,
 #ifdef _WIN32
                     Sleep(50);
 #else
-                    usleep(50000);
+                    trace_usleep(50000);
 #endif
                     continue;
                 }
@@ -456,7 +452,7 @@ thingino_error_t bootstrap_transfer_data(usb_device_t* device,
 #ifdef _WIN32
             Sleep(10);
 #else
-            usleep(10000);
+            trace_usleep(10000);
 #endif
         }
     }
@@ -0,0 +1,249 @@
+#include "crc32.h"
+#include <pthread.h>
+
+// ============================================================================
+// CRC32 (reflected 0xEDB88320, as used by the burner handshakes and zlib)
+// ============================================================================
+//
+// All kernels work on the raw shift register (pre-inverted by the caller) so
+// they can be chained; crc32_update() applies the zlib-style inversion once.
+//
+// - slice-by-8: eight 256-entry tables, one table lookup per input byte and
+//   no per-bit work. Portable, used for short tails and as the fallback.
+// - pclmul: folds 64 bytes per iteration with carry-less multiplies and
+//   finishes with a Barrett reduction (Intel "Fast CRC Computation Using
+//   PCLMULQDQ"; constants for the reflected 0xEDB88320 polynomial).
+// - armv8-crc: the CRC32X/CRC32B instructions implement this exact CRC.
+
+#define CRC32_POLY_REFLECTED 0xEDB88320u
+
+typedef uint32_t (*crc32_kernel_fn)(uint32_t crc, const uint8_t* data, size_t length);
+
+static uint32_t crc32_table[8][256];
+static crc32_kernel_fn crc32_kernel;
+static const char* crc32_kernel_name;
+static pthread_once_t crc32_once = PTHREAD_ONCE_INIT;
+
+static uint32_t crc32_slice8(uint32_t crc, const uint8_t* p, size_t length) {
+    while (length >= 8) {
+        uint32_t one = crc ^ ((uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+                              ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+        uint32_t two = (uint32_t)p[4] | ((uint32_t)p[5] << 8) |
+                       ((uint32_t)p[6] << 16) | ((uint32_t)p[7] << 24);
+
+        crc = crc32_table[7][one & 0xFF] ^
+              crc32_table[6][(one >> 8) & 0xFF] ^
+              crc32_table[5][(one >> 16) & 0xFF] ^
+              crc32_table[4][one >> 24] ^
+              crc32_table[3][two & 0xFF] ^
+              crc32_table[2][(two >> 8) & 0xFF] ^
+              crc32_table[1][(two >> 16) & 0xFF] ^
+              crc32_table[0][two >> 24];
+
+        p += 8;
+        length -= 8;
+    }
+
+    while (length--) {
+        crc = crc32_table[0][(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+// ----------------------------------------------------------------------------
+// x86 PCLMULQDQ
+// ----------------------------------------------------------------------------
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CRC32_HAVE_PCLMUL 1
+#include <immintrin.h>
+
+// Folds length bytes (>= 64, multiple of 16) into the raw register.
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32_pclmul_fold(uint32_t crc, const uint8_t* buf, size_t length) {
+    static const uint64_t k1k2[2] __attribute__((aligned(16))) = { 0x0154442bd4, 0x01c6e41596 };
+    static const uint64_t k3k4[2] __attribute__((aligned(16))) = { 0x01751997d0, 0x00ccaa009e };
+    static const uint64_t k5k0[2] __attribute__((aligned(16))) = { 0x0163cd6124, 0x0000000000 };
+    static const uint64_t poly[2] __attribute__((aligned(16))) = { 0x01db710641, 0x01f7011641 };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_load_si128((const __m128i*)k1k2);
+
+    buf += 64;
+    length -= 64;
+
+    // Parallel fold: four 128-bit lanes, 64 bytes per iteration
+    while (length >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        buf += 64;
+        length -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = _mm_load_si128((const __m128i*)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Remaining 16-byte blocks
+    while (length >= 16) {
+        x2 = _mm_loadu_si128((const __m128i*)buf);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        buf += 16;
+        length -= 16;
+    }
+
+    // 128 -> 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128((const __m128i*)poly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+static uint32_t crc32_pclmul(uint32_t crc, const uint8_t* data, size_t length) {
+    if (length >= 64) {
+        size_t bulk = length & ~(size_t)15;
+        crc = crc32_pclmul_fold(crc, data, bulk);
+        data += bulk;
+        length -= bulk;
+    }
+    return crc32_slice8(crc, data, length);
+}
+#endif
+
+// ----------------------------------------------------------------------------
+// ARMv8 CRC32 extension
+// ----------------------------------------------------------------------------
+#if defined(__aarch64__) && defined(__linux__) && defined(__GNUC__)
+#define CRC32_HAVE_ARMV8 1
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+
+__attribute__((target("arch=armv8-a+crc")))
+static uint32_t crc32_armv8(uint32_t crc, const uint8_t* data, size_t length) {
+    while (length >= 8) {
+        uint64_t word = (uint64_t)data[0] | ((uint64_t)data[1] << 8) |
+                        ((uint64_t)data[2] << 16) | ((uint64_t)data[3] << 24) |
+                        ((uint64_t)data[4] << 32) | ((uint64_t)data[5] << 40) |
+                        ((uint64_t)data[6] << 48) | ((uint64_t)data[7] << 56);
+        crc = __crc32d(crc, word);
+        data += 8;
+        length -= 8;
+    }
+
+    while (length--) {
+        crc = __crc32b(crc, *data++);
+    }
+
+    return crc;
+}
+#endif
+
+static void crc32_init(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (c >> 1) ^ CRC32_POLY_REFLECTED : c >> 1;
+        }
+        crc32_table[0][n] = c;
+    }
+
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = crc32_table[0][n];
+        for (int k = 1; k < 8; k++) {
+            c = crc32_table[0][c & 0xFF] ^ (c >> 8);
+            crc32_table[k][n] = c;
+        }
+    }
+
+    crc32_kernel = crc32_slice8;
+    crc32_kernel_name = "slice-by-8";
+
+#ifdef CRC32_HAVE_PCLMUL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1")) {
+        crc32_kernel = crc32_pclmul;
+        crc32_kernel_name = "pclmul";
+    }
+#endif
+
+#ifdef CRC32_HAVE_ARMV8
+    if (getauxval(AT_HWCAP) & HWCAP_CRC32) {
+        crc32_kernel = crc32_armv8;
+        crc32_kernel_name = "armv8-crc";
+    }
+#endif
+}
+
+uint32_t crc32_update(uint32_t crc, const uint8_t* data, size_t length) {
+    if (!data || length == 0) {
+        return crc;
+    }
+
+    pthread_once(&crc32_once, crc32_init);
+    return ~crc32_kernel(~crc, data, length);
+}
+
+const char* crc32_implementation(void) {
+    pthread_once(&crc32_once, crc32_init);
+    return crc32_kernel_name;
+}
@@ -0,0 +1,222 @@
+#include "erase_model.h"
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#include <direct.h>
+#define erase_model_mkdir(path) _mkdir(path)
+#else
+#define erase_model_mkdir(path) mkdir(path, 0755)
+#endif
+
+// ============================================================================
+// LEARNED ERASE TIMES
+// ============================================================================
+
+#define ERASE_MODEL_FILE     "erase-times"
+#define ERASE_MODEL_MAX_KEYS 64
+#define ERASE_MODEL_WINDOW   8   // Moving average over roughly this many erases
+
+typedef struct {
+    char key[32];
+    erase_model_t model;
+} erase_model_entry_t;
+
+// Serializes read-modify-write of the file between parallel device workers
+static pthread_mutex_t erase_model_lock = PTHREAD_MUTEX_INITIALIZER;
+
+void erase_model_key(char* buffer, size_t size, const usb_device_t* device) {
+    const char* variant = processor_variant_to_string(device->info.variant);
+    // Devices behind another transport (the simulator) learn separately
+    const char* prefix = device->transport ? device->transport->name : "";
+    const char* dash = device->transport ? "-" : "";
+    if (device->flash_size) {
+        snprintf(buffer, size, "%s%s%s-%u", prefix, dash, variant,
+                 device->flash_size / (1024 * 1024));
+    } else {
+        snprintf(buffer, size, "%s%s%s-any", prefix, dash, variant);
+    }
+}
+
+// Directory holding the model: $XDG_CACHE_HOME/thingino-cloner or
+// ~/.cache/thingino-cloner (%LOCALAPPDATA%\thingino-cloner on Windows)
+static bool erase_model_dir(char* buffer, size_t size) {
+    int written;
+#if defined(_WIN32)
+    const char* base = getenv("LOCALAPPDATA");
+    if (!base || !*base) {
+        return false;
+    }
+    written = snprintf(buffer, size, "%s/thingino-cloner", base);
+#else
+    const char* base = getenv("XDG_CACHE_HOME");
+    if (base && *base) {
+        written = snprintf(buffer, size, "%s/thingino-cloner", base);
+    } else {
+        const char* home = getenv("HOME");
+        if (!home || !*home) {
+            return false;
+        }
+        written = snprintf(buffer, size, "%s/.cache/thingino-cloner", home);
+    }
+#endif
+    return written > 0 && (size_t)written < size;
+}
+
+static bool erase_model_path(char* buffer, size_t size) {
+    char dir[PATH_MAX];
+    if (!erase_model_dir(dir, sizeof(dir))) {
+        return false;
+    }
+    int written = snprintf(buffer, size, "%s/" ERASE_MODEL_FILE, dir);
+    return written > 0 && (size_t)written < size;
+}
+
+// Read every entry of the model file; a missing file is an empty model
+static int erase_model_load(erase_model_entry_t* entries, int max_entries) {
+    char path[PATH_MAX];
+    if (!erase_model_path(path, sizeof(path))) {
+        return 0;
+    }
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        return 0;
+    }
+
+    int count = 0;
+    char line[128];
+    while (count < max_entries && fgets(line, sizeof(line), file)) {
+        erase_model_entry_t* entry = &entries[count];
+        unsigned int samples, min_ms, mean_ms, max_ms;
+        if (sscanf(line, "%31s %u %u %u %u", entry->key, &samples, &min_ms, &mean_ms,
+                   &max_ms) != 5 || samples == 0) {
+            continue;
+        }
+        entry->model.samples = samples;
+        entry->model.min_ms = min_ms;
+        entry->model.mean_ms = mean_ms;
+        entry->model.max_ms = max_ms;
+        count++;
+    }
+
+    fclose(file);
+    return count;
+}
+
+// Write the model to a temporary file and rename it into place, so a
+// concurrent reader never sees a half-written file
+static thingino_error_t erase_model_save(const erase_model_entry_t* entries, int count) {
+    char dir[PATH_MAX];
+    char path[PATH_MAX];
+    char tmp[PATH_MAX + 8];
+    if (!erase_model_dir(dir, sizeof(dir)) || !erase_model_path(path, sizeof(path))) {
+        return THINGINO_ERROR_FILE_IO;
+    }
+
+#if !defined(_WIN32)
+    // ~/.cache itself may not exist yet
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    if (!xdg || !*xdg) {
+        char cache[PATH_MAX];
+        snprintf(cache, sizeof(cache), "%s/.cache", getenv("HOME"));
+        erase_model_mkdir(cache);
+    }
+#endif
+    if (erase_model_mkdir(dir) != 0 && errno != EEXIST) {
+        return THINGINO_ERROR_FILE_IO;
+    }
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE* file = fopen(tmp, "w");
+    if (!file) {
+        return THINGINO_ERROR_FILE_IO;
+    }
+    for (int i = 0; i < count; i++) {
+        fprintf(file, "%s %u %u %u %u\n", entries[i].key, entries[i].model.samples,
+                entries[i].model.min_ms, entries[i].model.mean_ms, entries[i].model.max_ms);
+    }
+    if (fclose(file) != 0) {
+        remove(tmp);
+        return THINGINO_ERROR_FILE_IO;
+    }
+
+#if defined(_WIN32)
+    // rename() does not replace an existing file on Windows
+    remove(path);
+#endif
+    if (rename(tmp, path) != 0) {
+        remove(tmp);
+        return THINGINO_ERROR_FILE_IO;
+    }
+    return THINGINO_SUCCESS;
+}
+
+bool erase_model_lookup(const char* key, erase_model_t* model) {
+    if (!key || !model) {
+        return false;
+    }
+
+    erase_model_entry_t entries[ERASE_MODEL_MAX_KEYS];
+    pthread_mutex_lock(&erase_model_lock);
+    int count = erase_model_load(entries, ERASE_MODEL_MAX_KEYS);
+    pthread_mutex_unlock(&erase_model_lock);
+
+    for (int i = 0; i < count; i++) {
+        if (strcmp(entries[i].key, key) == 0) {
+            *model = entries[i].model;
+            return true;
+        }
+    }
+    return false;
+}
+
+thingino_error_t erase_model_record(const char* key, uint32_t erase_ms) {
+    if (!key || !*key || strlen(key) >= sizeof(((erase_model_entry_t*)0)->key)) {
+        return THINGINO_ERROR_INVALID_PARAMETER;
+    }
+
+    erase_model_entry_t entries[ERASE_MODEL_MAX_KEYS];
+    pthread_mutex_lock(&erase_model_lock);
+    int count = erase_model_load(entries, ERASE_MODEL_MAX_KEYS);
+
+    erase_model_entry_t* entry = NULL;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(entries[i].key, key) == 0) {
+            entry = &entries[i];
+            break;
+        }
+    }
+    if (!entry) {
+        if (count == ERASE_MODEL_MAX_KEYS) {
+            // Full: drop the oldest key (the first line)
+            memmove(&entries[0], &entries[1], sizeof(entries[0]) * (size_t)(count - 1));
+            count--;
+        }
+        entry = &entries[count++];
+        memset(entry, 0, sizeof(*entry));
+        strcpy(entry->key, key);
+    }
+
+    erase_model_t* model = &entry->model;
+    if (model->samples == 0) {
+        model->min_ms = model->mean_ms = model->max_ms = erase_ms;
+    } else {
+        uint32_t window = model->samples < ERASE_MODEL_WINDOW ? model->samples + 1
+                                                              : ERASE_MODEL_WINDOW;
+        int64_t delta = (int64_t)erase_ms - (int64_t)model->mean_ms;
+        model->mean_ms = (uint32_t)((int64_t)model->mean_ms + delta / (int64_t)window);
+        if (erase_ms < model->min_ms) {
+            model->min_ms = erase_ms;
+        }
+        if (erase_ms > model->max_ms) {
+            model->max_ms = erase_ms;
+        }
+    }
+    model->samples++;
+
+    thingino_error_t result = erase_model_save(entries, count);
+    pthread_mutex_unlock(&erase_model_lock);
+    return result;
+}
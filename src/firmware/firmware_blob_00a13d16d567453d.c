@@ -0,0 +1,414 @@
+/**
+ * Embedded Firmware blob 00a13d16d567453d
+ * Used by: t41 SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 9856 bytes, 4783 compressed
+static const uint8_t blob_00a13d16d567453d_z[] = {
+    0x78, 0xda, 0xdd, 0x59, 0x6f, 0x70, 0x1b, 0xd7, 0x71, 0x5f, 0x1c, 0x40,
+    0x12, 0x04, 0x28, 0xf1, 0x48, 0xa1, 0x36, 0x6c, 0x31, 0xf6, 0x41, 0x3a,
+    0x90, 0x70, 0x44, 0x79, 0x8e, 0x24, 0x6c, 0xa9, 0xd2, 0x49, 0x73, 0x04,
+    0x40, 0x89, 0x1a, 0x93, 0x16, 0x44, 0x49, 0xb1, 0x1c, 0xcb, 0x43, 0x88,
+    0x00, 0x2d, 0xb1, 0xa5, 0x29, 0x9a, 0xa2, 0x1a, 0xa5, 0xe5, 0xc4, 0x27,
+    0x92, 0x56, 0x98, 0xf6, 0x42, 0x2a, 0x1a, 0x37, 0xe3, 0xc9, 0xb8, 0x33,
+    0x88, 0xfe, 0x38, 0x4a, 0x07, 0x21, 0xf4, 0xc7, 0x99, 0x49, 0x66, 0xec,
+    0x11, 0x24, 0xd9, 0x8e, 0xd3, 0x2f, 0x75, 0x5b, 0x7f, 0xf0, 0x07, 0x4f,
+    0x8b, 0xa6, 0xfd, 0xa0, 0x0f, 0xe9, 0x58, 0x1f, 0xdc, 0x5a, 0xae, 0x65,
+    0x5f, 0x7f, 0x7b, 0x77, 0x10, 0x41, 0x88, 0x54, 0x23, 0x7f, 0xe8, 0x87,
+    0x62, 0x66, 0xe7, 0xbd, 0xb7, 0xbb, 0xef, 0xed, 0xbe, 0x7d, 0xfb, 0x76,
+    0xf7, 0x1d, 0xa4, 0x4b, 0x41, 0xb5, 0x58, 0x1f, 0xdc, 0x40, 0xe4, 0x9d,
+    0x23, 0xbd, 0x56, 0x0d, 0x6b, 0xb5, 0x2e, 0xf4, 0xf3, 0xd2, 0x25, 0x2f,
+    0xf0, 0xde, 0x27, 0x88, 0x6a, 0x7f, 0x18, 0xa4, 0xc7, 0xb8, 0xfd, 0x85,
+    0x46, 0x5e, 0xd5, 0x73, 0x1b, 0xb8, 0xd4, 0x8c, 0x46, 0x87, 0xbc, 0x9a,
+    0x4e, 0x0e, 0xff, 0xa1, 0x19, 0x2d, 0x56, 0x43, 0x5e, 0xc2, 0xef, 0x18,
+    0xc5, 0xe6, 0x56, 0x90, 0x47, 0x0e, 0x45, 0x88, 0x02, 0xd4, 0x6d, 0x90,
+    0x2e, 0xa8, 0x7a, 0x34, 0x26, 0x8b, 0x54, 0x2d, 0x87, 0x82, 0x44, 0x75,
+    0x54, 0x2b, 0x87, 0x92, 0x1a, 0x3d, 0x42, 0x35, 0x32, 0xd1, 0x53, 0x86,
+    0x97, 0xfc, 0x7f, 0xc4, 0xf3, 0x84, 0xc8, 0xd0, 0x68, 0x48, 0xfa, 0x5b,
+    0xf2, 0xd0, 0x09, 0xe0, 0x5e, 0x31, 0x3c, 0x94, 0x78, 0x95, 0xe4, 0xf7,
+    0x26, 0xcc, 0xfa, 0x73, 0x8a, 0x8b, 0xd2, 0xf2, 0xa7, 0xe6, 0xc1, 0x40,
+    0x1d, 0xc5, 0x64, 0xd2, 0x6b, 0x54, 0x49, 0xfd, 0x9d, 0x21, 0xc4, 0x3c,
+    0x58, 0x2b, 0x7e, 0xd2, 0xa4, 0xb4, 0xa2, 0x53, 0x3a, 0x8a, 0x7e, 0xd6,
+    0x43, 0xdd, 0x59, 0xa2, 0x44, 0x96, 0xe9, 0x2f, 0x03, 0xcf, 0x38, 0x99,
+    0xb6, 0x65, 0x23, 0xd4, 0x75, 0xd6, 0x4b, 0x45, 0x37, 0xcb, 0x61, 0x7d,
+    0x24, 0x35, 0x66, 0x04, 0x28, 0x76, 0x92, 0x71, 0x2e, 0x8a, 0x29, 0x37,
+    0xcc, 0xb7, 0x5b, 0x7c, 0x24, 0x40, 0xc7, 0x0b, 0x79, 0x69, 0xda, 0x33,
+    0xe1, 0x26, 0xe1, 0x81, 0x00, 0x5d, 0xc9, 0xff, 0x43, 0x1d, 0xd5, 0xf1,
+    0x5e, 0xec, 0x39, 0x71, 0x83, 0x68, 0x14, 0x6b, 0x27, 0x8c, 0x14, 0x78,
+    0x03, 0x34, 0x75, 0x32, 0x05, 0x19, 0x5f, 0x9a, 0x03, 0x01, 0xf0, 0xce,
+    0x61, 0xee, 0x1c, 0xaf, 0x17, 0xa4, 0xb7, 0x5b, 0x78, 0x3d, 0x9e, 0xff,
+    0x5b, 0xcc, 0x67, 0x91, 0x5f, 0x9a, 0x9a, 0xb8, 0x20, 0xf7, 0xca, 0x1c,
+    0x41, 0x36, 0xf3, 0x31, 0xbf, 0x09, 0xf9, 0x6c, 0xb3, 0xd2, 0x1c, 0x91,
+    0xe2, 0x86, 0x9f, 0x04, 0x55, 0xc1, 0x5e, 0x43, 0xe2, 0x00, 0xd1, 0x2a,
+    0x81, 0x3e, 0x31, 0xdd, 0x96, 0x6e, 0x1e, 0xd2, 0xb2, 0x5e, 0xec, 0xe9,
+    0x36, 0xc6, 0x12, 0x5a, 0x37, 0xb9, 0xa1, 0x9b, 0xa8, 0xf2, 0x3e, 0xaf,
+    0x42, 0x96, 0xa4, 0x0a, 0xf3, 0x80, 0xd9, 0x07, 0x81, 0x67, 0xbe, 0x9f,
+    0x83, 0xaf, 0x09, 0x6d, 0x49, 0xbf, 0x90, 0x88, 0x93, 0x75, 0x74, 0x64,
+    0x7d, 0xb8, 0x7f, 0x53, 0x65, 0x9b, 0x7a, 0x54, 0x3e, 0x1b, 0x12, 0xa7,
+    0x65, 0x1c, 0x1b, 0x74, 0xad, 0x8a, 0x86, 0x95, 0x38, 0x10, 0x85, 0xb7,
+    0x24, 0x80, 0x06, 0x48, 0x01, 0x74, 0x40, 0x16, 0x50, 0x00, 0x14, 0x01,
+    0xe4, 0x02, 0x1d, 0xa0, 0x01, 0x52, 0x00, 0x1d, 0x90, 0x05, 0x14, 0x00,
+    0x45, 0x00, 0x09, 0xa0, 0x03, 0x34, 0x40, 0x0a, 0xa0, 0x03, 0xb2, 0x80,
+    0x02, 0xa0, 0x08, 0x20, 0x37, 0xe8, 0x00, 0x0d, 0x90, 0x02, 0xe8, 0x80,
+    0x2c, 0xa0, 0x00, 0x28, 0x02, 0xc8, 0x13, 0x93, 0xff, 0xd9, 0x4c, 0x04,
+    0x2c, 0x5d, 0xc4, 0xb4, 0xdc, 0x4a, 0x83, 0x22, 0xdb, 0xf3, 0x23, 0x93,
+    0x2c, 0x7b, 0xda, 0x3a, 0x5e, 0x85, 0x8e, 0x57, 0xa1, 0xe3, 0x55, 0xe8,
+    0x78, 0x15, 0x3a, 0x5e, 0x85, 0x8e, 0x57, 0xa1, 0xe3, 0x55, 0xe8, 0x78,
+    0x15, 0x3a, 0x82, 0x0e, 0xd0, 0x00, 0x29, 0x80, 0x0e, 0xc8, 0x02, 0x0a,
+    0x80, 0x22, 0x80, 0x04, 0xd0, 0x01, 0x1a, 0x20, 0x05, 0xd0, 0x01, 0x59,
+    0x40, 0x01, 0x50, 0x04, 0x90, 0x1b, 0x74, 0x80, 0x06, 0x48, 0x01, 0x74,
+    0x40, 0x16, 0x50, 0x00, 0x14, 0x01, 0x95, 0x3a, 0xd6, 0xd0, 0x60, 0x80,
+    0x75, 0xac, 0x61, 0x3b, 0x5a, 0xfe, 0xb6, 0x60, 0x5b, 0xb6, 0xeb, 0x3f,
+    0x3a, 0xba, 0xd7, 0x03, 0x55, 0x5f, 0x4e, 0xd7, 0x6c, 0xdb, 0x0b, 0x54,
+    0xe5, 0xec, 0xeb, 0x3a, 0xf6, 0x74, 0x1d, 0xfb, 0xb9, 0x8e, 0xbd, 0x5c,
+    0xc7, 0x3e, 0x30, 0x06, 0xe8, 0x80, 0x02, 0x80, 0x04, 0x8c, 0x01, 0x3a,
+    0xa0, 0x00, 0x20, 0x37, 0xc6, 0x00, 0x1d, 0x50, 0x00, 0x90, 0x07, 0x63,
+    0x80, 0x0e, 0x28, 0x00, 0xa8, 0x0a, 0x63, 0x80, 0x0e, 0x28, 0x00, 0xa8,
+    0x1a, 0x63, 0x80, 0x0e, 0x28, 0x00, 0xa8, 0x06, 0x63, 0x80, 0x0e, 0x28,
+    0x00, 0xc8, 0x5b, 0xb6, 0x2f, 0x2d, 0x2d, 0xbb, 0x2b, 0x6c, 0x4f, 0x59,
+    0xdb, 0x7f, 0x40, 0x34, 0xaa, 0x2d, 0x3f, 0x84, 0xcf, 0xaa, 0xf1, 0x1c,
+    0x5d, 0x12, 0x54, 0x17, 0xc6, 0xf0, 0xd5, 0x1c, 0x51, 0x3c, 0x07, 0x3f,
+    0xcc, 0x79, 0xac, 0xb6, 0xe8, 0x66, 0xff, 0x63, 0xba, 0x48, 0xdb, 0x71,
+    0x0f, 0xb6, 0x19, 0xf6, 0x9c, 0x2e, 0x63, 0x15, 0x15, 0xa9, 0x81, 0x0a,
+    0xe4, 0xa2, 0x57, 0x46, 0xe9, 0x92, 0x47, 0x6d, 0x04, 0x9f, 0x18, 0x64,
+    0x03, 0x9e, 0x00, 0xdf, 0x2b, 0xc6, 0xba, 0x8d, 0x67, 0xe8, 0xb6, 0x59,
+    0xb4, 0xec, 0x0a, 0x3d, 0x02, 0xeb, 0x22, 0xd7, 0xe8, 0x96, 0x99, 0xb5,
+    0xc6, 0xa5, 0x7b, 0x5d, 0xba, 0x3f, 0xc7, 0xab, 0xed, 0x3b, 0xc7, 0xfa,
+    0x59, 0xf6, 0x85, 0x7e, 0xe4, 0xc1, 0x7d, 0x81, 0xdc, 0x14, 0xf4, 0x28,
+    0xc7, 0xf3, 0xbd, 0x28, 0xbf, 0xb3, 0x4c, 0xe3, 0x35, 0x6c, 0x3a, 0x7e,
+    0x17, 0x78, 0x8f, 0xb1, 0x28, 0xf6, 0x61, 0x08, 0x94, 0x51, 0xb0, 0xf1,
+    0x40, 0x89, 0x24, 0x5a, 0x63, 0x97, 0x5c, 0x4d, 0xc7, 0xc5, 0x05, 0x9c,
+    0x0b, 0xe7, 0x7f, 0xfc, 0x0e, 0x0f, 0x5d, 0xf0, 0xa8, 0x38, 0xd7, 0x68,
+    0xed, 0x6d, 0x9d, 0x16, 0xff, 0x34, 0x6b, 0xef, 0xaf, 0xfb, 0xa9, 0x4e,
+    0x53, 0xbf, 0x2d, 0x7f, 0xdf, 0x89, 0x13, 0x2c, 0x2f, 0x42, 0x09, 0xc3,
+    0xfc, 0xcc, 0x2d, 0xcb, 0xc1, 0x29, 0x8a, 0xb0, 0xed, 0x24, 0x2d, 0xf7,
+    0x7b, 0xc8, 0xaf, 0x41, 0x8c, 0xfb, 0xc0, 0x4b, 0x75, 0xe8, 0xe7, 0x7e,
+    0xe1, 0x77, 0xf8, 0x6f, 0x56, 0x69, 0xec, 0x3f, 0x9d, 0x98, 0x7f, 0xe3,
+    0x89, 0x69, 0xb9, 0xd4, 0xbf, 0x85, 0x7e, 0x43, 0x8d, 0xc3, 0xe3, 0xe0,
+    0x3c, 0x4f, 0x4e, 0xcb, 0xad, 0xb5, 0x8b, 0x71, 0x22, 0x70, 0xbf, 0xf6,
+    0xda, 0xb8, 0xbf, 0xf6, 0x2d, 0xa6, 0x35, 0x81, 0xd6, 0x5e, 0xb1, 0x46,
+    0x04, 0xb8, 0x72, 0x9b, 0xad, 0x44, 0x1c, 0xac, 0xa6, 0x49, 0x91, 0xf5,
+    0xae, 0x47, 0x5f, 0xa6, 0x49, 0x6b, 0xef, 0x1e, 0x36, 0xc5, 0x05, 0x3e,
+    0xe7, 0x98, 0xe1, 0x66, 0x9f, 0x5e, 0x2f, 0x20, 0x17, 0xc4, 0x0c, 0x6e,
+    0xf5, 0x75, 0xdb, 0x26, 0x0a, 0x8d, 0x89, 0x09, 0x01, 0x78, 0xf6, 0x13,
+    0x2d, 0xe8, 0xa6, 0xaf, 0x4c, 0x3d, 0x60, 0x9a, 0xd3, 0xb2, 0x82, 0x58,
+    0xeb, 0xa2, 0x73, 0xb2, 0x10, 0x39, 0x3b, 0xea, 0xa2, 0x77, 0xe4, 0xc2,
+    0x43, 0xb1, 0x09, 0xc4, 0x67, 0xf9, 0x16, 0xce, 0x66, 0x35, 0x9d, 0xa5,
+    0x4f, 0x5d, 0x3a, 0x35, 0x2a, 0x44, 0xab, 0xe9, 0x3a, 0xfa, 0x29, 0x6a,
+    0x94, 0x58, 0xda, 0xd9, 0xfc, 0x6a, 0x9a, 0xc4, 0x58, 0xc3, 0x7d, 0x12,
+    0x54, 0x2d, 0x16, 0x93, 0x1b, 0x83, 0xec, 0x27, 0x90, 0x2b, 0x0e, 0x8c,
+    0x96, 0xfc, 0x8e, 0x5b, 0x2f, 0xc7, 0x3d, 0xe8, 0x85, 0xf8, 0x6b, 0x14,
+    0xb1, 0x26, 0xcb, 0x0f, 0x22, 0xae, 0xd2, 0xea, 0xe4, 0x04, 0xad, 0x8c,
+    0x4d, 0x54, 0x53, 0x5c, 0x6c, 0xc2, 0xf9, 0x0b, 0xc0, 0xfb, 0x29, 0x1e,
+    0xa8, 0x87, 0x3e, 0x82, 0x73, 0x8f, 0x57, 0xa2, 0x3f, 0x07, 0x7b, 0xb8,
+    0x48, 0x6c, 0x5e, 0x4d, 0x49, 0xc8, 0x23, 0x81, 0xe5, 0x30, 0x5d, 0xa4,
+    0x33, 0x88, 0xdb, 0xd9, 0x7c, 0x93, 0x15, 0x67, 0x4f, 0xcf, 0x05, 0x9d,
+    0x5c, 0x20, 0x41, 0x1e, 0xcb, 0x11, 0x69, 0xb2, 0x95, 0xd7, 0x0d, 0xd2,
+    0xa5, 0x7c, 0x80, 0x2e, 0xe6, 0xc7, 0x49, 0x13, 0x39, 0x9e, 0x93, 0xee,
+    0x56, 0x75, 0xd1, 0x43, 0xfb, 0x37, 0xa7, 0xed, 0x58, 0x0f, 0xbd, 0xbc,
+    0xa4, 0x59, 0x26, 0xe7, 0x75, 0x59, 0x26, 0xeb, 0xc0, 0xeb, 0x62, 0xee,
+    0x1c, 0xe6, 0x5a, 0x71, 0x1c, 0x7a, 0x78, 0xa5, 0x3b, 0x7b, 0x49, 0x1a,
+    0xbc, 0x0f, 0xaa, 0x17, 0xbe, 0x57, 0x05, 0xfd, 0x59, 0xf7, 0xfd, 0xcb,
+    0xe8, 0x5e, 0x4f, 0x62, 0x7b, 0xb9, 0xfe, 0xbb, 0x41, 0xe7, 0xbb, 0x56,
+    0xb9, 0xfe, 0x5b, 0xa5, 0xf5, 0xf5, 0x46, 0xb5, 0x0a, 0xeb, 0x85, 0x74,
+    0x9d, 0xaa, 0x68, 0x2a, 0x20, 0x6d, 0x89, 0x35, 0x6b, 0xd0, 0x91, 0x68,
+    0x17, 0xee, 0x0e, 0x89, 0x93, 0x0f, 0x36, 0x10, 0x3d, 0xe4, 0xa1, 0x90,
+    0x18, 0xb7, 0x74, 0x67, 0xfc, 0x4a, 0xdc, 0x11, 0xc6, 0xb3, 0x4e, 0x0f,
+    0x42, 0x1f, 0x7b, 0x2f, 0x6e, 0xf8, 0x49, 0x3c, 0xc0, 0x7e, 0x54, 0xef,
+    0xe8, 0xc2, 0xf8, 0x47, 0xb0, 0x06, 0x72, 0x59, 0x33, 0x0a, 0x00, 0x31,
+    0x05, 0xdf, 0xe2, 0x39, 0xb7, 0xcc, 0xb8, 0xc8, 0x3c, 0xff, 0x85, 0x9c,
+    0xb9, 0xd2, 0xda, 0x83, 0x1b, 0x36, 0x88, 0x8b, 0x9c, 0xeb, 0x7c, 0xce,
+    0x1a, 0x6e, 0x6b, 0x9e, 0xd0, 0xfc, 0x1f, 0x26, 0x39, 0x3c, 0xb1, 0x56,
+    0xd8, 0x2d, 0xc0, 0x6b, 0xf9, 0xac, 0x18, 0x9a, 0x6e, 0x1d, 0xc7, 0x7a,
+    0x9d, 0xce, 0xbd, 0x62, 0x7e, 0xf6, 0x81, 0x11, 0x17, 0xec, 0xf5, 0x64,
+    0x4c, 0x66, 0x3e, 0xe6, 0x59, 0x41, 0x29, 0xd1, 0xa4, 0xb6, 0x76, 0xbe,
+    0xc2, 0xd2, 0x96, 0xbe, 0xe6, 0x90, 0x9e, 0x84, 0xc9, 0xdc, 0xb3, 0x44,
+    0x69, 0x83, 0xeb, 0x0a, 0xae, 0x3b, 0xd8, 0x3f, 0x57, 0x53, 0xdc, 0xf2,
+    0xb7, 0x1a, 0xc7, 0x5e, 0x2e, 0x6a, 0x83, 0x0d, 0x77, 0x01, 0x27, 0x09,
+    0x82, 0x83, 0x0b, 0x2d, 0x61, 0xc7, 0x92, 0x0f, 0xd4, 0xd1, 0x64, 0x64,
+    0x3f, 0xce, 0x9c, 0x75, 0xf9, 0x00, 0xfe, 0x50, 0x85, 0xbb, 0x12, 0xa1,
+    0x37, 0x71, 0xfe, 0x01, 0x55, 0x82, 0x4f, 0x34, 0xc1, 0x27, 0xd8, 0x0f,
+    0x5b, 0xe1, 0x23, 0x32, 0x5d, 0xce, 0x87, 0x4e, 0xea, 0x14, 0xd2, 0xb3,
+    0x90, 0x37, 0x09, 0x9b, 0xff, 0xa8, 0x99, 0xed, 0xf5, 0x14, 0xc9, 0xa7,
+    0x92, 0xd4, 0x31, 0x4b, 0x7a, 0x83, 0x5a, 0x0d, 0x99, 0xa3, 0x5b, 0xda,
+    0x9a, 0xa9, 0x01, 0xb6, 0x9f, 0x59, 0x23, 0xf8, 0x41, 0xb3, 0x6d, 0xda,
+    0x31, 0xbb, 0x19, 0x72, 0x6e, 0x9b, 0x09, 0xec, 0x6f, 0xba, 0x15, 0xfb,
+    0x98, 0x7d, 0x04, 0x05, 0x82, 0x69, 0x7a, 0x9a, 0x9f, 0x23, 0x8f, 0x7a,
+    0xfc, 0x87, 0xd3, 0xd1, 0x75, 0x92, 0x47, 0xa8, 0x81, 0x60, 0x69, 0xcb,
+    0xab, 0xcd, 0xf4, 0xa3, 0x46, 0x0a, 0x9d, 0x3c, 0x25, 0xd4, 0x51, 0x62,
+    0x96, 0x6e, 0xa4, 0x27, 0xfc, 0x58, 0x37, 0x1c, 0xcc, 0x58, 0x71, 0xe8,
+    0x10, 0xe2, 0x90, 0x44, 0x6e, 0x35, 0x8c, 0x38, 0x74, 0x88, 0xe3, 0x26,
+    0xd6, 0xa2, 0x02, 0x72, 0x6e, 0x70, 0xe0, 0x8e, 0x1d, 0x79, 0xdd, 0x90,
+    0x38, 0x49, 0x77, 0xee, 0x83, 0xc4, 0x0e, 0x77, 0x36, 0xcf, 0xfa, 0xc5,
+    0x24, 0xf6, 0x8b, 0xbb, 0x69, 0x3e, 0x5a, 0x73, 0xca, 0x4d, 0x55, 0x32,
+    0xdf, 0x77, 0x8f, 0xd8, 0x45, 0xa8, 0x7f, 0xa2, 0x5e, 0x0a, 0x9f, 0x6a,
+    0xc1, 0xa9, 0xc9, 0x58, 0x1b, 0xac, 0xb2, 0x27, 0x72, 0x1a, 0xf8, 0x69,
+    0x25, 0x2c, 0xbd, 0x42, 0x2c, 0x1f, 0xb2, 0xe7, 0x6b, 0x69, 0xed, 0x29,
+    0x8f, 0x75, 0x47, 0xd2, 0xb3, 0xcc, 0xf7, 0xa5, 0x99, 0xb2, 0x62, 0x0d,
+    0x6c, 0x36, 0x07, 0x5b, 0xce, 0xc1, 0x6e, 0x73, 0xb0, 0xe5, 0x1c, 0x6c,
+    0x69, 0xdd, 0x3f, 0xc5, 0xa9, 0xaf, 0x4a, 0x71, 0x55, 0xc2, 0x7e, 0xfe,
+    0xe5, 0x65, 0xb7, 0xfa, 0xf7, 0x66, 0x3a, 0xca, 0xb1, 0x15, 0xf5, 0x53,
+    0x0e, 0xf1, 0xd5, 0xe0, 0x18, 0x6b, 0xd5, 0x66, 0x5b, 0x62, 0xa8, 0x99,
+    0x48, 0x54, 0x5c, 0x09, 0x99, 0xe3, 0x7d, 0x1d, 0xf2, 0x93, 0xc8, 0xf5,
+    0x26, 0x0d, 0x1a, 0x74, 0xe3, 0xdc, 0x44, 0x38, 0xf2, 0x06, 0x16, 0x1a,
+    0xcc, 0xdd, 0x42, 0x4e, 0x2c, 0xcf, 0x3b, 0x74, 0xc1, 0x8d, 0xb5, 0x07,
+    0xb0, 0x4e, 0xc6, 0x38, 0x46, 0xf1, 0x39, 0x17, 0xf6, 0x26, 0xc2, 0x7f,
+    0xfc, 0x4e, 0xbe, 0xac, 0x81, 0x8f, 0x21, 0xa7, 0xcb, 0x3c, 0xe6, 0x7d,
+    0xaf, 0x40, 0xfe, 0xfa, 0xd2, 0x74, 0xab, 0xec, 0xa7, 0x26, 0x74, 0x61,
+    0xdf, 0x34, 0xaf, 0xb8, 0x61, 0x0f, 0xb7, 0x6a, 0xbe, 0x9c, 0x96, 0xab,
+    0x30, 0x96, 0x71, 0x9f, 0xbe, 0xc2, 0xf8, 0xb6, 0x69, 0xf3, 0xc8, 0xd2,
+    0x54, 0x49, 0x0e, 0x74, 0xce, 0xe4, 0x4a, 0xb2, 0x39, 0xb6, 0xf0, 0xde,
+    0x38, 0xae, 0x84, 0x4e, 0x4e, 0x92, 0x15, 0x53, 0x28, 0x39, 0x8b, 0xb9,
+    0x32, 0xc7, 0x19, 0x59, 0x77, 0x0b, 0x01, 0xe2, 0x1a, 0xf0, 0x4a, 0x3e,
+    0x34, 0xc3, 0x39, 0x28, 0x39, 0xef, 0xa3, 0x29, 0xb1, 0x08, 0xdc, 0x0a,
+    0xb4, 0x22, 0x71, 0x5d, 0x39, 0x65, 0xdd, 0x29, 0xc9, 0x23, 0xaa, 0x17,
+    0xbd, 0x62, 0xb3, 0x48, 0xc9, 0x9c, 0x68, 0xc5, 0x66, 0xe4, 0xe6, 0x6a,
+    0x1b, 0x17, 0x00, 0xce, 0xef, 0xe0, 0x24, 0x07, 0x57, 0x04, 0xae, 0xda,
+    0xc1, 0xcd, 0xe0, 0xae, 0x85, 0x22, 0x92, 0xc0, 0xf7, 0x2d, 0xa4, 0x90,
+    0xc0, 0x38, 0xd8, 0x70, 0xd6, 0x8b, 0x3b, 0x54, 0x4d, 0xf6, 0x39, 0x99,
+    0x66, 0x4c, 0xfe, 0x6f, 0x53, 0xb3, 0x64, 0xf1, 0x1e, 0xcf, 0x63, 0x4e,
+    0x0d, 0xee, 0x2c, 0xdf, 0x19, 0xc6, 0x9d, 0xaf, 0x58, 0x63, 0xb9, 0xbb,
+    0x74, 0xc3, 0xd9, 0xf3, 0xe8, 0x5e, 0xb7, 0x6a, 0xd7, 0xcb, 0xbc, 0x67,
+    0x9c, 0xe1, 0x4d, 0x41, 0xad, 0x21, 0x9c, 0xdd, 0x05, 0x51, 0xfd, 0x10,
+    0x77, 0x58, 0x86, 0x1f, 0x73, 0x6d, 0xce, 0xb2, 0x3f, 0x41, 0x8e, 0x13,
+    0x11, 0x27, 0x44, 0xaa, 0x9a, 0x2d, 0xe5, 0xb2, 0x0f, 0x21, 0x8f, 0xf1,
+    0x01, 0xe0, 0x03, 0x65, 0xf8, 0x7f, 0x77, 0xf0, 0x45, 0xe0, 0x8b, 0x65,
+    0xf8, 0x4f, 0x81, 0xff, 0x8b, 0xbd, 0xc8, 0x69, 0x7b, 0xd9, 0x27, 0x84,
+    0x79, 0xd6, 0xe1, 0x43, 0x3b, 0x2f, 0x2b, 0xec, 0x8b, 0xfe, 0x9f, 0xb8,
+    0x41, 0x4b, 0xcb, 0xb6, 0x2e, 0x6e, 0xd5, 0xa6, 0x27, 0x0c, 0x3e, 0xbb,
+    0x2f, 0xcd, 0x29, 0xa7, 0x26, 0xe8, 0x32, 0xee, 0xe4, 0xe3, 0x0d, 0x76,
+    0x2e, 0x2d, 0x7f, 0x37, 0x2c, 0xbc, 0x51, 0x3c, 0x6a, 0xa9, 0x9e, 0x79,
+    0x11, 0x39, 0x3b, 0xb9, 0x75, 0x71, 0xde, 0x2d, 0xd5, 0xee, 0xfb, 0xb7,
+    0x26, 0x72, 0x1f, 0x71, 0x1e, 0xbb, 0xcc, 0x63, 0xce, 0x65, 0x97, 0x10,
+    0x3f, 0xae, 0xe4, 0x25, 0xc4, 0x96, 0x26, 0xc4, 0x11, 0xf6, 0x01, 0xb6,
+    0x0f, 0xc7, 0x13, 0x92, 0xa0, 0x17, 0x6a, 0x09, 0xd7, 0x65, 0xb7, 0xea,
+    0x91, 0x06, 0x0c, 0x7e, 0xf7, 0xf0, 0xbb, 0x64, 0xe7, 0x65, 0x11, 0xe7,
+    0xc1, 0x6f, 0x9c, 0x06, 0xe4, 0x6b, 0x9a, 0xff, 0x1c, 0xba, 0x21, 0x5b,
+    0xcb, 0x05, 0x75, 0xcd, 0x2c, 0xe3, 0x5b, 0x11, 0xd7, 0x43, 0xaf, 0x49,
+    0x82, 0x17, 0x7b, 0xfe, 0xdc, 0x89, 0xa7, 0x22, 0x05, 0xac, 0x3e, 0xd3,
+    0x57, 0xd0, 0x9e, 0x46, 0x37, 0xc5, 0x1e, 0xaf, 0x42, 0xdc, 0xc1, 0xbb,
+    0x49, 0x7e, 0x9e, 0xb4, 0x46, 0xab, 0x34, 0x71, 0x72, 0xcf, 0x0a, 0x8a,
+    0x35, 0x7a, 0x80, 0xff, 0x3d, 0xc5, 0x1e, 0xe0, 0xf1, 0x5f, 0x39, 0x78,
+    0x9e, 0xff, 0x3e, 0xe7, 0xfb, 0x95, 0x02, 0xf4, 0x16, 0xe6, 0x57, 0xad,
+    0xe0, 0xdc, 0xea, 0x91, 0xb9, 0x76, 0x28, 0xa8, 0x6b, 0x67, 0x4b, 0x74,
+    0xee, 0xbf, 0x86, 0xfb, 0x15, 0xc5, 0x9d, 0x22, 0x44, 0xb5, 0xe3, 0xa8,
+    0x83, 0x68, 0x53, 0x6c, 0xc2, 0x8a, 0x53, 0x01, 0x81, 0xc2, 0x88, 0x09,
+    0xe5, 0xf3, 0x99, 0xff, 0xe4, 0x7d, 0xf2, 0x4f, 0xdf, 0x27, 0xff, 0xcc,
+    0x7d, 0xf2, 0x1b, 0xf7, 0xc9, 0xff, 0xea, 0x7d, 0xf0, 0xbf, 0xc6, 0xf1,
+    0x02, 0xbe, 0x71, 0xb7, 0x7e, 0x19, 0xc3, 0x34, 0xe3, 0xca, 0x71, 0x9a,
+    0x8e, 0xd2, 0x6a, 0xb8, 0x55, 0x80, 0xd7, 0x98, 0xc2, 0xe9, 0x2c, 0xac,
+    0xc1, 0x36, 0xf6, 0x2d, 0xd2, 0xf1, 0xfe, 0xe6, 0x4c, 0x7f, 0x8d, 0x39,
+    0xfa, 0x1f, 0x38, 0x67, 0x3f, 0xf6, 0xc5, 0x73, 0x96, 0xf3, 0x93, 0x9d,
+    0x97, 0x39, 0xee, 0xc5, 0xe1, 0xc7, 0xf6, 0xfd, 0x0b, 0x52, 0x52, 0xd6,
+    0xa8, 0x01, 0xb5, 0x41, 0x5b, 0x73, 0x90, 0x76, 0xe5, 0x78, 0x5e, 0xc6,
+    0x92, 0x99, 0x5e, 0xb0, 0xc7, 0xa3, 0x71, 0x65, 0xca, 0x91, 0xa9, 0xf9,
+    0x17, 0xcb, 0x24, 0x47, 0xcf, 0x2a, 0x67, 0x8e, 0xf1, 0x35, 0xe6, 0x4c,
+    0x7f, 0x8d, 0x39, 0xfa, 0x7d, 0xcc, 0x99, 0x59, 0x85, 0x7b, 0x4a, 0x0d,
+    0xf3, 0x19, 0xc7, 0x2e, 0x71, 0x6a, 0xb0, 0xc6, 0xa5, 0xf5, 0x4a, 0x7d,
+    0xe6, 0x2b, 0xb7, 0x1b, 0xcf, 0x67, 0x9b, 0xb1, 0xed, 0x6a, 0x31, 0x27,
+    0x53, 0xc6, 0x6b, 0xc7, 0xa5, 0x85, 0x35, 0x4b, 0xf5, 0x12, 0xfb, 0xd4,
+    0x67, 0xce, 0x18, 0xf1, 0x04, 0x79, 0xf5, 0xf2, 0x5d, 0xf1, 0x38, 0xe2,
+    0xc4, 0xa2, 0xd4, 0xd6, 0xb8, 0x51, 0x8a, 0x49, 0x05, 0xbc, 0x01, 0xb9,
+    0xc6, 0xb1, 0x6b, 0x19, 0x8e, 0x43, 0x97, 0x50, 0xdb, 0x5c, 0xcc, 0x47,
+    0xe8, 0x97, 0x88, 0x4b, 0x1c, 0x93, 0x2e, 0xe4, 0x07, 0xf9, 0x1d, 0x82,
+    0xda, 0x87, 0xeb, 0xcb, 0x93, 0x78, 0x77, 0xec, 0xdb, 0xaa, 0xcf, 0x17,
+    0xd4, 0xae, 0x59, 0x99, 0x2e, 0x1a, 0x55, 0xb4, 0xe6, 0xf1, 0x87, 0xb9,
+    0x56, 0x42, 0x0c, 0xb4, 0xeb, 0xe3, 0x06, 0x7a, 0x7d, 0x89, 0xfa, 0x98,
+    0xe9, 0x75, 0x1c, 0x2b, 0x36, 0xd9, 0xef, 0x9e, 0x5a, 0xf4, 0x3f, 0x72,
+    0xfa, 0x9c, 0x97, 0x3e, 0x75, 0xfa, 0xbc, 0x17, 0x71, 0xb3, 0xdd, 0x6f,
+    0xdd, 0xbc, 0x50, 0x13, 0x56, 0x59, 0x71, 0x26, 0x36, 0xcb, 0xe3, 0x04,
+    0xf0, 0xa5, 0xbd, 0x86, 0xf8, 0x4d, 0xa1, 0xaf, 0x52, 0x9f, 0x45, 0x0e,
+    0x88, 0x20, 0x5e, 0xef, 0xdf, 0x3a, 0x30, 0x5b, 0xed, 0xd4, 0x6e, 0x64,
+    0xbd, 0x67, 0xec, 0x7e, 0xed, 0x2d, 0x0d, 0xbc, 0x92, 0xf0, 0x11, 0xea,
+    0x2e, 0x9e, 0xc3, 0x71, 0x34, 0x74, 0x5e, 0x43, 0xdc, 0xe3, 0x77, 0xcf,
+    0x82, 0x9f, 0xea, 0x15, 0xe3, 0x82, 0x9a, 0x98, 0xdd, 0x8b, 0xf7, 0x5b,
+    0x28, 0x92, 0x15, 0x58, 0x7e, 0x37, 0x7c, 0x58, 0x23, 0xf7, 0x7c, 0x0f,
+    0xda, 0x6e, 0xb4, 0x49, 0xb4, 0x49, 0xb4, 0x7b, 0xd0, 0xee, 0x43, 0xbb,
+    0x0f, 0x6d, 0x0a, 0xad, 0x8a, 0xf6, 0x18, 0x5a, 0x0d, 0xad, 0x8e, 0xf6,
+    0x2c, 0x72, 0x0b, 0xc7, 0x72, 0xaf, 0x94, 0xc9, 0x9d, 0x47, 0xbf, 0x0e,
+    0x6d, 0x0e, 0xad, 0x88, 0xf6, 0x02, 0xda, 0x00, 0xda, 0x37, 0x39, 0x76,
+    0x43, 0xc7, 0xa0, 0xc4, 0x75, 0x03, 0xcd, 0xe3, 0xe9, 0x34, 0xbf, 0x11,
+    0x30, 0xea, 0xbc, 0x03, 0xa3, 0xce, 0x3b, 0x92, 0xf5, 0xc0, 0x9b, 0xc1,
+    0x50, 0xb0, 0x6e, 0x02, 0xed, 0x46, 0xb4, 0x0a, 0xe6, 0x8a, 0x5c, 0x0b,
+    0xdf, 0x8c, 0x29, 0x61, 0xd4, 0x23, 0xbc, 0x87, 0x7d, 0x5b, 0x27, 0x67,
+    0xcb, 0xf7, 0x5f, 0x9a, 0xcb, 0x7a, 0x0c, 0x43, 0x66, 0x06, 0x32, 0x47,
+    0xd1, 0x1e, 0x42, 0x9b, 0xc2, 0x7c, 0xce, 0x09, 0x7c, 0x4f, 0xb9, 0xae,
+    0xe7, 0x3a, 0x8b, 0xcf, 0x82, 0xed, 0x19, 0x21, 0x2d, 0xc7, 0x6d, 0x1d,
+    0xe8, 0x5c, 0xbf, 0x79, 0xe8, 0x59, 0xa3, 0x96, 0xa4, 0x55, 0xf0, 0x11,
+    0xd4, 0x71, 0x6f, 0xa2, 0x8e, 0xbb, 0x0c, 0x7f, 0x63, 0x5f, 0xbb, 0x30,
+    0x67, 0xe9, 0x0f, 0x9f, 0xf3, 0x92, 0xe4, 0xe6, 0x9a, 0xae, 0x92, 0x87,
+    0x69, 0x01, 0xc7, 0x1f, 0x99, 0x6e, 0xe5, 0x42, 0x51, 0xcb, 0x79, 0xc5,
+    0xb8, 0xf5, 0x2e, 0x42, 0x9b, 0x2b, 0xbd, 0x0b, 0x5d, 0x97, 0xd9, 0x1f,
+    0xb8, 0xf6, 0x74, 0xcb, 0xd3, 0x0d, 0x27, 0x8c, 0x7a, 0x7a, 0x4f, 0xa9,
+    0xa1, 0x77, 0x03, 0x5c, 0x9b, 0xf0, 0x3b, 0xd3, 0x87, 0x7a, 0x84, 0xe7,
+    0xdf, 0xb0, 0x6a, 0x74, 0x12, 0x39, 0xff, 0xfe, 0xa7, 0x19, 0x0f, 0x94,
+    0xee, 0x04, 0xd3, 0x4a, 0x7e, 0xc2, 0x32, 0x86, 0x1b, 0xe3, 0xc6, 0x28,
+    0x60, 0x1c, 0x70, 0xac, 0x91, 0x7d, 0xd3, 0xce, 0xdf, 0xcc, 0xa7, 0x35,
+    0x6c, 0x33, 0x08, 0x72, 0x64, 0xe5, 0x3a, 0x6a, 0xda, 0xf7, 0xa2, 0x18,
+    0xe7, 0x12, 0xc0, 0xf1, 0x58, 0xc7, 0x18, 0xfd, 0x5c, 0x0f, 0x8f, 0x83,
+    0xd7, 0xe9, 0x9d, 0x47, 0xab, 0xd5, 0xce, 0x4f, 0xde, 0x8b, 0xae, 0x43,
+    0x8d, 0x19, 0xa1, 0x17, 0xa2, 0xdd, 0x88, 0xf9, 0x7e, 0x65, 0x90, 0x40,
+    0xcf, 0x75, 0x83, 0xa7, 0xc8, 0xeb, 0x04, 0x79, 0x9d, 0x74, 0xb4, 0xbb,
+    0x21, 0x9e, 0xd3, 0xa8, 0x5a, 0x96, 0xf8, 0x8d, 0x1a, 0x7c, 0x17, 0x3c,
+    0x71, 0x2b, 0xa7, 0xeb, 0x0d, 0x03, 0x86, 0xc7, 0xc9, 0xe9, 0x2c, 0x1f,
+    0xb5, 0xb5, 0x2d, 0x3f, 0x72, 0x86, 0x7c, 0x74, 0x2e, 0x8a, 0x71, 0x8e,
+    0xf7, 0x1e, 0x45, 0x4b, 0xa0, 0xc9, 0xc1, 0x33, 0xc8, 0xcd, 0xc8, 0x2d,
+    0xb0, 0x4f, 0x13, 0xc6, 0x13, 0x74, 0xc2, 0xb8, 0xe9, 0xf0, 0x73, 0xad,
+    0x0b, 0x5c, 0x2e, 0x00, 0xfc, 0x31, 0x9a, 0xb6, 0x78, 0x39, 0xff, 0x04,
+    0xc0, 0x1b, 0x64, 0xdb, 0x96, 0x7d, 0x4b, 0x45, 0xa5, 0x6f, 0xd5, 0xcb,
+    0x35, 0xa8, 0x27, 0xed, 0xb7, 0x7f, 0x1c, 0x76, 0xe0, 0xfb, 0xca, 0x6f,
+    0xc2, 0xb8, 0xf1, 0xb9, 0x53, 0xa7, 0xdb, 0xef, 0xef, 0x98, 0x9c, 0x88,
+    0xd9, 0xb5, 0xcd, 0xb6, 0x1d, 0x56, 0x4d, 0x63, 0xd5, 0x27, 0x73, 0x7c,
+    0x1f, 0x74, 0xcd, 0x9d, 0x48, 0x78, 0xd4, 0x63, 0xf0, 0x33, 0x1e, 0x53,
+    0x9f, 0x5d, 0xf3, 0x70, 0x0c, 0xe0, 0x78, 0x93, 0xda, 0x3a, 0x90, 0x5b,
+    0xa8, 0x7f, 0xdc, 0xd6, 0x1a, 0x1f, 0xa8, 0x69, 0x6b, 0x0d, 0xc8, 0xc9,
+    0x73, 0xed, 0x1d, 0x40, 0xce, 0xf4, 0xa2, 0xff, 0x6b, 0xe7, 0x8c, 0xac,
+    0x77, 0x31, 0xee, 0x7d, 0x13, 0x70, 0xbb, 0x80, 0xfb, 0xd5, 0xe6, 0xc5,
+    0x75, 0x14, 0xc7, 0xa9, 0x30, 0xd5, 0xe2, 0xdc, 0x6b, 0x64, 0x19, 0x71,
+    0x4a, 0x42, 0x9c, 0x6a, 0xb2, 0xde, 0x61, 0x6f, 0x22, 0x5e, 0x5d, 0xce,
+    0xaf, 0x20, 0x9f, 0x3c, 0x4a, 0x7e, 0xd4, 0xa9, 0xb9, 0x16, 0x85, 0x56,
+    0xc8, 0x61, 0x5a, 0x29, 0x1f, 0xa1, 0x7a, 0xac, 0x19, 0x84, 0x9e, 0x0f,
+    0xc9, 0xfb, 0x10, 0x26, 0x33, 0x88, 0xa7, 0xeb, 0xa9, 0x11, 0x36, 0x38,
+    0xad, 0xd7, 0xd2, 0x0e, 0xb1, 0x99, 0xe2, 0x91, 0x7e, 0xd4, 0xfc, 0x2c,
+    0xff, 0x80, 0xe5, 0xdf, 0x6f, 0xce, 0x3d, 0x47, 0xdb, 0x2d, 0x1b, 0x3c,
+    0x63, 0xd5, 0x3e, 0x7f, 0x99, 0x75, 0x81, 0x77, 0x05, 0x3d, 0x25, 0xbe,
+    0x04, 0xde, 0x1a, 0x87, 0xb7, 0x96, 0x92, 0x56, 0xdb, 0x43, 0xbb, 0x2c,
+    0xde, 0xb5, 0x16, 0xef, 0x35, 0x43, 0xa5, 0x9d, 0xe2, 0xed, 0xcd, 0xee,
+    0x96, 0x6d, 0xf4, 0xac, 0x53, 0x43, 0x5e, 0xc7, 0x39, 0xff, 0x13, 0xde,
+    0xc4, 0xd9, 0x33, 0xf5, 0x74, 0xba, 0xa5, 0x9e, 0x0e, 0x29, 0x3e, 0x0a,
+    0x3c, 0xf6, 0x0c, 0x55, 0x87, 0x15, 0xf2, 0x86, 0xd9, 0x97, 0xfd, 0x4a,
+    0xc0, 0x25, 0x3c, 0xe4, 0xa6, 0x5b, 0x96, 0xed, 0xb7, 0x65, 0xd9, 0x77,
+    0xd7, 0x05, 0x27, 0x5d, 0x44, 0xbd, 0x59, 0x6e, 0x39, 0x5f, 0x96, 0x7c,
+    0xde, 0xfa, 0x56, 0x43, 0x71, 0x14, 0x88, 0x53, 0xd0, 0x6b, 0x9a, 0xcf,
+    0x52, 0xbf, 0x0d, 0x3a, 0xd3, 0x04, 0x3a, 0x27, 0xff, 0x16, 0x6f, 0x90,
+    0x90, 0x92, 0x12, 0x3c, 0xf4, 0x3e, 0x78, 0x3b, 0x3d, 0x2c, 0x97, 0xe8,
+    0x54, 0x76, 0x2d, 0x5e, 0x35, 0xcc, 0x5f, 0x4f, 0x67, 0x5a, 0x1e, 0xa6,
+    0xed, 0x78, 0xe3, 0x15, 0x51, 0xe3, 0xa7, 0x65, 0x3c, 0x2a, 0x48, 0xb1,
+    0xde, 0x4d, 0x03, 0x59, 0xfe, 0x56, 0x23, 0xd2, 0x1b, 0xf9, 0xcf, 0xcc,
+    0x42, 0x80, 0xdf, 0xc8, 0x55, 0x96, 0xac, 0x01, 0xc8, 0x9a, 0xcc, 0xf2,
+    0xdb, 0xda, 0x96, 0x37, 0xa0, 0x7f, 0xc1, 0xef, 0x02, 0xfc, 0xfc, 0xd6,
+    0xdb, 0xfd, 0x9c, 0xcc, 0xfb, 0x66, 0x79, 0xac, 0xb7, 0xcf, 0x8a, 0xfb,
+    0x4b, 0xeb, 0x76, 0xda, 0xd2, 0x8d, 0x5c, 0xf6, 0x1e, 0x66, 0x1d, 0x9e,
+    0xd3, 0xce, 0xfa, 0xd3, 0xf2, 0x4f, 0x4c, 0x7e, 0x9f, 0x9c, 0x43, 0xec,
+    0xb9, 0x8c, 0x98, 0x71, 0x09, 0x31, 0xe3, 0x22, 0x62, 0x86, 0xfd, 0x1d,
+    0x1c, 0xce, 0x9b, 0x2d, 0xc5, 0x8c, 0xe2, 0x57, 0x6f, 0xb7, 0xc8, 0xae,
+    0x73, 0xf9, 0x88, 0xeb, 0x8d, 0x7c, 0x28, 0xa2, 0x93, 0xec, 0x7a, 0xa3,
+    0x05, 0x6f, 0xd5, 0x96, 0x26, 0xd7, 0x95, 0x7c, 0xab, 0xeb, 0x67, 0xf9,
+    0x2b, 0xf0, 0x47, 0x11, 0xb4, 0x8f, 0xf9, 0x9b, 0x99, 0x8d, 0xbf, 0xf3,
+    0x2d, 0x5d, 0x72, 0x2d, 0x7c, 0xef, 0xff, 0xd8, 0xf1, 0xbb, 0x72, 0x1f,
+    0xf3, 0x5b, 0xf1, 0x9f, 0xdf, 0x96, 0xe7, 0x95, 0x90, 0x34, 0x69, 0x7d,
+    0x27, 0xa0, 0xb5, 0x1e, 0xf2, 0x8b, 0xef, 0x83, 0x6f, 0x32, 0xe7, 0xa1,
+    0x9f, 0x29, 0x8c, 0xf3, 0x8b, 0xbf, 0x21, 0x19, 0x63, 0x81, 0xce, 0x38,
+    0xe3, 0xeb, 0x14, 0xc5, 0x38, 0xd4, 0xcd, 0x7e, 0x7c, 0x5a, 0xf1, 0x77,
+    0x5f, 0xa3, 0x04, 0xfd, 0xc0, 0x1a, 0xfb, 0xba, 0xdf, 0x47, 0x8d, 0x54,
+    0xea, 0x5f, 0xa7, 0x10, 0x42, 0x31, 0x7f, 0x43, 0xf6, 0x05, 0xaf, 0x91,
+    0x4f, 0xfb, 0x0d, 0x62, 0xc8, 0x0c, 0xde, 0x70, 0xa7, 0x95, 0x8d, 0xcc,
+    0x83, 0x80, 0xdf, 0x4d, 0x53, 0x39, 0xa6, 0xfb, 0x99, 0xbe, 0xf1, 0x1a,
+    0xf2, 0xf9, 0x39, 0x47, 0xc6, 0xbb, 0xe4, 0x57, 0xaa, 0x28, 0xe0, 0x9a,
+    0xca, 0x05, 0x5d, 0xdf, 0xcf, 0xc9, 0xae, 0xc9, 0x5c, 0xc4, 0x75, 0xe2,
+    0xce, 0xfd, 0xe6, 0xff, 0x25, 0xf8, 0x8d, 0x59, 0xfa, 0x6e, 0xc5, 0x77,
+    0xb5, 0xc9, 0xca, 0xeb, 0xbb, 0x8c, 0x90, 0xce, 0xfb, 0x27, 0xb1, 0x0e,
+    0xbe, 0xcf, 0x7c, 0xfc, 0x5d, 0x89, 0x73, 0x34, 0x7f, 0xbf, 0x6c, 0x45,
+    0xde, 0xdc, 0x07, 0x5b, 0x28, 0x78, 0x43, 0x7f, 0x53, 0x6c, 0x10, 0x3e,
+    0xc3, 0xf9, 0x0a, 0xc1, 0xc6, 0x31, 0xe6, 0xab, 0x7c, 0xd7, 0x05, 0xc1,
+    0xdf, 0x04, 0x7e, 0x09, 0xbc, 0x98, 0x63, 0x7d, 0x77, 0xf2, 0x38, 0xff,
+    0x87, 0xf0, 0x1b, 0x85, 0x73, 0x88, 0x75, 0xc7, 0x11, 0x6b, 0x32, 0x5b,
+    0x63, 0x06, 0xc7, 0x68, 0xb6, 0xef, 0xf7, 0x9c, 0xef, 0xbc, 0xd5, 0xce,
+    0x98, 0xef, 0x39, 0xdf, 0x71, 0x8f, 0xba, 0x90, 0xcb, 0x2b, 0xff, 0x8f,
+    0x39, 0x77, 0xe7, 0xfd, 0xf2, 0xac, 0xf3, 0xed, 0x57, 0x5a, 0x92, 0x1e,
+    0xfc, 0x5f, 0xe8, 0xd2, 0x32, 0x74, 0xb6, 0x0f, 0xf3, 0xf0, 0x7f, 0x48,
+    0xb2, 0xc3, 0x83, 0xda, 0x40, 0xb0, 0xeb, 0x25, 0x9b, 0x97, 0xed, 0xd9,
+    0xe4, 0xac, 0xc5, 0xdf, 0x43, 0x22, 0xe0, 0x43, 0x6b, 0xd9, 0x85, 0x79,
+    0x4a, 0xdf, 0x0c, 0xb9, 0x66, 0x0a, 0x38, 0xf6, 0x66, 0x5e, 0xfe, 0x06,
+    0xc7, 0x7e, 0x1e, 0x9a, 0xd1, 0xe0, 0x27, 0x6b, 0x66, 0x39, 0xff, 0xb2,
+    0xcd, 0x11, 0x71, 0x27, 0xbf, 0x30, 0xf5, 0x80, 0x6d, 0xd7, 0x85, 0x5c,
+    0xc8, 0xeb, 0x98, 0x26, 0x39, 0xdf, 0xec, 0x59, 0xe6, 0xa5, 0xfc, 0x6b,
+    0xd4, 0xa8, 0xea, 0x3f, 0xee, 0x7b, 0xb2, 0x54, 0x87, 0xc9, 0xd6, 0x37,
+    0xc9, 0x8b, 0x79, 0x5e, 0xdb, 0x45, 0xbb, 0x9b, 0xd7, 0xcd, 0xac, 0x12,
+    0x42, 0xa2, 0x26, 0xf8, 0x71, 0x66, 0x2c, 0x27, 0x24, 0x69, 0xd4, 0x84,
+    0xfa, 0x66, 0xad, 0xde, 0x20, 0x7c, 0x6e, 0xd2, 0x03, 0x4c, 0xe7, 0xba,
+    0x70, 0xa9, 0xdc, 0x1b, 0x71, 0xec, 0xc0, 0x36, 0x60, 0x5b, 0x58, 0xba,
+    0x62, 0x5d, 0xae, 0x29, 0x6f, 0xb8, 0x3d, 0xc8, 0xb9, 0x62, 0xf3, 0x6d,
+    0xac, 0x51, 0xf9, 0xe6, 0x6d, 0x87, 0x7e, 0xca, 0x51, 0xbb, 0xbc, 0x7a,
+    0x8a, 0x6d, 0xfb, 0xb4, 0xdd, 0x1f, 0xe1, 0x5a, 0xec, 0x09, 0xbb, 0x7f,
+    0x02, 0xf0, 0x37, 0xeb, 0xec, 0xfe, 0x8f, 0xf9, 0xfc, 0x5a, 0xec, 0xfe,
+    0xfb, 0x1c, 0x2f, 0xbf, 0x61, 0xf7, 0x5b, 0x11, 0xdd, 0x66, 0x56, 0xd9,
+    0xfd, 0x7d, 0x02, 0xd1, 0x3b, 0xb5, 0xa2, 0xf3, 0x09, 0x9e, 0xe8, 0x77,
+    0x1e, 0xbb, 0xef, 0xad, 0x21, 0xd2, 0xdc, 0x76, 0x3f, 0x85, 0x82, 0xf1,
+    0x25, 0xc1, 0xee, 0x17, 0xf0, 0x62, 0xdd, 0xe8, 0x72, 0xfe, 0xae, 0x09,
+    0x13, 0xbd, 0xee, 0xfc, 0x75, 0xc3, 0x0a, 0x3d, 0x5d, 0xea, 0x43, 0x70,
+    0x4b, 0xa9, 0xff, 0xaf, 0x44, 0x0f, 0x97, 0xfa, 0xd7, 0x5c, 0xc8, 0xa3,
+    0x4e, 0x7f, 0xda, 0x0d, 0x7f, 0x6c, 0xa0, 0x3e, 0xc1, 0x16, 0xe6, 0x76,
+    0xfa, 0xd2, 0x4f, 0xb9, 0xef, 0xf0, 0xfc, 0x1d, 0x5e, 0xea, 0x98, 0xf1,
+    0x09, 0xff, 0xc9, 0x20, 0xae, 0x24, 0x01, 0x7d, 0xeb, 0x1f, 0x81, 0x18,
+    0xaa, 0x94, 0x52, 0x39, 0xfe, 0x2a, 0x7f, 0x3f, 0x0d, 0xd0, 0x17, 0x2b,
+    0xa1, 0xe7, 0xbf, 0x3d, 0xc0, 0xe7, 0x6c, 0xeb, 0x36, 0xfd, 0x08, 0xfa,
+    0xce, 0xdf, 0x1b, 0xe1, 0x66, 0xf4, 0x6b, 0xe9, 0x97, 0x28, 0x76, 0x0b,
+    0xef, 0xad, 0x47, 0xdf, 0xfa, 0xfb, 0x95, 0x8a, 0x07, 0x9f, 0x40, 0xbf,
+    0x9a, 0x3e, 0xf3, 0x73, 0x52, 0xd9, 0x62, 0xf5, 0xad, 0x2f, 0x0f, 0x7d,
+    0x7d, 0x3b, 0xfb, 0xa4, 0xae, 0x64, 0x5c, 0x0a, 0x1f, 0xf3, 0x61, 0xbc,
+    0x67, 0xe8, 0xc5, 0xc1, 0x31, 0x69, 0x68, 0x64, 0x68, 0xdc, 0x47, 0xc9,
+    0x9e, 0x1e, 0xa7, 0x87, 0x08, 0xdb, 0xf3, 0xd4, 0x9d, 0xfe, 0xee, 0x44,
+    0x5f, 0x67, 0xaf, 0x33, 0x1a, 0x3b, 0x3a, 0x22, 0x1d, 0x19, 0x3f, 0x30,
+    0x36, 0xde, 0x26, 0xbd, 0x30, 0x34, 0xf6, 0xe2, 0x77, 0x0e, 0x8c, 0x0d,
+    0xa2, 0x33, 0x32, 0x74, 0xe4, 0xd0, 0x60, 0x86, 0x79, 0xbf, 0x73, 0x60,
+    0x68, 0x5c, 0x4a, 0x0f, 0xff, 0xa9, 0x14, 0xce, 0x48, 0xe3, 0x58, 0xfb,
+    0xf0, 0x51, 0x6b, 0x09, 0x4a, 0x24, 0xfa, 0x2c, 0xf4, 0x91, 0xb1, 0xb4,
+    0x34, 0x38, 0x36, 0x16, 0x0a, 0x85, 0x7c, 0x74, 0x17, 0x02, 0xbf, 0xd1,
+    0xe1, 0x61, 0x69, 0x6c, 0xf0, 0xe0, 0x73, 0xca, 0xb1, 0xf0, 0xb1, 0xe7,
+    0xa5, 0x91, 0xc3, 0xe3, 0x18, 0xa5, 0x0f, 0x1f, 0x84, 0x80, 0x41, 0x8b,
+    0x61, 0x31, 0xfd, 0xcf, 0x0e, 0x0c, 0x3b, 0xbd, 0x23, 0x83, 0xe3, 0xe3,
+    0x43, 0x23, 0x07, 0x4b, 0x32, 0x2d, 0xde, 0x78, 0xb2, 0xb3, 0x1f, 0x90,
+    0x8c, 0xf7, 0x6d, 0xb2, 0x36, 0x1b, 0x4f, 0xf6, 0x62, 0xdc, 0x5b, 0x31,
+    0xfe, 0x56, 0xc5, 0x38, 0x5e, 0x1a, 0xd2, 0xc8, 0x81, 0x17, 0x07, 0x6b,
+    0x6b, 0x25, 0xeb, 0xb7, 0x45, 0x0a, 0x1f, 0x61, 0xdc, 0x50, 0xa6, 0x0c,
+    0x03, 0xae, 0xf1, 0xef, 0x8e, 0x0e, 0x2e, 0xc6, 0x10, 0xbd, 0x30, 0x36,
+    0xf8, 0x52, 0x25, 0x0e, 0xfb, 0x8f, 0xf7, 0xc7, 0xb7, 0x6d, 0xef, 0xff,
+    0x56, 0x67, 0xcf, 0xde, 0x2e, 0x49, 0x2a, 0xa7, 0xda, 0xb4, 0x3d, 0x7d,
+    0x3d, 0x8b, 0x88, 0x65, 0xb4, 0x44, 0x4f, 0x6f, 0xdf, 0xb2, 0xb4, 0x44,
+    0x4f, 0x72, 0x39, 0x5a, 0x6f, 0x6f, 0x67, 0x52, 0x29, 0x27, 0x56, 0xd0,
+    0xda, 0x96, 0xa1, 0xf5, 0x75, 0x6d, 0x8b, 0x3f, 0xbd, 0xa7, 0x8c, 0x58,
+    0x46, 0xdb, 0xb3, 0xa3, 0x77, 0xc7, 0xd3, 0xdb, 0xcb, 0x66, 0xde, 0x45,
+    0x6b, 0xbf, 0x07, 0xad, 0xe3, 0x1e, 0xb4, 0xe8, 0x3d, 0x68, 0x4f, 0x2c,
+    0x49, 0xeb, 0xdc, 0xbb, 0x67, 0xe7, 0xee, 0xbe, 0xfe, 0x05, 0x5d, 0xef,
+    0xa6, 0x75, 0x3d, 0x5d, 0x9a, 0x59, 0x46, 0xeb, 0xee, 0xeb, 0xda, 0x9e,
+    0xec, 0xdb, 0xb9, 0xe4, 0x9a, 0xc9, 0x7b, 0xd0, 0xe2, 0xdb, 0xf7, 0xc6,
+    0x97, 0xb3, 0x27, 0xd3, 0x96, 0xb6, 0x67, 0xb2, 0xbf, 0xb7, 0xab, 0x77,
+    0xf1, 0xd1, 0x97, 0xd1, 0xe2, 0x8b, 0x4f, 0x7d, 0x31, 0xed, 0x99, 0x9e,
+    0x65, 0xfc, 0xa5, 0xbf, 0xb7, 0x4f, 0x59, 0x6e, 0x1e, 0x68, 0x6d, 0xf7,
+    0xa0, 0xb5, 0xdf, 0x83, 0xd6, 0x71, 0xaf, 0x35, 0x95, 0xe5, 0x75, 0x69,
+    0x6b, 0x5b, 0x9e, 0xf6, 0x64, 0xc7, 0x72, 0xb4, 0x78, 0xf7, 0x8e, 0x64,
+    0xbf, 0xd2, 0xbf, 0x7b, 0xc7, 0xb7, 0xbb, 0x96, 0xa6, 0xb5, 0xdd, 0x4d,
+    0xeb, 0xeb, 0x62, 0xc7, 0xed, 0xef, 0xec, 0xeb, 0xeb, 0x7c, 0xf6, 0xb9,
+    0x70, 0xe6, 0xf9, 0xd2, 0x05, 0xc3, 0x9c, 0x4d, 0xb8, 0xa2, 0x12, 0xdf,
+    0x47, 0x69, 0xe8, 0x88, 0xb4, 0x49, 0x02, 0xa6, 0xc3, 0xb7, 0x04, 0xbe,
+    0x27, 0x09, 0x5c, 0x29, 0x26, 0x2d, 0x45, 0x6b, 0xf7, 0x2d, 0x4f, 0xeb,
+    0x58, 0x9a, 0x66, 0xcf, 0x3a, 0x3a, 0x72, 0xe4, 0xe8, 0xe8, 0xe8, 0xe1,
+    0xb1, 0x71, 0x29, 0x93, 0x19, 0xb3, 0xa8, 0x76, 0x4c, 0x6b, 0x92, 0x48,
+    0xbf, 0x1f, 0x78, 0xeb, 0x51, 0x54, 0x31, 0x68, 0x5f, 0x43, 0x9b, 0x05,
+    0xfc, 0xea, 0x9b, 0xa4, 0xbf, 0x03, 0xf8, 0x00, 0xf0, 0x31, 0xe0, 0x06,
+    0x60, 0xef, 0xfa, 0xd8, 0xe1, 0xc3, 0xe3, 0xa8, 0xf5, 0xec, 0x8e, 0xb4,
+    0x3b, 0xd9, 0x23, 0xb5, 0x2b, 0x6d, 0x1d, 0x8f, 0x2b, 0x1b, 0xd6, 0x2b,
+    0x8a, 0xd2, 0xd1, 0xbe, 0xfe, 0xe0, 0x86, 0xcc, 0x86, 0x3f, 0x4e, 0x67,
+    0x06, 0xd7, 0x67, 0x86, 0xc6, 0xc6, 0xbf, 0x2b, 0x45, 0x12, 0x83, 0x69,
+    0xa9, 0x2d, 0x0a, 0xa6, 0xf6, 0x0e, 0x69, 0xbd, 0xd4, 0xb6, 0x61, 0x53,
+    0x7b, 0x74, 0x53, 0x74, 0xe3, 0x63, 0xd0, 0x30, 0x32, 0x72, 0x74, 0x78,
+    0xf8, 0x31, 0xc4, 0xbf, 0x03, 0x23, 0x1c, 0x70, 0x11, 0xce, 0x33, 0x52,
+    0xfa, 0xf0, 0xc8, 0x91, 0xc3, 0xc3, 0x83, 0x3e, 0xfb, 0x9b, 0x3d, 0x2a,
+    0x88, 0xff, 0x67, 0xbf, 0x3f, 0xf9, 0xf3, 0xfe, 0x23, 0x83, 0x63, 0x43,
+    0x07, 0x86, 0x9d, 0xf1, 0xf4, 0x43, 0x64, 0xfd, 0x39, 0x9f, 0x0c, 0x92,
+    0xbe, 0x07, 0xfd, 0x9b, 0x68, 0x3d, 0x68, 0x5f, 0xed, 0xb0, 0xf1, 0xad,
+    0x28, 0x21, 0xbe, 0x42, 0x0a, 0xff, 0x46, 0xd3, 0x6a, 0xce, 0xd8, 0xfa,
+    0x5b, 0x0b, 0xe3, 0x95, 0x4c, 0xdf, 0xb3, 0x98, 0xae, 0x65, 0x16, 0xc6,
+    0x9c, 0xb4, 0xf5, 0x43, 0x15, 0xf4, 0xe1, 0x8a, 0xf1, 0x68, 0xc5, 0x7a,
+    0xa9, 0x0a, 0xfa, 0xc9, 0x0a, 0xba, 0x5e, 0x31, 0xce, 0x55, 0xf0, 0x9f,
+    0xaf, 0x18, 0xff, 0x5f, 0xdb, 0xd7, 0x08, 0xdb, 0x76, 0x33, 0xff, 0xc0,
+    0xdf, 0xff, 0x00, 0x74, 0x48, 0xc6, 0xbb,
+};
+
+const firmware_blob_t firmware_blob_00a13d16d567453d = {
+    blob_00a13d16d567453d_z, sizeof(blob_00a13d16d567453d_z), 9856, 0xc3318ba7
+};
@@ -0,0 +1,478 @@
+/**
+ * Embedded Firmware blob 059f775304941425
+ * Used by: t40 SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 12032 bytes, 5548 compressed
+static const uint8_t blob_059f775304941425_z[] = {
+    0x78, 0xda, 0xdd, 0x5a, 0x6b, 0x6c, 0x1c, 0xd7, 0x75, 0x3e, 0x3b, 0x33,
+    0x24, 0x97, 0x0f, 0x91, 0xb3, 0xd4, 0x58, 0x59, 0x5b, 0x4c, 0x32, 0x6b,
+    0x0d, 0xa9, 0x75, 0x44, 0x19, 0x4b, 0x89, 0x92, 0x29, 0x65, 0xdd, 0x8e,
+    0xf6, 0x41, 0x49, 0x35, 0x25, 0xad, 0x69, 0x39, 0xa6, 0x63, 0x1b, 0x7c,
+    0xec, 0xae, 0x25, 0xb6, 0x34, 0xc9, 0x90, 0x74, 0x2d, 0xa7, 0x44, 0x3d,
+    0x26, 0x69, 0x87, 0x69, 0x37, 0x24, 0x63, 0x08, 0x81, 0x10, 0x38, 0xc0,
+    0x56, 0x0f, 0xc7, 0x2d, 0xa6, 0xa4, 0x2c, 0xa9, 0x40, 0x7e, 0x38, 0xf0,
+    0xca, 0x52, 0x62, 0xb5, 0x75, 0x11, 0xa1, 0xd5, 0x0f, 0xfd, 0x30, 0x5a,
+    0x36, 0x69, 0x6b, 0xfd, 0x70, 0x61, 0x17, 0x70, 0x63, 0xa5, 0x96, 0xbd,
+    0xfd, 0xce, 0x3c, 0xc4, 0xe1, 0x52, 0x54, 0x23, 0xff, 0x28, 0x8a, 0x12,
+    0x38, 0x38, 0xaf, 0xfb, 0x38, 0xf7, 0xcc, 0xb9, 0xe7, 0x9e, 0x7b, 0x97,
+    0xea, 0x19, 0x7f, 0x74, 0xb1, 0xce, 0xbf, 0x8d, 0xa8, 0xf2, 0x7b, 0x41,
+    0xba, 0x8f, 0xf1, 0x5f, 0xea, 0xe4, 0x8f, 0x4a, 0x37, 0x20, 0xeb, 0x99,
+    0xd6, 0xe9, 0xb0, 0x5f, 0x37, 0xa8, 0x32, 0xda, 0xa8, 0x57, 0xfa, 0xe8,
+    0xf0, 0xb4, 0xde, 0x59, 0x41, 0x7e, 0xc2, 0xdf, 0x11, 0x8a, 0xcd, 0xae,
+    0x21, 0x49, 0x0b, 0x85, 0x89, 0x14, 0xda, 0x93, 0x23, 0x43, 0x88, 0x1a,
+    0x3b, 0x62, 0x9a, 0x4c, 0xe5, 0x5a, 0x28, 0x48, 0x54, 0x43, 0x95, 0x5a,
+    0x28, 0xa5, 0xd3, 0x57, 0xa8, 0x42, 0x23, 0x7a, 0x28, 0xe7, 0xa7, 0xea,
+    0xbb, 0xb8, 0x9f, 0x10, 0xee, 0x1f, 0x0e, 0xa9, 0x7f, 0x41, 0x12, 0xbd,
+    0x0c, 0xd9, 0x4b, 0x39, 0x89, 0x12, 0x47, 0x49, 0xfb, 0xf9, 0x78, 0xb1,
+    0xee, 0x54, 0xc4, 0x47, 0x69, 0xed, 0xe3, 0xe2, 0x21, 0xa5, 0x86, 0x62,
+    0x1a, 0x19, 0x15, 0xd1, 0x7c, 0xe2, 0x97, 0x39, 0x21, 0x26, 0x61, 0xac,
+    0xf8, 0x5c, 0x91, 0xd2, 0x11, 0x83, 0xd2, 0xad, 0xa0, 0xf3, 0x12, 0xed,
+    0xc9, 0x13, 0x25, 0xf2, 0xac, 0x7f, 0x01, 0x72, 0x96, 0x69, 0xd4, 0x9e,
+    0x0f, 0x53, 0xf2, 0xa4, 0x9f, 0x16, 0x45, 0x9e, 0x87, 0xed, 0xc9, 0x27,
+    0x62, 0x39, 0x85, 0x62, 0x73, 0x2c, 0xf3, 0x51, 0x2c, 0x72, 0xad, 0xf8,
+    0xd3, 0x8d, 0x55, 0x24, 0xc0, 0xc6, 0xd3, 0x0b, 0xea, 0x94, 0x34, 0x2e,
+    0x92, 0xb0, 0x4e, 0xa1, 0xb7, 0x16, 0x02, 0xb5, 0x54, 0xc3, 0x6b, 0xb1,
+    0xfb, 0xc4, 0x73, 0x44, 0xc3, 0x18, 0x3b, 0x91, 0xeb, 0x41, 0x5b, 0x85,
+    0x26, 0xe7, 0x7a, 0x30, 0xc7, 0x67, 0xc5, 0x3e, 0x05, 0x6d, 0x67, 0xd1,
+    0x77, 0x96, 0xc7, 0x0b, 0xd2, 0x4f, 0x37, 0xf2, 0x78, 0xdc, 0xbf, 0x12,
+    0xfd, 0x79, 0xca, 0xcf, 0x8a, 0xba, 0xbc, 0x34, 0xef, 0x5b, 0xb3, 0x84,
+    0xb9, 0xb9, 0x1d, 0xb7, 0x2f, 0x62, 0x7e, 0xf6, 0x99, 0xdb, 0x47, 0xa6,
+    0x78, 0xae, 0x9a, 0x84, 0x68, 0x04, 0x6b, 0x0d, 0xc9, 0x7d, 0x44, 0x6b,
+    0x05, 0xfa, 0xb0, 0x28, 0x5a, 0xb6, 0x49, 0xa4, 0xe7, 0xfd, 0x58, 0xd3,
+    0x0d, 0xf0, 0x2a, 0xb0, 0x48, 0x22, 0x6c, 0x93, 0xa3, 0xbc, 0x4e, 0x1f,
+    0xe6, 0xca, 0x27, 0x84, 0x79, 0xc0, 0xcc, 0x97, 0x20, 0xe7, 0x76, 0x7f,
+    0x8e, 0x76, 0x0d, 0xc0, 0xae, 0x7d, 0x21, 0x99, 0xc8, 0xb5, 0x91, 0xed,
+    0x61, 0x7a, 0x38, 0xc9, 0x3e, 0x95, 0xa2, 0xfc, 0x6d, 0x48, 0x9e, 0xd2,
+    0xf0, 0xd9, 0x60, 0x6b, 0x59, 0x6b, 0x63, 0x24, 0x0e, 0x41, 0xe1, 0x4d,
+    0x15, 0xa0, 0x03, 0x7a, 0x00, 0x06, 0x20, 0x0f, 0x28, 0x00, 0x16, 0x01,
+    0xe4, 0x83, 0x1e, 0xa0, 0x03, 0x7a, 0x00, 0x06, 0x20, 0x0f, 0x28, 0x00,
+    0x16, 0x01, 0x24, 0x40, 0x0f, 0xd0, 0x01, 0x3d, 0x00, 0x03, 0x90, 0x07,
+    0x14, 0x00, 0x8b, 0x00, 0x12, 0xa1, 0x07, 0xe8, 0x80, 0x1e, 0x80, 0x01,
+    0xc8, 0x03, 0x0a, 0x80, 0x45, 0x00, 0x49, 0x31, 0xed, 0x1f, 0x8b, 0x09,
+    0xc5, 0xb2, 0x45, 0x4e, 0x6b, 0xcd, 0x94, 0x95, 0xd9, 0x9f, 0x57, 0x8b,
+    0x64, 0xf9, 0xd3, 0xb6, 0xf1, 0x3c, 0x6c, 0x3c, 0x0f, 0x1b, 0xcf, 0xc3,
+    0xc6, 0xf3, 0xb0, 0xf1, 0x3c, 0x6c, 0x3c, 0x0f, 0x1b, 0xcf, 0xc3, 0xc6,
+    0xf3, 0xb0, 0x11, 0x7a, 0x80, 0x0e, 0xe8, 0x01, 0x18, 0x80, 0x3c, 0xa0,
+    0x00, 0x58, 0x04, 0x90, 0x00, 0x3d, 0x40, 0x07, 0xf4, 0x00, 0x0c, 0x40,
+    0x1e, 0x50, 0x00, 0x2c, 0x02, 0x48, 0x84, 0x1e, 0xa0, 0x03, 0x7a, 0x00,
+    0x06, 0x20, 0x0f, 0x28, 0x00, 0x16, 0x01, 0xa5, 0x36, 0x56, 0x50, 0x56,
+    0x61, 0x1b, 0x2b, 0xd8, 0x8f, 0x56, 0xbc, 0x2d, 0xf9, 0x96, 0xfd, 0xfa,
+    0xf7, 0x8e, 0xed, 0x75, 0x10, 0xd5, 0x79, 0xf5, 0xba, 0xed, 0x7b, 0x81,
+    0xca, 0x9c, 0x75, 0x5d, 0xc0, 0x9a, 0x2e, 0x60, 0x3d, 0x17, 0xb0, 0x96,
+    0x0b, 0x58, 0x07, 0x78, 0x80, 0x01, 0x28, 0x00, 0x48, 0x00, 0x0f, 0x30,
+    0x00, 0x05, 0x00, 0x89, 0xe0, 0x01, 0x06, 0xa0, 0x00, 0x20, 0x09, 0x3c,
+    0xc0, 0x00, 0x14, 0x00, 0x54, 0x06, 0x1e, 0x60, 0x00, 0x0a, 0x00, 0x2a,
+    0x07, 0x0f, 0x30, 0x00, 0x05, 0x00, 0x55, 0x80, 0x07, 0x18, 0x80, 0x02,
+    0x80, 0xfc, 0x9e, 0x75, 0xe9, 0x69, 0x4d, 0x2c, 0xf1, 0x3d, 0xe5, 0xed,
+    0xf8, 0x81, 0x32, 0x57, 0x6e, 0xc5, 0xa1, 0x10, 0x3d, 0x9d, 0x88, 0x9b,
+    0x74, 0x46, 0x88, 0xfa, 0xc0, 0x23, 0x56, 0x4d, 0xa2, 0xb8, 0x89, 0x38,
+    0x34, 0x25, 0x0b, 0x2f, 0x8a, 0x1c, 0x7f, 0xac, 0x97, 0x69, 0x37, 0xf6,
+    0x41, 0x7b, 0xce, 0xee, 0x93, 0xcc, 0xad, 0xa5, 0x45, 0x0a, 0x50, 0x81,
+    0x7c, 0xf4, 0xd2, 0x30, 0x9d, 0x91, 0xa2, 0xf5, 0x68, 0x27, 0x07, 0xd9,
+    0x81, 0x2f, 0xa3, 0xdd, 0x4b, 0xb9, 0x4d, 0x6d, 0x27, 0xe8, 0x46, 0x71,
+    0xd1, 0xf2, 0x2b, 0xec, 0x50, 0x36, 0x85, 0xdf, 0xa6, 0xeb, 0xc5, 0xbc,
+    0xc5, 0xdf, 0xdc, 0xd7, 0xa7, 0x85, 0x28, 0xf6, 0x04, 0x72, 0x47, 0xba,
+    0x15, 0xd8, 0xbc, 0x48, 0x89, 0x5c, 0xf1, 0x43, 0x51, 0xd3, 0x82, 0x93,
+    0x74, 0x11, 0xbc, 0x0a, 0xfe, 0x93, 0xa2, 0xcd, 0xab, 0x8e, 0x3d, 0xdc,
+    0xcd, 0xdd, 0x77, 0x7f, 0x54, 0x6e, 0xef, 0x55, 0x5e, 0x97, 0xf5, 0x5d,
+    0xb0, 0x2e, 0x92, 0xb0, 0xcf, 0x60, 0x6f, 0x0f, 0xda, 0x7b, 0xe5, 0xbc,
+    0x9f, 0xdc, 0x7d, 0xa4, 0x4f, 0x8b, 0x51, 0xdf, 0x5a, 0x21, 0xfa, 0x3b,
+    0xf0, 0x51, 0xb3, 0x8a, 0x76, 0x45, 0x31, 0xfa, 0x77, 0xc8, 0x57, 0xac,
+    0x6f, 0x63, 0x1e, 0x6b, 0x74, 0xe7, 0x78, 0xaf, 0x86, 0x6a, 0x0a, 0x89,
+    0x6f, 0x6a, 0xef, 0xac, 0x71, 0xe6, 0x82, 0xcd, 0x61, 0xb6, 0xf3, 0x13,
+    0xdb, 0xae, 0x30, 0xfb, 0x4a, 0xd5, 0xcd, 0x0f, 0xb0, 0x8e, 0x0a, 0xac,
+    0xe3, 0x92, 0x9f, 0x6a, 0x40, 0x9b, 0xff, 0x5e, 0xe3, 0xb4, 0xff, 0xa8,
+    0x4c, 0xe7, 0x78, 0x79, 0x11, 0xfd, 0xaf, 0xed, 0x9c, 0xd2, 0x5c, 0xfa,
+    0x3a, 0xe8, 0xea, 0x0a, 0xa7, 0x8d, 0x23, 0x93, 0xbe, 0x3e, 0xa5, 0x45,
+    0x2a, 0x97, 0xcb, 0x64, 0xc8, 0xde, 0xf0, 0x2f, 0x97, 0x35, 0x40, 0x76,
+    0xbc, 0xca, 0x96, 0xfd, 0x9e, 0x33, 0xc6, 0x4e, 0x07, 0x37, 0x97, 0x8c,
+    0x19, 0x46, 0x5b, 0xef, 0xda, 0xeb, 0x90, 0x07, 0xab, 0x68, 0x42, 0xbe,
+    0x8e, 0xf5, 0x05, 0x40, 0x57, 0x83, 0xe6, 0x35, 0xd5, 0x82, 0x5e, 0x4f,
+    0x13, 0x0a, 0xd3, 0x32, 0xc5, 0x72, 0xbc, 0x17, 0x84, 0x46, 0xc1, 0x5a,
+    0x2f, 0xf2, 0x6e, 0x4e, 0x74, 0xf8, 0x2e, 0xd0, 0x8c, 0x83, 0x88, 0x17,
+    0x41, 0x9d, 0x1c, 0x36, 0x36, 0xc5, 0xc7, 0xd7, 0xd3, 0x24, 0x7d, 0xec,
+    0xeb, 0x21, 0xaa, 0x8f, 0x8f, 0x17, 0xea, 0x63, 0xe3, 0xf5, 0x61, 0x36,
+    0xe0, 0xd4, 0x82, 0x20, 0xf7, 0x0d, 0xaf, 0xa7, 0xe3, 0xd0, 0xe9, 0xd8,
+    0x37, 0x42, 0x54, 0x8f, 0xc5, 0xb4, 0x7a, 0xc4, 0x88, 0xc0, 0x63, 0x41,
+    0xe7, 0xe6, 0x36, 0x3f, 0xe7, 0x36, 0xcc, 0x83, 0x1c, 0x9b, 0x5b, 0x84,
+    0x5d, 0x1c, 0x8b, 0x41, 0xe4, 0x4e, 0x5a, 0x9f, 0x1a, 0xa7, 0xda, 0xd8,
+    0x78, 0x39, 0xc5, 0xe5, 0x06, 0x7c, 0x0b, 0x01, 0xf2, 0x6a, 0x8a, 0x2b,
+    0x75, 0xc8, 0xef, 0x82, 0xb3, 0x57, 0x6b, 0x41, 0x7f, 0x17, 0x6b, 0xf6,
+    0x91, 0xdc, 0xb4, 0x9e, 0x52, 0x98, 0x8b, 0x04, 0x77, 0x0e, 0x99, 0x4e,
+    0x20, 0x37, 0xe7, 0x17, 0x1a, 0xac, 0x5c, 0x7a, 0x7c, 0x36, 0xe8, 0xe4,
+    0x7b, 0x15, 0xf3, 0xf1, 0x3c, 0x32, 0x4d, 0x34, 0xf3, 0xb8, 0x41, 0x3a,
+    0xb3, 0xa0, 0xd0, 0x1b, 0x0b, 0xcf, 0x93, 0x2e, 0x73, 0xce, 0x26, 0x43,
+    0x8c, 0x1a, 0xb2, 0x44, 0x57, 0xe3, 0x69, 0x3b, 0x9f, 0xc3, 0x2e, 0x3f,
+    0xe9, 0x96, 0x5b, 0x79, 0x5c, 0x9e, 0x93, 0x6d, 0xe0, 0x71, 0xd1, 0x77,
+    0x16, 0x7d, 0xad, 0x5c, 0x0d, 0x3b, 0xfc, 0xea, 0xcd, 0xb5, 0xa4, 0x72,
+    0xbc, 0x0e, 0xaa, 0x13, 0xfe, 0xb8, 0x0c, 0xf6, 0xb3, 0xed, 0xbd, 0xab,
+    0xd8, 0x5e, 0x47, 0xf2, 0x16, 0xaf, 0xfd, 0x5d, 0xd0, 0xf3, 0x7e, 0x2a,
+    0x1d, 0x7f, 0xc1, 0x1d, 0xdf, 0xa8, 0x8f, 0xf2, 0xfe, 0x0d, 0x19, 0x06,
+    0x95, 0xd1, 0xa4, 0x92, 0x4f, 0xc6, 0x9a, 0x52, 0xb0, 0x91, 0xe8, 0x61,
+    0xc4, 0x39, 0xc9, 0x13, 0x5f, 0x0a, 0x10, 0xdd, 0x2d, 0x51, 0x48, 0x8e,
+    0x5b, 0xb6, 0xb3, 0xbc, 0x96, 0x0c, 0x85, 0xe5, 0xb6, 0x6f, 0xe3, 0xb2,
+    0xbd, 0x16, 0x51, 0x83, 0x6f, 0x15, 0x8e, 0x95, 0x3a, 0xc7, 0x16, 0x96,
+    0x6f, 0xc0, 0x18, 0x9f, 0x16, 0xc5, 0xa6, 0x7b, 0x80, 0xc7, 0x11, 0x3f,
+    0xdc, 0xe7, 0x7a, 0x31, 0x2e, 0x73, 0x9b, 0x5f, 0xe3, 0x5c, 0xac, 0xb5,
+    0xd6, 0x20, 0x61, 0xbf, 0x24, 0xac, 0x76, 0x22, 0xe8, 0x5a, 0x4a, 0x58,
+    0xe3, 0xf8, 0xad, 0x7c, 0x98, 0x6e, 0xfe, 0xa0, 0x48, 0x4e, 0xbb, 0x74,
+    0x73, 0x2d, 0xf5, 0xc8, 0xfc, 0xad, 0xdf, 0x87, 0x2c, 0x60, 0xf5, 0xeb,
+    0x51, 0x18, 0xff, 0xaa, 0x68, 0xfb, 0x61, 0x0e, 0x73, 0xbc, 0xe8, 0xec,
+    0x2f, 0x8e, 0x33, 0x6e, 0x3b, 0xe8, 0x83, 0x0f, 0xb7, 0xc7, 0x34, 0x1e,
+    0x9f, 0xc7, 0x58, 0x83, 0x31, 0x8a, 0xd4, 0xb2, 0x85, 0x5e, 0xc4, 0x17,
+    0x4d, 0x76, 0x36, 0x85, 0x8c, 0x14, 0xdc, 0x28, 0xce, 0x10, 0xa5, 0x73,
+    0x5c, 0x4f, 0x70, 0xbd, 0xa1, 0x07, 0x45, 0x5a, 0x4f, 0x71, 0x2b, 0x16,
+    0x2b, 0x1c, 0x1f, 0xfa, 0xa8, 0x05, 0x7e, 0x7d, 0x18, 0x32, 0x55, 0x10,
+    0x1c, 0x59, 0xe8, 0x16, 0xbe, 0x75, 0xe3, 0xa2, 0x86, 0x26, 0xc2, 0x4f,
+    0x22, 0x0e, 0xd8, 0x96, 0xcb, 0x88, 0x91, 0x72, 0xec, 0x8b, 0x30, 0x9d,
+    0x43, 0x4c, 0x28, 0xc8, 0x55, 0x67, 0x10, 0x4b, 0x6f, 0x2c, 0x70, 0x6c,
+    0x36, 0x23, 0x6e, 0x34, 0x3a, 0xbb, 0x10, 0x9a, 0x33, 0x28, 0x64, 0xe4,
+    0x31, 0xdf, 0x04, 0xbe, 0xc3, 0xf7, 0x9b, 0xd8, 0x87, 0x4f, 0x90, 0xf6,
+    0x4a, 0x0f, 0x6d, 0x9d, 0x21, 0x23, 0x80, 0xef, 0x84, 0x35, 0xb6, 0xb7,
+    0x34, 0x51, 0x00, 0xdf, 0x63, 0xfa, 0x5e, 0xa1, 0x1a, 0x3a, 0xdb, 0xcf,
+    0x5b, 0x67, 0xbe, 0x8e, 0x79, 0x3e, 0x2d, 0x26, 0xb0, 0xbe, 0xa9, 0x66,
+    0xac, 0x63, 0xe6, 0x2b, 0x28, 0x0c, 0x8a, 0x45, 0xa9, 0xe9, 0x09, 0xc2,
+    0xde, 0xfd, 0xde, 0x54, 0xeb, 0x26, 0x55, 0x12, 0x2a, 0x30, 0x71, 0x3e,
+    0x79, 0xb4, 0x89, 0xbe, 0x5f, 0x4f, 0xa1, 0xb9, 0x57, 0x84, 0x1a, 0x4a,
+    0xcc, 0xd0, 0xb5, 0xf4, 0x78, 0x35, 0xc6, 0x6d, 0x0c, 0x66, 0xac, 0xfd,
+    0x79, 0x18, 0xf9, 0x48, 0x25, 0x31, 0xda, 0x88, 0x7c, 0x74, 0x98, 0xf3,
+    0x1e, 0xc6, 0xa2, 0x02, 0xce, 0xda, 0x60, 0xdf, 0x4d, 0x3f, 0xf2, 0xb8,
+    0x21, 0x79, 0x82, 0x6e, 0xee, 0x11, 0x95, 0x0d, 0x3b, 0xb9, 0xc0, 0xf6,
+    0xc5, 0x54, 0x8e, 0x95, 0x95, 0xba, 0x2a, 0xba, 0xf7, 0x15, 0x91, 0xca,
+    0xd0, 0x77, 0x4a, 0x93, 0xe4, 0x24, 0xa1, 0xee, 0x69, 0xf5, 0x53, 0xe3,
+    0x2b, 0x1b, 0xf1, 0x85, 0x35, 0x8c, 0x8d, 0xa6, 0x9a, 0x14, 0x3e, 0x0e,
+    0xf9, 0x54, 0xa4, 0x51, 0x7d, 0x89, 0x78, 0x7e, 0xcc, 0x3d, 0x5f, 0x49,
+    0x1b, 0x5e, 0x91, 0xac, 0x7d, 0x93, 0x9e, 0xe1, 0x76, 0x9f, 0x15, 0x7b,
+    0xac, 0xbc, 0x0f, 0x9f, 0xcd, 0xc2, 0x97, 0xb3, 0xf0, 0xdb, 0x2c, 0x7c,
+    0x39, 0x0b, 0x5f, 0x5a, 0x7b, 0x32, 0xe2, 0xd4, 0x55, 0x4b, 0x67, 0x42,
+    0x22, 0xf7, 0x4f, 0x2f, 0x88, 0xd1, 0x5f, 0x14, 0xd3, 0xad, 0x6e, 0xee,
+    0x47, 0x9e, 0xcd, 0x71, 0xae, 0xb5, 0x6a, 0x32, 0xd4, 0x3f, 0x1c, 0x67,
+    0x11, 0x5f, 0x02, 0xf5, 0x68, 0x3c, 0x57, 0x83, 0x73, 0x49, 0xe6, 0x3a,
+    0x93, 0xb2, 0x39, 0xba, 0x76, 0x6a, 0xbc, 0x31, 0xfc, 0x1a, 0x06, 0xca,
+    0x9a, 0xd7, 0x71, 0x16, 0x2e, 0x3f, 0x6f, 0x44, 0x8c, 0xdd, 0x87, 0x71,
+    0x32, 0xb9, 0x23, 0x14, 0x9f, 0xf5, 0x61, 0x6d, 0x32, 0xe2, 0xa7, 0xda,
+    0x39, 0x27, 0x2b, 0x10, 0x63, 0x38, 0xcb, 0x35, 0xe6, 0x79, 0xdd, 0x6b,
+    0x70, 0x6e, 0x7d, 0x86, 0xb3, 0xa1, 0x0a, 0x73, 0x15, 0x61, 0x0b, 0xc7,
+    0x66, 0xf1, 0x2d, 0x11, 0xfe, 0x10, 0xa3, 0xc5, 0x17, 0xd2, 0x5a, 0x19,
+    0x78, 0x0d, 0x7b, 0xec, 0x73, 0xf0, 0x37, 0x8a, 0x76, 0x1b, 0x4d, 0x9d,
+    0x74, 0xe7, 0x81, 0xcd, 0x99, 0x9b, 0x67, 0x16, 0xe7, 0x1b, 0x5e, 0x1b,
+    0xe7, 0x9a, 0xd0, 0xdc, 0x04, 0x71, 0xbe, 0xc1, 0xbe, 0x9c, 0xf9, 0xdc,
+    0xa9, 0x13, 0xb5, 0xe9, 0x0d, 0x82, 0x42, 0x5c, 0xfb, 0xbd, 0xb5, 0xc0,
+    0xfb, 0x1a, 0xba, 0xf9, 0x7a, 0x9a, 0x94, 0xef, 0xa2, 0xc9, 0xe6, 0x72,
+    0xd8, 0xd5, 0x45, 0xdc, 0x4e, 0x44, 0x8e, 0x9e, 0xb4, 0xf6, 0x19, 0xc7,
+    0xb7, 0x5e, 0x1e, 0x88, 0x72, 0x9b, 0x45, 0xc8, 0xef, 0x72, 0xe4, 0x6c,
+    0xab, 0x2a, 0x06, 0xa2, 0xbe, 0xc7, 0x5b, 0x9a, 0x64, 0x7a, 0xd8, 0xe4,
+    0x7c, 0xe0, 0xe3, 0xdc, 0x5b, 0x6e, 0xcb, 0x14, 0xc8, 0xea, 0x1c, 0x99,
+    0xaf, 0xb7, 0xa5, 0x69, 0x11, 0x7c, 0xb5, 0xc3, 0x5b, 0xfd, 0x20, 0xeb,
+    0x82, 0xac, 0xdc, 0x91, 0x9d, 0xc4, 0xde, 0xc4, 0xbd, 0x40, 0xe0, 0xfd,
+    0x19, 0x8a, 0xa8, 0x02, 0xcb, 0xe0, 0xf3, 0x19, 0x9c, 0xd9, 0x11, 0xd8,
+    0x65, 0xf9, 0xb7, 0x58, 0x8c, 0x69, 0xff, 0x55, 0xd4, 0xad, 0xf9, 0xd9,
+    0x27, 0x17, 0xd1, 0xa7, 0x82, 0x74, 0x85, 0xf7, 0x18, 0xcb, 0x2e, 0x96,
+    0x8c, 0xb1, 0xda, 0xde, 0xbb, 0xe6, 0xf8, 0x68, 0xf8, 0x51, 0x31, 0x6a,
+    0xd7, 0xd5, 0xc8, 0xc5, 0xfc, 0xcd, 0x3f, 0x12, 0xb0, 0x5e, 0x7c, 0xeb,
+    0xd3, 0x72, 0xf4, 0x0a, 0xf6, 0xbc, 0x86, 0xb8, 0xe7, 0x1a, 0x9e, 0xe7,
+    0x7e, 0x1f, 0x67, 0xa3, 0x8c, 0x5c, 0x22, 0x53, 0xd9, 0x8c, 0x7b, 0xe6,
+    0x7d, 0x84, 0xf9, 0x58, 0xae, 0x40, 0xae, 0x78, 0xe4, 0x14, 0xb5, 0xe5,
+    0x8b, 0x90, 0x2f, 0x7a, 0xe4, 0xb2, 0x23, 0xef, 0x82, 0xbc, 0xcb, 0x23,
+    0x57, 0x21, 0x7f, 0xee, 0x51, 0x9c, 0x87, 0x5b, 0x39, 0xb6, 0x84, 0x79,
+    0xb6, 0xed, 0x8a, 0x7d, 0xce, 0x47, 0x38, 0xa6, 0x2b, 0x7e, 0x28, 0x42,
+    0x97, 0xd6, 0x6c, 0x1b, 0xc5, 0xa8, 0xad, 0x4f, 0xe4, 0x38, 0x06, 0x3e,
+    0x2b, 0x4e, 0x5a, 0xf6, 0x11, 0x25, 0x73, 0xee, 0x78, 0x91, 0xa8, 0x7d,
+    0x16, 0x7b, 0xef, 0x1d, 0x4b, 0x77, 0x1c, 0xe9, 0x66, 0xcd, 0xf1, 0x1c,
+    0x6a, 0x80, 0xcb, 0xed, 0xcb, 0xcf, 0x6d, 0xb7, 0xf6, 0x7f, 0xaf, 0x3d,
+    0x61, 0x5e, 0xe5, 0x33, 0xf2, 0xac, 0x1b, 0x4b, 0x88, 0x15, 0xd5, 0xa9,
+    0x93, 0x38, 0x27, 0x59, 0xfb, 0xe5, 0x1c, 0xf2, 0xd4, 0x59, 0xeb, 0x4c,
+    0xb3, 0x7c, 0x88, 0x9a, 0xc6, 0x77, 0x56, 0x8c, 0x4a, 0x6a, 0x5f, 0x8e,
+    0xef, 0x4e, 0x7c, 0xb7, 0x39, 0x70, 0x56, 0xc6, 0x39, 0x2f, 0xce, 0xbc,
+    0x50, 0x14, 0xa2, 0xf8, 0x7e, 0xad, 0x1a, 0xf6, 0xab, 0x8c, 0x35, 0x7e,
+    0xec, 0x93, 0xb4, 0x1d, 0x7c, 0x07, 0x42, 0xee, 0xd2, 0x93, 0xf7, 0xce,
+    0x08, 0xa4, 0x68, 0x2c, 0x6b, 0xc6, 0x39, 0x12, 0x3a, 0xa6, 0x0a, 0x7e,
+    0xb4, 0x91, 0x49, 0x99, 0xdf, 0xe1, 0xdc, 0x93, 0xd6, 0xd0, 0xc1, 0x7a,
+    0x91, 0x62, 0xf7, 0x97, 0x21, 0x97, 0xe1, 0x0e, 0xa6, 0x3d, 0x45, 0x7a,
+    0xbd, 0x55, 0xf6, 0x38, 0x67, 0xdc, 0x1a, 0x8a, 0xd5, 0x4b, 0x90, 0x7f,
+    0x40, 0xb1, 0x75, 0xcc, 0xff, 0xa9, 0x23, 0xe7, 0xfe, 0x97, 0xe0, 0x6f,
+    0x5f, 0xad, 0x80, 0xf3, 0x48, 0x98, 0x7f, 0xa4, 0x96, 0xcf, 0x70, 0x09,
+    0x35, 0x28, 0xe2, 0x3a, 0xb9, 0x61, 0xc6, 0xd5, 0x33, 0x7d, 0x0c, 0x7b,
+    0xb6, 0x15, 0xfb, 0x94, 0x90, 0x29, 0x5f, 0x44, 0x8d, 0x45, 0x3b, 0x63,
+    0xe3, 0x56, 0xee, 0x53, 0x04, 0x6a, 0x84, 0xdd, 0xde, 0xfe, 0xdc, 0x7e,
+    0xee, 0x0e, 0xdb, 0x4f, 0xdd, 0x61, 0xfb, 0xe9, 0x3b, 0x6c, 0x9f, 0xbb,
+    0xc3, 0xf6, 0x47, 0xef, 0xa0, 0xfd, 0x31, 0xce, 0x41, 0x88, 0x93, 0x95,
+    0xf6, 0x65, 0x72, 0xc5, 0x62, 0x3c, 0xf2, 0x22, 0x4d, 0xb5, 0xd2, 0x7a,
+    0x84, 0x98, 0xc2, 0x63, 0x4c, 0xe2, 0xeb, 0x2c, 0x8d, 0xc1, 0x3e, 0xae,
+    0x5a, 0x66, 0xe3, 0x9d, 0xf5, 0x99, 0xfa, 0x02, 0x7d, 0x8c, 0xdf, 0xb2,
+    0xcf, 0x93, 0x58, 0x17, 0xf7, 0x59, 0x2d, 0x4e, 0x0e, 0x58, 0xf1, 0x1f,
+    0x47, 0x3c, 0xdb, 0x7b, 0x31, 0x48, 0x29, 0x4d, 0xa7, 0x40, 0x54, 0xc4,
+    0x79, 0x1f, 0x44, 0xfe, 0xe2, 0x7e, 0x19, 0x6b, 0xce, 0xf4, 0x92, 0x3f,
+    0xbe, 0x1a, 0x8f, 0x4c, 0x3a, 0x73, 0xea, 0xd5, 0xcb, 0xe7, 0x24, 0xc7,
+    0xce, 0x32, 0xa7, 0x4f, 0xee, 0x0b, 0xf4, 0x99, 0xfa, 0x02, 0x7d, 0x8c,
+    0x3b, 0xe8, 0x33, 0xbd, 0x56, 0x42, 0xae, 0x09, 0xcc, 0x67, 0x1c, 0xbf,
+    0xc4, 0x29, 0x60, 0xf1, 0xee, 0x78, 0x2e, 0xcd, 0xed, 0xbc, 0x7e, 0xe3,
+    0xfe, 0xec, 0x33, 0xf6, 0x5d, 0x25, 0xfa, 0x64, 0x3c, 0x6d, 0xed, 0x1c,
+    0xb5, 0x34, 0xa6, 0x5b, 0x83, 0x71, 0x4c, 0x3d, 0xe0, 0xf0, 0xc8, 0x27,
+    0x38, 0xab, 0xcf, 0xae, 0xc8, 0xd9, 0x61, 0x27, 0x2f, 0x2d, 0xb6, 0xc7,
+    0x73, 0x6e, 0x7e, 0xd2, 0x93, 0x71, 0x2b, 0x3f, 0x71, 0x2e, 0xe2, 0x3c,
+    0xe4, 0xd6, 0xd6, 0x9c, 0x8f, 0x38, 0x17, 0x0d, 0xf1, 0xfd, 0x06, 0xb5,
+    0x14, 0xd7, 0xb0, 0x3f, 0xc2, 0x1d, 0xe6, 0x6a, 0xbb, 0x31, 0xaf, 0x27,
+    0x93, 0x33, 0x1a, 0xbd, 0x91, 0x2b, 0xa3, 0x7b, 0xef, 0xbf, 0x87, 0x6b,
+    0x2f, 0xe4, 0x42, 0xbb, 0x06, 0x0f, 0x50, 0x30, 0xb1, 0xb2, 0x06, 0x67,
+    0x3d, 0x0c, 0x93, 0x3f, 0xf8, 0x5d, 0xfb, 0x3e, 0x55, 0x09, 0x5a, 0xd2,
+    0x6d, 0x9a, 0xcf, 0x2d, 0xd5, 0xa1, 0x79, 0x1d, 0x51, 0x87, 0xee, 0xd2,
+    0x97, 0x6a, 0xcc, 0x32, 0x2b, 0xc7, 0xc4, 0x66, 0x98, 0x1f, 0x86, 0xdc,
+    0x5d, 0x67, 0x48, 0xe5, 0xb1, 0xd7, 0x46, 0x1f, 0xc6, 0x59, 0x10, 0x46,
+    0xde, 0x7e, 0xaf, 0xbd, 0x6f, 0x06, 0xe7, 0x98, 0x6c, 0xc9, 0x31, 0xbf,
+    0xe4, 0xd4, 0x85, 0x95, 0xd7, 0x75, 0xb4, 0x55, 0x05, 0x96, 0xff, 0x2d,
+    0x6a, 0x39, 0xce, 0xa5, 0x73, 0xc4, 0xf7, 0xa6, 0xa5, 0xf8, 0x9c, 0xaf,
+    0xa6, 0x1a, 0x3d, 0x99, 0x98, 0xe1, 0x1c, 0xfb, 0x61, 0x49, 0x8e, 0x75,
+    0xdb, 0x9c, 0x74, 0xee, 0x88, 0x6c, 0xcb, 0x1e, 0xc4, 0xb2, 0x4e, 0xe2,
+    0x7c, 0x07, 0xf0, 0x1e, 0xe0, 0x14, 0x70, 0x0a, 0xf8, 0x20, 0x30, 0xce,
+    0xfe, 0xf9, 0x2e, 0xe0, 0x1e, 0xe0, 0x28, 0xf0, 0x11, 0x60, 0x1d, 0xd8,
+    0x00, 0x3e, 0x89, 0xf3, 0x86, 0x73, 0xbb, 0x5f, 0xcd, 0x98, 0xaf, 0x83,
+    0xae, 0x01, 0x36, 0x81, 0x65, 0xe0, 0xd3, 0xc0, 0x0a, 0xf0, 0x39, 0xce,
+    0xdd, 0xb0, 0x37, 0xa8, 0x72, 0x4d, 0x42, 0xf3, 0x11, 0x40, 0x1b, 0xe0,
+    0xdb, 0xce, 0x5d, 0x73, 0x57, 0xf5, 0x92, 0x1d, 0x4f, 0x62, 0xdc, 0x08,
+    0xc6, 0x4d, 0x00, 0xb7, 0x01, 0x47, 0xd0, 0x97, 0xd7, 0x40, 0x1f, 0xc5,
+    0x22, 0x8d, 0xa8, 0x75, 0xd8, 0xfe, 0xab, 0xed, 0x13, 0x33, 0xa2, 0xc7,
+    0x17, 0x6e, 0x5f, 0xb6, 0x63, 0x00, 0x73, 0x66, 0x30, 0xe7, 0x30, 0xf0,
+    0x61, 0xe0, 0x1e, 0xf4, 0xe7, 0xb3, 0x81, 0xf7, 0x2b, 0xdf, 0x23, 0xb8,
+    0x86, 0xe3, 0xef, 0xc2, 0xbe, 0x0d, 0x93, 0x6e, 0x32, 0xae, 0x86, 0x9e,
+    0xe3, 0x4d, 0xa2, 0xc7, 0xf1, 0x8d, 0xd5, 0xb5, 0xde, 0x78, 0xb3, 0xde,
+    0xc0, 0x60, 0x3b, 0xc7, 0x1d, 0x74, 0x56, 0xcc, 0xdd, 0x2e, 0x1e, 0xf9,
+    0x5c, 0xf4, 0xcb, 0xf1, 0x9c, 0x7b, 0x96, 0x22, 0x3f, 0xb4, 0x72, 0xdc,
+    0x41, 0x66, 0xba, 0x77, 0x50, 0xb6, 0xb3, 0x8e, 0xca, 0x51, 0xc7, 0x95,
+    0x69, 0x35, 0x81, 0x43, 0xb9, 0x3a, 0x7a, 0x3f, 0x52, 0x46, 0xff, 0xa6,
+    0xd4, 0x04, 0x32, 0xb8, 0xc7, 0xe8, 0x8a, 0x0f, 0xdf, 0xb3, 0xdc, 0x39,
+    0xa7, 0xb8, 0xb6, 0xf9, 0x75, 0x31, 0x69, 0xc9, 0x6e, 0xbe, 0x0f, 0xd1,
+    0x4b, 0x37, 0xcf, 0xf4, 0x44, 0x6c, 0x29, 0x7e, 0xfc, 0xb2, 0x88, 0x7a,
+    0x4e, 0xd0, 0xf8, 0x3b, 0xfb, 0x65, 0x61, 0xfe, 0x72, 0x40, 0x98, 0xb9,
+    0x12, 0x10, 0x67, 0xe6, 0xea, 0xa5, 0x99, 0xa3, 0x80, 0xb0, 0x8c, 0xda,
+    0x22, 0x90, 0x1e, 0xa7, 0x40, 0x6c, 0xfc, 0x3f, 0x8a, 0x92, 0xa6, 0xa9,
+    0x27, 0x69, 0x53, 0xb8, 0x8f, 0xaa, 0xe4, 0x2c, 0xf6, 0x5c, 0x4c, 0xd3,
+    0x65, 0xde, 0xef, 0x09, 0x0a, 0xa3, 0xaf, 0x24, 0x0b, 0x56, 0x1d, 0xf2,
+    0x1e, 0xe2, 0x53, 0x47, 0xdd, 0x0d, 0x7e, 0xde, 0x8d, 0xdf, 0xcb, 0x81,
+    0xa5, 0x1a, 0x25, 0x83, 0xf9, 0xaf, 0x78, 0x78, 0x03, 0xfc, 0x5c, 0xfd,
+    0x12, 0xff, 0x2a, 0xf8, 0xa3, 0x1e, 0xfe, 0x27, 0xe0, 0xbb, 0x3c, 0xed,
+    0xaf, 0x80, 0x3f, 0xe6, 0xe1, 0x3f, 0x02, 0x1f, 0xf4, 0xb4, 0xaf, 0x89,
+    0xa3, 0xbd, 0x87, 0x0f, 0x83, 0xef, 0xf1, 0xb4, 0x4f, 0x80, 0xcf, 0x7b,
+    0xf8, 0x1e, 0xf0, 0xaa, 0xa7, 0xfd, 0x38, 0xb7, 0xf7, 0xf0, 0xc7, 0xe2,
+    0x2b, 0x6b, 0x20, 0xfe, 0x66, 0xe3, 0x72, 0x32, 0xf7, 0x11, 0x6a, 0x98,
+    0x3a, 0x3a, 0xd5, 0x0a, 0xda, 0x94, 0xe4, 0xf6, 0x1c, 0xe1, 0xfb, 0x68,
+    0xe1, 0x9f, 0xc1, 0xe9, 0xa7, 0xb0, 0xfe, 0xa4, 0xd9, 0x80, 0x36, 0xe3,
+    0xf4, 0x72, 0x4e, 0x0b, 0x9f, 0x20, 0xae, 0xf1, 0xc1, 0x9b, 0x0a, 0x64,
+    0x47, 0x3c, 0x32, 0xf0, 0x66, 0x10, 0x32, 0x2d, 0x78, 0x82, 0x82, 0xf8,
+    0xe6, 0x85, 0xfa, 0x64, 0x6e, 0x91, 0x6b, 0x23, 0xe8, 0x79, 0x6c, 0xf0,
+    0xe6, 0x45, 0xc8, 0x5c, 0x1e, 0xb4, 0x79, 0xc9, 0xe1, 0x03, 0xe0, 0x41,
+    0x9b, 0xef, 0x7a, 0x78, 0xd0, 0x26, 0xad, 0xb5, 0x79, 0x11, 0x3c, 0x68,
+    0x53, 0xf2, 0xf0, 0xa0, 0x4d, 0xdd, 0xc3, 0x83, 0x36, 0x13, 0x1e, 0x1e,
+    0xb4, 0x69, 0x78, 0x78, 0xd0, 0xe6, 0x94, 0x87, 0x07, 0x6d, 0x16, 0x3c,
+    0x3c, 0x68, 0xf3, 0xa2, 0x87, 0x07, 0x6d, 0xfa, 0xd7, 0x2e, 0xd9, 0x03,
+    0xda, 0xac, 0xf1, 0xf0, 0xa0, 0xcd, 0x3d, 0x1e, 0x1e, 0xb4, 0xd9, 0xe1,
+    0xe1, 0x41, 0x9b, 0xd3, 0x1e, 0x1e, 0xb4, 0x99, 0xf3, 0xf0, 0xa0, 0xcd,
+    0x4b, 0x1e, 0x1e, 0xb4, 0xf9, 0xee, 0x5a, 0xdb, 0x7f, 0x01, 0xec, 0x9d,
+    0x77, 0xd7, 0xc6, 0xcd, 0x1a, 0xdc, 0x85, 0x78, 0xef, 0x1e, 0x84, 0x6f,
+    0xbb, 0xe0, 0xd3, 0x54, 0x20, 0x69, 0xce, 0x01, 0x64, 0xf8, 0x26, 0x05,
+    0x38, 0x18, 0x88, 0x9b, 0x47, 0x01, 0x4a, 0x7d, 0xdc, 0x3c, 0x08, 0xd0,
+    0x68, 0x32, 0xc7, 0x77, 0x16, 0x52, 0x92, 0xa8, 0xe7, 0x24, 0xed, 0x39,
+    0xca, 0x58, 0x77, 0x83, 0x07, 0xb1, 0x7f, 0xca, 0xb0, 0xef, 0xfc, 0x80,
+    0x71, 0x85, 0x6b, 0xea, 0xd7, 0x4c, 0x89, 0x4e, 0x81, 0x97, 0xb4, 0x1b,
+    0xc5, 0xe3, 0x0a, 0xef, 0xcb, 0x2e, 0x85, 0xef, 0x4c, 0xe5, 0xda, 0x93,
+    0xc0, 0x06, 0xc3, 0xba, 0x8c, 0x39, 0x05, 0x3c, 0x05, 0x3c, 0x0d, 0x3c,
+    0x0d, 0x9c, 0x03, 0xce, 0x01, 0xcf, 0x01, 0xcf, 0x01, 0x1f, 0x05, 0x3e,
+    0x0a, 0x7c, 0x0c, 0xf8, 0x18, 0xf0, 0xab, 0xc0, 0xaf, 0x02, 0xe7, 0x81,
+    0xf3, 0xc0, 0x26, 0xb0, 0x09, 0x7c, 0x1a, 0xf8, 0x34, 0xf0, 0x39, 0xe0,
+    0x73, 0xc0, 0x3f, 0x01, 0xfe, 0x09, 0xf0, 0x9b, 0xc0, 0x6f, 0x02, 0x17,
+    0x80, 0x0b, 0xc0, 0x17, 0x81, 0x2f, 0x02, 0x5f, 0x02, 0xbe, 0x04, 0xfc,
+    0x2e, 0xf0, 0xbb, 0xc0, 0xa4, 0x64, 0x34, 0x5d, 0xe1, 0x7a, 0xff, 0x65,
+    0xd8, 0x3d, 0x05, 0xbb, 0xcb, 0x60, 0xf7, 0xa4, 0xc2, 0xf1, 0xdb, 0xa5,
+    0x24, 0xcd, 0x27, 0x01, 0x9c, 0x7b, 0xf8, 0x3d, 0x93, 0xf3, 0x8d, 0x5b,
+    0xdb, 0x7b, 0xd7, 0x5a, 0xe6, 0x59, 0xab, 0x80, 0xba, 0xf8, 0xff, 0xda,
+    0x1a, 0x4f, 0x2a, 0x7d, 0xe6, 0xc9, 0x75, 0x7d, 0xe6, 0xeb, 0xc0, 0xaf,
+    0x03, 0x5f, 0x06, 0xbe, 0x0c, 0x7c, 0x05, 0xf8, 0x0a, 0xb0, 0x5f, 0xee,
+    0xc3, 0xfa, 0x62, 0x58, 0x5f, 0xdf, 0x8a, 0xf7, 0xd8, 0xd2, 0xf3, 0x94,
+    0xfd, 0x62, 0xc8, 0x09, 0xec, 0x63, 0xec, 0x3f, 0xdc, 0x89, 0x64, 0xd4,
+    0x37, 0xe0, 0xcd, 0x29, 0xd9, 0xbe, 0x23, 0xdd, 0x03, 0x1e, 0xb4, 0x39,
+    0xed, 0xf0, 0xf0, 0x69, 0xeb, 0xb4, 0xab, 0x47, 0xfd, 0x13, 0x84, 0x1f,
+    0xa7, 0x96, 0xe5, 0x6d, 0x09, 0xe7, 0xa8, 0xa8, 0xf9, 0x03, 0x2f, 0xc1,
+    0x86, 0x53, 0x91, 0x0a, 0xca, 0xcb, 0x9c, 0x9f, 0x71, 0xa7, 0xc1, 0x5d,
+    0x5d, 0x57, 0x5c, 0x5b, 0xf8, 0x7c, 0x67, 0x7b, 0xfe, 0xb3, 0x18, 0x5f,
+    0x7e, 0xff, 0x77, 0x72, 0xd0, 0xb9, 0xb8, 0x27, 0x67, 0x7b, 0x7e, 0x63,
+    0x22, 0x39, 0x66, 0xbd, 0x27, 0x54, 0xe0, 0x4e, 0xcd, 0x22, 0xc9, 0x7e,
+    0x9b, 0xd6, 0xec, 0x77, 0xb4, 0x78, 0xee, 0x37, 0xce, 0x3b, 0x86, 0xfd,
+    0x66, 0x19, 0xd3, 0x12, 0x31, 0xfb, 0xce, 0xd6, 0xbe, 0xd7, 0xca, 0x69,
+    0x56, 0x7d, 0xf3, 0x0b, 0x9c, 0xe9, 0x21, 0x43, 0x17, 0x13, 0x09, 0x29,
+    0x7a, 0x04, 0x67, 0x25, 0xf3, 0xd4, 0x69, 0xe7, 0x3c, 0xae, 0x69, 0x38,
+    0xef, 0x2d, 0xb6, 0xdb, 0xbe, 0xb3, 0xef, 0x75, 0xa2, 0x35, 0x46, 0x2a,
+    0x99, 0xb6, 0xc6, 0xc0, 0x3c, 0x0b, 0xfc, 0x36, 0xa1, 0xa0, 0xfe, 0xf7,
+    0x83, 0xfe, 0x8d, 0x93, 0xf3, 0xad, 0xb7, 0x44, 0xd8, 0xdf, 0x00, 0xd9,
+    0xf7, 0x21, 0x6b, 0x4d, 0x2c, 0xbf, 0x1f, 0xf2, 0x5b, 0x55, 0x23, 0x55,
+    0x6a, 0x55, 0x54, 0x81, 0x7b, 0xe0, 0x19, 0xd4, 0x5e, 0x5c, 0x73, 0xf1,
+    0x3b, 0xd5, 0xb9, 0x85, 0x30, 0x6a, 0xaf, 0x35, 0x54, 0xa5, 0x0d, 0x53,
+    0x35, 0xee, 0xe5, 0xe6, 0xc6, 0x08, 0xad, 0xd1, 0x1a, 0xa9, 0x56, 0x1b,
+    0xa5, 0x3a, 0x8c, 0x19, 0x84, 0x9d, 0x77, 0xe3, 0xde, 0x2b, 0xa3, 0x2e,
+    0x0c, 0x68, 0x9b, 0xa9, 0x1e, 0x3e, 0x38, 0x6e, 0x54, 0xd2, 0x5e, 0xb9,
+    0x89, 0xe2, 0xe1, 0x6e, 0xde, 0xc7, 0xf8, 0xeb, 0xc5, 0x19, 0x8d, 0xb1,
+    0x66, 0x9f, 0xa0, 0xdd, 0x96, 0x0f, 0x1e, 0xb3, 0xce, 0xc2, 0x3f, 0xc9,
+    0xfb, 0xd0, 0x76, 0x0d, 0x3d, 0x24, 0x7f, 0x0b, 0x6d, 0x2b, 0x9c, 0xb6,
+    0x95, 0x94, 0xb2, 0x70, 0x07, 0x3d, 0xac, 0xb8, 0xef, 0x89, 0x44, 0x6f,
+    0xe7, 0xa2, 0x74, 0x40, 0x3e, 0x92, 0x10, 0x37, 0xb6, 0xd3, 0xe3, 0xce,
+    0xdd, 0xf8, 0x02, 0x6a, 0xaa, 0x7f, 0x40, 0xce, 0xcf, 0x9f, 0xa8, 0xa3,
+    0xe3, 0x1b, 0xeb, 0xe8, 0x70, 0xa4, 0x8a, 0x94, 0xfb, 0x1e, 0xa3, 0xf2,
+    0xc6, 0x08, 0xf9, 0x1b, 0xf9, 0xdb, 0x56, 0x47, 0x14, 0x9f, 0x70, 0xb7,
+    0x48, 0xd7, 0x2d, 0xdf, 0xb7, 0xe7, 0xb9, 0x76, 0xd8, 0x14, 0x9c, 0xf0,
+    0x11, 0xed, 0xcb, 0x33, 0xe6, 0xda, 0xdf, 0x8d, 0x01, 0xc9, 0x9a, 0x27,
+    0x8e, 0x0b, 0xf1, 0x24, 0xec, 0x9a, 0xe2, 0x6f, 0x69, 0xdc, 0x80, 0x9e,
+    0x75, 0x02, 0xf6, 0xde, 0x5f, 0x17, 0x49, 0x0e, 0x45, 0x7a, 0x04, 0x89,
+    0x2e, 0xa1, 0xed, 0x2e, 0x89, 0xe7, 0x25, 0x7a, 0x25, 0xbf, 0x01, 0xe7,
+    0x2e, 0xb7, 0xaf, 0xa3, 0x13, 0x1b, 0xef, 0xa1, 0xdd, 0xf4, 0xb1, 0x6f,
+    0x11, 0xe7, 0x7e, 0x5a, 0x93, 0x31, 0x5a, 0xc4, 0x7a, 0x57, 0xea, 0xcb,
+    0xd7, 0x47, 0x78, 0xf0, 0xd7, 0x16, 0x3e, 0x29, 0x16, 0x14, 0x7e, 0x43,
+    0x2c, 0xb3, 0xe6, 0xea, 0xc3, 0x5c, 0x13, 0x79, 0x7e, 0x7b, 0xb4, 0xe7,
+    0xeb, 0x33, 0x3e, 0x2d, 0xda, 0x71, 0x58, 0x6d, 0xbd, 0x83, 0x9e, 0xd2,
+    0x78, 0xdd, 0x3c, 0x1f, 0xdb, 0x5d, 0x65, 0xd5, 0xb1, 0xb7, 0xb6, 0xed,
+    0xb8, 0x65, 0x1b, 0xf9, 0xec, 0x35, 0xcc, 0x38, 0x6d, 0x8e, 0x3b, 0xe3,
+    0x4f, 0x69, 0x3f, 0x2c, 0xf2, 0x7b, 0xcc, 0x29, 0xd4, 0x4f, 0x67, 0x67,
+    0xf1, 0x7d, 0x67, 0xf1, 0x7d, 0x51, 0x03, 0xd9, 0xbf, 0x0f, 0x22, 0x78,
+    0xf3, 0x1c, 0x07, 0xfc, 0x8e, 0xb6, 0xf8, 0x39, 0x6a, 0x6f, 0xdf, 0xa9,
+    0x85, 0xb0, 0xef, 0xb5, 0x85, 0x50, 0xd8, 0x20, 0xcd, 0xf7, 0xda, 0x46,
+    0x99, 0x4e, 0x6e, 0x6c, 0xf0, 0xbd, 0xb5, 0xd0, 0xec, 0xfb, 0xf1, 0x42,
+    0x11, 0xf1, 0x28, 0x43, 0xd7, 0x50, 0xcb, 0xef, 0x26, 0x96, 0xfc, 0xe6,
+    0x6f, 0x8c, 0xaa, 0x6f, 0xe9, 0x77, 0xd0, 0x06, 0x67, 0x7f, 0x78, 0x63,
+    0xac, 0xda, 0xaa, 0x71, 0xf9, 0xed, 0xed, 0xf5, 0x48, 0x48, 0x9d, 0xb0,
+    0xde, 0x51, 0x69, 0x83, 0x44, 0xd5, 0xf2, 0x25, 0xb4, 0x9b, 0x40, 0x7e,
+    0xfb, 0x71, 0x84, 0x65, 0xd5, 0xf2, 0x3b, 0xa4, 0x81, 0x17, 0xe8, 0x84,
+    0xc3, 0x5f, 0xa0, 0x56, 0xf0, 0xa1, 0x3d, 0x1c, 0xc7, 0xc7, 0x23, 0xd5,
+    0x7b, 0xde, 0xa6, 0x04, 0x7d, 0xd7, 0xe2, 0xab, 0xf6, 0x5c, 0xc2, 0x3e,
+    0x77, 0xe9, 0x0b, 0x14, 0x42, 0x39, 0xc9, 0xbf, 0xad, 0x55, 0x05, 0xdf,
+    0xa6, 0x2a, 0xfd, 0x1d, 0x0a, 0xd3, 0xb4, 0x29, 0xa3, 0x4f, 0x1b, 0xb7,
+    0x41, 0xd1, 0xba, 0x87, 0x26, 0x4d, 0xd6, 0x57, 0xb3, 0xbe, 0xed, 0x6d,
+    0xdc, 0x4d, 0x4e, 0x39, 0x73, 0xfc, 0x8c, 0xaa, 0x51, 0xc5, 0x29, 0xbe,
+    0x49, 0x33, 0xe8, 0xfb, 0x8e, 0xa9, 0xf9, 0x26, 0xcc, 0xb0, 0xef, 0xe5,
+    0x9b, 0x39, 0x8a, 0x7f, 0xaf, 0xe5, 0x37, 0x38, 0xf7, 0x3e, 0xc2, 0x7b,
+    0xb5, 0xc1, 0x7a, 0xc3, 0x7d, 0x38, 0x17, 0x32, 0x78, 0xfd, 0x24, 0xd7,
+    0x20, 0xf6, 0xb9, 0x1d, 0xbf, 0xc5, 0xf3, 0x9d, 0x83, 0x7f, 0xe7, 0x69,
+    0xc6, 0x3d, 0xe0, 0x18, 0xbf, 0xdd, 0x50, 0x7b, 0xee, 0x6b, 0x72, 0x40,
+    0xf8, 0x04, 0xdf, 0x57, 0x08, 0xd6, 0x8f, 0x70, 0xbb, 0xd2, 0x77, 0xac,
+    0x20, 0xda, 0x37, 0xa0, 0xbd, 0x8a, 0xb6, 0xe8, 0x63, 0xbd, 0xd5, 0x4b,
+    0xce, 0xef, 0xc4, 0xfc, 0xee, 0xc2, 0x75, 0xb0, 0xb5, 0xc7, 0x91, 0x6b,
+    0xfe, 0xa5, 0x3d, 0x96, 0xab, 0x42, 0xce, 0x62, 0xff, 0x1e, 0x71, 0x7e,
+    0xc7, 0x2a, 0x77, 0x78, 0xde, 0xe7, 0xbc, 0xc7, 0x8d, 0xc4, 0xf2, 0x3c,
+    0xe5, 0xfd, 0x9d, 0xfa, 0x5f, 0x9d, 0xbc, 0x20, 0xa3, 0x66, 0xb6, 0xbf,
+    0x91, 0x7a, 0x4b, 0x7d, 0xf0, 0x7f, 0xd0, 0xab, 0xab, 0xe8, 0xd9, 0x3f,
+    0xdc, 0x86, 0x7f, 0x5b, 0xd7, 0x9c, 0x36, 0xb8, 0xef, 0x08, 0x76, 0xdd,
+    0x66, 0xb7, 0x65, 0x7f, 0x36, 0x38, 0x63, 0xf1, 0x7b, 0x71, 0x18, 0xed,
+    0x80, 0x2d, 0xbf, 0x70, 0x1b, 0xf7, 0x77, 0x96, 0x20, 0xfc, 0xad, 0x38,
+    0xfe, 0xe6, 0xb6, 0xfc, 0xbe, 0xc9, 0x71, 0x1e, 0x9a, 0xd6, 0x11, 0x27,
+    0xf7, 0xce, 0xf0, 0x1d, 0x82, 0x7d, 0x8e, 0x8c, 0x3b, 0xf1, 0x69, 0xd1,
+    0x50, 0x6c, 0xbf, 0xbe, 0x01, 0xbf, 0x2e, 0xbd, 0x0d, 0x16, 0x9d, 0xdf,
+    0x0a, 0xae, 0x5a, 0x73, 0x9e, 0x59, 0x38, 0x46, 0xf5, 0x51, 0xe3, 0x07,
+    0x9d, 0xdb, 0x55, 0xeb, 0x9d, 0xeb, 0xf4, 0x82, 0x66, 0xfd, 0x8e, 0xf3,
+    0x86, 0xf5, 0x76, 0xea, 0xa3, 0x47, 0x9a, 0x36, 0x4d, 0xaf, 0x15, 0x42,
+    0xb2, 0x2e, 0x54, 0xe3, 0x9b, 0xf1, 0x3c, 0x21, 0x55, 0xa7, 0x75, 0xb8,
+    0xab, 0x6d, 0x30, 0x02, 0xc2, 0x6f, 0x8a, 0xb4, 0x8e, 0xf5, 0x7c, 0xe7,
+    0x40, 0x7f, 0xd8, 0x7b, 0x66, 0xd9, 0x7c, 0x61, 0xc7, 0x0f, 0xec, 0x03,
+    0xf6, 0x85, 0x65, 0x2b, 0xc6, 0xe5, 0xfb, 0xf1, 0x35, 0x51, 0xc2, 0xbd,
+    0x41, 0x6e, 0xba, 0x81, 0x31, 0x4a, 0xeb, 0xd8, 0x2d, 0xb0, 0x2f, 0xf2,
+    0xac, 0x7d, 0x45, 0x78, 0x88, 0x7d, 0xbb, 0xdf, 0xa6, 0x07, 0xf9, 0x6e,
+    0xb9, 0xcd, 0xa6, 0x5f, 0x06, 0xfc, 0x68, 0x93, 0x4d, 0xff, 0x80, 0xbf,
+    0xdf, 0x46, 0x9b, 0xbe, 0xc4, 0xf9, 0xf2, 0xcb, 0x36, 0xdd, 0x8c, 0xec,
+    0x36, 0xbd, 0xd6, 0xa6, 0xbb, 0x04, 0xa2, 0x8b, 0x95, 0x36, 0x7d, 0x1a,
+    0x86, 0xfc, 0x52, 0xb2, 0x69, 0x3f, 0x2e, 0x23, 0xba, 0x68, 0xd3, 0x3d,
+    0xb8, 0x00, 0x7f, 0x4b, 0xb0, 0xe9, 0x42, 0x3d, 0x51, 0x9b, 0xcf, 0xf9,
+    0x19, 0xbb, 0x91, 0xe8, 0x55, 0xf7, 0xca, 0x02, 0x83, 0xf6, 0xbb, 0x34,
+    0x26, 0xde, 0xe8, 0xd2, 0xff, 0x4c, 0x38, 0x87, 0x1d, 0xfa, 0x6d, 0x1f,
+    0xad, 0x71, 0xe9, 0x29, 0x11, 0xf1, 0x18, 0xa0, 0x4e, 0xc1, 0x9e, 0x4c,
+    0x74, 0x68, 0xf5, 0xcf, 0x98, 0x76, 0xda, 0xfc, 0x8d, 0x1f, 0xf4, 0x1a,
+    0xfa, 0x90, 0x7f, 0x64, 0x95, 0x6b, 0x49, 0x00, 0x6d, 0xdd, 0x05, 0x63,
+    0x38, 0xb1, 0xdd, 0xa7, 0x85, 0xa3, 0xfc, 0x9b, 0x93, 0x42, 0x9f, 0xd6,
+    0xc2, 0xce, 0x5f, 0xad, 0xe3, 0xef, 0x6c, 0xdb, 0x36, 0xf5, 0x15, 0xd0,
+    0xce, 0xcf, 0xb7, 0x8d, 0x4d, 0xa0, 0x2b, 0xe9, 0xaf, 0x70, 0xe9, 0x2a,
+    0xfc, 0x7c, 0x33, 0x68, 0xeb, 0xdf, 0x52, 0x68, 0xf1, 0xd0, 0x36, 0xd0,
+    0xe5, 0xf4, 0x49, 0x35, 0x1f, 0x2a, 0x0f, 0x5a, 0xb4, 0xf5, 0xa2, 0xda,
+    0xd9, 0x79, 0xa0, 0x53, 0x4d, 0xa6, 0xe2, 0x6a, 0xe3, 0x91, 0x2a, 0xf0,
+    0x07, 0xfb, 0x9f, 0xc9, 0x8e, 0xa8, 0xfd, 0x83, 0xfd, 0x63, 0x55, 0x94,
+    0xea, 0xe8, 0x70, 0x28, 0x64, 0xd8, 0x8e, 0x87, 0x6e, 0xd2, 0x8f, 0x24,
+    0x3a, 0x77, 0xed, 0x73, 0xb8, 0x91, 0x67, 0x07, 0xd5, 0xd1, 0xb1, 0xde,
+    0x91, 0xb1, 0x16, 0xf5, 0xe9, 0xfe, 0x91, 0x67, 0x9e, 0xeb, 0x1d, 0xc9,
+    0x82, 0x18, 0xec, 0x1f, 0x3d, 0x9c, 0xcd, 0x70, 0xdb, 0xfe, 0x67, 0x7a,
+    0x0f, 0x65, 0xd5, 0xec, 0xe0, 0xd8, 0xc8, 0xf3, 0xea, 0xf0, 0x50, 0xff,
+    0xe0, 0xd8, 0x4e, 0x35, 0x72, 0xc4, 0x9e, 0x8a, 0x9e, 0xeb, 0xed, 0x1f,
+    0x53, 0xd3, 0x03, 0x7f, 0xa0, 0x36, 0x66, 0xd4, 0x31, 0xcc, 0x3b, 0xf4,
+    0xac, 0x35, 0x3c, 0x25, 0x12, 0x9d, 0x96, 0x78, 0x74, 0x24, 0xad, 0x66,
+    0x47, 0x46, 0x42, 0xa1, 0x50, 0x15, 0xad, 0x10, 0xe0, 0x6f, 0x78, 0x60,
+    0x40, 0x1d, 0xc9, 0x1e, 0x7a, 0x82, 0x07, 0x7c, 0x4a, 0x1d, 0x1c, 0x1a,
+    0x03, 0x97, 0x1e, 0x3a, 0x84, 0xc9, 0xb3, 0x56, 0x83, 0xe5, 0xfa, 0x3f,
+    0xec, 0x1d, 0x70, 0xa8, 0xd1, 0xec, 0xd8, 0x58, 0xff, 0xe0, 0x21, 0x77,
+    0x4e, 0xab, 0x6d, 0x3c, 0xb5, 0xab, 0x1b, 0x90, 0x8a, 0x77, 0xee, 0xb4,
+    0xac, 0x8b, 0xa7, 0xf6, 0x81, 0xdf, 0x57, 0xc2, 0x7f, 0xa3, 0x84, 0x4f,
+    0x96, 0xf0, 0x71, 0x97, 0xa5, 0xc1, 0xde, 0x67, 0xb2, 0x95, 0x95, 0xaa,
+    0xf5, 0xf7, 0xa0, 0xda, 0x38, 0x6a, 0xf9, 0x22, 0xe3, 0x91, 0xa0, 0xd5,
+    0xd8, 0xf3, 0xc3, 0xd9, 0xe5, 0x12, 0xa2, 0xa7, 0x47, 0xb2, 0xdf, 0x2a,
+    0x95, 0xc1, 0x1f, 0xf1, 0xee, 0x78, 0xfb, 0xee, 0xee, 0x6f, 0xec, 0xea,
+    0x78, 0x34, 0xa9, 0xaa, 0x5e, 0xad, 0xad, 0x3b, 0xd8, 0xd9, 0xb1, 0x4c,
+    0xe9, 0xd1, 0x25, 0x3a, 0xf6, 0x75, 0xae, 0xaa, 0x4b, 0x74, 0xa4, 0x56,
+    0xd3, 0xed, 0xdb, 0xb7, 0x2b, 0x15, 0xf1, 0x2a, 0x4b, 0x74, 0x2d, 0xab,
+    0xe8, 0x3a, 0x93, 0xed, 0xf1, 0xfd, 0x07, 0x3d, 0x4a, 0x8f, 0xee, 0xe0,
+    0xde, 0x7d, 0x7b, 0xf7, 0xef, 0xf6, 0xf4, 0x5c, 0xa1, 0xdb, 0x72, 0x1b,
+    0xdd, 0xd6, 0xdb, 0xe8, 0x5a, 0x6f, 0xa3, 0xdb, 0x76, 0x4b, 0xdd, 0xae,
+    0x47, 0x0f, 0x1e, 0x78, 0xa4, 0xb3, 0x7b, 0xc9, 0xd6, 0x95, 0xba, 0xe4,
+    0x7e, 0xb7, 0xa7, 0x47, 0xb7, 0xa7, 0x33, 0xb9, 0x3b, 0xd5, 0x79, 0xe0,
+    0x96, 0x63, 0xa6, 0x6e, 0xa3, 0x8b, 0xef, 0x7e, 0x34, 0xbe, 0x9a, 0x3f,
+    0x59, 0x77, 0x6b, 0x7f, 0xa6, 0xba, 0xf7, 0x25, 0xf7, 0x2d, 0xff, 0xf4,
+    0x1e, 0x5d, 0x7c, 0xf9, 0x57, 0x5f, 0xae, 0x7b, 0xac, 0x63, 0x95, 0x78,
+    0xe9, 0xde, 0xd7, 0x19, 0x59, 0xad, 0x1f, 0x74, 0x2d, 0xb7, 0xd1, 0x6d,
+    0xb9, 0x8d, 0x6e, 0xeb, 0xed, 0xc6, 0x8c, 0xac, 0x6e, 0x4b, 0x4b, 0xcb,
+    0xea, 0xba, 0xed, 0x5b, 0x57, 0xd3, 0xc5, 0xf7, 0xec, 0x4d, 0x75, 0x47,
+    0xba, 0x1f, 0xd9, 0xfb, 0xcd, 0xe4, 0xad, 0x75, 0x2d, 0x2b, 0x75, 0x9d,
+    0x49, 0x0e, 0xdc, 0xee, 0x5d, 0x9d, 0x9d, 0xbb, 0x1e, 0x7f, 0xa2, 0x31,
+    0xf3, 0x94, 0xbb, 0xc1, 0xd0, 0x67, 0x27, 0xb6, 0xa8, 0xca, 0xfb, 0x51,
+    0xed, 0x1f, 0x55, 0x77, 0xaa, 0x90, 0x6c, 0xad, 0xba, 0x85, 0xbc, 0x23,
+    0x05, 0x99, 0x9b, 0xa3, 0x6e, 0xa5, 0xdb, 0x52, 0xb5, 0xba, 0x6e, 0xeb,
+    0xad, 0x75, 0x76, 0xaf, 0x67, 0x07, 0x47, 0x9f, 0x1d, 0x1e, 0x1e, 0x1a,
+    0x19, 0x53, 0x33, 0x99, 0x11, 0x4b, 0x6b, 0xe7, 0xb8, 0xf4, 0xe1, 0xde,
+    0xc1, 0xee, 0xfe, 0xc1, 0x4c, 0xf6, 0x08, 0x5b, 0x9b, 0x51, 0xab, 0x54,
+    0xf2, 0xb4, 0x1d, 0x1b, 0xe9, 0x45, 0xae, 0x45, 0x2a, 0xe3, 0x66, 0x83,
+    0xd9, 0x81, 0x2a, 0x4a, 0x63, 0xf4, 0x4c, 0xb3, 0x3a, 0x64, 0xa3, 0x8c,
+    0x8d, 0x46, 0x18, 0x55, 0x51, 0x5f, 0xf6, 0x50, 0xff, 0x20, 0x46, 0xe5,
+    0x19, 0xd2, 0xbd, 0x03, 0xfd, 0x7d, 0xea, 0x58, 0x76, 0x74, 0xcc, 0x49,
+    0xd7, 0x90, 0x8f, 0x0e, 0x3d, 0x3d, 0xa6, 0xee, 0xea, 0xb6, 0x55, 0x91,
+    0x23, 0x0f, 0xb4, 0xaa, 0x4b, 0xc9, 0xba, 0x54, 0xb7, 0xad, 0x54, 0x17,
+    0xbb, 0xa9, 0xeb, 0x6d, 0xbd, 0x8d, 0x6e, 0xdb, 0xca, 0x31, 0xfb, 0x9e,
+    0x1f, 0xee, 0x1d, 0x1d, 0x85, 0x74, 0xdb, 0xf6, 0x25, 0x65, 0xa9, 0x6e,
+    0x7b, 0xa9, 0x2e, 0xb6, 0xa4, 0x6b, 0xbb, 0x8d, 0x6e, 0xc7, 0xca, 0x31,
+    0x47, 0x32, 0x38, 0x17, 0x30, 0x5b, 0x9b, 0xc7, 0x94, 0x12, 0xdd, 0xf6,
+    0x95, 0xba, 0x98, 0xab, 0x6b, 0xbb, 0x8d, 0x6e, 0xc7, 0x32, 0x9d, 0x73,
+    0xbe, 0xec, 0xdc, 0xbb, 0x7f, 0xff, 0x81, 0xd4, 0x9e, 0xc7, 0xbb, 0xe3,
+    0xbb, 0x3a, 0xf6, 0xc6, 0xba, 0x13, 0x07, 0xf6, 0x27, 0xed, 0xb8, 0x3b,
+    0xdc, 0x3b, 0x92, 0x59, 0xcd, 0xdf, 0xa5, 0xba, 0x6d, 0xa5, 0xba, 0x55,
+    0xfc, 0x5d, 0xaa, 0xdb, 0xb6, 0x72, 0xcc, 0x5b, 0xfa, 0xbb, 0x54, 0xb7,
+    0xbd, 0x54, 0xb7, 0x8a, 0xbf, 0x4b, 0x75, 0x3b, 0x56, 0x8e, 0x79, 0x4b,
+    0x7f, 0x2f, 0xd7, 0x6d, 0x5f, 0xa9, 0x5b, 0xc5, 0xdf, 0xcb, 0x75, 0xcb,
+    0xfd, 0x6d, 0xe5, 0x3d, 0xd7, 0xd9, 0x28, 0x5e, 0xba, 0x3b, 0x0e, 0xc4,
+    0x1f, 0xb2, 0x4e, 0x79, 0x95, 0x8f, 0x79, 0xab, 0x6a, 0xb8, 0xf6, 0x55,
+    0x32, 0xee, 0x04, 0xa6, 0x01, 0x97, 0x01, 0x19, 0xc0, 0x00, 0xcb, 0xbe,
+    0x46, 0xc6, 0xc7, 0x00, 0xda, 0x44, 0x46, 0x0d, 0x20, 0x08, 0x78, 0x74,
+    0x73, 0x6c, 0x68, 0x68, 0x0c, 0xf7, 0x2c, 0x9b, 0x50, 0x1f, 0x49, 0x75,
+    0xa8, 0x5b, 0x22, 0x2d, 0x5b, 0xef, 0x8f, 0x3c, 0xb0, 0x39, 0x12, 0x89,
+    0x6c, 0xdd, 0xb2, 0xf9, 0xd0, 0x03, 0x99, 0x07, 0x76, 0xa4, 0x33, 0xd9,
+    0xcd, 0x99, 0xfe, 0x91, 0xb1, 0xe7, 0xd5, 0x70, 0x22, 0x9b, 0x56, 0x5b,
+    0x5a, 0xd1, 0x68, 0xcb, 0x56, 0x75, 0xb3, 0xda, 0xf2, 0xc0, 0xce, 0x2d,
+    0xad, 0x3b, 0xb7, 0xb4, 0xdd, 0x07, 0xfb, 0xc2, 0x83, 0xcf, 0x0e, 0x0c,
+    0xdc, 0x87, 0x7a, 0x02, 0xfb, 0x79, 0xc8, 0xda, 0x9b, 0x19, 0x35, 0x3d,
+    0x34, 0x38, 0x3a, 0x34, 0x90, 0xad, 0xb2, 0xdf, 0xd0, 0xed, 0x3f, 0xfa,
+    0x7f, 0xf6, 0xf7, 0xfb, 0xdf, 0xee, 0x1e, 0xcd, 0x8e, 0xf4, 0xf7, 0x0e,
+    0x38, 0xfc, 0xc0, 0xdd, 0xc4, 0xff, 0xb8, 0x41, 0x6d, 0x41, 0x32, 0xa2,
+    0xa0, 0xaf, 0x02, 0x7f, 0x00, 0x38, 0xda, 0x66, 0xcb, 0x9b, 0x51, 0xc2,
+    0x7f, 0x8e, 0x12, 0xfa, 0xcb, 0x0d, 0xeb, 0xb9, 0x62, 0x36, 0x22, 0x4b,
+    0x7c, 0x2d, 0xeb, 0x0f, 0x96, 0xf0, 0x99, 0x25, 0x9e, 0x8b, 0x66, 0x63,
+    0xb8, 0x44, 0x7f, 0x78, 0xf9, 0x78, 0xfa, 0x40, 0x09, 0xdf, 0x53, 0xc2,
+    0xcf, 0x95, 0xf4, 0x3f, 0x5a, 0xc2, 0x1f, 0x2b, 0xe1, 0x8d, 0x12, 0xfe,
+    0x7f, 0xfb, 0xef, 0x5c, 0xa3, 0xed, 0xb7, 0xe2, 0x6f, 0xf9, 0xf7, 0xdf,
+    0xf1, 0xa5, 0x4a, 0x1e,
+};
+
+const firmware_blob_t firmware_blob_059f775304941425 = {
+    blob_059f775304941425_z, sizeof(blob_059f775304941425_z), 12032, 0x664743c4
+};
@@ -0,0 +1,457 @@
+/**
+ * Embedded Firmware blob 41bb22eec9116297
+ * Used by: t23 SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 10092 bytes, 5302 compressed
+static const uint8_t blob_41bb22eec9116297_z[] = {
+    0x78, 0xda, 0xd5, 0x5a, 0x6f, 0x70, 0x5c, 0xd5, 0x75, 0x3f, 0xef, 0xed,
+    0x93, 0xb4, 0xfa, 0x67, 0x3d, 0xc9, 0x8b, 0xbd, 0xb6, 0x15, 0xf2, 0xd6,
+    0x7a, 0x2b, 0xad, 0x59, 0x99, 0x59, 0xc9, 0x82, 0x0a, 0xb1, 0xc2, 0xcb,
+    0xee, 0xca, 0x96, 0x41, 0x36, 0x6b, 0xa1, 0x14, 0x93, 0xa4, 0x23, 0x59,
+    0xbb, 0xb2, 0x25, 0x90, 0xed, 0xb5, 0x24, 0x52, 0x93, 0xa8, 0xe4, 0x45,
+    0x16, 0xae, 0x42, 0x76, 0x24, 0x95, 0x21, 0x19, 0x93, 0x49, 0x67, 0x16,
+    0xff, 0x25, 0xa0, 0x4a, 0x36, 0x7f, 0x3a, 0x7c, 0x80, 0x5a, 0xe3, 0x10,
+    0xa0, 0x4c, 0xa6, 0x43, 0xa7, 0x4c, 0xc3, 0xb7, 0xba, 0x84, 0xb6, 0x4c,
+    0xcb, 0xd4, 0x7c, 0xf0, 0x0c, 0x4e, 0x31, 0x7e, 0xfd, 0x9d, 0x7b, 0xdf,
+    0x93, 0xd7, 0xb6, 0x32, 0x31, 0x1f, 0xfa, 0xa1, 0x9a, 0x79, 0x73, 0xcf,
+    0xbd, 0xf7, 0x9c, 0x7b, 0xcf, 0x3d, 0xf7, 0xfc, 0xbd, 0xab, 0x12, 0x4b,
+    0x8d, 0x11, 0xfe, 0x54, 0x8a, 0xb7, 0x94, 0x58, 0x13, 0x12, 0xee, 0x93,
+    0x63, 0xf6, 0x0f, 0x3d, 0x51, 0xdb, 0x4e, 0xb7, 0x98, 0x7a, 0x02, 0x63,
+    0x72, 0x2e, 0x46, 0xde, 0xa8, 0x76, 0xc5, 0x7b, 0x17, 0xf5, 0x4d, 0xc5,
+    0x2c, 0x2a, 0x8d, 0xd2, 0xe0, 0x8f, 0x63, 0x2f, 0x17, 0x93, 0x97, 0xe7,
+    0x0e, 0x51, 0x7c, 0xa6, 0x92, 0x34, 0x33, 0x10, 0x22, 0xf2, 0x51, 0x67,
+    0x8e, 0x2c, 0x35, 0x4a, 0xad, 0x71, 0x53, 0xa7, 0x62, 0x33, 0xe0, 0x27,
+    0xaa, 0xa0, 0x52, 0x33, 0x90, 0x8a, 0xd1, 0xed, 0x54, 0x62, 0x12, 0x3d,
+    0x98, 0xf3, 0x52, 0xf9, 0x6d, 0x62, 0xbf, 0xd0, 0x50, 0x36, 0x60, 0xbc,
+    0x44, 0x1a, 0x1d, 0xc1, 0xd8, 0xd3, 0x39, 0x8d, 0x92, 0xcf, 0x91, 0xf9,
+    0xce, 0xb8, 0x5d, 0x75, 0x32, 0xa2, 0x50, 0xda, 0xbc, 0x64, 0xef, 0xf5,
+    0x55, 0x50, 0xdc, 0x24, 0xab, 0x24, 0x1a, 0x6b, 0xff, 0x38, 0xa7, 0xc6,
+    0x35, 0xac, 0x95, 0x98, 0xb5, 0x29, 0x1d, 0xb1, 0x28, 0xdd, 0x02, 0x38,
+    0xaf, 0x51, 0x67, 0x9e, 0x28, 0x99, 0xe7, 0xf9, 0x1f, 0x62, 0x9c, 0xc7,
+    0x4c, 0xda, 0x92, 0x0f, 0x51, 0xc7, 0x09, 0x2f, 0x5d, 0xf0, 0xf0, 0x3e,
+    0xcc, 0x4f, 0xac, 0x3d, 0x9e, 0xf3, 0x51, 0x7c, 0x96, 0xc7, 0x14, 0x8a,
+    0x47, 0x3e, 0xb5, 0xdf, 0x6a, 0x28, 0x23, 0x15, 0x3c, 0x9e, 0x59, 0x30,
+    0x26, 0xb5, 0x71, 0x0f, 0xa9, 0xab, 0x7c, 0x74, 0x6e, 0x61, 0xba, 0x82,
+    0x2a, 0xf8, 0x2c, 0x92, 0x26, 0x91, 0x23, 0xca, 0x62, 0xed, 0x64, 0xae,
+    0x0f, 0xb8, 0x3e, 0x3a, 0x3c, 0xdb, 0x87, 0x3d, 0xbe, 0xb2, 0xfb, 0x7d,
+    0xc0, 0x9d, 0x01, 0xed, 0x0c, 0xaf, 0xe7, 0xa7, 0xb7, 0x1a, 0x78, 0x3d,
+    0xa6, 0x3f, 0x02, 0x7a, 0xde, 0xf2, 0x2b, 0x3b, 0xa6, 0x5f, 0xdb, 0xf7,
+    0xdc, 0x0c, 0x61, 0x6f, 0xc6, 0x63, 0x7c, 0x1b, 0xfb, 0xb3, 0xcc, 0x5c,
+    0x1a, 0x9d, 0x12, 0xb9, 0x72, 0x52, 0xa3, 0x11, 0x9c, 0x35, 0xa0, 0xf7,
+    0x13, 0xad, 0x54, 0xe9, 0xa2, 0xed, 0x11, 0xbc, 0x69, 0x14, 0xcb, 0x7b,
+    0x71, 0xa6, 0x2b, 0xe8, 0x1b, 0x68, 0x3d, 0xe4, 0x01, 0x6f, 0x7a, 0x94,
+    0xcf, 0xf9, 0x14, 0xf6, 0x8a, 0xb5, 0xab, 0xf3, 0xf8, 0xa6, 0x57, 0x63,
+    0x9c, 0xf1, 0x7e, 0x09, 0xbc, 0x5a, 0xb4, 0x2e, 0x7f, 0x01, 0x9d, 0xc8,
+    0xe5, 0x91, 0xf9, 0x11, 0x32, 0xb9, 0x2f, 0x6e, 0xf2, 0xfe, 0x97, 0xb1,
+    0x3f, 0x61, 0xef, 0x76, 0xec, 0x4d, 0xa5, 0x71, 0x73, 0x1d, 0xf5, 0xd3,
+    0x25, 0x25, 0x26, 0xe4, 0x55, 0x61, 0x79, 0x5a, 0x6a, 0x0c, 0xa2, 0x54,
+    0x7b, 0x72, 0x8e, 0xce, 0xa8, 0xd1, 0x4f, 0x8d, 0xd8, 0xdc, 0x27, 0xf8,
+    0x2e, 0xe0, 0xfb, 0xcc, 0x48, 0xcc, 0x91, 0xe5, 0x31, 0x7d, 0x46, 0xe2,
+    0x84, 0xbb, 0xbe, 0x97, 0xd7, 0x07, 0xde, 0x27, 0xc6, 0xd6, 0xdc, 0x15,
+    0x63, 0x8b, 0xd0, 0x81, 0x54, 0x7b, 0x47, 0x6e, 0x25, 0x5d, 0xa0, 0x6a,
+    0x5a, 0x24, 0x85, 0x9e, 0xce, 0xd2, 0x19, 0x2d, 0x5a, 0x03, 0x7c, 0x1d,
+    0x3a, 0xf1, 0x89, 0x71, 0x04, 0x78, 0x4f, 0xe7, 0xc2, 0xad, 0xc7, 0xe9,
+    0x8a, 0x7d, 0xc1, 0xc7, 0x32, 0xf3, 0xd0, 0x80, 0x2f, 0x1c, 0x3a, 0x4f,
+    0x97, 0xed, 0xbc, 0xe8, 0x17, 0xde, 0x1f, 0xcb, 0xaa, 0xaf, 0xfd, 0xdb,
+    0x26, 0xcb, 0xeb, 0x52, 0x19, 0x55, 0xb0, 0x6c, 0x92, 0x8e, 0xac, 0xff,
+    0xc6, 0x2b, 0xdb, 0xa2, 0x72, 0xd9, 0xd2, 0xe7, 0x45, 0x31, 0xb2, 0xb4,
+    0xe8, 0xf3, 0xe8, 0x0f, 0xde, 0x33, 0x69, 0xba, 0xf0, 0x21, 0xc0, 0x56,
+    0xb1, 0x83, 0xe3, 0x8c, 0x4d, 0x62, 0xec, 0xbf, 0x6f, 0x18, 0x9b, 0xc5,
+    0xd8, 0x0b, 0xde, 0xeb, 0xc7, 0x7e, 0x81, 0xb1, 0x13, 0x65, 0xd7, 0x8f,
+    0xbd, 0xc8, 0x6b, 0xe3, 0xcc, 0x8d, 0x94, 0xca, 0xfd, 0x7b, 0x09, 0x55,
+    0x04, 0x20, 0xaf, 0x89, 0xbf, 0xd4, 0x61, 0x53, 0x7c, 0x17, 0x9e, 0x1a,
+    0xb2, 0x8a, 0xa2, 0x8c, 0xfb, 0x06, 0xf0, 0x52, 0xd1, 0x93, 0x26, 0xd3,
+    0x64, 0x61, 0x13, 0xb6, 0x4d, 0xba, 0xb4, 0x9b, 0xc4, 0x0c, 0xcf, 0xbf,
+    0x8d, 0x79, 0x2f, 0x0d, 0xe4, 0x78, 0x3e, 0x10, 0x89, 0x2d, 0xad, 0xff,
+    0x21, 0xc6, 0x6f, 0xd4, 0xb3, 0x58, 0xb1, 0x27, 0xaa, 0xec, 0x4c, 0x8b,
+    0x7d, 0x7d, 0x94, 0x98, 0x73, 0x5a, 0xd8, 0x0f, 0xeb, 0x65, 0x9f, 0x58,
+    0x17, 0xf6, 0x90, 0xa3, 0x9f, 0x7a, 0xa2, 0xa6, 0xff, 0x30, 0xfd, 0xe0,
+    0x31, 0x2d, 0xaa, 0x7f, 0x6b, 0xd2, 0x0c, 0xfa, 0x33, 0x18, 0x97, 0xf8,
+    0x1f, 0x02, 0xbf, 0x44, 0xe2, 0xfb, 0x5c, 0xfc, 0x4b, 0xe4, 0x89, 0x5e,
+    0x7c, 0x09, 0x36, 0x0f, 0x9a, 0x72, 0x87, 0x86, 0x65, 0xce, 0x74, 0x52,
+    0x47, 0xcf, 0x2c, 0x08, 0xfa, 0xcb, 0x9e, 0x28, 0x9d, 0xd1, 0xb1, 0x86,
+    0x3a, 0xcd, 0xfe, 0x41, 0xe8, 0x39, 0xfe, 0x74, 0x2a, 0x9a, 0x76, 0xf9,
+    0xd6, 0xdb, 0x98, 0xef, 0x6b, 0xfd, 0x5a, 0xf4, 0xa9, 0xa0, 0x1f, 0x6a,
+    0xbb, 0xf9, 0x5c, 0xbc, 0xd7, 0x0a, 0x61, 0x63, 0xe7, 0x16, 0x56, 0xd2,
+    0x84, 0xce, 0xfb, 0x55, 0xd1, 0x44, 0xa8, 0x98, 0x62, 0x7a, 0x15, 0xc6,
+    0x2b, 0xf1, 0xdd, 0x41, 0x13, 0x3e, 0xe6, 0xdf, 0x4b, 0x52, 0x7e, 0x95,
+    0xc0, 0xe3, 0x3e, 0x24, 0x6e, 0xd6, 0x39, 0x73, 0xe5, 0xce, 0x9c, 0x8e,
+    0x3b, 0x29, 0x75, 0x60, 0x29, 0xa3, 0x54, 0xae, 0xc8, 0xe9, 0x5f, 0x00,
+    0xac, 0x3a, 0xf0, 0x2e, 0xc0, 0x6c, 0x0b, 0x6a, 0x10, 0xe6, 0x1a, 0x2e,
+    0x7e, 0x0a, 0x76, 0x9a, 0x0b, 0xb4, 0x12, 0xad, 0xa1, 0x09, 0x62, 0xfd,
+    0xff, 0x18, 0x3a, 0xa6, 0xc3, 0xaf, 0x05, 0x0c, 0xdc, 0x4b, 0x4d, 0xf1,
+    0x53, 0x81, 0x50, 0x9f, 0x18, 0x63, 0x1c, 0x1e, 0xe3, 0xfe, 0x22, 0xc6,
+    0xdd, 0x31, 0x28, 0xac, 0xce, 0x67, 0x63, 0xbb, 0xb8, 0xf1, 0x8c, 0xcc,
+    0xc7, 0x20, 0x64, 0x7f, 0x01, 0x67, 0x0d, 0x18, 0x13, 0x34, 0xb1, 0xda,
+    0x43, 0x7e, 0x9c, 0xb3, 0x16, 0x67, 0x26, 0x9a, 0xcd, 0xf1, 0x59, 0xd9,
+    0xf7, 0x28, 0xd0, 0x1f, 0xd8, 0xb7, 0x4f, 0xc1, 0xb9, 0x14, 0xac, 0xb7,
+    0x02, 0x63, 0x50, 0x99, 0x66, 0x13, 0x3a, 0xa6, 0x90, 0x5e, 0x1f, 0xb3,
+    0x74, 0x5a, 0x47, 0x29, 0xd8, 0x2a, 0xa9, 0x35, 0x7e, 0xf6, 0xe1, 0x04,
+    0x79, 0x1d, 0xc7, 0x1d, 0x1d, 0xe3, 0xb5, 0xb0, 0xe7, 0xb1, 0x19, 0xbf,
+    0xb3, 0xaf, 0x81, 0x7d, 0xdf, 0xb3, 0xa5, 0xed, 0xf7, 0x6c, 0x8e, 0x9b,
+    0x26, 0xbd, 0xb2, 0x60, 0xd0, 0xd9, 0x85, 0xc0, 0x6c, 0x9e, 0x02, 0x53,
+    0x16, 0xb5, 0x60, 0xef, 0x08, 0xbd, 0xbe, 0xd0, 0x48, 0xaf, 0x2d, 0x84,
+    0xe8, 0x55, 0xd0, 0x9f, 0x59, 0xb0, 0x6d, 0xcd, 0x2c, 0x12, 0xe7, 0x28,
+    0x82, 0x5e, 0xc2, 0x27, 0xf9, 0xff, 0x11, 0x36, 0xba, 0x25, 0xe7, 0xa1,
+    0x3d, 0x79, 0xf6, 0x17, 0xff, 0x63, 0x67, 0x7c, 0x6a, 0x64, 0x20, 0x4b,
+    0x96, 0x0f, 0xfa, 0x7d, 0x5b, 0x34, 0x60, 0xf1, 0x59, 0x57, 0x9a, 0x9f,
+    0xdc, 0xf7, 0x5c, 0x3d, 0x44, 0xa5, 0x27, 0xdb, 0x5e, 0xaf, 0x57, 0xf5,
+    0x95, 0x23, 0x01, 0xff, 0x4e, 0x48, 0xb8, 0x7f, 0x76, 0x3d, 0xce, 0xc5,
+    0xf2, 0x80, 0x7d, 0xcf, 0x6a, 0x1c, 0x27, 0x22, 0xfd, 0xf0, 0xf9, 0xef,
+    0xcc, 0xae, 0xa5, 0x5f, 0xe3, 0x8c, 0x71, 0xd8, 0x43, 0x1c, 0xe7, 0xdc,
+    0x33, 0xcb, 0xfe, 0x41, 0xa5, 0xf4, 0x6c, 0x20, 0xf2, 0x36, 0xe8, 0xde,
+    0xce, 0x69, 0x7e, 0xf8, 0xc2, 0x4f, 0x27, 0xc7, 0x59, 0x07, 0x4b, 0x40,
+    0x07, 0xda, 0x55, 0x22, 0x3e, 0xfd, 0x8b, 0x86, 0xf8, 0x34, 0x09, 0x5d,
+    0x65, 0x9d, 0xfe, 0xd5, 0x5c, 0x19, 0xf8, 0x24, 0x7a, 0x37, 0xc7, 0xe7,
+    0x57, 0xf5, 0xa2, 0x91, 0x80, 0x91, 0x57, 0x85, 0x2d, 0x85, 0x7a, 0xb0,
+    0x0f, 0xe9, 0x2c, 0xb3, 0xdf, 0xd9, 0x49, 0x1f, 0xef, 0xcb, 0xf0, 0x1d,
+    0x7a, 0x8d, 0xfa, 0x5b, 0x3b, 0xe6, 0xc3, 0xd9, 0x67, 0x70, 0xf6, 0x19,
+    0x9c, 0x7d, 0x06, 0x67, 0x9f, 0x81, 0x6c, 0x66, 0x20, 0x9b, 0x99, 0x5a,
+    0x47, 0x76, 0xad, 0xce, 0x9d, 0xb1, 0x4e, 0xf0, 0x9d, 0xf1, 0xbd, 0xf0,
+    0x7d, 0xd1, 0xba, 0xd4, 0x38, 0xad, 0x88, 0x8f, 0x17, 0x53, 0x42, 0xe7,
+    0xbb, 0x63, 0x7b, 0x2f, 0xc7, 0x7d, 0xf1, 0x3d, 0xa9, 0x4b, 0xba, 0xa9,
+    0x99, 0xee, 0x7d, 0x2d, 0x7f, 0x57, 0xf9, 0x65, 0xef, 0x8a, 0xed, 0xa0,
+    0x9a, 0x26, 0x1a, 0xd9, 0x0e, 0x12, 0x90, 0x9b, 0xb0, 0x3b, 0xdc, 0x5d,
+    0x5f, 0x34, 0x6e, 0x5a, 0x86, 0x06, 0x9d, 0x4b, 0x62, 0xf5, 0x09, 0xd8,
+    0x7b, 0x8c, 0x5c, 0xdd, 0x66, 0xff, 0xc3, 0xe7, 0x9c, 0x58, 0xad, 0x93,
+    0xe4, 0x37, 0x95, 0xa3, 0x2a, 0xf5, 0x29, 0xe6, 0xb7, 0x08, 0x3c, 0x32,
+    0x7f, 0x91, 0x3f, 0xc0, 0x5f, 0x15, 0xf4, 0xaa, 0x90, 0x47, 0x04, 0x04,
+    0xbd, 0xa6, 0x40, 0x77, 0xdf, 0x2f, 0x21, 0xaf, 0xab, 0xbb, 0x3d, 0x58,
+    0x97, 0xd7, 0xe4, 0x7d, 0xf8, 0xec, 0x2b, 0xc4, 0x9d, 0x48, 0x9d, 0xe5,
+    0x3d, 0x56, 0x63, 0x8f, 0x2a, 0x67, 0x5d, 0xd6, 0xd7, 0xff, 0xb4, 0xa5,
+    0xec, 0x79, 0xcf, 0x41, 0x8c, 0x9f, 0xc0, 0xe7, 0xae, 0xfb, 0x67, 0xce,
+    0xba, 0xc5, 0x98, 0xab, 0x14, 0xeb, 0x48, 0x3d, 0x67, 0x5c, 0x5e, 0x43,
+    0x2f, 0xc0, 0x35, 0x1d, 0xdc, 0xe5, 0x6c, 0xea, 0x03, 0xc8, 0xab, 0x1c,
+    0x7e, 0xa2, 0x11, 0xf2, 0x0a, 0x41, 0x87, 0x4d, 0xe8, 0xb0, 0x01, 0x1d,
+    0xaf, 0x85, 0x8e, 0xc3, 0x9e, 0x7c, 0xe2, 0xbe, 0x1c, 0xbf, 0x93, 0x81,
+    0xdf, 0xf9, 0x0e, 0xd6, 0x07, 0xee, 0x8c, 0x0f, 0xb6, 0xa5, 0xfa, 0x27,
+    0xa0, 0xc3, 0xd5, 0xd1, 0xc8, 0x7d, 0x4d, 0xf5, 0x81, 0x59, 0x4b, 0xc8,
+    0x2e, 0x60, 0xb1, 0x5d, 0x1c, 0x84, 0x9e, 0xd4, 0x3d, 0xeb, 0x21, 0xf3,
+    0x59, 0x11, 0x8f, 0xa9, 0x27, 0xc7, 0x67, 0x12, 0x31, 0x06, 0x6b, 0xf2,
+    0x7a, 0x87, 0xb0, 0x56, 0x20, 0x14, 0x53, 0x71, 0x1b, 0xba, 0x87, 0xea,
+    0x9f, 0x75, 0xe5, 0x17, 0x37, 0x74, 0x11, 0xdf, 0xc2, 0x46, 0x06, 0xfa,
+    0x6e, 0xf9, 0xea, 0x42, 0x09, 0xf8, 0x88, 0x14, 0xd5, 0x85, 0x8e, 0xc3,
+    0x66, 0xcf, 0x08, 0x9c, 0x2f, 0xed, 0x38, 0x64, 0x12, 0x6f, 0x64, 0x7d,
+    0x60, 0xf9, 0xd9, 0xf6, 0xa8, 0x19, 0x3f, 0xea, 0x21, 0xb6, 0x75, 0xc0,
+    0xf5, 0x36, 0x8d, 0x36, 0xf3, 0x1e, 0x47, 0x79, 0x8f, 0x08, 0x49, 0x5d,
+    0x6e, 0xed, 0x53, 0x81, 0xbb, 0x8a, 0xe3, 0xbf, 0xbd, 0xa8, 0x46, 0xd9,
+    0x3e, 0x3f, 0xb7, 0xe3, 0x2d, 0x3a, 0xad, 0x9f, 0xd6, 0xe0, 0x87, 0x91,
+    0x53, 0xb4, 0x34, 0xe0, 0xa6, 0xcd, 0x7c, 0x0f, 0xe2, 0xe6, 0xfa, 0x69,
+    0xbe, 0x27, 0x05, 0xfc, 0xf3, 0x5c, 0xf0, 0x68, 0xbf, 0x2a, 0xce, 0x06,
+    0x9f, 0x13, 0xcc, 0x8f, 0x41, 0xc4, 0xcf, 0xcd, 0x29, 0xe0, 0xb9, 0x82,
+    0xcc, 0xe9, 0x80, 0x7e, 0x9e, 0x34, 0xf8, 0x7c, 0x8e, 0x01, 0xa6, 0x71,
+    0x18, 0xfe, 0xdc, 0xf2, 0xb1, 0x3d, 0xa9, 0xfe, 0x8e, 0x11, 0xa2, 0xad,
+    0x32, 0x97, 0x03, 0x2f, 0x9f, 0x20, 0x67, 0x68, 0x01, 0x3f, 0xd2, 0xae,
+    0xfa, 0xa9, 0x14, 0xbc, 0xb0, 0x1c, 0x65, 0x3c, 0xe1, 0x78, 0xaf, 0x45,
+    0xdf, 0xc4, 0xfc, 0x87, 0xa0, 0x7d, 0xde, 0x89, 0xc3, 0x3c, 0x8f, 0x3b,
+    0x81, 0x5d, 0xbd, 0x0a, 0xbb, 0x7a, 0x05, 0x76, 0x75, 0x76, 0x49, 0xd7,
+    0x23, 0x8e, 0x4e, 0x19, 0xd4, 0x91, 0xbb, 0x68, 0x6b, 0xd1, 0x10, 0xfc,
+    0xca, 0x45, 0xb6, 0x69, 0xe3, 0x04, 0x19, 0x84, 0x9c, 0xc3, 0x12, 0x63,
+    0x73, 0x91, 0xfb, 0x26, 0xcd, 0x1f, 0xe0, 0xfe, 0x4b, 0xd9, 0xc6, 0x05,
+    0x7e, 0x3c, 0xc7, 0x71, 0x53, 0xa7, 0x34, 0xfc, 0x79, 0x1f, 0xf4, 0x8b,
+    0x7d, 0x55, 0xc6, 0x67, 0xdb, 0x9e, 0x28, 0xeb, 0x8e, 0xfd, 0xc3, 0xb4,
+    0x69, 0x9f, 0xf3, 0x98, 0x1c, 0x9b, 0xe8, 0x8c, 0x07, 0xf8, 0xfd, 0x73,
+    0x6e, 0x1e, 0xc1, 0xb6, 0x35, 0xea, 0xe4, 0x7c, 0x1c, 0xc3, 0xd8, 0xc6,
+    0x98, 0xfe, 0x03, 0x52, 0xe7, 0x3f, 0x70, 0x72, 0x89, 0x83, 0x98, 0x77,
+    0xfb, 0x4a, 0x81, 0x0e, 0x16, 0xe6, 0x50, 0xc3, 0x9b, 0xe3, 0x39, 0xf6,
+    0x09, 0x31, 0x5f, 0x7c, 0xfc, 0x2b, 0xf8, 0x2e, 0xd8, 0x58, 0xe3, 0x0a,
+    0xf0, 0xc2, 0x3c, 0x23, 0x2f, 0x8a, 0x5a, 0xb8, 0x87, 0x13, 0xd1, 0xb4,
+    0xcc, 0xe5, 0x80, 0xe7, 0xda, 0x2a, 0xaf, 0xa1, 0x62, 0x7d, 0x6e, 0xdd,
+    0xbc, 0x09, 0x79, 0xa7, 0xc9, 0x79, 0x02, 0xf3, 0xf6, 0x01, 0xe4, 0xf7,
+    0x06, 0xf2, 0x04, 0xe6, 0x8b, 0x65, 0xf8, 0xcf, 0x4a, 0xb1, 0xf9, 0x9a,
+    0xc3, 0x97, 0xcc, 0x5b, 0x25, 0xad, 0xc6, 0x71, 0xe1, 0x55, 0x99, 0x13,
+    0xf9, 0x70, 0xcf, 0x6e, 0x7c, 0xb6, 0xf4, 0xc4, 0x5c, 0x11, 0xfa, 0x53,
+    0x68, 0xd7, 0xa2, 0x9d, 0x44, 0xeb, 0x77, 0xda, 0xf7, 0xf4, 0x8e, 0x9c,
+    0x6b, 0x07, 0x1f, 0x61, 0x1f, 0xa6, 0xcf, 0x19, 0x09, 0xf8, 0x0d, 0x99,
+    0x37, 0xb0, 0x5e, 0x8d, 0xeb, 0x22, 0xaf, 0x8b, 0x8e, 0x6d, 0x4e, 0x23,
+    0x76, 0x3a, 0xb9, 0x01, 0xfa, 0xc3, 0xe8, 0xb7, 0x52, 0x26, 0xa7, 0xe9,
+    0xc9, 0xb9, 0x18, 0xda, 0x5a, 0xb4, 0x9c, 0xc6, 0x45, 0x71, 0x07, 0xec,
+    0xcf, 0xab, 0x20, 0x7f, 0xe5, 0x55, 0x3d, 0x5a, 0x8d, 0x35, 0xa0, 0x6f,
+    0x73, 0x95, 0x9c, 0xa3, 0x3a, 0x6b, 0x31, 0x6d, 0x12, 0x34, 0xb4, 0x66,
+    0x72, 0x1c, 0x3e, 0xdb, 0x64, 0xda, 0x24, 0xe8, 0x68, 0x4d, 0x7a, 0xdc,
+    0x07, 0x1c, 0xa6, 0xf3, 0xeb, 0x34, 0x5f, 0xab, 0x5f, 0xcb, 0x0f, 0x3e,
+    0xe3, 0xfc, 0xa0, 0xa0, 0x7f, 0x19, 0x7d, 0x7f, 0x41, 0x5f, 0xbb, 0xf7,
+    0xe6, 0xfc, 0x81, 0xcf, 0xc3, 0x3a, 0x8f, 0x33, 0xcd, 0xe5, 0x90, 0xa3,
+    0xe6, 0x8c, 0x24, 0x62, 0xfc, 0x24, 0xce, 0x66, 0x09, 0x7f, 0x97, 0x33,
+    0x3a, 0x84, 0x0f, 0xe7, 0x35, 0x74, 0x41, 0x7f, 0x76, 0x81, 0x6d, 0x5f,
+    0x77, 0xe2, 0x2f, 0xaf, 0xeb, 0x87, 0xdf, 0x18, 0xde, 0xbc, 0x7e, 0xfa,
+    0x21, 0xf0, 0x84, 0x1c, 0x63, 0x9e, 0x63, 0x1d, 0xe3, 0x6b, 0xe4, 0x99,
+    0x77, 0x72, 0xba, 0xf9, 0xb1, 0xcd, 0x93, 0xb9, 0x41, 0xd8, 0xb5, 0xc8,
+    0x9a, 0x44, 0xde, 0x25, 0xe5, 0x6a, 0xdb, 0xfd, 0x11, 0xce, 0xdb, 0xab,
+    0xe9, 0x64, 0x0b, 0xf9, 0xd2, 0xe3, 0xb4, 0xd6, 0x43, 0xc1, 0xd0, 0x31,
+    0x7c, 0xc7, 0x89, 0xd7, 0x8e, 0x60, 0xcf, 0xe1, 0xcd, 0x75, 0xe2, 0x0c,
+    0x51, 0xc0, 0x9d, 0xd4, 0x9f, 0xe3, 0x9c, 0xcf, 0xb6, 0x13, 0x11, 0x5a,
+    0xe7, 0x71, 0xe8, 0xe2, 0xe3, 0x8c, 0x4f, 0x35, 0xaa, 0xa0, 0x61, 0x7a,
+    0x97, 0xa6, 0x13, 0x34, 0x5d, 0x5f, 0x93, 0xa6, 0x07, 0x34, 0xa9, 0x5b,
+    0xa6, 0x59, 0x2f, 0x68, 0xfa, 0xee, 0xe5, 0x5c, 0xb4, 0x43, 0xe6, 0xa2,
+    0xc0, 0xe5, 0x71, 0xf7, 0x9c, 0xb6, 0x9d, 0x89, 0x08, 0xfa, 0x3a, 0x78,
+    0x6b, 0x9c, 0x31, 0x08, 0x5b, 0x15, 0xe7, 0x84, 0xff, 0xa8, 0x80, 0x6c,
+    0x3a, 0x6f, 0x11, 0xaf, 0xeb, 0x16, 0xf1, 0x52, 0xb7, 0x88, 0xe7, 0xe5,
+    0x9c, 0x0d, 0xfe, 0xaf, 0x02, 0x76, 0xfb, 0x73, 0xe8, 0x25, 0xc7, 0xd5,
+    0xef, 0xd3, 0x61, 0x71, 0x47, 0xdf, 0x15, 0x6b, 0xc0, 0x5e, 0xeb, 0x3d,
+    0xc4, 0x38, 0xd4, 0x06, 0x7a, 0x1d, 0x5e, 0xbb, 0x96, 0xe9, 0x13, 0x82,
+    0xde, 0xb5, 0x75, 0x96, 0x5b, 0x8f, 0x90, 0x17, 0xf4, 0x13, 0x1e, 0x3a,
+    0x80, 0x1a, 0x93, 0xda, 0xe2, 0x22, 0xff, 0x20, 0x9f, 0x4a, 0x41, 0xd8,
+    0x73, 0x45, 0x81, 0x6f, 0x60, 0xfc, 0xce, 0xaf, 0x89, 0xdf, 0xf5, 0x35,
+    0xf1, 0x53, 0x5f, 0x13, 0x9f, 0xef, 0x30, 0x5b, 0xa0, 0x5f, 0x74, 0x3b,
+    0xd3, 0x9d, 0x94, 0x74, 0x7c, 0xe7, 0xbe, 0x9b, 0xf5, 0x64, 0xbc, 0x40,
+    0xb7, 0x6e, 0x05, 0x7f, 0xaa, 0x40, 0xaf, 0x6e, 0x05, 0xff, 0x39, 0xe0,
+    0xf7, 0x7c, 0x0d, 0xfc, 0x13, 0xc0, 0xff, 0xee, 0x2d, 0xe0, 0x7f, 0xd3,
+    0xb9, 0xeb, 0x6a, 0x55, 0x35, 0x59, 0x0e, 0x15, 0xa2, 0xc6, 0xa8, 0x11,
+    0x3e, 0xe2, 0xb5, 0x7b, 0x93, 0xf5, 0xd5, 0x1e, 0x1e, 0xa7, 0x79, 0x77,
+    0x6e, 0x69, 0x5c, 0x59, 0x7e, 0x9c, 0x75, 0x9d, 0xc7, 0x99, 0x87, 0x24,
+    0xf4, 0xee, 0x6d, 0xf0, 0x41, 0xe1, 0x22, 0x61, 0x33, 0xc0, 0x9b, 0x77,
+    0xe3, 0x1a, 0xe3, 0xf0, 0xbe, 0xf0, 0x17, 0xc8, 0x23, 0xce, 0x2e, 0xf9,
+    0x21, 0xc3, 0x89, 0x0f, 0x63, 0x9b, 0x65, 0x8e, 0xef, 0x87, 0x8f, 0x61,
+    0xdf, 0x82, 0xc2, 0x64, 0x61, 0x15, 0xfc, 0x69, 0x60, 0x8a, 0x6b, 0x3b,
+    0x1d, 0x3e, 0x51, 0x15, 0xe7, 0xfc, 0xe8, 0x5e, 0x19, 0x4f, 0x3b, 0xa9,
+    0x63, 0x96, 0xc7, 0x60, 0x3f, 0xb3, 0xec, 0xc7, 0x2a, 0xe0, 0x17, 0x63,
+    0xf0, 0x37, 0x3a, 0xda, 0x13, 0xec, 0x77, 0xd0, 0xb2, 0x7f, 0xe6, 0xb9,
+    0x45, 0x3d, 0x99, 0xbb, 0x6a, 0x4b, 0xdd, 0x7e, 0xc1, 0x99, 0x1b, 0x03,
+    0xdf, 0x2a, 0xf2, 0x88, 0x14, 0xfa, 0x3b, 0x89, 0xeb, 0xff, 0x73, 0x33,
+    0x8c, 0xcb, 0xbe, 0xd8, 0x74, 0xe8, 0xc0, 0x0b, 0x78, 0x3d, 0x33, 0x13,
+    0xc2, 0x58, 0x61, 0xae, 0xc9, 0xfe, 0x8f, 0x7d, 0xb0, 0x57, 0x57, 0xa7,
+    0xbd, 0x8e, 0x8f, 0x75, 0xe3, 0xcf, 0x67, 0xe0, 0xef, 0x05, 0x8e, 0x39,
+    0xba, 0x3a, 0xef, 0x2d, 0xf0, 0xbf, 0xde, 0xa8, 0x8c, 0x1f, 0x1e, 0xe8,
+    0xdc, 0x6f, 0x10, 0x57, 0xae, 0xda, 0x27, 0x04, 0x3f, 0xbf, 0x29, 0x88,
+    0x31, 0xa6, 0xc0, 0xd1, 0xa3, 0xf9, 0x65, 0xe8, 0x5b, 0xa2, 0x37, 0xfb,
+    0x6f, 0x96, 0x17, 0xcb, 0x8a, 0x65, 0xf6, 0x0f, 0xa8, 0xbd, 0x59, 0x66,
+    0xbf, 0x5d, 0x5d, 0x24, 0xe2, 0x29, 0x4d, 0x9e, 0x6c, 0xe1, 0xda, 0xba,
+    0x19, 0xe3, 0x63, 0x9b, 0xfb, 0xe7, 0xde, 0x42, 0xcb, 0x3e, 0xda, 0xad,
+    0xb9, 0x3f, 0x27, 0xae, 0x09, 0xa5, 0x1d, 0x14, 0x81, 0x27, 0xeb, 0x86,
+    0xfe, 0xe7, 0x5c, 0xcb, 0xc3, 0xd7, 0xb7, 0x94, 0xca, 0xfb, 0xfb, 0x53,
+    0xa7, 0x8e, 0xe7, 0xfb, 0xae, 0x85, 0x7f, 0xe8, 0x83, 0x0f, 0x30, 0xd0,
+    0x22, 0x63, 0x9b, 0x37, 0xd1, 0x0e, 0xa2, 0xe5, 0x7c, 0x64, 0x18, 0x6d,
+    0x23, 0xda, 0x2c, 0x5a, 0xe4, 0xcf, 0xb9, 0x31, 0xb4, 0xfc, 0x56, 0x03,
+    0x99, 0xce, 0x73, 0xcd, 0x1d, 0x42, 0xab, 0xc1, 0xb7, 0xd8, 0x33, 0x9c,
+    0x6f, 0xf4, 0x13, 0xef, 0xf9, 0xa3, 0xeb, 0xd6, 0x66, 0x1d, 0xe1, 0x9c,
+    0x27, 0x91, 0xf3, 0x3b, 0xb8, 0x8c, 0x83, 0x4a, 0x68, 0xfa, 0x9c, 0xad,
+    0x0a, 0x1a, 0x54, 0x04, 0xf3, 0x6f, 0x42, 0x9f, 0x7c, 0x37, 0xe8, 0x10,
+    0xe9, 0x71, 0x93, 0x44, 0x9d, 0x7e, 0x58, 0xc4, 0x2f, 0x4d, 0xd6, 0xf8,
+    0xc8, 0x29, 0x12, 0x5c, 0xc7, 0xe7, 0x7e, 0xef, 0xd4, 0xee, 0xf2, 0xed,
+    0x25, 0x6e, 0x26, 0xe3, 0x9a, 0xc8, 0x07, 0xb6, 0x6c, 0x9b, 0x5c, 0xca,
+    0x07, 0xfe, 0x03, 0xbc, 0x04, 0xac, 0x98, 0x27, 0x99, 0x44, 0xbe, 0x8a,
+    0x7d, 0xb8, 0x4f, 0xdd, 0x52, 0xf6, 0x2c, 0x57, 0x96, 0xff, 0xf0, 0x66,
+    0x99, 0x1f, 0xc9, 0xdc, 0xc6, 0x23, 0xd6, 0xb8, 0xd0, 0x9e, 0x16, 0x6b,
+    0x60, 0x9f, 0x05, 0xce, 0xb5, 0x7c, 0xf0, 0x3f, 0x5e, 0xc0, 0xdf, 0x73,
+    0x72, 0x11, 0x45, 0xbc, 0x41, 0x69, 0x51, 0xc8, 0x6e, 0xe1, 0x97, 0xb8,
+    0xcf, 0x0f, 0x9c, 0xfb, 0x2c, 0xcc, 0xc9, 0x83, 0x54, 0x6a, 0x96, 0x51,
+    0xc9, 0x52, 0xbd, 0xc9, 0x75, 0xa5, 0x5b, 0x63, 0x56, 0x52, 0x99, 0x99,
+    0xa5, 0x72, 0xa4, 0xd4, 0x73, 0x0d, 0x11, 0xaa, 0x34, 0x83, 0xb4, 0xc2,
+    0x1c, 0xa5, 0x2a, 0xac, 0xe9, 0x07, 0x9f, 0x6b, 0xcc, 0x5d, 0xa4, 0x9b,
+    0x19, 0xaa, 0x36, 0x37, 0x52, 0x0d, 0x64, 0x70, 0xcc, 0x2a, 0xa5, 0x6d,
+    0x7a, 0x3d, 0x25, 0x42, 0xbd, 0x24, 0xdf, 0x37, 0x76, 0x43, 0xd7, 0xb9,
+    0x66, 0xfb, 0x0e, 0x6d, 0x15, 0x32, 0x78, 0x44, 0xd4, 0x34, 0xcf, 0xe4,
+    0x15, 0xe0, 0x56, 0xd2, 0x83, 0xfa, 0x41, 0xe0, 0x96, 0x38, 0xb8, 0xa5,
+    0x94, 0x12, 0x6d, 0x17, 0xed, 0x14, 0xb8, 0x75, 0x02, 0xf7, 0x7c, 0x2e,
+    0x4a, 0x0f, 0xe9, 0xbe, 0x76, 0x4f, 0xc3, 0x16, 0x7a, 0xd4, 0x79, 0x03,
+    0xf9, 0x15, 0x72, 0x99, 0x7f, 0x42, 0x2e, 0x93, 0x3f, 0x5e, 0x45, 0xc7,
+    0x1a, 0xaa, 0x68, 0x30, 0x52, 0x46, 0xbe, 0x0d, 0x8f, 0x50, 0x71, 0x30,
+    0x42, 0xde, 0x20, 0xd7, 0xa8, 0xe5, 0x11, 0x9f, 0xa2, 0xae, 0xf1, 0xd0,
+    0x65, 0x21, 0xfb, 0x2d, 0x79, 0xae, 0xf5, 0xc3, 0xfe, 0x09, 0xa4, 0xed,
+    0xdb, 0xf3, 0xdc, 0xf2, 0x7b, 0x8a, 0xac, 0x65, 0xe3, 0xa2, 0x9e, 0x81,
+    0xfc, 0x50, 0x54, 0x1c, 0x06, 0x5f, 0xfc, 0xfe, 0x91, 0xb0, 0xae, 0x60,
+    0x9e, 0xe7, 0x54, 0x3a, 0x69, 0xfe, 0x3d, 0x6a, 0xa3, 0x40, 0x84, 0x73,
+    0xfa, 0xf7, 0x80, 0x7b, 0xbf, 0xc6, 0xfb, 0x12, 0x3d, 0x9b, 0xaf, 0x43,
+    0xee, 0xc8, 0xf8, 0x55, 0x74, 0xbc, 0x61, 0x2d, 0x6d, 0x45, 0xbd, 0x70,
+    0x81, 0x6c, 0x3b, 0x0d, 0x5f, 0x40, 0xc4, 0xef, 0x83, 0xa8, 0xa7, 0xf3,
+    0x35, 0x11, 0x5e, 0xfc, 0xd4, 0xc2, 0x17, 0xf6, 0xa2, 0x8f, 0x6b, 0x35,
+    0xf9, 0xae, 0xd1, 0x8f, 0xbd, 0x26, 0xf2, 0xfc, 0x6e, 0x2a, 0xf7, 0xeb,
+    0xb7, 0xbe, 0x44, 0x8d, 0xcb, 0x27, 0xe3, 0x37, 0x11, 0xde, 0x93, 0xcf,
+    0xcd, 0xfb, 0x31, 0xdf, 0x65, 0x42, 0xf7, 0x96, 0xe7, 0xed, 0x98, 0xe0,
+    0x8d, 0x14, 0x79, 0x86, 0x69, 0x07, 0xe7, 0x98, 0xb3, 0xfe, 0xa4, 0xf9,
+    0x73, 0x51, 0xd7, 0x9d, 0x34, 0x6f, 0xac, 0x99, 0x03, 0x42, 0xd2, 0x56,
+    0xde, 0xcd, 0xef, 0x2f, 0x5c, 0x7d, 0xab, 0xc1, 0x54, 0x4e, 0x2e, 0x84,
+    0x94, 0x53, 0x0b, 0x81, 0x90, 0x45, 0xa6, 0x72, 0x0a, 0xfe, 0xe6, 0x44,
+    0x43, 0xad, 0x72, 0x6e, 0xa1, 0x51, 0x39, 0xbd, 0xb0, 0x9a, 0xdf, 0x8a,
+    0x30, 0xf7, 0x3c, 0xbf, 0xb1, 0xc8, 0xf1, 0xa5, 0xf7, 0x4a, 0x43, 0xb9,
+    0xf6, 0xa6, 0xfa, 0xbc, 0xa3, 0x77, 0x85, 0x3a, 0x66, 0xdb, 0x6a, 0xd4,
+    0xd4, 0x27, 0x50, 0x63, 0xc5, 0x7c, 0x06, 0xeb, 0x23, 0xa4, 0xa8, 0x73,
+    0x5b, 0x30, 0x4e, 0x9f, 0xc3, 0x8e, 0xd6, 0x6b, 0xb8, 0xaf, 0xb4, 0xb9,
+    0x34, 0x86, 0xda, 0x89, 0x02, 0x1a, 0x5d, 0x29, 0x1c, 0x63, 0xae, 0x51,
+    0x5b, 0x5f, 0xc5, 0x58, 0x03, 0xda, 0xf3, 0xab, 0x35, 0xc1, 0x43, 0x1d,
+    0x64, 0xf4, 0x91, 0xe0, 0xe1, 0xec, 0x42, 0x39, 0x71, 0xae, 0x88, 0x3a,
+    0xd1, 0xf8, 0x2b, 0xdc, 0xc7, 0xb1, 0x48, 0x2d, 0xf4, 0x98, 0x6d, 0xcc,
+    0x04, 0x7f, 0x06, 0xf4, 0x9a, 0x73, 0xc7, 0xc0, 0xd1, 0x45, 0xa2, 0x9f,
+    0x68, 0x54, 0xc3, 0xef, 0x1d, 0xa8, 0x23, 0x75, 0xa5, 0x79, 0xba, 0x44,
+    0xbc, 0x3f, 0xf8, 0x4c, 0xcd, 0xdf, 0x83, 0x51, 0x95, 0x1a, 0xfc, 0xf0,
+    0x9a, 0xfa, 0xc3, 0x64, 0x5a, 0x1e, 0x35, 0x38, 0x1b, 0x57, 0x6d, 0x5b,
+    0x6b, 0x2e, 0x22, 0x99, 0xa3, 0x9e, 0x71, 0xe2, 0xcb, 0x25, 0xdc, 0x1b,
+    0xeb, 0x11, 0xe8, 0xe7, 0xe5, 0x39, 0x55, 0x75, 0x25, 0xa8, 0xb1, 0xd7,
+    0x8c, 0x81, 0x35, 0xbd, 0xce, 0x9a, 0x17, 0x81, 0xa3, 0xf9, 0xc7, 0x96,
+    0x5d, 0x17, 0x3a, 0x51, 0xe3, 0xae, 0x09, 0x1f, 0xa9, 0xca, 0x35, 0x13,
+    0x26, 0xe8, 0xe7, 0xc5, 0x3a, 0xb0, 0x1f, 0x9c, 0xe1, 0xa6, 0x18, 0x16,
+    0x22, 0xae, 0xa7, 0xf9, 0x4d, 0x2d, 0x8e, 0x3c, 0xf0, 0x74, 0x24, 0x00,
+    0x19, 0xf1, 0x1b, 0x3e, 0xe7, 0xb6, 0xec, 0xa3, 0xcb, 0xfd, 0xef, 0x12,
+    0x9f, 0x95, 0x65, 0xe2, 0xe6, 0xce, 0x01, 0x6b, 0x91, 0xf8, 0x2d, 0x52,
+    0xa3, 0x53, 0x11, 0xc6, 0x2d, 0xf7, 0x17, 0xa3, 0xa8, 0x49, 0xcc, 0x05,
+    0xa6, 0xf2, 0x82, 0x16, 0x3a, 0x15, 0x29, 0xf7, 0x17, 0xa9, 0x2d, 0x3c,
+    0x16, 0x63, 0xff, 0x51, 0xd7, 0x5c, 0x1e, 0xf3, 0xa0, 0x76, 0xee, 0x14,
+    0xfd, 0xb2, 0x58, 0x89, 0xea, 0x5f, 0x82, 0x8b, 0x54, 0xf1, 0xb6, 0x16,
+    0x02, 0xdc, 0x5a, 0xac, 0x96, 0x85, 0x3c, 0x6a, 0x88, 0xb6, 0xce, 0xb5,
+    0x62, 0x1e, 0x71, 0x12, 0x75, 0xc7, 0xfa, 0x66, 0xae, 0x99, 0xb9, 0x5e,
+    0x07, 0x8e, 0xfa, 0x7e, 0x39, 0xe7, 0x3e, 0xc5, 0x66, 0x8c, 0x9a, 0x9a,
+    0x4b, 0xc9, 0xa8, 0xa9, 0x15, 0xb5, 0xfd, 0xd9, 0x99, 0x80, 0x11, 0x53,
+    0x79, 0x9e, 0xcf, 0x27, 0xde, 0xc1, 0x61, 0x33, 0xc0, 0xf5, 0xb2, 0x7f,
+    0x5d, 0x2e, 0x6e, 0xf3, 0x1b, 0xa0, 0x8c, 0xd9, 0xd7, 0x9f, 0xcd, 0xa4,
+    0x9d, 0x39, 0x7e, 0xdf, 0x62, 0x99, 0x57, 0xc0, 0x1f, 0x31, 0x1e, 0xbf,
+    0x69, 0x70, 0x6d, 0x17, 0x42, 0xcd, 0xdc, 0x88, 0x3c, 0xa1, 0x04, 0xfa,
+    0x19, 0x41, 0x0d, 0x7c, 0x87, 0x5e, 0xad, 0x7e, 0x01, 0x39, 0xab, 0xfe,
+    0x9a, 0x11, 0xc6, 0xbb, 0x31, 0x47, 0xf0, 0x03, 0xbf, 0x16, 0xf8, 0x06,
+    0x70, 0x41, 0x23, 0x78, 0xd1, 0x9c, 0xdf, 0x01, 0xf8, 0x37, 0x89, 0x22,
+    0x9c, 0x4b, 0xf8, 0x5d, 0xf8, 0xff, 0x2c, 0x6a, 0xcc, 0x32, 0xe8, 0x26,
+    0xeb, 0xfc, 0x5f, 0x38, 0xef, 0xd3, 0xc5, 0x4e, 0x9f, 0x7d, 0x2f, 0xfb,
+    0xdd, 0xda, 0xf6, 0xc9, 0xeb, 0xea, 0xc3, 0xc2, 0xdf, 0x21, 0xfa, 0x9d,
+    0x71, 0x9d, 0x1e, 0xcd, 0x49, 0xbb, 0x31, 0x96, 0x9d, 0xf7, 0xff, 0x91,
+    0x79, 0xe3, 0x0f, 0xcc, 0xb3, 0x7c, 0x18, 0x87, 0x7f, 0x3b, 0x31, 0x1d,
+    0x1c, 0xd6, 0x33, 0x29, 0x53, 0xe3, 0xba, 0x98, 0xde, 0x2f, 0xed, 0x1b,
+    0xbe, 0xff, 0xd1, 0x1c, 0x5a, 0x21, 0x17, 0xc6, 0x31, 0x1c, 0x1c, 0x8e,
+    0xf9, 0x3e, 0x47, 0xde, 0x8c, 0x1b, 0xb0, 0x2c, 0xf1, 0x6e, 0xc7, 0xf9,
+    0x92, 0x49, 0xeb, 0xa7, 0x4b, 0x2f, 0xc7, 0xc4, 0xbb, 0x1d, 0xa2, 0xe0,
+    0xc4, 0x97, 0xb6, 0xe5, 0x73, 0xe3, 0x6a, 0x61, 0xcc, 0x74, 0xdf, 0xd4,
+    0x3f, 0x12, 0x7b, 0xbe, 0xb2, 0x70, 0x94, 0x6a, 0xa2, 0xd6, 0xcf, 0xba,
+    0xef, 0x36, 0x60, 0xa7, 0x3e, 0xc7, 0x4e, 0x79, 0x1f, 0x5e, 0x5b, 0xa1,
+    0x87, 0xeb, 0xc3, 0x53, 0x2b, 0xd5, 0x80, 0x1e, 0x53, 0xcb, 0x71, 0x67,
+    0xbc, 0x0f, 0xbf, 0xe5, 0xfe, 0x14, 0x72, 0xae, 0xb3, 0xaa, 0xd5, 0xdf,
+    0xdb, 0xb4, 0x8a, 0xe7, 0xa5, 0x9d, 0xbc, 0x0a, 0x7e, 0x5f, 0xb9, 0x6e,
+    0xbf, 0x50, 0x41, 0xee, 0xc4, 0xb2, 0x10, 0xbc, 0x62, 0xdd, 0xbf, 0x05,
+    0xef, 0x9f, 0x7a, 0x34, 0xd3, 0xb6, 0xf5, 0xfa, 0x2b, 0x58, 0xe3, 0xa6,
+    0xb7, 0x83, 0xe5, 0xfe, 0xac, 0x35, 0xd1, 0xd9, 0x4d, 0xf7, 0x34, 0x04,
+    0x62, 0x8b, 0x14, 0xe8, 0xb4, 0x68, 0x33, 0x5d, 0xf0, 0x05, 0xfc, 0x79,
+    0x0a, 0xeb, 0xa7, 0xe8, 0x01, 0xe8, 0x83, 0xa1, 0x9f, 0xcf, 0x7a, 0xd9,
+    0xc2, 0x61, 0x8d, 0x75, 0x86, 0x4a, 0xc5, 0xc6, 0x8f, 0x49, 0xf3, 0x77,
+    0x90, 0x16, 0xdb, 0x22, 0xea, 0x1f, 0xad, 0x73, 0x9b, 0x78, 0x15, 0x58,
+    0x47, 0x19, 0xc4, 0x0a, 0x0b, 0xbe, 0xa9, 0xa4, 0x49, 0x6d, 0x2c, 0xa5,
+    0x9a, 0x14, 0x98, 0xda, 0xc5, 0x05, 0x50, 0x39, 0x6a, 0xd0, 0x01, 0x85,
+    0xe3, 0x84, 0x1a, 0xd9, 0x7a, 0x30, 0xbc, 0xeb, 0xd4, 0x12, 0x6e, 0x39,
+    0xf5, 0x55, 0xd7, 0xf9, 0x4f, 0xc1, 0x8e, 0x5e, 0xa4, 0xb0, 0xff, 0x45,
+    0xe8, 0x97, 0x88, 0x5f, 0xc1, 0x30, 0xc6, 0x34, 0xc4, 0x4f, 0x9e, 0xbb,
+    0x8a, 0x3e, 0xcf, 0x33, 0x6c, 0xdb, 0x1b, 0x9a, 0x5c, 0x5a, 0x11, 0x83,
+    0x52, 0xfc, 0x34, 0x56, 0x46, 0xc1, 0xce, 0x6d, 0x4a, 0x0d, 0xec, 0x55,
+    0x6d, 0x7d, 0x37, 0x1b, 0x4e, 0x35, 0x28, 0x2e, 0x4e, 0x09, 0xc5, 0xaa,
+    0x03, 0x9d, 0x21, 0x25, 0x1c, 0x0b, 0x71, 0x2c, 0xb9, 0xcd, 0xb6, 0x7f,
+    0x6d, 0x86, 0x5b, 0x1b, 0x94, 0xab, 0xf6, 0x3b, 0x66, 0x79, 0xe8, 0x5d,
+    0xa7, 0x86, 0x39, 0x26, 0x7c, 0x84, 0xfb, 0x46, 0x13, 0xd6, 0x4f, 0x23,
+    0xea, 0xc1, 0xa7, 0xc7, 0x3e, 0xcd, 0x6e, 0x03, 0x8d, 0x18, 0x0b, 0xfd,
+    0x1b, 0xf8, 0xc9, 0xfb, 0x02, 0xe2, 0x5d, 0xed, 0x08, 0xc5, 0x9c, 0xfa,
+    0xdb, 0x7d, 0x0f, 0x91, 0xb6, 0xb1, 0xe8, 0x33, 0x74, 0xf5, 0x20, 0x8f,
+    0xad, 0xa3, 0x2d, 0xd8, 0x7f, 0x91, 0x6a, 0xe0, 0x4f, 0x78, 0xec, 0x29,
+    0x27, 0x46, 0xd4, 0xe1, 0x1c, 0x6a, 0x8b, 0x57, 0xc8, 0x88, 0x73, 0x98,
+    0x75, 0x74, 0x4a, 0xe0, 0xa9, 0x26, 0xe4, 0x05, 0x59, 0xe9, 0x7d, 0x58,
+    0x28, 0x53, 0x41, 0x41, 0x63, 0x52, 0xca, 0x2b, 0xb5, 0xf7, 0x60, 0xb8,
+    0xef, 0x19, 0x72, 0xf1, 0xbc, 0x48, 0x22, 0x79, 0xaf, 0x80, 0x31, 0x05,
+    0x9e, 0xa6, 0x04, 0x4f, 0xa8, 0xfb, 0x83, 0xe1, 0xd0, 0x33, 0xf4, 0x22,
+    0xc9, 0xdf, 0xac, 0xea, 0x8c, 0x67, 0x1c, 0x39, 0x1d, 0x91, 0x3c, 0x14,
+    0xde, 0x43, 0xe7, 0x90, 0x23, 0x27, 0xbe, 0x07, 0x96, 0x93, 0xc4, 0x41,
+    0xae, 0x72, 0x83, 0x9c, 0x3a, 0x82, 0x52, 0x4e, 0x0f, 0x04, 0xcb, 0x43,
+    0x5b, 0x15, 0x57, 0x4e, 0xee, 0x59, 0x59, 0x0e, 0x6e, 0x9c, 0x94, 0x36,
+    0xaa, 0x9a, 0x75, 0x7a, 0x27, 0x15, 0xfb, 0xb7, 0x90, 0xd6, 0x5a, 0xa2,
+    0x04, 0x5b, 0xf7, 0x52, 0x71, 0xaa, 0x83, 0xd4, 0xda, 0x12, 0xf0, 0x9e,
+    0x50, 0x2e, 0x29, 0x7d, 0x54, 0x8c, 0x9a, 0xd7, 0xb6, 0xff, 0x2b, 0xa2,
+    0x85, 0x8a, 0x94, 0x60, 0x08, 0x73, 0x63, 0x45, 0x54, 0x33, 0x08, 0xde,
+    0x3a, 0x39, 0x39, 0x2a, 0x05, 0x6f, 0x77, 0xca, 0x33, 0xf7, 0xbd, 0x7c,
+    0x30, 0x9c, 0x6d, 0x54, 0x5c, 0xba, 0x32, 0x5a, 0xac, 0xd6, 0x22, 0xc5,
+    0x4a, 0xa0, 0xb3, 0x41, 0xe1, 0xbb, 0x85, 0x0f, 0x02, 0x7f, 0xc7, 0x82,
+    0xe1, 0x54, 0xa3, 0x82, 0xd8, 0x29, 0xe4, 0x71, 0x15, 0x7d, 0x9e, 0xaf,
+    0xeb, 0x6c, 0x54, 0x6c, 0xfb, 0x64, 0x64, 0x1d, 0xd5, 0x09, 0xda, 0x9a,
+    0x3e, 0xf1, 0xf0, 0x8b, 0x64, 0xb8, 0x12, 0x3a, 0x78, 0x52, 0x61, 0x59,
+    0xa8, 0xbb, 0x7e, 0x72, 0x30, 0x3c, 0xf8, 0x32, 0xb9, 0x38, 0x65, 0x94,
+    0x97, 0x32, 0x0d, 0x9d, 0x86, 0x0e, 0x9e, 0x76, 0x74, 0xf0, 0x19, 0xe8,
+    0xe0, 0xcb, 0x88, 0xcd, 0x32, 0x87, 0xbb, 0x8a, 0x3e, 0xcf, 0x4b, 0x39,
+    0xc4, 0x95, 0xba, 0xd0, 0xcb, 0xb4, 0x06, 0x77, 0xac, 0x23, 0x4e, 0x84,
+    0x3b, 0x4f, 0x03, 0x32, 0x6e, 0x63, 0x7d, 0x8c, 0xd1, 0x69, 0xdd, 0x95,
+    0x8f, 0x2b, 0x1b, 0x2d, 0xd6, 0x09, 0xdd, 0xed, 0x87, 0x3c, 0x06, 0xc4,
+    0xdd, 0x43, 0x37, 0x14, 0x96, 0x79, 0x31, 0x6a, 0x68, 0x0d, 0x72, 0x60,
+    0x5d, 0x80, 0x7d, 0xc0, 0x8e, 0x92, 0xa4, 0x66, 0x8a, 0xa4, 0x1e, 0x30,
+    0xcf, 0x3e, 0xf0, 0xac, 0x4f, 0x28, 0xe2, 0xcd, 0xde, 0x60, 0x3d, 0x48,
+    0x2e, 0xd1, 0x96, 0xb9, 0x7a, 0x00, 0xe1, 0x85, 0x53, 0x9d, 0x24, 0x65,
+    0x92, 0x86, 0x4c, 0x92, 0x74, 0x4d, 0x26, 0xe9, 0x20, 0xcf, 0xd7, 0x09,
+    0xb9, 0xb3, 0x4c, 0x1c, 0x9d, 0x2c, 0xd4, 0xb3, 0xd0, 0xd3, 0x0a, 0xff,
+    0xc6, 0x24, 0xf5, 0xec, 0x25, 0x72, 0x71, 0x96, 0xd6, 0x67, 0xbb, 0xd4,
+    0x5f, 0x14, 0x7e, 0xdf, 0xb6, 0x33, 0xc1, 0xb0, 0xfe, 0x12, 0xaf, 0xef,
+    0xc8, 0x24, 0x23, 0xec, 0x92, 0xdf, 0x31, 0xea, 0x42, 0x2f, 0x51, 0x17,
+    0xfc, 0x9f, 0xf0, 0x07, 0x86, 0xa6, 0x84, 0x23, 0x47, 0xe8, 0xef, 0xec,
+    0x45, 0x81, 0xc7, 0x79, 0xc4, 0x9b, 0x9c, 0xcf, 0xf9, 0x99, 0xa6, 0x3f,
+    0xf8, 0x08, 0xc3, 0xd0, 0xdf, 0x66, 0xcc, 0x45, 0x9e, 0x90, 0x3f, 0x8f,
+    0x3d, 0xc8, 0x3a, 0xb4, 0x43, 0xc2, 0xfb, 0x79, 0xdf, 0xbb, 0x24, 0x7c,
+    0x04, 0xdf, 0x5f, 0x87, 0x25, 0xfc, 0x33, 0x8e, 0x25, 0x0d, 0x12, 0x7e,
+    0x8f, 0x55, 0xe6, 0x1b, 0x12, 0x6e, 0x44, 0xf6, 0x3b, 0xb5, 0x52, 0xc2,
+    0xbb, 0x54, 0xa2, 0xb7, 0x4b, 0x9d, 0x9f, 0xdc, 0xa0, 0xc8, 0x1f, 0x6b,
+    0x12, 0xf6, 0x22, 0x09, 0x8a, 0x79, 0x24, 0xdc, 0x57, 0x4a, 0x74, 0x50,
+    0x95, 0xf0, 0x22, 0x32, 0x94, 0x56, 0x45, 0xc2, 0x56, 0x90, 0xe8, 0x17,
+    0xce, 0xcf, 0x75, 0xcc, 0xd0, 0x0e, 0x17, 0xc6, 0xc6, 0x0d, 0x2e, 0xfc,
+    0xaf, 0x44, 0x6b, 0x5d, 0xf8, 0xbc, 0x42, 0x95, 0x2e, 0x3c, 0xe9, 0x81,
+    0x8c, 0xaa, 0xa9, 0x5b, 0x95, 0x9b, 0x79, 0x1c, 0xd8, 0x78, 0x81, 0x61,
+    0x07, 0xe7, 0x7d, 0x2f, 0xe0, 0x4a, 0xba, 0x58, 0x45, 0xe2, 0x97, 0x06,
+    0x15, 0xb0, 0xf8, 0xbf, 0x86, 0x78, 0x15, 0x60, 0xf9, 0xb3, 0x2e, 0x3d,
+    0x57, 0x0d, 0x9f, 0xe2, 0xa3, 0x2f, 0x57, 0x80, 0xcf, 0xdf, 0xad, 0xe2,
+    0x98, 0x23, 0x79, 0x9b, 0xbc, 0x1d, 0xb0, 0xc4, 0xc9, 0x07, 0xeb, 0x01,
+    0x97, 0xd2, 0xeb, 0xc5, 0xe0, 0xff, 0x9d, 0x8d, 0x80, 0xc5, 0xbf, 0x40,
+    0xd0, 0x85, 0xbd, 0x77, 0x01, 0x2e, 0xa6, 0x2f, 0xca, 0xb9, 0xe8, 0x68,
+    0x17, 0x30, 0xff, 0x75, 0x74, 0x77, 0x3f, 0xd4, 0x6d, 0x74, 0xa4, 0x12,
+    0x46, 0xe4, 0x50, 0xf0, 0x50, 0x19, 0xf5, 0x0c, 0xed, 0x1b, 0x18, 0x31,
+    0x86, 0xf6, 0x0f, 0x8d, 0x95, 0x51, 0xaa, 0xab, 0xcb, 0x81, 0x90, 0x81,
+    0x77, 0x3d, 0xb8, 0x04, 0x3f, 0x9c, 0xec, 0xbe, 0x7f, 0xbb, 0xd3, 0xbb,
+    0x06, 0x1b, 0x07, 0x1e, 0xc7, 0xe4, 0xc0, 0xc8, 0xc8, 0x81, 0x11, 0x23,
+    0x38, 0x6a, 0x04, 0x33, 0x94, 0xc9, 0x00, 0xca, 0x18, 0xed, 0xed, 0xf7,
+    0xa1, 0xc1, 0xdc, 0xc8, 0x13, 0xfb, 0x8d, 0x3d, 0x43, 0x23, 0xfb, 0xfe,
+    0x7c, 0xf7, 0xc8, 0x00, 0x80, 0xfd, 0x43, 0xa3, 0x83, 0x03, 0x3c, 0x3e,
+    0xb4, 0x6f, 0xf7, 0xde, 0x01, 0x63, 0x60, 0xff, 0xd8, 0xc8, 0x93, 0x46,
+    0xf6, 0xc0, 0xd0, 0xfe, 0xb1, 0x36, 0x87, 0x19, 0xd6, 0x01, 0x07, 0x48,
+    0x67, 0x77, 0x67, 0xd3, 0x58, 0x8e, 0x3b, 0xe9, 0xec, 0xbe, 0x02, 0x38,
+    0x9d, 0x1e, 0x69, 0x93, 0x38, 0xc1, 0xd1, 0x10, 0xa3, 0x6f, 0x30, 0xda,
+    0x24, 0x55, 0x70, 0x54, 0x2c, 0xb4, 0xab, 0xcd, 0xf8, 0xde, 0xee, 0xe1,
+    0x27, 0x06, 0xda, 0x19, 0x36, 0x1e, 0x33, 0xda, 0x25, 0x37, 0x44, 0xa3,
+    0x03, 0x63, 0x46, 0x7a, 0xf8, 0x71, 0x63, 0x28, 0x63, 0x08, 0xb6, 0xc5,
+    0x3e, 0xb2, 0x1f, 0xcc, 0x84, 0x82, 0x99, 0x0d, 0x6d, 0xc6, 0x5e, 0xa0,
+    0x64, 0x87, 0x87, 0xaf, 0xcd, 0xa3, 0xd3, 0x3b, 0xb2, 0x7b, 0x6c, 0x40,
+    0xac, 0xd2, 0x68, 0x14, 0x80, 0x69, 0x9c, 0x56, 0x2e, 0x9d, 0xce, 0x66,
+    0x47, 0x47, 0xc4, 0x11, 0xda, 0x96, 0xce, 0x21, 0x24, 0x02, 0x08, 0x32,
+    0xc9, 0x8a, 0x15, 0x87, 0x0f, 0xa4, 0x1f, 0x77, 0x8e, 0x99, 0x78, 0xa4,
+    0x0b, 0x94, 0x0e, 0x7c, 0x0d, 0xa4, 0xfb, 0x0b, 0x60, 0xd0, 0xf5, 0x0e,
+    0xed, 0xdf, 0x7f, 0xa0, 0x37, 0x3b, 0xf8, 0x64, 0xaf, 0x10, 0xf7, 0x9d,
+    0x77, 0x06, 0x8c, 0xa6, 0xa6, 0x36, 0xc3, 0x08, 0xee, 0xc2, 0xfc, 0xf6,
+    0xee, 0x88, 0xe1, 0x8a, 0x6d, 0x7b, 0x77, 0x53, 0x01, 0xdc, 0x5c, 0x00,
+    0x6f, 0x5a, 0x82, 0xbf, 0xbd, 0x13, 0x3b, 0x15, 0xc8, 0x79, 0xdf, 0x48,
+    0xd3, 0xd2, 0x66, 0xfb, 0x46, 0x9a, 0x0b, 0xe0, 0x4d, 0x05, 0x70, 0x53,
+    0xe4, 0x1a, 0x47, 0x4c, 0x73, 0xf7, 0xa6, 0xc2, 0x7e, 0x32, 0xd9, 0x9d,
+    0xe8, 0xed, 0xda, 0xde, 0xdd, 0x26, 0xaf, 0x66, 0xa9, 0xdf, 0x68, 0x80,
+    0x3b, 0x67, 0xf0, 0x91, 0xae, 0xde, 0xed, 0x0f, 0x25, 0x3b, 0x9a, 0x0a,
+    0xf7, 0xde, 0xb6, 0x63, 0xc7, 0x43, 0xbd, 0x3d, 0xdd, 0xf7, 0x6f, 0xdb,
+    0xb1, 0x6d, 0xc7, 0xd6, 0xde, 0x44, 0x4f, 0x77, 0x97, 0xd1, 0xe4, 0xae,
+    0xb1, 0xcc, 0x5c, 0xb3, 0x3b, 0x97, 0xde, 0x3d, 0x3c, 0xd4, 0x6f, 0x64,
+    0x0e, 0xec, 0x1f, 0x90, 0x23, 0xcb, 0xe0, 0x6e, 0x72, 0x71, 0xfb, 0x0f,
+    0xec, 0x1e, 0xc9, 0x08, 0xc1, 0xf5, 0xee, 0x11, 0x3e, 0xe2, 0x9b, 0x64,
+    0xbd, 0x66, 0x90, 0x15, 0x31, 0x64, 0xcb, 0xdf, 0x30, 0xbe, 0xb1, 0x82,
+    0xbe, 0xfb, 0x7d, 0x04, 0x5c, 0x03, 0xed, 0x14, 0xbe, 0x59, 0x7c, 0x47,
+    0xf1, 0xe5, 0xf1, 0x9d, 0xa9, 0x23, 0xeb, 0x0d, 0x7c, 0x63, 0xf8, 0xc6,
+    0xf1, 0x4d, 0xe2, 0x83, 0xc2, 0xf4, 0xf2, 0x5d, 0x8d, 0x3d, 0x99, 0x1d,
+    0xe0, 0x7d, 0xbe, 0xb5, 0x31, 0x7e, 0xe0, 0xc0, 0x18, 0x6a, 0x05, 0x09,
+    0x18, 0x0f, 0xa7, 0x70, 0x80, 0x48, 0xd3, 0xa6, 0x3b, 0x23, 0x7f, 0xb2,
+    0x31, 0x82, 0xbf, 0x7b, 0x36, 0xee, 0x6d, 0x6d, 0x6e, 0xca, 0xec, 0xe9,
+    0x6f, 0xda, 0x98, 0x19, 0x1a, 0x19, 0x7b, 0xd2, 0x08, 0x3d, 0x00, 0x2b,
+    0x89, 0xdc, 0x0d, 0xa4, 0xe6, 0x4d, 0xc6, 0x46, 0xa3, 0x29, 0xd2, 0x76,
+    0x57, 0x53, 0xdb, 0xa6, 0x7b, 0x36, 0xe0, 0x10, 0xa1, 0xfd, 0x4f, 0x0c,
+    0x0f, 0x6f, 0x80, 0x2d, 0xee, 0x86, 0x22, 0x8c, 0xb1, 0x05, 0x65, 0x8c,
+    0xf4, 0x81, 0xfd, 0xa3, 0x07, 0x86, 0x07, 0xca, 0xa4, 0x2f, 0xbd, 0xf6,
+    0x47, 0xff, 0xcf, 0xff, 0x1e, 0xfb, 0x7e, 0xef, 0xe8, 0xc0, 0xc8, 0xd0,
+    0xee, 0xe1, 0xa5, 0x34, 0x94, 0x2c, 0xf1, 0x4e, 0xe2, 0x27, 0x2b, 0x05,
+    0xf8, 0x33, 0xb4, 0x08, 0xb2, 0xd6, 0x54, 0xb3, 0x1c, 0x57, 0x1a, 0x6f,
+    0x5f, 0x41, 0x95, 0x2b, 0xec, 0x6f, 0x00, 0xae, 0xc5, 0xb7, 0xee, 0xff,
+    0x80, 0x27, 0x65, 0xf0, 0xf6, 0xca, 0xca, 0x15, 0x55, 0xfa, 0x75, 0x7b,
+    0x9c, 0x90, 0x72, 0xff, 0x63, 0xfb, 0x2a, 0x63, 0xb7, 0xaf, 0x60, 0x5a,
+    0x17, 0x67, 0x2d, 0x09, 0x9b, 0x76, 0x66, 0x07, 0x07, 0x86, 0x87, 0x0e,
+    0x09, 0x68, 0xdf, 0xee, 0x34, 0x2c, 0x5c, 0xbc, 0xd0, 0xa5, 0x33, 0xce,
+    0xec, 0x50, 0xf3, 0xa8, 0x03, 0xed, 0x1b, 0x4d, 0x5f, 0x83, 0x9a, 0x24,
+    0x34, 0x3a, 0x3a, 0xe4, 0x8c, 0x8d, 0xee, 0x71, 0x67, 0xd3, 0x43, 0xfb,
+    0x5c, 0xda, 0xd1, 0xec, 0x12, 0x0f, 0xa8, 0xb9, 0x09, 0xa1, 0x03, 0xf9,
+    0x9c, 0x6c, 0x5d, 0x5d, 0xf9, 0x5f, 0x0a, 0xb3, 0x94, 0x32,
+};
+
+const firmware_blob_t firmware_blob_41bb22eec9116297 = {
+    blob_41bb22eec9116297_z, sizeof(blob_41bb22eec9116297_z), 10092, 0xa2e23647
+};
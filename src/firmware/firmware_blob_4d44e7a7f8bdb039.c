@@ -0,0 +1,476 @@
+/**
+ * Embedded Firmware blob 4d44e7a7f8bdb039
+ * Used by: t20 SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 10176 bytes, 5526 compressed
+static const uint8_t blob_4d44e7a7f8bdb039_z[] = {
+    0x78, 0xda, 0xd5, 0x5a, 0x7d, 0x70, 0x5c, 0xd5, 0x75, 0x3f, 0xfb, 0xf6,
+    0x49, 0x5a, 0x7d, 0x59, 0x4f, 0xeb, 0xc5, 0x2c, 0x58, 0x71, 0xde, 0xda,
+    0x6f, 0xa5, 0x05, 0xcb, 0xe4, 0x49, 0x96, 0x61, 0xa3, 0x3c, 0xe1, 0x65,
+    0x77, 0x25, 0xdb, 0xc1, 0x60, 0x59, 0x16, 0xc5, 0x24, 0xcc, 0xe8, 0x63,
+    0x77, 0x6d, 0x29, 0x95, 0xed, 0x45, 0x92, 0x13, 0xd3, 0x2a, 0xe5, 0x45,
+    0x16, 0x44, 0xc9, 0xec, 0x48, 0x2a, 0x25, 0x19, 0xa7, 0xa5, 0x99, 0x8d,
+    0x2d, 0x01, 0x4d, 0x77, 0x2c, 0x83, 0x49, 0xca, 0x74, 0x42, 0xd1, 0x18,
+    0x83, 0xdd, 0xfe, 0x53, 0xd2, 0x66, 0x5a, 0xfe, 0xc8, 0xb4, 0x06, 0x9c,
+    0xc4, 0xed, 0x30, 0x03, 0x9d, 0xa1, 0x89, 0x13, 0x4c, 0x5f, 0x7f, 0xe7,
+    0xbe, 0xf7, 0xac, 0x27, 0xa1, 0xb6, 0x7f, 0x57, 0x33, 0xeb, 0x73, 0xcf,
+    0xb9, 0xe7, 0xde, 0x7b, 0xee, 0xb9, 0xe7, 0xeb, 0xde, 0xe7, 0x0a, 0x53,
+    0x4a, 0x10, 0xfe, 0x24, 0x4a, 0xb6, 0x55, 0x98, 0x93, 0x76, 0xbb, 0xdf,
+    0xa6, 0x59, 0x4f, 0xf8, 0x0d, 0xcb, 0xca, 0xb4, 0x69, 0x4a, 0x0a, 0x34,
+    0xbb, 0x2f, 0x41, 0x01, 0x43, 0xbe, 0x11, 0xd8, 0x41, 0xfd, 0xd3, 0x09,
+    0x93, 0x2a, 0x0d, 0x1a, 0xfa, 0x56, 0xe2, 0x2f, 0xcb, 0x29, 0xc0, 0x7d,
+    0x27, 0x28, 0x39, 0x5b, 0x4b, 0xb2, 0x16, 0x89, 0x11, 0x85, 0x68, 0x77,
+    0x81, 0x4c, 0xc9, 0x38, 0x75, 0x77, 0x52, 0x53, 0xa8, 0x5c, 0x8b, 0x84,
+    0x89, 0x6a, 0xa8, 0x52, 0x8b, 0x74, 0x27, 0x68, 0x13, 0x55, 0x68, 0x44,
+    0xf7, 0x17, 0x02, 0x54, 0x7d, 0x8b, 0x58, 0x2f, 0x36, 0x9c, 0x8f, 0xa8,
+    0x3f, 0x24, 0x99, 0x9e, 0x02, 0xed, 0xc9, 0x82, 0x4c, 0xe9, 0x67, 0x48,
+    0x7b, 0x73, 0xc2, 0xaa, 0x5b, 0xd0, 0x7d, 0x94, 0xd1, 0x3e, 0xb2, 0x0e,
+    0x87, 0x6a, 0x28, 0xa9, 0x91, 0x59, 0x61, 0x98, 0x1d, 0xef, 0x16, 0xa4,
+    0xa4, 0x8c, 0xb9, 0x52, 0x73, 0x16, 0x65, 0x74, 0x93, 0x32, 0x6d, 0x68,
+    0x17, 0x65, 0xda, 0x5d, 0x24, 0x4a, 0x17, 0xb9, 0xff, 0x09, 0xd0, 0x99,
+    0xa6, 0x51, 0x57, 0x31, 0x46, 0x9d, 0xf3, 0x01, 0xba, 0xe2, 0xe7, 0x75,
+    0x58, 0x1e, 0xb3, 0x23, 0x59, 0x08, 0x51, 0x72, 0x8e, 0x69, 0x3e, 0x4a,
+    0xea, 0xd7, 0xac, 0x57, 0x9b, 0xaa, 0x48, 0x82, 0x8c, 0xe7, 0x16, 0xd5,
+    0x29, 0x79, 0xc2, 0x4f, 0xd2, 0x86, 0x10, 0xbd, 0xb6, 0xf8, 0x70, 0x2d,
+    0xd5, 0xf0, 0x5e, 0xec, 0x31, 0xa9, 0x02, 0x51, 0x1e, 0x73, 0xa7, 0x0b,
+    0xfd, 0xe0, 0x0d, 0xd1, 0xc9, 0xb9, 0x7e, 0xac, 0xf1, 0x89, 0x35, 0x18,
+    0x02, 0xef, 0x2c, 0xc6, 0xce, 0xf2, 0x7c, 0x61, 0x7a, 0xb5, 0x89, 0xe7,
+    0xe3, 0xf1, 0xfb, 0x30, 0x9e, 0x97, 0xfc, 0xc4, 0x4a, 0x28, 0xcb, 0xeb,
+    0xbe, 0x36, 0x4b, 0x58, 0x9b, 0xf9, 0x98, 0xdf, 0xc2, 0xfa, 0xac, 0x33,
+    0x77, 0x8c, 0x42, 0xa9, 0x42, 0x35, 0x49, 0x86, 0x8e, 0xbd, 0x46, 0x94,
+    0x41, 0xa2, 0xf5, 0x12, 0x7d, 0x60, 0xf9, 0x85, 0x6c, 0x32, 0x25, 0x8a,
+    0x01, 0xec, 0xe9, 0x06, 0x70, 0x15, 0xd0, 0x4f, 0x7e, 0xc8, 0xa6, 0x18,
+    0xbc, 0xcf, 0x5d, 0x58, 0xcb, 0xec, 0x90, 0xce, 0xe2, 0x37, 0x73, 0x2b,
+    0xe8, 0xcc, 0xf7, 0x17, 0xe0, 0x6b, 0x00, 0x74, 0xe5, 0x8b, 0x28, 0x44,
+    0xae, 0x8c, 0x2c, 0x0f, 0xb7, 0x13, 0xf7, 0x26, 0x35, 0x5e, 0xff, 0x3a,
+    0xd6, 0x27, 0xac, 0xdd, 0x81, 0xb5, 0xa9, 0x32, 0xa9, 0x6d, 0xa4, 0x41,
+    0xfa, 0xc8, 0x97, 0x10, 0xfa, 0xaa, 0x31, 0xfd, 0x6d, 0x41, 0x95, 0x68,
+    0xae, 0x23, 0x5d, 0xa2, 0x73, 0x92, 0x71, 0x4d, 0x4d, 0x94, 0xae, 0xe2,
+    0x77, 0x05, 0xbf, 0xf7, 0xd5, 0x54, 0x89, 0x4c, 0xbf, 0x16, 0x52, 0x53,
+    0xf3, 0xee, 0xfc, 0x01, 0x9e, 0x1f, 0x7c, 0x57, 0xd5, 0x5d, 0x85, 0x1b,
+    0x6a, 0x97, 0xb0, 0x81, 0xb9, 0x8e, 0xce, 0xc2, 0x7a, 0xba, 0x42, 0xf5,
+    0xb4, 0x44, 0x3e, 0x7a, 0x32, 0x4f, 0xe7, 0x64, 0x23, 0x08, 0x7e, 0x05,
+    0x36, 0x71, 0x55, 0x7d, 0x0a, 0x7c, 0x4f, 0x16, 0xb6, 0xc6, 0xcf, 0xd0,
+    0x0d, 0xeb, 0x4a, 0x88, 0x75, 0xe6, 0xa7, 0x5c, 0x68, 0x6b, 0xec, 0x02,
+    0x5d, 0xb7, 0x8a, 0x02, 0xf7, 0x9e, 0x9f, 0xab, 0xab, 0xcd, 0x35, 0x54,
+    0x53, 0xec, 0xf8, 0x92, 0x56, 0xeb, 0xe8, 0xb9, 0xab, 0xd2, 0x86, 0xdb,
+    0x6b, 0x6c, 0x48, 0x1f, 0x96, 0x25, 0xc8, 0x94, 0x8d, 0x4b, 0x8c, 0xc7,
+    0xa7, 0x34, 0xb3, 0xdc, 0xa6, 0xbf, 0x53, 0x61, 0xc3, 0xbf, 0x77, 0xf0,
+    0x76, 0x67, 0xdc, 0xf1, 0x6a, 0x1b, 0xb6, 0x05, 0x61, 0xf3, 0x67, 0x24,
+    0xe3, 0xc4, 0xef, 0x65, 0xb4, 0x1b, 0x56, 0xb2, 0x8d, 0xe7, 0x80, 0x6e,
+    0x4a, 0x3c, 0x8f, 0x82, 0x79, 0x58, 0x9f, 0xae, 0x1e, 0x4f, 0x50, 0x7a,
+    0xf6, 0x04, 0xa5, 0x66, 0xdf, 0x82, 0x4c, 0x32, 0x4d, 0xc1, 0x76, 0x33,
+    0x85, 0x66, 0xc8, 0x16, 0xa3, 0xf3, 0x8b, 0x1b, 0xe9, 0x24, 0x74, 0xd8,
+    0x4f, 0x1a, 0xbd, 0xb4, 0xa8, 0xd2, 0x8b, 0x8b, 0x41, 0xec, 0x55, 0xa6,
+    0xfe, 0x50, 0x03, 0xce, 0x92, 0x75, 0xee, 0xc3, 0x39, 0xe1, 0xec, 0x4a,
+    0xf6, 0x1c, 0x9d, 0x98, 0x73, 0xa1, 0x20, 0xc5, 0x72, 0x79, 0x99, 0x9e,
+    0x14, 0xb4, 0x1a, 0x3a, 0x59, 0xe2, 0xb9, 0x99, 0xd7, 0x96, 0x21, 0x07,
+    0xbf, 0xe8, 0x2a, 0xb0, 0x1c, 0x69, 0xc8, 0xc1, 0x63, 0xb8, 0xaf, 0x8e,
+    0xfc, 0x46, 0x22, 0x99, 0xd1, 0x64, 0x4a, 0xc2, 0x46, 0xe7, 0x0b, 0x1b,
+    0x29, 0x25, 0xd6, 0x65, 0xfd, 0xba, 0x32, 0xf0, 0xda, 0x49, 0xdd, 0x4f,
+    0x6e, 0x9f, 0x02, 0xff, 0xdc, 0xaa, 0x3f, 0x07, 0x3d, 0x2f, 0x85, 0xb6,
+    0xa8, 0x9d, 0x14, 0x51, 0x07, 0x69, 0x8b, 0xfa, 0x24, 0x45, 0xe0, 0x4d,
+    0x7c, 0x8e, 0x3b, 0xa9, 0x0c, 0x36, 0xf0, 0xba, 0x3d, 0x36, 0x4e, 0x14,
+    0x9c, 0x83, 0x8f, 0x26, 0xde, 0x83, 0x6c, 0xe5, 0xb7, 0xf8, 0xd8, 0x0f,
+    0x95, 0x6b, 0xcd, 0x38, 0x10, 0xe1, 0xbb, 0xff, 0x69, 0x75, 0x86, 0x22,
+    0xfa, 0x45, 0xaa, 0x20, 0x45, 0x93, 0x70, 0xa4, 0xbc, 0x2f, 0xcb, 0x52,
+    0x1a, 0x37, 0x52, 0x37, 0xc6, 0x93, 0xc4, 0x6b, 0x95, 0x93, 0x7d, 0x8e,
+    0x2e, 0x2d, 0x32, 0x4d, 0x52, 0x19, 0x78, 0x59, 0xc6, 0x8f, 0x2c, 0xff,
+    0x06, 0xee, 0xbb, 0x6e, 0x91, 0x62, 0xf3, 0xec, 0x07, 0x8f, 0x2a, 0xb1,
+    0x6d, 0x54, 0x41, 0x5f, 0x12, 0x6d, 0xb9, 0xcb, 0xa5, 0x2d, 0x7e, 0x0e,
+    0xf6, 0x19, 0x48, 0x6a, 0x5b, 0x95, 0x49, 0xac, 0x97, 0x08, 0x05, 0x4f,
+    0xb1, 0x6d, 0x90, 0x12, 0xa2, 0xf9, 0xc5, 0xff, 0xb0, 0xfa, 0x15, 0xcb,
+    0x6a, 0x69, 0xfc, 0xc8, 0x62, 0x19, 0x5a, 0x1a, 0x13, 0x73, 0xe0, 0x30,
+    0x15, 0xe2, 0x3e, 0xd6, 0x9f, 0x82, 0x33, 0x88, 0xc4, 0x12, 0x52, 0x44,
+    0xef, 0x97, 0x22, 0x71, 0x92, 0x58, 0x8f, 0x07, 0xa1, 0x47, 0xb6, 0x55,
+    0xf3, 0xcf, 0xd6, 0x13, 0x7d, 0xbb, 0x9e, 0xd8, 0xff, 0xa2, 0xd3, 0x8f,
+    0x49, 0xf4, 0x9d, 0x20, 0x45, 0xe7, 0x5a, 0xa5, 0xa5, 0x49, 0x85, 0xa2,
+    0x66, 0xb7, 0x84, 0x18, 0xa4, 0x7f, 0x11, 0xb2, 0xf8, 0x48, 0xb9, 0xbb,
+    0x93, 0x6c, 0x39, 0x99, 0x37, 0x20, 0x62, 0x40, 0xbf, 0xc0, 0xcb, 0xc5,
+    0xde, 0x39, 0x36, 0xac, 0xa4, 0x4b, 0xa0, 0xf1, 0x39, 0xfe, 0xc3, 0xed,
+    0x65, 0x86, 0x39, 0xbe, 0xa0, 0xb1, 0x8d, 0x50, 0x93, 0x44, 0x5b, 0x63,
+    0x39, 0x32, 0x37, 0x49, 0xb0, 0x89, 0x62, 0x28, 0x1a, 0x3e, 0x49, 0x8f,
+    0x9b, 0x65, 0x06, 0x74, 0xaa, 0x28, 0xe9, 0x05, 0xed, 0x0f, 0xd1, 0x56,
+    0x1e, 0x5a, 0xd0, 0xa2, 0xe1, 0x1c, 0xd1, 0x06, 0x89, 0xa2, 0x1c, 0x0b,
+    0xce, 0xf9, 0x85, 0x0d, 0x90, 0x25, 0x1b, 0x9a, 0x3a, 0x4f, 0x79, 0x2a,
+    0x33, 0xa2, 0x38, 0x33, 0x7a, 0xa5, 0x73, 0x42, 0x40, 0xca, 0x96, 0x98,
+    0xe7, 0x67, 0x94, 0x2d, 0x54, 0xd0, 0x14, 0xd6, 0x37, 0x85, 0xce, 0x41,
+    0xc7, 0x98, 0x32, 0x43, 0x53, 0x20, 0xf9, 0x2b, 0x53, 0x13, 0x51, 0x25,
+    0x0d, 0xda, 0x60, 0x89, 0xae, 0x63, 0xbe, 0x73, 0x0a, 0xf8, 0xa5, 0x19,
+    0x8e, 0xef, 0x22, 0x4e, 0x89, 0x7d, 0x95, 0xcd, 0xb8, 0x7e, 0x33, 0x21,
+    0xec, 0x7d, 0x19, 0x9f, 0x66, 0x7d, 0x79, 0xf0, 0x67, 0x80, 0x57, 0x60,
+    0x48, 0xb3, 0x88, 0x31, 0xdd, 0xa5, 0xbf, 0xe6, 0x33, 0x84, 0x3e, 0x43,
+    0x68, 0xbf, 0xea, 0xb4, 0xe1, 0x0b, 0xb3, 0xf0, 0x81, 0x59, 0xf8, 0xc0,
+    0x6c, 0x83, 0x13, 0x27, 0x75, 0xf8, 0x4e, 0x2d, 0xf4, 0x52, 0x45, 0x93,
+    0x0a, 0xc7, 0x9e, 0x75, 0x68, 0x57, 0xa3, 0xcd, 0xfc, 0x35, 0x68, 0x6f,
+    0xa4, 0xc9, 0x10, 0xb7, 0x15, 0xd8, 0x74, 0xb9, 0xa3, 0x6f, 0x7b, 0xde,
+    0x64, 0x41, 0x72, 0xf0, 0x2b, 0x68, 0xb3, 0x5e, 0xa5, 0x28, 0x28, 0xd0,
+    0xa9, 0xa4, 0x9e, 0xcc, 0x9b, 0x5b, 0x53, 0x13, 0xae, 0xcd, 0x53, 0x30,
+    0x35, 0xb1, 0x14, 0x4c, 0x4e, 0x04, 0x63, 0x6c, 0x53, 0x67, 0x6c, 0x5b,
+    0x56, 0x79, 0xe4, 0x3c, 0x7c, 0x73, 0x52, 0xc4, 0x37, 0xc9, 0xb1, 0xc1,
+    0xd5, 0xb1, 0x6b, 0x08, 0x67, 0x78, 0x05, 0x72, 0x45, 0xd4, 0x49, 0xba,
+    0x70, 0xab, 0x9f, 0xc2, 0xf0, 0xd9, 0x06, 0xf8, 0x35, 0xa2, 0x60, 0xa1,
+    0x8c, 0x12, 0x4a, 0x0d, 0xf2, 0x42, 0x0d, 0x20, 0x9f, 0xb7, 0x0f, 0x73,
+    0x70, 0x9e, 0xc0, 0x76, 0x5b, 0xbf, 0x8f, 0xd8, 0x02, 0x1b, 0x69, 0x64,
+    0xbb, 0x73, 0x6d, 0x9d, 0x7d, 0x8f, 0xd7, 0x51, 0xe8, 0x0c, 0xe2, 0xfb,
+    0x69, 0x9e, 0x07, 0xba, 0x3a, 0x3d, 0x1b, 0x76, 0x74, 0xa1, 0x62, 0xcd,
+    0xb7, 0xb1, 0x96, 0x8a, 0x98, 0xd1, 0x80, 0x58, 0x11, 0x86, 0x9d, 0x92,
+    0x19, 0x34, 0xc8, 0xac, 0xc7, 0x6f, 0x3d, 0xf6, 0x7c, 0x6e, 0x51, 0xc3,
+    0xda, 0x11, 0x13, 0x19, 0xe8, 0xde, 0x96, 0xc6, 0xf8, 0xce, 0x9e, 0xc6,
+    0x62, 0x7c, 0xac, 0x31, 0x84, 0xb5, 0xa5, 0xb0, 0x34, 0x5a, 0xc1, 0xf9,
+    0x56, 0x79, 0x8c, 0x5a, 0x49, 0x0e, 0xfa, 0x90, 0x13, 0xe9, 0x5c, 0x39,
+    0x62, 0x7b, 0xba, 0x10, 0xd1, 0x0f, 0x61, 0xaf, 0x6f, 0x14, 0xd8, 0x1f,
+    0x65, 0xf5, 0x24, 0x59, 0x34, 0xd5, 0xc6, 0x76, 0x52, 0x43, 0x9d, 0x05,
+    0x39, 0x7c, 0x46, 0xf4, 0x69, 0xb1, 0x33, 0x38, 0xf7, 0xa2, 0x63, 0x27,
+    0x17, 0x4b, 0x88, 0x47, 0xe0, 0x97, 0xc1, 0x9f, 0x05, 0xfe, 0x7a, 0x41,
+    0x0b, 0x67, 0xd1, 0xcf, 0x76, 0xcf, 0x39, 0x65, 0x57, 0x41, 0xc1, 0xbc,
+    0x3c, 0x4e, 0x8e, 0xbf, 0x47, 0x3c, 0x67, 0x54, 0xbd, 0x4a, 0xb6, 0xed,
+    0xf1, 0xd8, 0x34, 0xe6, 0x3d, 0xc9, 0xed, 0x82, 0x86, 0x3e, 0xd7, 0xfe,
+    0x02, 0x22, 0x2e, 0xbd, 0x6e, 0xcf, 0x0b, 0xdb, 0x6b, 0x52, 0x24, 0x62,
+    0x7b, 0xab, 0x42, 0x8c, 0x21, 0xba, 0x50, 0x92, 0x94, 0xb2, 0x51, 0xa2,
+    0x4b, 0x85, 0x88, 0xda, 0x2f, 0x7c, 0x32, 0x12, 0xeb, 0x21, 0xd6, 0x21,
+    0xe7, 0xe4, 0x37, 0x2d, 0x69, 0x03, 0xf6, 0x0e, 0xdb, 0x39, 0x0f, 0xdb,
+    0x79, 0x09, 0x3a, 0x7b, 0x71, 0x36, 0xe4, 0xe8, 0x2d, 0x06, 0xbd, 0x71,
+    0xdc, 0xe5, 0x9c, 0xf0, 0xc2, 0xce, 0xa4, 0xc6, 0xfa, 0x63, 0xdd, 0x45,
+    0x4e, 0x15, 0x29, 0x32, 0x6d, 0x92, 0x1d, 0x87, 0x7f, 0x04, 0xdd, 0xbd,
+    0x2c, 0xf4, 0xca, 0x7a, 0xb4, 0x2c, 0x59, 0x2b, 0x13, 0xf1, 0xa2, 0x4c,
+    0x93, 0xf4, 0x5c, 0x3e, 0x12, 0xfe, 0x29, 0x72, 0x4e, 0x57, 0xc1, 0x4f,
+    0x87, 0x8a, 0x9c, 0xff, 0x7e, 0x67, 0x65, 0x43, 0x01, 0x51, 0x67, 0x84,
+    0xa0, 0xfb, 0x5b, 0x0c, 0xd6, 0x79, 0x88, 0x82, 0x5a, 0x7c, 0xe7, 0x33,
+    0x8d, 0x5b, 0x30, 0xee, 0x5c, 0xfc, 0x47, 0x8d, 0x91, 0xf8, 0x20, 0x7c,
+    0xf6, 0x57, 0x73, 0x1b, 0xe9, 0x97, 0x8e, 0xde, 0x0e, 0xcf, 0xdd, 0x46,
+    0xbf, 0x08, 0x71, 0x5c, 0xb4, 0xac, 0x24, 0xec, 0xe1, 0xd0, 0x1c, 0xe7,
+    0x37, 0x89, 0x32, 0x73, 0x1c, 0x17, 0x59, 0x1f, 0x32, 0xfc, 0xb7, 0x82,
+    0xf3, 0xf5, 0xb5, 0xa9, 0x09, 0x99, 0xfc, 0x1b, 0xd8, 0x07, 0xad, 0xd7,
+    0x96, 0x6b, 0xab, 0x4f, 0xeb, 0xa2, 0xe8, 0xe8, 0xa2, 0x97, 0xca, 0x44,
+    0x5c, 0x51, 0x1a, 0x79, 0xfe, 0x77, 0xac, 0x74, 0x88, 0xd7, 0x67, 0xfc,
+    0x4e, 0x65, 0xbd, 0x84, 0x08, 0xa7, 0x48, 0x4a, 0x70, 0xd4, 0x87, 0xf1,
+    0x32, 0xdb, 0x41, 0x78, 0x3f, 0x62, 0xfa, 0xa1, 0xb9, 0x7f, 0x82, 0x31,
+    0xb2, 0x4d, 0xb3, 0x5f, 0x42, 0x07, 0xf0, 0xbf, 0x97, 0xd7, 0xd4, 0xa1,
+    0xee, 0xd8, 0x3b, 0xb2, 0x43, 0x81, 0xf3, 0x2a, 0x9f, 0x33, 0xd7, 0x1a,
+    0xb4, 0xb1, 0x7b, 0x82, 0xd6, 0x25, 0x27, 0xca, 0x29, 0xa5, 0x70, 0xae,
+    0x95, 0x40, 0xaf, 0xa6, 0x94, 0xa8, 0x75, 0x24, 0xc7, 0xde, 0xd9, 0x07,
+    0x5c, 0x7b, 0x77, 0x6d, 0xdd, 0xe7, 0xf8, 0xd3, 0x5a, 0x35, 0x51, 0x1d,
+    0x4d, 0x36, 0xf3, 0x5c, 0x1d, 0x90, 0x59, 0xac, 0x81, 0x73, 0x53, 0x8d,
+    0xa4, 0x66, 0xaa, 0x32, 0xf2, 0x0f, 0xc7, 0xa4, 0x49, 0xc4, 0xcd, 0x04,
+    0xb9, 0xbe, 0xde, 0x4c, 0xdd, 0xc8, 0x77, 0xa4, 0x4c, 0xde, 0xaa, 0x90,
+    0x2d, 0x63, 0x77, 0x81, 0xea, 0xa4, 0x3f, 0x62, 0x19, 0xcb, 0x20, 0x17,
+    0xcb, 0x74, 0x27, 0x64, 0x62, 0x59, 0xdc, 0x98, 0xe0, 0xca, 0x54, 0x07,
+    0x5f, 0xf4, 0xca, 0x15, 0x59, 0x25, 0x97, 0x19, 0xa0, 0x40, 0xd8, 0xd9,
+    0x7b, 0x2f, 0xf6, 0x7e, 0xe1, 0x56, 0xcc, 0xe6, 0xf8, 0xf5, 0x2d, 0x80,
+    0xb5, 0xce, 0x3c, 0x3c, 0x67, 0x90, 0x6c, 0x5d, 0xf2, 0x1a, 0x43, 0xa0,
+    0xcf, 0xe3, 0xe7, 0xce, 0x73, 0xb1, 0xc2, 0x9e, 0x87, 0xe5, 0xac, 0x71,
+    0xe4, 0xe0, 0xb1, 0xeb, 0x3c, 0x3c, 0xdf, 0x77, 0x78, 0x22, 0x6b, 0xe8,
+    0xe5, 0x2d, 0x51, 0x7b, 0x4e, 0xc6, 0xdc, 0x9a, 0xc1, 0xad, 0x15, 0xca,
+    0x91, 0xdb, 0x1a, 0x84, 0x8e, 0xec, 0x38, 0x7b, 0x19, 0x71, 0x76, 0x8f,
+    0x13, 0x67, 0x6d, 0xbf, 0x9f, 0xcc, 0x73, 0xed, 0x97, 0xbf, 0x57, 0x69,
+    0x64, 0x5b, 0xe7, 0x7d, 0x44, 0xe6, 0x60, 0xf7, 0x66, 0x1e, 0xb6, 0xe1,
+    0x7f, 0xda, 0x4f, 0xf2, 0xd3, 0xa2, 0x7e, 0xa4, 0x03, 0x05, 0x77, 0x1f,
+    0x9c, 0x2f, 0x2d, 0x2b, 0xd5, 0xc8, 0x73, 0xfe, 0x1c, 0xf3, 0xd9, 0xf6,
+    0xa5, 0x4a, 0xdb, 0x9d, 0x79, 0x99, 0x7f, 0x23, 0xf5, 0x70, 0x5c, 0x94,
+    0x3e, 0xb6, 0xb4, 0x46, 0x89, 0xa6, 0x9a, 0xcb, 0xb0, 0x88, 0xa8, 0x1d,
+    0x14, 0x3f, 0xb1, 0x6d, 0x73, 0xac, 0xe7, 0x9a, 0xd5, 0xb2, 0x06, 0x61,
+    0x6f, 0xea, 0x06, 0xd1, 0x5e, 0xf2, 0x1b, 0x1c, 0xa3, 0x3f, 0x84, 0x2d,
+    0x2b, 0xe4, 0x9f, 0xf1, 0xb3, 0x9f, 0x23, 0x6e, 0xa0, 0x36, 0x6f, 0x6b,
+    0x0a, 0xfb, 0xe1, 0xff, 0xf2, 0x8c, 0x76, 0x6a, 0x8c, 0xdc, 0x38, 0x14,
+    0x3d, 0x35, 0x28, 0x45, 0x4f, 0x65, 0x61, 0x2b, 0xf2, 0xd3, 0x42, 0x6e,
+    0xc4, 0x58, 0xa2, 0x3f, 0x29, 0xf9, 0x84, 0xcc, 0x93, 0x7c, 0x86, 0x33,
+    0x76, 0x1c, 0x49, 0xdf, 0x8c, 0x23, 0xec, 0x1f, 0x52, 0x38, 0x0a, 0xdf,
+    0xd8, 0x25, 0xea, 0x49, 0xde, 0x43, 0x1c, 0x3e, 0x5f, 0xc4, 0x3e, 0x22,
+    0x3a, 0x3c, 0x46, 0xec, 0x65, 0xd0, 0xb1, 0xf7, 0xb5, 0xf3, 0x0d, 0xaf,
+    0xa5, 0x22, 0xf6, 0x7d, 0x80, 0xfc, 0x19, 0x83, 0xaf, 0x7f, 0x60, 0x4d,
+    0xb5, 0x71, 0x1e, 0x55, 0x09, 0x75, 0xad, 0x29, 0x68, 0xa5, 0xfc, 0xbd,
+    0x53, 0xda, 0xe7, 0x60, 0x1b, 0xc2, 0x1f, 0x05, 0xbf, 0x9d, 0x63, 0x14,
+    0xe4, 0x97, 0x32, 0xea, 0x57, 0x38, 0x86, 0x95, 0x51, 0x16, 0x7a, 0xf4,
+    0x1b, 0x7c, 0xd6, 0xd6, 0x13, 0x19, 0x0d, 0x7e, 0xac, 0xb1, 0x0f, 0x73,
+    0xee, 0x55, 0x91, 0x57, 0xdd, 0x5a, 0x95, 0x6d, 0x7e, 0xcc, 0xb9, 0x57,
+    0x70, 0x9e, 0x65, 0xdb, 0xe7, 0xf1, 0x6f, 0x91, 0x74, 0xf6, 0x7b, 0x4e,
+    0xcd, 0xfa, 0x18, 0xfa, 0x5d, 0xdc, 0xe7, 0xb1, 0x99, 0xe5, 0x3a, 0x5d,
+    0xbe, 0x59, 0xef, 0xb6, 0x55, 0x51, 0xcd, 0xb3, 0x3b, 0x57, 0xd6, 0x9f,
+    0x9c, 0x37, 0x78, 0x7e, 0xdf, 0x79, 0xc5, 0x90, 0x15, 0x3b, 0x2f, 0x5f,
+    0x87, 0x4e, 0x38, 0x5f, 0xa8, 0x22, 0xee, 0x71, 0x4c, 0x7c, 0x69, 0x91,
+    0xf5, 0x13, 0x82, 0x5d, 0x05, 0x94, 0xe5, 0xdc, 0x1d, 0xf8, 0xfc, 0x94,
+    0x56, 0xe3, 0xc1, 0x1b, 0x80, 0x87, 0x3d, 0xb8, 0x0e, 0xbc, 0xc1, 0x83,
+    0xa7, 0x81, 0xab, 0x1e, 0xfc, 0x20, 0x70, 0xdd, 0x83, 0x8f, 0x00, 0x6f,
+    0xf3, 0xe0, 0x13, 0xc0, 0xe3, 0x1e, 0x7c, 0x0e, 0xb8, 0xe1, 0xc1, 0xe7,
+    0x81, 0x27, 0x3c, 0xf8, 0x2b, 0xc0, 0xd3, 0x1e, 0xfc, 0x32, 0xf0, 0xdd,
+    0x1e, 0xfc, 0x6d, 0xe0, 0x7b, 0x3d, 0xf8, 0x35, 0xe0, 0xdd, 0x1e, 0xfc,
+    0x3a, 0xf0, 0xe9, 0x7a, 0x1b, 0xaf, 0x69, 0x9f, 0x12, 0x31, 0x5c, 0xd4,
+    0xfe, 0xc8, 0xa5, 0x17, 0xeb, 0xd9, 0x4f, 0x88, 0xd4, 0xf6, 0x67, 0x1a,
+    0xf5, 0xf6, 0x9e, 0x46, 0x99, 0xd6, 0x23, 0xde, 0x96, 0xcf, 0xb0, 0xfd,
+    0x0b, 0xdb, 0x51, 0x4d, 0x49, 0x71, 0xf0, 0x88, 0x9a, 0x10, 0x34, 0xae,
+    0x21, 0x7f, 0x6d, 0x6d, 0xdf, 0x90, 0x40, 0x1c, 0xb1, 0x73, 0xd0, 0xcb,
+    0xb0, 0xa7, 0xf3, 0x88, 0x9f, 0x2f, 0xc1, 0x07, 0x5f, 0xbc, 0x79, 0x4e,
+    0x31, 0x27, 0xbe, 0xf9, 0xce, 0x4b, 0xe2, 0x8c, 0x6b, 0x94, 0x14, 0xf2,
+    0xe6, 0x49, 0xd4, 0x83, 0x59, 0x11, 0x93, 0x2c, 0x6b, 0x41, 0xfb, 0x9d,
+    0x93, 0x63, 0x39, 0x4e, 0xb0, 0x7c, 0x95, 0xa8, 0xf9, 0xc4, 0x5d, 0x90,
+    0xeb, 0x7a, 0xd4, 0x7a, 0xbb, 0x21, 0xef, 0xcf, 0x8c, 0x05, 0xe1, 0x93,
+    0xe7, 0x70, 0x57, 0xfe, 0xba, 0x63, 0x1f, 0xee, 0x39, 0x73, 0x2d, 0xc2,
+    0xb9, 0x8d, 0x73, 0x98, 0xf0, 0x77, 0xf8, 0x3e, 0x8f, 0xed, 0xc6, 0x38,
+    0xae, 0x4b, 0x78, 0xdc, 0x94, 0x51, 0x06, 0xdf, 0xf6, 0x1b, 0x17, 0x77,
+    0x66, 0x0a, 0xfb, 0xce, 0xf3, 0xfd, 0x2e, 0x51, 0xe2, 0xda, 0x0f, 0x77,
+    0xe9, 0x52, 0x08, 0xb0, 0x1f, 0x30, 0x0c, 0x98, 0x05, 0x6c, 0x00, 0x1c,
+    0x02, 0x54, 0x01, 0x47, 0x00, 0x35, 0xc0, 0x3c, 0x60, 0x0c, 0x70, 0x1c,
+    0x30, 0x00, 0xa8, 0x01, 0xd6, 0x00, 0xc6, 0x00, 0xab, 0x60, 0x9b, 0xa8,
+    0x29, 0x4a, 0x0a, 0xf0, 0x30, 0xa0, 0x0c, 0xc8, 0xf8, 0x39, 0xc0, 0x67,
+    0x01, 0x5f, 0x06, 0x2c, 0x02, 0xbe, 0x02, 0x38, 0x0f, 0xf8, 0x13, 0xc0,
+    0x17, 0x00, 0x97, 0x00, 0x4b, 0xec, 0x5f, 0xf0, 0xbb, 0xd7, 0x90, 0x7b,
+    0xd9, 0xdf, 0xe0, 0xd7, 0xa5, 0x66, 0xd0, 0x2b, 0xb1, 0x89, 0x48, 0x8c,
+    0x24, 0x8e, 0x23, 0x34, 0x27, 0x1b, 0x3f, 0x81, 0xbc, 0x65, 0x22, 0x16,
+    0x65, 0x0a, 0x75, 0x34, 0xa5, 0xb1, 0x3e, 0x87, 0x54, 0xe6, 0xb5, 0xf7,
+    0xc3, 0xfb, 0x95, 0xfd, 0xa9, 0xd2, 0xa3, 0xed, 0x76, 0xec, 0x9a, 0x82,
+    0xbe, 0xb8, 0x96, 0xf2, 0xe6, 0x33, 0xd5, 0x73, 0xb7, 0x5d, 0xda, 0x09,
+    0xf9, 0xa0, 0x37, 0x03, 0x35, 0x40, 0x1c, 0xbe, 0xc0, 0xf9, 0x9c, 0x6d,
+    0x42, 0x87, 0x3f, 0x34, 0x73, 0x9d, 0x30, 0x87, 0xbb, 0xce, 0x74, 0x91,
+    0xba, 0xdb, 0xe7, 0x1b, 0x4f, 0x19, 0x4f, 0x36, 0xee, 0x85, 0x1e, 0x13,
+    0xf4, 0xe3, 0xc5, 0x36, 0xf8, 0x4c, 0x0c, 0x7a, 0xde, 0x4d, 0x7f, 0x23,
+    0xfc, 0x2a, 0x4d, 0x7f, 0xb5, 0x68, 0xdb, 0xd1, 0x06, 0xe3, 0x16, 0xdc,
+    0x8f, 0x7b, 0x15, 0xe9, 0x2c, 0x8f, 0x79, 0xc1, 0x78, 0xa3, 0xd1, 0xa6,
+    0xaf, 0x87, 0xce, 0x07, 0x67, 0x74, 0xc4, 0x14, 0x5d, 0xf1, 0x9f, 0x4d,
+    0x03, 0x86, 0x01, 0x77, 0x03, 0x36, 0x00, 0xee, 0x05, 0x54, 0x01, 0xbb,
+    0x01, 0xdb, 0x00, 0x7b, 0x01, 0xe3, 0x80, 0x07, 0x01, 0x0d, 0xc0, 0x2c,
+    0xe0, 0x52, 0xbd, 0xff, 0x2c, 0xd7, 0x9c, 0x14, 0xf4, 0x9f, 0x1d, 0x01,
+    0x4c, 0x00, 0xe6, 0x01, 0x4d, 0xc0, 0x47, 0xf9, 0x3e, 0x01, 0xbe, 0x32,
+    0xdc, 0x83, 0xb6, 0x22, 0x06, 0xd9, 0x36, 0x23, 0x1b, 0x66, 0xb8, 0x9e,
+    0x1e, 0x35, 0x10, 0xff, 0x44, 0xac, 0xcc, 0xe0, 0x3c, 0xfa, 0x29, 0x12,
+    0x5b, 0x92, 0x96, 0x74, 0xd9, 0xf0, 0x9d, 0xf7, 0x1b, 0xeb, 0x03, 0x88,
+    0x03, 0x4a, 0xb6, 0x14, 0xdc, 0x23, 0x6b, 0x31, 0xc0, 0x36, 0xc4, 0xd3,
+    0x04, 0xe0, 0x3a, 0xe8, 0xd8, 0x40, 0x5c, 0x63, 0x9c, 0xf9, 0x98, 0xc6,
+    0x71, 0x3d, 0xee, 0xe0, 0x4a, 0xa5, 0xcd, 0x9f, 0x00, 0xbe, 0x17, 0x90,
+    0xe9, 0x69, 0x40, 0x1e, 0xb3, 0x5b, 0x19, 0x14, 0xe3, 0x59, 0x17, 0x5e,
+    0x5e, 0x77, 0xee, 0x38, 0x78, 0xd2, 0xe0, 0x29, 0x73, 0x78, 0xd8, 0xae,
+    0x59, 0x4f, 0xc8, 0xee, 0xca, 0x3d, 0xbe, 0x72, 0xed, 0xd1, 0xf6, 0x8b,
+    0xd0, 0x9b, 0x6d, 0xe7, 0x6c, 0xc3, 0xac, 0x47, 0x6e, 0x2f, 0xc1, 0x76,
+    0xb9, 0x96, 0xae, 0xa7, 0xcd, 0xc1, 0xc8, 0x87, 0x24, 0xf5, 0xa1, 0xfd,
+    0x04, 0xee, 0x93, 0xd5, 0xe6, 0x7e, 0x62, 0x3b, 0x30, 0xeb, 0xd3, 0x85,
+    0x0f, 0xf7, 0xf9, 0x8d, 0x3a, 0xba, 0x55, 0x63, 0xdf, 0xa2, 0x84, 0x6c,
+    0x44, 0x91, 0x63, 0xcc, 0xfa, 0x54, 0x09, 0xf6, 0x3e, 0x33, 0x8e, 0xfd,
+    0x4f, 0xa1, 0xed, 0x77, 0xea, 0x80, 0x6a, 0xf0, 0x3d, 0x8c, 0xf1, 0xeb,
+    0x29, 0x11, 0xe4, 0xfa, 0xf8, 0xb7, 0x96, 0xa4, 0x69, 0xa6, 0x24, 0x49,
+    0x2a, 0xdb, 0x91, 0xdf, 0x88, 0xa2, 0x2d, 0xfc, 0x55, 0x49, 0x95, 0x70,
+    0xe1, 0x2a, 0x98, 0xb8, 0x43, 0xf3, 0x1d, 0x4c, 0x01, 0xde, 0x0c, 0x9c,
+    0xdf, 0x5c, 0x78, 0x9d, 0x66, 0xe0, 0x9f, 0xf0, 0xd8, 0x57, 0xde, 0x95,
+    0x78, 0x9e, 0x9f, 0x56, 0x72, 0x5c, 0x28, 0x33, 0x78, 0xac, 0xac, 0x74,
+    0x97, 0x22, 0xea, 0x15, 0x49, 0x69, 0x2a, 0x83, 0x6f, 0x28, 0xad, 0xdc,
+    0xa7, 0xa1, 0xbe, 0xff, 0x32, 0x4a, 0x06, 0xc0, 0xd9, 0xe9, 0xfa, 0xae,
+    0x82, 0x59, 0x71, 0x61, 0xa2, 0x92, 0xec, 0x7b, 0x15, 0x9f, 0x19, 0xeb,
+    0x63, 0xc9, 0x78, 0xa3, 0xe9, 0xbb, 0xd0, 0xc5, 0x25, 0xe7, 0x9d, 0xc2,
+    0xf5, 0x75, 0xb6, 0x21, 0x7e, 0x23, 0xfb, 0xd8, 0x0a, 0xa0, 0x96, 0xad,
+    0xd4, 0x6e, 0x58, 0xc8, 0x79, 0xf1, 0xa1, 0x7c, 0x04, 0x77, 0x96, 0xf2,
+    0xf8, 0x2f, 0x45, 0x1d, 0xf8, 0x59, 0xfa, 0x95, 0x3e, 0x4d, 0x5f, 0xfc,
+    0xe3, 0x32, 0xfa, 0x77, 0x45, 0x3a, 0x98, 0xcb, 0xfb, 0xe0, 0x27, 0x1f,
+    0x5b, 0xdf, 0x0a, 0x45, 0xba, 0xd3, 0xc4, 0xb8, 0x42, 0x3f, 0x6c, 0x42,
+    0x4d, 0xa9, 0x45, 0xe2, 0x5f, 0xf1, 0x7d, 0x68, 0xe5, 0x10, 0x73, 0xae,
+    0xf2, 0x5b, 0x02, 0xea, 0xf6, 0xe7, 0x66, 0x27, 0x60, 0x47, 0x3c, 0xb7,
+    0x14, 0x7f, 0x2a, 0x9f, 0x8c, 0xf9, 0x71, 0xd7, 0xff, 0x05, 0xb9, 0x77,
+    0xfc, 0x10, 0xfa, 0xf9, 0x9e, 0xaf, 0xd0, 0xf3, 0x8b, 0xdc, 0x1f, 0x06,
+    0x1e, 0x51, 0x7f, 0x71, 0xf3, 0xfd, 0xc0, 0xc4, 0x1c, 0x53, 0x18, 0x1f,
+    0x14, 0xef, 0x7a, 0x0b, 0x8b, 0x3c, 0x9e, 0xf9, 0xbc, 0x73, 0x34, 0x38,
+    0x73, 0x84, 0x9d, 0x39, 0xbc, 0xe3, 0xd9, 0x56, 0x78, 0x6c, 0x03, 0xc6,
+    0x9a, 0xf5, 0xb8, 0x8f, 0x2a, 0x7e, 0x83, 0xf7, 0xc7, 0xf9, 0x9d, 0xf7,
+    0x2c, 0xed, 0x66, 0xd9, 0x9f, 0x6f, 0x8a, 0xe8, 0x28, 0x41, 0xe9, 0x4d,
+    0xdc, 0x5d, 0xba, 0x68, 0x9a, 0x2e, 0xcd, 0x49, 0xfa, 0x50, 0x9e, 0xf7,
+    0x23, 0xeb, 0x97, 0xe8, 0xd7, 0xd8, 0x4f, 0x54, 0x7d, 0x0a, 0x42, 0x4a,
+    0xb8, 0xf7, 0x4e, 0xba, 0x76, 0x51, 0x62, 0x9b, 0xb2, 0x6d, 0xe8, 0x0d,
+    0xe1, 0xfb, 0x4b, 0x3b, 0xf9, 0xce, 0x68, 0xeb, 0x9c, 0xef, 0x1e, 0x5c,
+    0xd7, 0x71, 0x4c, 0xaf, 0xbc, 0x9e, 0x20, 0x8e, 0xef, 0xac, 0x67, 0xd7,
+    0xf6, 0xb8, 0xe6, 0xe7, 0xd8, 0x72, 0x15, 0xf6, 0xb7, 0x84, 0x7a, 0x45,
+    0x46, 0x0d, 0x20, 0xd9, 0xef, 0x67, 0xe2, 0xbd, 0x27, 0x72, 0x8a, 0x24,
+    0x8c, 0x0f, 0x7e, 0x83, 0x6b, 0x2e, 0xd8, 0xce, 0x37, 0x50, 0x83, 0xfb,
+    0xce, 0xd7, 0x1b, 0x15, 0xb0, 0x01, 0x59, 0xd9, 0x7c, 0xb6, 0xde, 0xb1,
+    0x09, 0xf5, 0x07, 0x0b, 0x6d, 0x35, 0xca, 0xe6, 0x99, 0x7e, 0x4a, 0xe9,
+    0xf0, 0x43, 0x85, 0xef, 0x0d, 0x7c, 0xde, 0x43, 0x38, 0xef, 0x48, 0x2c,
+    0x61, 0xd7, 0x27, 0x66, 0x82, 0x8e, 0x39, 0x6f, 0x4d, 0xae, 0xcc, 0x57,
+    0x8d, 0x5c, 0x23, 0xce, 0x35, 0xc8, 0xf1, 0xc7, 0xb5, 0x8f, 0xc7, 0x51,
+    0xbb, 0xff, 0x18, 0xf6, 0xe1, 0xe6, 0x35, 0x8e, 0x77, 0x88, 0x4d, 0xb3,
+    0x88, 0x47, 0xb3, 0x88, 0x45, 0xb3, 0x88, 0x51, 0xb3, 0x88, 0x69, 0xb3,
+    0x88, 0x69, 0xb3, 0x88, 0x55, 0xb3, 0x88, 0x67, 0xb3, 0x88, 0x67, 0xa8,
+    0x7b, 0xec, 0x18, 0xd8, 0xed, 0xe4, 0x0b, 0xce, 0x0b, 0x61, 0x71, 0xef,
+    0x79, 0x71, 0xf1, 0x30, 0xd6, 0x75, 0x6b, 0xee, 0x8b, 0x3b, 0xf9, 0x3e,
+    0x96, 0x2c, 0x24, 0x42, 0xc9, 0x89, 0x4f, 0x50, 0xd3, 0xa1, 0x96, 0x6e,
+    0x5e, 0x77, 0x33, 0xae, 0xf8, 0x0d, 0x13, 0x95, 0x75, 0xde, 0xc8, 0xd8,
+    0xef, 0x8f, 0xe0, 0x73, 0x6b, 0xf2, 0x3a, 0xd6, 0x3c, 0x7c, 0xaa, 0x96,
+    0xeb, 0x61, 0x93, 0x7d, 0x0c, 0xa7, 0x08, 0xdc, 0xcd, 0x5f, 0x37, 0x1c,
+    0xbf, 0x7e, 0xcf, 0x93, 0xbf, 0xec, 0xf7, 0x20, 0x05, 0xb5, 0xa2, 0x22,
+    0xde, 0x19, 0xd9, 0x96, 0xdf, 0xa9, 0xaf, 0x47, 0x7c, 0xee, 0x2c, 0xfc,
+    0x6b, 0x00, 0x3c, 0x67, 0x5a, 0xee, 0xfe, 0x5e, 0x80, 0xf3, 0x2f, 0xeb,
+    0xcb, 0x6f, 0x6c, 0x9d, 0xde, 0x4f, 0x4b, 0x3b, 0x07, 0xc5, 0xf9, 0x45,
+    0xe6, 0xfa, 0xc5, 0xfa, 0xf6, 0xf9, 0xa9, 0xce, 0xf9, 0xa1, 0x96, 0x47,
+    0xfb, 0x9e, 0x2a, 0xae, 0xf7, 0x48, 0x72, 0xf5, 0xc9, 0xb4, 0x7f, 0xab,
+    0xb4, 0x69, 0x38, 0xff, 0x99, 0x0a, 0xe7, 0xfc, 0xf9, 0x4d, 0x4c, 0x76,
+    0xda, 0xde, 0x39, 0xf6, 0x21, 0xae, 0x7b, 0xdf, 0x31, 0xe6, 0x20, 0xbf,
+    0xec, 0xc1, 0xe7, 0x81, 0x07, 0x3c, 0xf8, 0xcb, 0xc0, 0x6b, 0x3c, 0xf8,
+    0x65, 0xe0, 0xfd, 0x1e, 0xfc, 0x6d, 0xe0, 0x59, 0x0f, 0xfe, 0x3e, 0xf0,
+    0x21, 0x0f, 0x4e, 0x5f, 0x98, 0xd2, 0x46, 0x3c, 0x78, 0x08, 0x78, 0xde,
+    0x83, 0xc7, 0x80, 0x8f, 0x7b, 0x70, 0x03, 0x78, 0xd8, 0x83, 0x77, 0x7f,
+    0x81, 0x6b, 0xba, 0x65, 0x3c, 0x0b, 0x3c, 0xe6, 0xc1, 0x4f, 0x00, 0x7f,
+    0xd6, 0x83, 0x17, 0x80, 0x17, 0x3d, 0x78, 0x11, 0xf8, 0xbc, 0x77, 0x3f,
+    0xc0, 0x5f, 0xf0, 0xee, 0x07, 0x78, 0xc9, 0x83, 0xff, 0xfc, 0x0b, 0x6e,
+    0xfe, 0xed, 0x2c, 0xb8, 0xb4, 0x0f, 0x41, 0x93, 0xfd, 0x9e, 0xfa, 0xd1,
+    0x98, 0x72, 0xf2, 0xef, 0xca, 0x7a, 0xc8, 0xcd, 0xc1, 0xa4, 0xe0, 0x1e,
+    0x0d, 0xff, 0xaa, 0xa0, 0x93, 0xce, 0x59, 0x88, 0x77, 0x31, 0xd8, 0x15,
+    0x6a, 0x65, 0xb4, 0x7f, 0x6b, 0xf5, 0xdf, 0x7c, 0xdb, 0xe5, 0x3b, 0x77,
+    0x3a, 0x69, 0xd7, 0xba, 0x5d, 0x7b, 0x44, 0x8d, 0xbb, 0xc8, 0xf6, 0x7a,
+    0x8b, 0xed, 0x37, 0xfe, 0x74, 0x5a, 0x36, 0x4e, 0xa0, 0x4e, 0x66, 0x9c,
+    0x7a, 0xec, 0x1a, 0x98, 0xed, 0x45, 0xdc, 0xc1, 0x76, 0xda, 0x35, 0xb7,
+    0x5d, 0x2f, 0xfb, 0xc5, 0x1c, 0xea, 0xbd, 0x19, 0x31, 0x07, 0xd6, 0x59,
+    0xe4, 0xfa, 0x3d, 0x24, 0xf2, 0x63, 0x6a, 0x71, 0xa7, 0x63, 0x97, 0x3e,
+    0xf1, 0x76, 0x2e, 0x1b, 0x0d, 0xa0, 0xfd, 0x33, 0x9f, 0x47, 0xc7, 0xca,
+    0xba, 0x9a, 0xef, 0x65, 0x51, 0xc4, 0xe0, 0x2a, 0xaa, 0xd0, 0xdc, 0x3b,
+    0x19, 0xdf, 0xc7, 0x9a, 0x51, 0x47, 0xf0, 0x3d, 0xad, 0x96, 0xaa, 0x70,
+    0x7e, 0xd5, 0xb8, 0x0f, 0x95, 0x9a, 0x74, 0xaa, 0xd5, 0xa2, 0xb4, 0x4e,
+    0x1b, 0xa3, 0x3a, 0xcc, 0x19, 0x86, 0x9c, 0xb7, 0x69, 0x07, 0x61, 0xef,
+    0x59, 0xaa, 0xd7, 0xb6, 0x71, 0x2a, 0xa0, 0xd3, 0x66, 0x25, 0xed, 0x51,
+    0x1a, 0x29, 0x15, 0xeb, 0x23, 0xfb, 0x4d, 0x70, 0x00, 0x36, 0x89, 0xb9,
+    0x66, 0xbf, 0x4c, 0xbb, 0x84, 0x0e, 0x1e, 0x16, 0x79, 0xeb, 0xdb, 0x45,
+    0x1f, 0x78, 0x6b, 0xe9, 0x7e, 0xe5, 0x31, 0xf0, 0x56, 0x38, 0xbc, 0x95,
+    0xd4, 0x2d, 0xe0, 0x5e, 0xda, 0x2f, 0x78, 0xb7, 0x08, 0xde, 0x0b, 0x05,
+    0x83, 0xf6, 0x29, 0x07, 0x3b, 0xfc, 0x4d, 0x5d, 0xf4, 0x88, 0xf3, 0x0e,
+    0xf1, 0x3a, 0x6c, 0xfd, 0x1f, 0xb5, 0x3a, 0x2a, 0x9e, 0xa9, 0xa3, 0xd3,
+    0xb8, 0x6f, 0x0f, 0xe9, 0x55, 0x14, 0xba, 0xe3, 0x61, 0x2a, 0x8f, 0xea,
+    0x14, 0x88, 0xf2, 0xfd, 0xad, 0x5a, 0x0f, 0xf9, 0xa4, 0xdb, 0xfc, 0x74,
+    0x5d, 0xe8, 0xbe, 0xab, 0xc8, 0xf9, 0x72, 0x6b, 0x78, 0x12, 0x31, 0xf7,
+    0x81, 0x22, 0x43, 0x7e, 0xeb, 0xb1, 0xdf, 0x30, 0x92, 0x9a, 0xa8, 0x55,
+    0x29, 0x05, 0x4f, 0x3f, 0x59, 0xe4, 0x3c, 0xc3, 0xed, 0x1b, 0xe2, 0x2d,
+    0x28, 0x89, 0x7b, 0xee, 0x82, 0xf6, 0xb7, 0xfc, 0xc6, 0xa0, 0xf7, 0xa3,
+    0x7e, 0xbb, 0x0c, 0xde, 0xfb, 0x64, 0x5e, 0x97, 0xe8, 0xe9, 0xe2, 0x16,
+    0x44, 0x09, 0xe6, 0xaf, 0xa3, 0x33, 0x4d, 0xb7, 0xd3, 0x2e, 0xc4, 0xff,
+    0x2b, 0xc4, 0x31, 0x1c, 0x97, 0x7e, 0xe2, 0xef, 0x1a, 0x44, 0x83, 0xc5,
+    0xa0, 0xce, 0x93, 0x3f, 0xb7, 0xf8, 0x1b, 0x6b, 0x29, 0xc4, 0xf7, 0x72,
+    0x51, 0x2f, 0xd0, 0x20, 0xd6, 0x9a, 0x2c, 0xf2, 0xf7, 0x1e, 0x7b, 0xbd,
+    0x41, 0xf3, 0x63, 0x2b, 0x11, 0xb2, 0xf3, 0x39, 0xc7, 0x9e, 0x05, 0x7e,
+    0x23, 0x29, 0xf0, 0x7a, 0x2c, 0x77, 0x95, 0x88, 0x4f, 0x6b, 0xcb, 0x76,
+    0x5a, 0xc8, 0x46, 0x3e, 0x7b, 0x0f, 0x33, 0x0e, 0xcf, 0x69, 0x67, 0xfe,
+    0x29, 0xed, 0x4f, 0xc5, 0x1b, 0xf1, 0x82, 0xb6, 0xfa, 0xae, 0x18, 0x11,
+    0x9a, 0x36, 0x8b, 0xee, 0x9d, 0xf1, 0xca, 0x7f, 0xbd, 0xda, 0xa4, 0xf9,
+    0x16, 0x16, 0x63, 0xbe, 0xe7, 0x16, 0x23, 0x31, 0x93, 0x34, 0xdf, 0x73,
+    0xb8, 0x6f, 0xcd, 0x37, 0x35, 0xf8, 0x5e, 0x5b, 0x6c, 0xf6, 0x3d, 0xbf,
+    0xd8, 0xc9, 0xdf, 0x04, 0xd0, 0x37, 0x58, 0xcb, 0xf1, 0x55, 0xd0, 0x6f,
+    0x7e, 0x67, 0x51, 0x7d, 0xcb, 0xdf, 0x82, 0x06, 0x1d, 0xbb, 0xf3, 0xda,
+    0xd8, 0x39, 0xfe, 0xd6, 0xe2, 0x4b, 0x22, 0xce, 0xbc, 0xa0, 0xf3, 0x1d,
+    0x58, 0xac, 0xbd, 0x59, 0xa6, 0x6a, 0xe5, 0x32, 0xf8, 0x26, 0x51, 0x63,
+    0x3f, 0xaf, 0x33, 0xad, 0x5a, 0xb9, 0x44, 0x1a, 0x70, 0x89, 0xce, 0x38,
+    0xf8, 0xeb, 0xd4, 0x06, 0x3c, 0xb2, 0x9b, 0xed, 0xf8, 0xb4, 0x5e, 0xbd,
+    0xfb, 0x02, 0xa5, 0xe9, 0x5b, 0x02, 0xaf, 0xda, 0x7d, 0x19, 0xf9, 0xd7,
+    0x6d, 0xbf, 0x4e, 0x11, 0x84, 0x6e, 0xce, 0xaf, 0x55, 0xe1, 0x0b, 0x54,
+    0x95, 0xb8, 0x44, 0x31, 0x9a, 0x46, 0x0d, 0x7f, 0x5a, 0x8f, 0x33, 0x0f,
+    0x72, 0xf5, 0x6e, 0x3a, 0x59, 0xe2, 0xfe, 0x6a, 0xee, 0x8f, 0x5f, 0x40,
+    0xa4, 0x5f, 0x70, 0xd6, 0x78, 0x83, 0xaa, 0x75, 0xdc, 0x74, 0xd1, 0x3f,
+    0x44, 0xdf, 0xc4, 0x6f, 0xb2, 0x94, 0xa5, 0xa7, 0x6e, 0xde, 0x6d, 0x39,
+    0x96, 0xdb, 0x77, 0x12, 0x3b, 0xbf, 0x28, 0xce, 0xfb, 0xa8, 0x46, 0xfb,
+    0x0b, 0x9c, 0x1b, 0x02, 0xe2, 0x3d, 0x24, 0xa8, 0xd9, 0xdf, 0x39, 0x70,
+    0xf7, 0xc2, 0x59, 0xe1, 0x1e, 0x51, 0x68, 0x46, 0xdc, 0xff, 0x17, 0xbe,
+    0x5b, 0x52, 0x57, 0xe1, 0x4e, 0xa5, 0x5e, 0xfa, 0x0d, 0xce, 0x57, 0x0a,
+    0x07, 0x47, 0x99, 0x6f, 0x75, 0x2c, 0xc1, 0x3d, 0xa3, 0xd0, 0x00, 0x7e,
+    0x15, 0xbc, 0x18, 0x13, 0x50, 0xc5, 0x3b, 0x8b, 0xfd, 0xad, 0x8c, 0xbf,
+    0xdb, 0xf1, 0x3b, 0xac, 0xf0, 0x71, 0xc4, 0x9a, 0xcb, 0xc8, 0x69, 0x55,
+    0x94, 0x10, 0x77, 0xaa, 0xaf, 0x3b, 0xdf, 0x75, 0xca, 0x1d, 0x9c, 0xfd,
+    0x9c, 0x7d, 0xbc, 0x1f, 0x3e, 0xbe, 0xfa, 0x5e, 0xe5, 0x9e, 0xcf, 0x56,
+    0x87, 0xae, 0xd0, 0x23, 0x05, 0xfb, 0x8c, 0xd4, 0x35, 0xfb, 0xc3, 0xff,
+    0x47, 0xbf, 0xfa, 0x3f, 0xf4, 0xb3, 0x7e, 0x98, 0x87, 0xbf, 0x2f, 0x6a,
+    0x0e, 0x0f, 0x72, 0x9e, 0x64, 0xc7, 0x4c, 0xf5, 0xe6, 0x1d, 0xaf, 0xc1,
+    0x99, 0x0b, 0xb6, 0x84, 0x38, 0xf3, 0x08, 0xea, 0xb6, 0x79, 0xa1, 0x17,
+    0xe6, 0x51, 0x57, 0xdd, 0x03, 0x5d, 0xde, 0x88, 0x69, 0x8a, 0x7b, 0x65,
+    0x64, 0x3a, 0x01, 0x3b, 0xd9, 0x3c, 0xc3, 0x39, 0x8e, 0x75, 0x8e, 0x88,
+    0x3b, 0xf9, 0xb1, 0x65, 0x86, 0xd6, 0xba, 0x23, 0x59, 0xce, 0xb7, 0x96,
+    0xb7, 0xc5, 0x9a, 0x2f, 0x2d, 0x9e, 0xa2, 0xa0, 0x61, 0x7e, 0xb7, 0xe7,
+    0x6e, 0x7e, 0x43, 0x75, 0xdf, 0x9b, 0xc5, 0x5b, 0x2a, 0xe6, 0xf6, 0xd1,
+    0x81, 0xc6, 0xad, 0xd3, 0xeb, 0xa5, 0x88, 0x92, 0x90, 0xaa, 0x71, 0x66,
+    0xbc, 0x0e, 0xea, 0x29, 0xfa, 0x0e, 0xf4, 0xbc, 0xc5, 0xac, 0x97, 0x7e,
+    0x6b, 0xd1, 0x06, 0xee, 0xff, 0xdf, 0xde, 0x69, 0xaf, 0x39, 0xef, 0x14,
+    0xac, 0x0b, 0x21, 0x2b, 0xe6, 0x7d, 0x02, 0xb2, 0x5f, 0xf3, 0xcb, 0xe2,
+    0x5b, 0xd1, 0x0d, 0xcc, 0xb1, 0xfa, 0xed, 0xa3, 0x15, 0xf2, 0xe9, 0xc7,
+    0xed, 0xd2, 0xf9, 0x7e, 0xd6, 0xed, 0x83, 0x76, 0xfb, 0x28, 0xe7, 0xf2,
+    0x1d, 0x76, 0x1b, 0xd5, 0x20, 0xfd, 0xf9, 0x56, 0xbb, 0xfd, 0x5d, 0x3e,
+    0xbf, 0x26, 0xbb, 0x7d, 0x99, 0xe3, 0xe5, 0x67, 0xec, 0x76, 0x33, 0xa2,
+    0xdb, 0xf4, 0x7a, 0xbb, 0x7d, 0x10, 0x05, 0xc9, 0xc5, 0x4a, 0xe7, 0x73,
+    0x02, 0x04, 0x79, 0x57, 0xb6, 0xdb, 0x01, 0x5c, 0x80, 0x12, 0x7e, 0xbb,
+    0xdd, 0x5f, 0x49, 0xf4, 0x98, 0x64, 0xb7, 0x97, 0x82, 0x44, 0x71, 0x9f,
+    0x53, 0xbe, 0x47, 0x89, 0x9e, 0x75, 0x3e, 0x45, 0xb0, 0x40, 0x0f, 0xba,
+    0x6d, 0x2c, 0xdc, 0xe4, 0xb6, 0xdf, 0x21, 0xba, 0xdd, 0x6d, 0x5f, 0xf0,
+    0x51, 0xad, 0xdb, 0x9e, 0xf2, 0xc3, 0x1e, 0xeb, 0xa9, 0x47, 0xb2, 0x17,
+    0xf3, 0x3b, 0x6d, 0xf5, 0x07, 0xdc, 0x76, 0x78, 0xfe, 0x2e, 0x80, 0x76,
+    0x2d, 0x7d, 0x50, 0xc7, 0x1b, 0x59, 0x87, 0xda, 0xa9, 0x56, 0x90, 0x13,
+    0xc9, 0x3a, 0xb4, 0xed, 0x4f, 0x9a, 0xf4, 0x4c, 0x3d, 0xce, 0x23, 0x44,
+    0x1f, 0xe3, 0x12, 0xd6, 0xff, 0xde, 0x06, 0x3e, 0x67, 0x5b, 0xb6, 0xa9,
+    0x4d, 0x68, 0xdb, 0x3c, 0xc5, 0x68, 0x23, 0xda, 0x95, 0xf4, 0xa3, 0x72,
+    0xc8, 0xff, 0xe6, 0x36, 0xb4, 0xc5, 0xa7, 0x79, 0xba, 0x72, 0x78, 0x07,
+    0xda, 0xe5, 0xf4, 0x9b, 0x6a, 0x4e, 0x2a, 0x1d, 0xa2, 0xcd, 0x7f, 0x9d,
+    0x3d, 0x3d, 0xfb, 0x7a, 0xd4, 0xce, 0xee, 0x94, 0x1a, 0x3d, 0x51, 0x05,
+    0x7c, 0xf4, 0xf8, 0x51, 0xf5, 0xd0, 0xf0, 0xe8, 0x91, 0xaf, 0x0d, 0x8c,
+    0xe6, 0xd0, 0x38, 0x3a, 0x3c, 0x36, 0x94, 0xcb, 0xa2, 0x63, 0xf8, 0xc8,
+    0xc0, 0xe1, 0x9c, 0x9a, 0x3b, 0x3a, 0x3e, 0xfa, 0xb8, 0x9a, 0x3f, 0x36,
+    0x7c, 0x74, 0xbc, 0x5d, 0xd5, 0x4f, 0x44, 0x0f, 0xf2, 0x10, 0xca, 0x9d,
+    0x18, 0x1f, 0x18, 0xe9, 0x88, 0x66, 0x9b, 0xd5, 0x4c, 0xfe, 0x38, 0x20,
+    0x13, 0x8f, 0x1e, 0x62, 0xc2, 0xd1, 0x51, 0xfe, 0xf7, 0x58, 0xb6, 0xc5,
+    0x06, 0x3a, 0x83, 0x23, 0xf9, 0x91, 0x11, 0x9b, 0x29, 0x93, 0x1f, 0xc8,
+    0x67, 0x46, 0xed, 0x85, 0x33, 0xf9, 0x23, 0x9e, 0x76, 0x26, 0x33, 0xda,
+    0x6e, 0xcb, 0x13, 0x1d, 0x8b, 0x61, 0x9d, 0x13, 0x77, 0xa8, 0xed, 0x0c,
+    0xaa, 0x80, 0xdb, 0x0b, 0xb7, 0xab, 0x5f, 0x1d, 0x18, 0x39, 0x9e, 0xeb,
+    0x70, 0x85, 0x18, 0xcb, 0x8d, 0xab, 0x99, 0x91, 0xdf, 0x57, 0x87, 0xb3,
+    0x6a, 0x6e, 0x74, 0xf4, 0xd8, 0x28, 0xd3, 0x1c, 0x3c, 0x9a, 0x6d, 0x57,
+    0x0f, 0xa3, 0x1b, 0xeb, 0x2e, 0xf7, 0xa5, 0xd3, 0x3d, 0xdd, 0x7d, 0xdd,
+    0x7b, 0x7a, 0x2a, 0x2b, 0xed, 0x79, 0x6d, 0x7c, 0x57, 0xea, 0x26, 0xe1,
+    0x26, 0xcf, 0xae, 0x03, 0x9f, 0xa6, 0xf5, 0xf6, 0xe8, 0x6b, 0xd0, 0x5a,
+    0xd6, 0xa0, 0xb5, 0xae, 0xa6, 0xa5, 0x53, 0x2b, 0xd7, 0x4c, 0xf7, 0x76,
+    0x7b, 0x27, 0xbb, 0x49, 0x6b, 0x59, 0x83, 0xd6, 0xba, 0x8a, 0xf6, 0xc0,
+    0xf2, 0x48, 0x07, 0x6f, 0x59, 0x85, 0xb7, 0xae, 0xc2, 0xb7, 0xaf, 0xc0,
+    0xf7, 0xa5, 0x7b, 0xbd, 0x1b, 0x16, 0xb4, 0x2f, 0xed, 0x3f, 0x78, 0xc0,
+    0x23, 0x50, 0xfa, 0x60, 0x34, 0x0b, 0x0d, 0xe8, 0xed, 0x8e, 0x7d, 0x24,
+    0xf2, 0x03, 0x63, 0xed, 0xe9, 0x83, 0xe9, 0xfd, 0x07, 0x7a, 0x7b, 0x62,
+    0xd1, 0xec, 0x1d, 0x1d, 0xaa, 0x7b, 0x2e, 0xaa, 0x38, 0x53, 0x40, 0x18,
+    0x49, 0x6e, 0xf4, 0x2e, 0xa7, 0x7d, 0x62, 0x78, 0xfc, 0x2e, 0x67, 0x6e,
+    0x75, 0x68, 0x60, 0x34, 0x2b, 0xec, 0x6a, 0x7c, 0x74, 0x00, 0x96, 0x75,
+    0xf4, 0xb0, 0x7d, 0x1c, 0xea, 0x68, 0x6e, 0xec, 0xf8, 0xc8, 0x78, 0x87,
+    0xea, 0xc8, 0x95, 0xea, 0x3b, 0xd0, 0x7b, 0x5f, 0xef, 0x43, 0x07, 0x96,
+    0x65, 0x60, 0x5a, 0xaa, 0x6b, 0x97, 0x47, 0x76, 0xe0, 0xbd, 0x3d, 0x7b,
+    0x57, 0xea, 0x36, 0xd5, 0xb7, 0xf7, 0x81, 0x9e, 0x15, 0x3c, 0xbd, 0x7b,
+    0x1e, 0xd8, 0xf3, 0xe0, 0xae, 0x96, 0x35, 0x68, 0xad, 0x6b, 0xd0, 0xb6,
+    0xaf, 0x41, 0x6b, 0x5b, 0x83, 0xb6, 0x63, 0x0d, 0xda, 0xdd, 0x2b, 0x68,
+    0x3d, 0x9d, 0x5d, 0xa9, 0x07, 0x7b, 0x57, 0xca, 0xff, 0xc0, 0x03, 0xf7,
+    0x75, 0xaf, 0x3c, 0x67, 0x9b, 0xd6, 0xb2, 0x8a, 0xd6, 0xd3, 0xb9, 0x82,
+    0xb8, 0x4c, 0x6b, 0x5d, 0x83, 0xb6, 0x7d, 0x0d, 0x5a, 0xdb, 0x1a, 0xb4,
+    0x1d, 0xab, 0x74, 0xb9, 0xf7, 0xfe, 0x03, 0xbd, 0xdd, 0x5e, 0x95, 0xda,
+    0xf4, 0xfb, 0x1e, 0xea, 0xdd, 0x77, 0xa0, 0xa7, 0xaf, 0xf3, 0xc1, 0x65,
+    0x99, 0x9e, 0xd9, 0x4c, 0xe6, 0xd0, 0x16, 0x32, 0x6f, 0x38, 0x90, 0x7f,
+    0x31, 0xfc, 0xf4, 0x2d, 0xcb, 0x38, 0xff, 0xe6, 0xd1, 0xff, 0x3e, 0x7e,
+    0x69, 0xb4, 0xf7, 0xe2, 0xd7, 0x8b, 0xdf, 0xf5, 0x3b, 0xc8, 0x7c, 0x0b,
+    0xbf, 0x9a, 0x3b, 0xed, 0x5f, 0x1c, 0xbf, 0x47, 0xef, 0x22, 0x33, 0x8b,
+    0x5f, 0x0c, 0x3f, 0x1d, 0xbf, 0x38, 0xe3, 0xd9, 0xd1, 0xbe, 0xcc, 0x31,
+    0x84, 0x96, 0x63, 0x23, 0x23, 0xb9, 0xd1, 0x3e, 0x98, 0xc6, 0x38, 0x31,
+    0x2d, 0x3f, 0xf4, 0xb8, 0x8d, 0xf0, 0x57, 0x6c, 0x07, 0xcf, 0x0f, 0x8c,
+    0x0e, 0x1c, 0x61, 0xee, 0x43, 0xc3, 0x87, 0xbd, 0x74, 0xe6, 0xeb, 0xcb,
+    0xa2, 0x0f, 0xb4, 0xaf, 0x0d, 0x70, 0x3b, 0x3b, 0x9a, 0xef, 0xcb, 0x1f,
+    0x1e, 0x1b, 0xb5, 0x79, 0x5c, 0x93, 0xeb, 0x73, 0x8d, 0x90, 0xbf, 0xdc,
+    0xe5, 0x04, 0x5b, 0xdf, 0xf8, 0xe3, 0x79, 0x46, 0xe9, 0xa1, 0x6d, 0xc9,
+    0x63, 0xc7, 0xb0, 0x5a, 0x95, 0xdd, 0x50, 0x0f, 0x74, 0xef, 0x55, 0x5b,
+    0xf5, 0x96, 0xed, 0x77, 0xe9, 0xf7, 0x6c, 0xd3, 0x75, 0x7d, 0x7b, 0xeb,
+    0xb6, 0xc3, 0xf7, 0x64, 0xef, 0xf9, 0x7c, 0x26, 0x9b, 0xdb, 0x96, 0x1d,
+    0x1e, 0x1d, 0x7f, 0x5c, 0x8d, 0xa5, 0x73, 0x19, 0xb5, 0xa5, 0x0d, 0x4c,
+    0xad, 0xdb, 0xd5, 0x6d, 0x6a, 0xcb, 0x3d, 0xed, 0xad, 0x3b, 0xda, 0x5b,
+    0x3f, 0x7f, 0x07, 0x14, 0x17, 0x3b, 0x7a, 0x7c, 0x64, 0xe4, 0x0e, 0x54,
+    0xa6, 0x03, 0x47, 0x8f, 0x62, 0x2a, 0x44, 0xd2, 0xac, 0x0a, 0xa9, 0xc7,
+    0x8e, 0x8d, 0xe4, 0xaa, 0xec, 0x77, 0x61, 0xfb, 0x8f, 0xfe, 0x9f, 0xff,
+    0x7d, 0xe5, 0x0f, 0xfa, 0xc6, 0x72, 0xa3, 0xc3, 0x03, 0x23, 0x0e, 0x6e,
+    0xde, 0x46, 0xa6, 0xb8, 0xaf, 0x84, 0xc9, 0xec, 0x46, 0xfb, 0x7d, 0x40,
+    0x02, 0x2c, 0xed, 0xb0, 0xe9, 0xbe, 0xe6, 0x4d, 0xfc, 0x3f, 0xab, 0xac,
+    0xcf, 0x10, 0xbf, 0x07, 0xf1, 0xb7, 0x79, 0xd0, 0xf4, 0x4d, 0xb5, 0x35,
+    0xb5, 0xeb, 0xd6, 0xad, 0xa0, 0xf5, 0xae, 0x41, 0xcb, 0x6e, 0x5a, 0xc7,
+    0x34, 0x17, 0xbf, 0x9d, 0x69, 0xfd, 0x9b, 0x6a, 0x3e, 0xc5, 0x37, 0xf4,
+    0x59, 0xd0, 0xac, 0x15, 0x6b, 0xd0, 0xbc, 0xad, 0xf3, 0x15, 0x7c, 0xe3,
+    0x9f, 0xad, 0x5d, 0xcd, 0xe7, 0x9b, 0xb0, 0xd7, 0x58, 0x41, 0x33, 0x3f,
+    0x2d, 0x0b, 0xec, 0xc6, 0xd9, 0xf1, 0x57, 0xf3, 0xc7, 0x9d, 0xd6, 0x91,
+    0x81, 0x0c, 0x4c, 0x91, 0x5b, 0x23, 0x99, 0xac, 0x43, 0x1b, 0x6e, 0x1d,
+    0x73, 0x7b, 0xc7, 0x32, 0xcb, 0xad, 0x16, 0xbb, 0x35, 0x36, 0x36, 0xec,
+    0xd0, 0x32, 0xc3, 0x47, 0xdc, 0x11, 0x63, 0x79, 0xa7, 0x75, 0x30, 0x6a,
+    0xeb, 0x8c, 0xff, 0x70, 0x47, 0x12, 0x15, 0x41, 0x85, 0x03, 0x5d, 0xfb,
+    0xf9, 0x6f, 0xe8, 0x97, 0x1e, 0x3b,
+};
+
+const firmware_blob_t firmware_blob_4d44e7a7f8bdb039 = {
+    blob_4d44e7a7f8bdb039_z, sizeof(blob_4d44e7a7f8bdb039_z), 10176, 0x9aeeb953
+};
@@ -0,0 +1,417 @@
+/**
+ * Embedded Firmware blob 8f48ab74a25c1044
+ * Used by: a1_n_ne_x SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 8704 bytes, 4813 compressed
+static const uint8_t blob_8f48ab74a25c1044_z[] = {
+    0x78, 0xda, 0xd5, 0x59, 0x7d, 0x70, 0x5c, 0xd5, 0x75, 0x3f, 0xfb, 0xde,
+    0xdb, 0x0f, 0xad, 0xd6, 0xd2, 0x5b, 0x69, 0xed, 0x2c, 0x58, 0x71, 0x9f,
+    0xf0, 0x5b, 0x6b, 0xb1, 0xe5, 0xf8, 0x59, 0xac, 0xf1, 0xda, 0xd9, 0x34,
+    0x8f, 0x5d, 0x09, 0x44, 0x50, 0xb0, 0x2a, 0x42, 0x0b, 0x29, 0x1d, 0x7d,
+    0xac, 0x56, 0x1f, 0x89, 0x90, 0xc4, 0x4a, 0x06, 0x93, 0x2a, 0xed, 0x46,
+    0x5a, 0x5c, 0x77, 0x66, 0x2b, 0x09, 0xc6, 0x93, 0x7a, 0xa8, 0x3b, 0xa3,
+    0xd8, 0x88, 0x90, 0xe9, 0x56, 0x32, 0x38, 0xed, 0xe4, 0x1f, 0x06, 0x8d,
+    0x31, 0x86, 0x52, 0xfe, 0xf0, 0xb4, 0x4c, 0xeb, 0xe9, 0xb8, 0x8c, 0xc3,
+    0xa7, 0x93, 0x71, 0x0b, 0x14, 0x03, 0xe6, 0xf3, 0xf5, 0x77, 0xee, 0x7b,
+    0x4f, 0x96, 0x85, 0x93, 0xd0, 0x3f, 0xbb, 0x33, 0x57, 0xf7, 0xdc, 0x7b,
+    0xcf, 0x39, 0xf7, 0xdc, 0xf3, 0x75, 0xcf, 0x7d, 0x32, 0x29, 0x90, 0x52,
+    0x3e, 0x0d, 0xec, 0xa0, 0xae, 0x03, 0x26, 0x0d, 0x04, 0xcc, 0x02, 0x55,
+    0xa4, 0x62, 0x66, 0x85, 0x87, 0x06, 0x0e, 0x98, 0x15, 0x3e, 0x0a, 0x10,
+    0xff, 0x0a, 0x52, 0xea, 0xbc, 0xf5, 0x74, 0x43, 0x84, 0x9e, 0x59, 0x1c,
+    0x08, 0x52, 0x68, 0x69, 0xe7, 0x77, 0xf5, 0x7d, 0xd4, 0x3c, 0x33, 0xec,
+    0x91, 0x53, 0x74, 0x63, 0x56, 0x27, 0x9a, 0x2a, 0xf3, 0xf8, 0xc2, 0x36,
+    0x8c, 0xc3, 0x59, 0x5d, 0x71, 0xc6, 0xff, 0xfe, 0x15, 0x8c, 0x8b, 0xd9,
+    0x44, 0x40, 0x8c, 0x33, 0x33, 0x1e, 0x52, 0x74, 0x0f, 0x49, 0x29, 0x95,
+    0x7a, 0xc5, 0x98, 0x4e, 0xa4, 0x13, 0x27, 0x2b, 0x29, 0x14, 0xa1, 0x9e,
+    0x32, 0x1d, 0x93, 0x52, 0x49, 0xca, 0x94, 0x9e, 0xb1, 0x14, 0x5d, 0x8f,
+    0xf6, 0x12, 0xe0, 0xb2, 0xa2, 0x99, 0xe5, 0x8b, 0x98, 0xf3, 0x53, 0x36,
+    0xd1, 0xeb, 0xa7, 0x10, 0xe0, 0x72, 0x00, 0xf8, 0x42, 0xa6, 0x77, 0xbc,
+    0x26, 0x15, 0x94, 0xd4, 0xc3, 0x18, 0xcf, 0x6e, 0x2f, 0xea, 0x2e, 0x3c,
+    0x07, 0xf8, 0xcd, 0xa0, 0x83, 0xe3, 0xcc, 0x95, 0x57, 0xac, 0xff, 0x02,
+    0xf0, 0x2b, 0xfe, 0x2b, 0xd7, 0x4f, 0xae, 0x58, 0x3f, 0x0d, 0xf8, 0xae,
+    0x55, 0xeb, 0x67, 0x57, 0xac, 0x9f, 0x07, 0xfc, 0xab, 0x80, 0xbd, 0x0e,
+    0x7d, 0xcc, 0xf0, 0xfc, 0x45, 0xcc, 0x61, 0x2d, 0x10, 0xa5, 0xa7, 0x1b,
+    0xf8, 0x1c, 0x87, 0x20, 0x73, 0xbd, 0x36, 0x09, 0x8c, 0xc9, 0xd2, 0xe4,
+    0xef, 0xc9, 0x24, 0xe1, 0xdc, 0xb5, 0xd4, 0xab, 0x5a, 0x94, 0x36, 0x64,
+    0xc0, 0x51, 0xc0, 0xb6, 0x2e, 0xd2, 0xba, 0x1f, 0xb0, 0xa9, 0x4a, 0x74,
+    0x61, 0x9b, 0x0f, 0xba, 0x3b, 0xa5, 0xaf, 0xa7, 0x13, 0x74, 0xd1, 0x63,
+    0x42, 0xf1, 0xe7, 0xe4, 0x1a, 0x95, 0x68, 0xff, 0x2d, 0xde, 0x14, 0x95,
+    0xe6, 0x13, 0xeb, 0xe9, 0x88, 0x98, 0xff, 0xc8, 0x22, 0x95, 0xf7, 0x66,
+    0xda, 0x48, 0x4a, 0x49, 0x31, 0x2d, 0x9d, 0x2d, 0x62, 0x7d, 0x52, 0xac,
+    0xbf, 0xbb, 0x62, 0xfd, 0xd1, 0xaf, 0xcb, 0xf6, 0xfa, 0x8b, 0x59, 0xac,
+    0xf7, 0x88, 0xf5, 0x5f, 0x39, 0xeb, 0x6c, 0xd3, 0xb9, 0x5d, 0x69, 0xdd,
+    0xb2, 0x7c, 0x7a, 0x84, 0xfc, 0x7a, 0x00, 0xf8, 0x97, 0xac, 0x4c, 0xa9,
+    0x92, 0xfa, 0x22, 0x92, 0xd9, 0x3f, 0x1a, 0x33, 0xf8, 0x7c, 0x15, 0x90,
+    0x31, 0x08, 0x7b, 0x56, 0xea, 0x74, 0x2c, 0x94, 0xda, 0xac, 0x3e, 0x47,
+    0x7e, 0x32, 0x23, 0x92, 0xfa, 0x4f, 0xa3, 0x2c, 0x1f, 0xb3, 0xa9, 0x8f,
+    0x2a, 0x9e, 0x4f, 0xad, 0xd6, 0xd2, 0xdb, 0xe0, 0x2b, 0xd3, 0xc0, 0x5c,
+    0x7d, 0xb4, 0x99, 0x64, 0xea, 0x9f, 0x8d, 0x61, 0x97, 0x7a, 0xb3, 0x87,
+    0x14, 0x0a, 0x3c, 0x5c, 0x4d, 0xfe, 0xb5, 0x62, 0x4f, 0x1a, 0x98, 0x5d,
+    0x43, 0xc1, 0xb5, 0x2c, 0x9b, 0x65, 0xa5, 0xc1, 0xbb, 0x7f, 0x56, 0xa2,
+    0xec, 0x6c, 0x7d, 0xf2, 0x02, 0xd6, 0xce, 0x97, 0x14, 0xb5, 0x07, 0x5d,
+    0xe0, 0x87, 0x31, 0xb5, 0x15, 0xe3, 0x57, 0xcb, 0xaf, 0x81, 0xa7, 0x87,
+    0x4e, 0x09, 0x3d, 0xfd, 0x97, 0x75, 0x5b, 0x84, 0xf9, 0xbd, 0xe2, 0xcc,
+    0xb1, 0x9e, 0x09, 0x7a, 0x66, 0x3d, 0xd2, 0xfa, 0x9e, 0x09, 0xaa, 0xca,
+    0x4e, 0x78, 0xa1, 0x4b, 0xd6, 0x75, 0x50, 0xe8, 0x37, 0xa3, 0xb3, 0x8c,
+    0x2c, 0x07, 0xc3, 0x17, 0xb6, 0x01, 0x3f, 0x9c, 0x86, 0x7e, 0x33, 0xd0,
+    0x43, 0xd7, 0x0a, 0xfd, 0x4a, 0xa9, 0x8f, 0x59, 0x27, 0xa5, 0x74, 0xa2,
+    0x86, 0x26, 0x1b, 0x6b, 0xc9, 0x14, 0xfa, 0x29, 0xa8, 0x8a, 0xb0, 0x7f,
+    0xa4, 0xa9, 0xa8, 0xbb, 0xb6, 0x0c, 0x90, 0x29, 0x4e, 0xc1, 0x34, 0xe2,
+    0xfc, 0xa0, 0x61, 0x39, 0x52, 0x94, 0x86, 0x9d, 0x25, 0x62, 0x59, 0xc2,
+    0x8e, 0x0c, 0x32, 0x7a, 0xc6, 0x75, 0x65, 0xa8, 0x86, 0xed, 0x59, 0x0e,
+    0xa6, 0x65, 0xba, 0xd5, 0x72, 0xd8, 0xe7, 0x49, 0x97, 0xfe, 0x9b, 0x65,
+    0xa9, 0xce, 0x4c, 0xb8, 0xf8, 0x2c, 0xf7, 0x45, 0x9e, 0x83, 0xec, 0x0b,
+    0x6e, 0x3c, 0x02, 0x77, 0x09, 0xb8, 0xe7, 0x5d, 0x5b, 0x62, 0x7c, 0x1a,
+    0xe3, 0xd7, 0x9d, 0xf1, 0x21, 0xec, 0xff, 0x1d, 0x07, 0xf7, 0x33, 0xcc,
+    0x1d, 0xc6, 0x38, 0x92, 0x72, 0x64, 0x3e, 0x9b, 0x4e, 0x3c, 0xfa, 0x75,
+    0x07, 0x7e, 0x31, 0x9d, 0x60, 0xfe, 0x02, 0x06, 0xff, 0x10, 0x4d, 0xc6,
+    0x15, 0xd8, 0xf7, 0x03, 0x6b, 0xd2, 0xf5, 0xf7, 0xc0, 0x3d, 0x38, 0xbf,
+    0x44, 0xe9, 0x46, 0x09, 0x7a, 0x89, 0x90, 0xa4, 0x17, 0xe2, 0x5e, 0x92,
+    0xa2, 0x93, 0xa3, 0x54, 0x08, 0xa4, 0x0a, 0xc9, 0x40, 0xac, 0x5e, 0x1d,
+    0xc0, 0xb9, 0x6f, 0x99, 0xa5, 0x63, 0x72, 0xaa, 0x3e, 0xf9, 0x1a, 0x6c,
+    0x9f, 0x99, 0x25, 0x7a, 0xb3, 0xf4, 0x3f, 0x16, 0xe7, 0x81, 0x9e, 0x46,
+    0xf8, 0x8b, 0x5a, 0x88, 0xca, 0xc2, 0xdf, 0x4a, 0x4d, 0x69, 0xbd, 0x3e,
+    0x0a, 0x1b, 0x53, 0xb6, 0xe4, 0xa5, 0xae, 0x48, 0xba, 0xdd, 0x4b, 0xb1,
+    0x78, 0xc1, 0x8d, 0xb3, 0xc0, 0x28, 0xf6, 0x5a, 0x4f, 0x39, 0xe8, 0x65,
+    0x8e, 0xd8, 0x05, 0xb6, 0xb4, 0x6f, 0xf6, 0xc8, 0x64, 0xae, 0xdd, 0xa8,
+    0x0e, 0x52, 0xbd, 0x7a, 0x94, 0x36, 0xaa, 0xb7, 0xd2, 0x7a, 0x6a, 0x11,
+    0xeb, 0x97, 0xac, 0x29, 0xc8, 0x95, 0x6d, 0x5c, 0x43, 0x5d, 0x2a, 0xeb,
+    0x2f, 0x0d, 0xad, 0xb3, 0x4f, 0x71, 0x8c, 0x45, 0x48, 0xd6, 0xa5, 0xf8,
+    0xd4, 0x68, 0x7d, 0xf4, 0x09, 0x28, 0x24, 0x57, 0x92, 0x31, 0x56, 0xa2,
+    0x47, 0xc9, 0x42, 0x1e, 0xf1, 0x11, 0xa9, 0x0d, 0x90, 0x87, 0x71, 0xdf,
+    0xb7, 0x0a, 0x11, 0xc6, 0xb7, 0x96, 0xe4, 0xd4, 0x3b, 0x56, 0x36, 0xa1,
+    0x47, 0xfb, 0x28, 0x06, 0x1f, 0x5c, 0xa6, 0xd7, 0x9e, 0x80, 0x12, 0xa7,
+    0xe0, 0x63, 0x5e, 0xd0, 0xe7, 0xc4, 0x1a, 0xfb, 0xa5, 0x87, 0xa6, 0x66,
+    0x59, 0xe7, 0x7c, 0x16, 0xe8, 0xac, 0xa4, 0xc4, 0x5b, 0x30, 0xdf, 0x53,
+    0xd2, 0xd5, 0x16, 0xe8, 0xdb, 0x8c, 0xb8, 0x76, 0x77, 0x6d, 0x63, 0xc0,
+    0x4f, 0x2d, 0x4b, 0x41, 0x7e, 0x6b, 0x29, 0x59, 0xdf, 0x2c, 0x8a, 0xfc,
+    0xc6, 0x67, 0xc6, 0x7c, 0xb9, 0x90, 0x2c, 0xea, 0x98, 0x2f, 0xff, 0x19,
+    0xec, 0x15, 0xc2, 0x3e, 0x36, 0x7e, 0xba, 0xe4, 0xe6, 0x4b, 0x15, 0xba,
+    0x0a, 0x39, 0xbe, 0xe4, 0xc7, 0x59, 0xd9, 0xb7, 0x7c, 0x9c, 0x4b, 0x3e,
+    0x91, 0x75, 0xd6, 0xb9, 0x81, 0xdc, 0xe9, 0xee, 0x65, 0x7d, 0x2e, 0xeb,
+    0xec, 0xcb, 0xba, 0x9a, 0x11, 0x76, 0xb7, 0x3e, 0x93, 0xf5, 0x6a, 0x42,
+    0x0e, 0x48, 0x67, 0xf5, 0x6b, 0x69, 0x4a, 0xf8, 0xdb, 0x3e, 0x4a, 0xcf,
+    0xfc, 0xd0, 0xe3, 0x4b, 0x99, 0xfb, 0x10, 0x43, 0xd8, 0x67, 0xb3, 0xb1,
+    0x9f, 0x6a, 0xe2, 0x44, 0xae, 0x3f, 0x56, 0xd3, 0x92, 0x5a, 0x13, 0xe5,
+    0x00, 0xf0, 0xa7, 0xa8, 0x80, 0xdc, 0x03, 0x39, 0x39, 0xf7, 0xb7, 0x25,
+    0xde, 0xd2, 0xbf, 0x4b, 0x3e, 0xfd, 0x70, 0xd3, 0xbc, 0xce, 0xf7, 0x80,
+    0xc8, 0xab, 0xb0, 0x17, 0xe7, 0xc0, 0x5f, 0x5b, 0x92, 0x88, 0x35, 0xce,
+    0x7f, 0x1b, 0xc8, 0x97, 0x2a, 0x14, 0x4f, 0xc1, 0xbf, 0x8f, 0x0a, 0x7e,
+    0xaa, 0xc9, 0xbc, 0x6f, 0x06, 0xbc, 0x44, 0x6c, 0xa7, 0x2d, 0xaa, 0xc4,
+    0x36, 0x8d, 0x6c, 0x4c, 0x3e, 0x41, 0xf5, 0x71, 0xd8, 0x14, 0xbd, 0x69,
+    0xf8, 0xe1, 0x43, 0x92, 0xfe, 0x4d, 0x0a, 0xc0, 0xfe, 0xcf, 0x0a, 0x3a,
+    0x96, 0x49, 0x6a, 0xcd, 0x8d, 0x2a, 0xb4, 0x49, 0xe4, 0x8b, 0xe7, 0x2a,
+    0x7e, 0xd6, 0x28, 0x93, 0x26, 0xf2, 0xc8, 0x07, 0x56, 0x6b, 0xa4, 0xde,
+    0x78, 0x1e, 0xfa, 0x80, 0x9d, 0x20, 0x93, 0x2b, 0xbb, 0x9a, 0x24, 0xda,
+    0x48, 0xe7, 0x84, 0xfe, 0xdd, 0xb9, 0x58, 0xb2, 0x0b, 0xbc, 0x7d, 0x3a,
+    0xef, 0xbd, 0x9e, 0x6e, 0xc1, 0xdc, 0x39, 0x21, 0x13, 0x14, 0x16, 0xb6,
+    0xf1, 0xde, 0x74, 0xf0, 0xed, 0x35, 0xab, 0xfa, 0x71, 0x23, 0x86, 0xbd,
+    0x95, 0xcf, 0x9e, 0x9b, 0xc0, 0xbd, 0x63, 0x30, 0x5d, 0xf1, 0x6f, 0x5a,
+    0x26, 0x16, 0x11, 0x27, 0x9e, 0x40, 0x5a, 0x57, 0x3a, 0xde, 0x98, 0xd8,
+    0x8c, 0x7c, 0xe0, 0x47, 0x86, 0x38, 0xf9, 0xbd, 0xdc, 0x84, 0x69, 0xf8,
+    0x40, 0x73, 0xca, 0x30, 0xe1, 0x53, 0x2e, 0x0d, 0xcf, 0xdb, 0x71, 0x3f,
+    0x47, 0xff, 0x69, 0xf5, 0x09, 0xdb, 0xfd, 0x1b, 0xdb, 0x03, 0x31, 0xf1,
+    0x8a, 0xe8, 0xdf, 0xd2, 0x4f, 0x43, 0xa7, 0x9c, 0x0b, 0x34, 0x7a, 0x72,
+    0x91, 0x0a, 0x61, 0x91, 0x13, 0xea, 0xe8, 0xd8, 0xe2, 0x99, 0x5d, 0xc6,
+    0x26, 0x85, 0xa4, 0x05, 0xb6, 0xbf, 0x9b, 0xb3, 0xce, 0xec, 0xba, 0x6e,
+    0x81, 0xe3, 0x97, 0x63, 0x57, 0x81, 0x3f, 0x04, 0xb0, 0xce, 0x31, 0xcc,
+    0xf1, 0xdb, 0x08, 0x5b, 0xc4, 0xe9, 0xf8, 0xa2, 0x4e, 0x4f, 0x2d, 0x46,
+    0x10, 0x53, 0x21, 0x87, 0x36, 0x00, 0x3c, 0x15, 0x63, 0xde, 0x9b, 0xc7,
+    0x6c, 0x77, 0xb6, 0xa9, 0x82, 0x78, 0x08, 0xd0, 0xcd, 0x25, 0x8e, 0xc7,
+    0x89, 0x04, 0xee, 0x10, 0x3a, 0xb2, 0xc8, 0x36, 0xee, 0xf0, 0x48, 0xf0,
+    0xb5, 0x23, 0x8b, 0x87, 0x9b, 0xde, 0xe2, 0xbb, 0x2c, 0xf4, 0x3a, 0x6c,
+    0xab, 0xc1, 0x41, 0x98, 0x2e, 0x40, 0x1d, 0x25, 0xc8, 0x34, 0xbd, 0x9e,
+    0x3a, 0xf8, 0x0e, 0x91, 0x54, 0xf8, 0xc7, 0xdf, 0x83, 0x77, 0x8d, 0xc8,
+    0xad, 0xb2, 0x1e, 0x44, 0x5c, 0x48, 0x6a, 0xc7, 0xa8, 0x2d, 0x77, 0x7a,
+    0x46, 0x01, 0x3e, 0x64, 0xbe, 0x02, 0xbf, 0xbc, 0x0a, 0x9f, 0x65, 0x52,
+    0xc8, 0x3b, 0xcd, 0x74, 0x2c, 0xeb, 0x3e, 0xba, 0x79, 0xc6, 0xf5, 0x19,
+    0x3e, 0x2f, 0xfb, 0x60, 0x88, 0x9e, 0x2d, 0xdb, 0x78, 0xd9, 0x92, 0x6b,
+    0x4f, 0xe6, 0xa1, 0x62, 0x9f, 0xf7, 0xbd, 0x38, 0xff, 0x2f, 0xd3, 0xcb,
+    0xf7, 0x22, 0xcf, 0x7f, 0x64, 0x71, 0x0e, 0x4b, 0x37, 0x1e, 0xe6, 0x1c,
+    0x8e, 0xf3, 0x05, 0xe1, 0x53, 0x1a, 0x70, 0x91, 0xb1, 0x70, 0xe7, 0x4a,
+    0x0b, 0x75, 0x68, 0x12, 0x60, 0xe4, 0xb1, 0x05, 0x3a, 0x56, 0xc3, 0xf9,
+    0x76, 0x9a, 0xee, 0x44, 0x8d, 0xf2, 0x8b, 0xf4, 0x44, 0x0c, 0x31, 0x83,
+    0xf1, 0xc2, 0x3e, 0xdc, 0xfd, 0x67, 0x76, 0xe9, 0xd3, 0xbf, 0xb6, 0x64,
+    0xf8, 0x74, 0x46, 0x35, 0x14, 0xd8, 0xfd, 0x0f, 0xd2, 0xd0, 0x4d, 0x7a,
+    0x81, 0xe3, 0x4d, 0x45, 0x9c, 0xe3, 0xae, 0x34, 0x10, 0xe7, 0xc2, 0xae,
+    0x8c, 0xaf, 0x90, 0xb2, 0x8c, 0x6f, 0xfa, 0x20, 0x17, 0xf0, 0x98, 0x86,
+    0xeb, 0x9a, 0xc8, 0x55, 0xf0, 0x03, 0x0e, 0xbe, 0x1f, 0xf8, 0xf0, 0xed,
+    0x04, 0xe3, 0xd7, 0x01, 0xb7, 0xee, 0x2a, 0xb8, 0xa1, 0x15, 0xbc, 0x4f,
+    0xfb, 0x1d, 0xde, 0x77, 0xa7, 0x71, 0x9e, 0x9e, 0x72, 0x74, 0x15, 0x3e,
+    0xaf, 0x71, 0x1e, 0x22, 0xe4, 0x1a, 0x5d, 0x6d, 0xa6, 0x3f, 0x25, 0x25,
+    0xa5, 0xde, 0x59, 0xd4, 0x63, 0x80, 0x31, 0x5f, 0x2e, 0x62, 0x4d, 0x06,
+    0x7e, 0xbb, 0x27, 0x9d, 0x00, 0x5c, 0xbe, 0x80, 0x71, 0xb5, 0x4d, 0x1f,
+    0xb1, 0xef, 0x67, 0xd0, 0x3e, 0x8a, 0x98, 0x3f, 0xa6, 0x38, 0x3a, 0x69,
+    0x71, 0xe8, 0x26, 0x4b, 0x9f, 0x42, 0x06, 0xce, 0x2b, 0xb8, 0x0b, 0x40,
+    0x3b, 0x59, 0x7e, 0xd6, 0x47, 0xa1, 0x2a, 0xe4, 0xa2, 0x6a, 0x34, 0x86,
+    0x63, 0x28, 0x1f, 0x55, 0x17, 0x9e, 0x35, 0x11, 0x5c, 0x0e, 0x7c, 0xc8,
+    0x14, 0xb9, 0x0e, 0x71, 0x28, 0xc5, 0x0c, 0x53, 0x8a, 0xc5, 0x35, 0x89,
+    0xfd, 0x4c, 0xd4, 0x5a, 0x37, 0x14, 0x75, 0xb6, 0x2f, 0xec, 0x39, 0xcd,
+    0xf5, 0x62, 0x08, 0x76, 0xa6, 0x82, 0x4f, 0xe4, 0x1d, 0xd8, 0x5b, 0xb2,
+    0xf3, 0x55, 0x66, 0x26, 0x92, 0x38, 0xa5, 0xd7, 0x25, 0xe6, 0xf5, 0x9a,
+    0x59, 0xce, 0xab, 0x8f, 0x94, 0x99, 0xdf, 0x7a, 0xba, 0x4e, 0x62, 0xbb,
+    0xeb, 0x89, 0xa2, 0x5e, 0x73, 0x80, 0x88, 0xf9, 0x29, 0x74, 0x5f, 0x19,
+    0xf1, 0x30, 0x83, 0x78, 0x98, 0x41, 0x3c, 0xcc, 0x20, 0xb6, 0x66, 0x10,
+    0x53, 0x33, 0x7c, 0xff, 0x72, 0x3c, 0x1a, 0x5c, 0x9f, 0xad, 0xc8, 0x6b,
+    0xa3, 0xc8, 0x69, 0xef, 0x3a, 0x39, 0x8d, 0xe9, 0xcd, 0x1b, 0x6c, 0x9f,
+    0x6f, 0x43, 0x8c, 0x32, 0xcd, 0x97, 0xc1, 0xfd, 0xb6, 0x83, 0xdb, 0x85,
+    0x58, 0xb2, 0x65, 0x87, 0xce, 0x71, 0xbe, 0xb8, 0xc7, 0x0f, 0xdc, 0x53,
+    0x02, 0xf7, 0x20, 0x70, 0x7b, 0x80, 0xc7, 0xbe, 0xe7, 0x39, 0x2e, 0xa5,
+    0x14, 0x35, 0x53, 0x6a, 0xd0, 0x90, 0xcd, 0xa8, 0x68, 0x6c, 0xc2, 0x5d,
+    0x80, 0x71, 0x39, 0x89, 0x39, 0xd4, 0x0c, 0x49, 0xbf, 0x33, 0x87, 0x71,
+    0xd9, 0xad, 0x1d, 0x7c, 0xa0, 0x3b, 0x87, 0x7c, 0xe1, 0xa5, 0x4c, 0x63,
+    0x1d, 0xe2, 0x3d, 0x2a, 0x62, 0xfd, 0xc9, 0xc5, 0x10, 0xee, 0x03, 0x15,
+    0x39, 0x83, 0xef, 0x37, 0x0f, 0x85, 0xf5, 0x2a, 0xf8, 0x08, 0xcb, 0xfb,
+    0x1f, 0x1e, 0x9f, 0x7e, 0x66, 0xc7, 0xfc, 0x72, 0xcd, 0x5a, 0x82, 0x8e,
+    0xfe, 0x9a, 0xec, 0xda, 0xc0, 0x0b, 0x5c, 0xdc, 0xd1, 0xaa, 0x0f, 0xfd,
+    0x7b, 0x2c, 0x3b, 0x74, 0x27, 0x81, 0x96, 0xe3, 0x36, 0x86, 0x03, 0xed,
+    0x39, 0xae, 0xa6, 0x64, 0xe1, 0xa3, 0x2d, 0x25, 0x61, 0x3f, 0xcd, 0xae,
+    0x83, 0x63, 0x71, 0x53, 0xe8, 0xf8, 0x20, 0x78, 0xbd, 0x23, 0x6a, 0x78,
+    0x69, 0xe1, 0x8e, 0x10, 0x85, 0xf8, 0x8e, 0x2a, 0xac, 0x1a, 0xbb, 0x67,
+    0x24, 0xcb, 0xab, 0xbf, 0x83, 0xfa, 0x52, 0xc7, 0xdd, 0x19, 0xc4, 0xdd,
+    0xcb, 0xe7, 0x4c, 0xa8, 0xcd, 0x25, 0x5d, 0xdb, 0x8f, 0xfc, 0x5b, 0x4c,
+    0x00, 0x2e, 0x93, 0x18, 0x3f, 0x44, 0x6b, 0x30, 0x06, 0x5c, 0xae, 0x73,
+    0xd6, 0x03, 0x18, 0x03, 0x2e, 0x47, 0x54, 0x71, 0x77, 0xea, 0x7c, 0x37,
+    0x57, 0x82, 0x07, 0xc6, 0xe5, 0x28, 0xe6, 0xa2, 0xaa, 0x59, 0x6e, 0x0b,
+    0x67, 0x4a, 0xcc, 0x1b, 0x7d, 0xb9, 0x1a, 0x32, 0x98, 0x69, 0xd4, 0x94,
+    0xc7, 0xbd, 0xa9, 0x42, 0xf8, 0x28, 0xf2, 0x55, 0xd6, 0xb8, 0xd3, 0xc9,
+    0x7f, 0x7c, 0xd7, 0x7f, 0x6c, 0x35, 0x0b, 0x98, 0x65, 0x0b, 0xe0, 0xec,
+    0xa4, 0x65, 0xca, 0x84, 0xf7, 0x85, 0xe7, 0xb8, 0x9c, 0x52, 0xb4, 0x1e,
+    0xdc, 0xf1, 0x97, 0xe3, 0x68, 0x17, 0xce, 0xd1, 0xc4, 0x75, 0xe5, 0x66,
+    0x29, 0xc5, 0xfa, 0xd8, 0xb1, 0x99, 0xe3, 0x9f, 0x16, 0x2e, 0x7a, 0x14,
+    0xdc, 0x37, 0x35, 0x3a, 0xe7, 0x5f, 0xc6, 0x61, 0x5c, 0x95, 0x6a, 0x04,
+    0x1c, 0x04, 0xfe, 0x20, 0x35, 0xd5, 0x20, 0x07, 0xea, 0xbf, 0x4f, 0xd7,
+    0xd5, 0xec, 0x01, 0xdf, 0x4b, 0xa4, 0xad, 0xdb, 0xe3, 0xf5, 0xe9, 0x5e,
+    0x51, 0xf3, 0xd3, 0x32, 0x0d, 0xea, 0x89, 0xd4, 0x54, 0x71, 0x3e, 0xc1,
+    0x7a, 0x8d, 0x92, 0x77, 0x81, 0xf5, 0xfa, 0x12, 0xf4, 0xca, 0xeb, 0x8c,
+    0xbb, 0x1a, 0x7f, 0xca, 0x27, 0x09, 0x5b, 0x4e, 0xf9, 0xbc, 0xfa, 0x19,
+    0xe0, 0x71, 0x2e, 0x7b, 0xd8, 0x79, 0x07, 0xfd, 0x46, 0x9a, 0x1e, 0x87,
+    0xa6, 0xc7, 0xab, 0xbf, 0xfe, 0x25, 0x69, 0x1e, 0xf0, 0x40, 0x2e, 0xb2,
+    0xfd, 0xc6, 0x95, 0xeb, 0x9d, 0x15, 0x72, 0x6d, 0xc5, 0x71, 0xb9, 0x5f,
+    0x44, 0xbe, 0x60, 0x3d, 0xba, 0xfe, 0xf5, 0x04, 0x70, 0x76, 0x3a, 0x3c,
+    0x38, 0x27, 0x39, 0xba, 0x8c, 0x44, 0x69, 0x54, 0x47, 0x26, 0x48, 0xc9,
+    0xb4, 0x7d, 0x53, 0x14, 0xb1, 0xc9, 0x7c, 0x7a, 0x9d, 0x37, 0xe0, 0x54,
+    0x01, 0x79, 0xcf, 0xd1, 0x23, 0xf3, 0x9c, 0x82, 0xde, 0xae, 0x18, 0x77,
+    0x5d, 0x39, 0x7e, 0xc0, 0x03, 0x1a, 0xd4, 0x01, 0xee, 0xdc, 0x81, 0x5a,
+    0xd8, 0x87, 0xc2, 0x0b, 0xcc, 0x8f, 0xc7, 0x19, 0xf8, 0x30, 0xe3, 0xf1,
+    0x9c, 0x7b, 0x1e, 0x86, 0x19, 0xcf, 0x1d, 0xe3, 0x8f, 0xaa, 0xfa, 0x91,
+    0x23, 0x7d, 0x72, 0x8a, 0xf7, 0x9b, 0xa2, 0xac, 0xd0, 0x8b, 0xdd, 0xe4,
+    0x05, 0x8a, 0xf2, 0x3c, 0xcf, 0xc9, 0x62, 0x8e, 0x71, 0xf7, 0xb0, 0xbf,
+    0xf8, 0xb3, 0x38, 0x47, 0xa6, 0x5c, 0x11, 0x90, 0x53, 0x95, 0x4a, 0x56,
+    0x6f, 0x05, 0xec, 0x93, 0xe5, 0x94, 0x0f, 0x70, 0x3b, 0xe0, 0x75, 0x35,
+    0xf0, 0x21, 0x35, 0xab, 0xdf, 0xc5, 0x6f, 0xd6, 0x82, 0x9c, 0xba, 0xa3,
+    0x3d, 0xab, 0x77, 0x01, 0xbe, 0xa4, 0xc9, 0x9c, 0xdf, 0xca, 0x14, 0x97,
+    0x11, 0x23, 0x99, 0xf2, 0x23, 0x05, 0x39, 0xa1, 0xa2, 0x17, 0x3e, 0x08,
+    0xff, 0x0d, 0xa8, 0xfc, 0x7e, 0x41, 0x6e, 0x57, 0x57, 0xfa, 0xaf, 0x02,
+    0x7d, 0xf9, 0xc5, 0xbb, 0xac, 0x18, 0x9e, 0x42, 0x7e, 0xce, 0x1a, 0x83,
+    0xd4, 0xaf, 0x16, 0xc3, 0x0f, 0xe9, 0xb6, 0x1f, 0xdf, 0xec, 0xf8, 0xb1,
+    0x0a, 0x1e, 0xd2, 0xf4, 0xe7, 0xc8, 0xcb, 0x6c, 0x07, 0xce, 0xcd, 0x18,
+    0x0b, 0x9b, 0xd5, 0xed, 0x28, 0xea, 0x43, 0x35, 0xde, 0xe9, 0xd1, 0x1a,
+    0xdf, 0x34, 0xaf, 0x25, 0x31, 0x5e, 0xd2, 0x9e, 0x9f, 0xe0, 0x35, 0x99,
+    0x4e, 0x19, 0xe3, 0x58, 0xdb, 0xe7, 0xac, 0xdd, 0xb3, 0x6a, 0xad, 0xb1,
+    0xd6, 0x3b, 0x6d, 0xd4, 0xda, 0x6b, 0x85, 0x55, 0x6b, 0x09, 0xac, 0x25,
+    0x9d, 0xb5, 0xc7, 0x56, 0xad, 0x9d, 0xf8, 0x43, 0x8e, 0x15, 0x39, 0xf5,
+    0x23, 0xd8, 0x28, 0x89, 0x3b, 0xa3, 0x4a, 0x96, 0x52, 0xa1, 0x35, 0x69,
+    0x3d, 0xa0, 0x49, 0x0b, 0x3e, 0xdc, 0x5b, 0x8a, 0x17, 0x77, 0x33, 0xe0,
+    0x60, 0x25, 0xce, 0x5e, 0x81, 0x78, 0x02, 0x2c, 0x55, 0xc3, 0x87, 0x3c,
+    0xb8, 0x27, 0x01, 0xd7, 0xd4, 0x22, 0x87, 0xa0, 0xd6, 0x89, 0x02, 0x7e,
+    0xe4, 0x98, 0x04, 0x3d, 0xf5, 0x94, 0xc3, 0x61, 0x29, 0x15, 0xc6, 0x5c,
+    0x2f, 0xe6, 0x6a, 0x51, 0x9f, 0x0c, 0xa0, 0xa7, 0x75, 0xa8, 0x8f, 0x43,
+    0x69, 0x9d, 0xeb, 0x5e, 0xae, 0x19, 0xe3, 0xd4, 0x55, 0x3e, 0x03, 0x78,
+    0x88, 0xd7, 0xd6, 0x4a, 0x0b, 0x26, 0x5a, 0x01, 0x6d, 0x09, 0xad, 0x0a,
+    0xeb, 0xca, 0x5a, 0x5a, 0xe0, 0x78, 0x6f, 0x46, 0x5f, 0x44, 0x3b, 0x89,
+    0xb6, 0x14, 0x91, 0x16, 0x4e, 0xa2, 0xbd, 0x80, 0xf6, 0x12, 0x1a, 0xbf,
+    0x6b, 0x02, 0xc0, 0x0f, 0xa1, 0xb5, 0xa2, 0xb5, 0xa1, 0x1d, 0x40, 0x2b,
+    0xad, 0x95, 0x17, 0x5e, 0x40, 0xff, 0x12, 0x7a, 0xe4, 0xdd, 0x19, 0xe4,
+    0xdd, 0x19, 0xe4, 0x5d, 0xdc, 0x57, 0xc7, 0x66, 0xce, 0x06, 0x28, 0xa0,
+    0x89, 0xfb, 0xc4, 0x9b, 0x9a, 0xff, 0x9c, 0xd4, 0x17, 0x90, 0x6f, 0x1f,
+    0x5d, 0xbe, 0x47, 0xe7, 0x4b, 0x6e, 0x6c, 0x7c, 0x8a, 0xd8, 0x48, 0xae,
+    0x78, 0x73, 0x93, 0xca, 0x3e, 0xcc, 0xdf, 0x34, 0xec, 0x9a, 0x5e, 0x01,
+    0x8c, 0xfa, 0x47, 0xaf, 0x17, 0xf5, 0x47, 0xa6, 0xf4, 0x91, 0xd5, 0xb5,
+    0xfc, 0x7e, 0xe0, 0x37, 0x79, 0x73, 0xda, 0xae, 0xbf, 0x6f, 0xbe, 0x55,
+    0xd4, 0xda, 0x8b, 0x7f, 0x1c, 0x44, 0x4e, 0x8e, 0x9b, 0x72, 0x73, 0xb3,
+    0x92, 0xda, 0x47, 0x47, 0xca, 0x3c, 0xa6, 0x0e, 0xbb, 0x0e, 0x27, 0xf8,
+    0xde, 0xe9, 0x5d, 0xf6, 0x7b, 0x80, 0x6b, 0x71, 0xce, 0xe9, 0x6b, 0xf0,
+    0xa6, 0x88, 0x45, 0xf9, 0x2d, 0xdf, 0x2a, 0x6a, 0xbe, 0xf3, 0x3b, 0x38,
+    0x97, 0x29, 0x3a, 0xbf, 0xef, 0x63, 0xad, 0x26, 0x88, 0x83, 0xfa, 0x06,
+    0xf8, 0x1b, 0xd1, 0x6d, 0x90, 0x63, 0x40, 0xd4, 0xd7, 0x92, 0xf6, 0x22,
+    0x6a, 0xb9, 0x96, 0x83, 0xf5, 0xd1, 0xbf, 0x84, 0x7c, 0xbd, 0x2c, 0x5f,
+    0x89, 0xf4, 0xe2, 0x84, 0x55, 0x9d, 0x35, 0xf8, 0xed, 0x7d, 0xd1, 0x7a,
+    0x1e, 0x75, 0x26, 0xdf, 0x77, 0xfe, 0x94, 0x99, 0x7c, 0xb3, 0x24, 0xa5,
+    0xbd, 0x78, 0x5b, 0xcd, 0x1b, 0x21, 0x3a, 0x31, 0x6b, 0xe1, 0xfe, 0x42,
+    0x9d, 0x6b, 0x14, 0x50, 0x27, 0x60, 0x3c, 0xa7, 0xd0, 0x0b, 0x73, 0x44,
+    0xcf, 0xcd, 0x99, 0xc9, 0x37, 0x4a, 0x7f, 0x8e, 0xbc, 0x10, 0xa2, 0x23,
+    0x73, 0x3a, 0x3d, 0x36, 0x17, 0xa7, 0xa3, 0x8f, 0x2d, 0xbf, 0x91, 0x20,
+    0x97, 0x99, 0x4c, 0x97, 0x22, 0x94, 0x9e, 0xe5, 0x39, 0xce, 0x1f, 0x7c,
+    0x66, 0xae, 0xdf, 0xf8, 0x7e, 0xe3, 0x73, 0xcb, 0x34, 0x19, 0x89, 0x15,
+    0x0a, 0x54, 0x83, 0x58, 0x5e, 0xc3, 0x71, 0x2e, 0x68, 0x70, 0x37, 0x90,
+    0xda, 0x44, 0x34, 0x0a, 0xfe, 0xcd, 0xa5, 0x2e, 0xd8, 0x39, 0x42, 0x93,
+    0xb3, 0x5d, 0x22, 0xff, 0x64, 0x22, 0xac, 0x13, 0xb6, 0x95, 0xab, 0x0f,
+    0xf7, 0x1b, 0x56, 0xd0, 0xc9, 0x07, 0x22, 0xdf, 0x83, 0x0f, 0xe3, 0xf1,
+    0xfe, 0xe4, 0xec, 0xef, 0xea, 0xae, 0x92, 0xf8, 0x7d, 0x95, 0xe5, 0xda,
+    0xaf, 0xc4, 0xb4, 0x2c, 0x8b, 0xb0, 0x53, 0xad, 0x44, 0x6f, 0x5b, 0xb2,
+    0xb0, 0x07, 0xde, 0xcb, 0x73, 0xa8, 0xcd, 0xe6, 0xb8, 0x3e, 0xd2, 0xd0,
+    0xf3, 0x5d, 0x8c, 0xa7, 0x41, 0x2a, 0x04, 0x58, 0xc2, 0x3e, 0x66, 0x12,
+    0x3e, 0x99, 0x94, 0xa6, 0xbf, 0x42, 0xa2, 0x86, 0x9b, 0xfb, 0x19, 0xf0,
+    0xea, 0xd0, 0xbb, 0xb2, 0xb9, 0xb5, 0x89, 0xf8, 0x76, 0x54, 0xb0, 0xdf,
+    0xe2, 0xa3, 0xbb, 0xd2, 0xe2, 0x7c, 0x7c, 0x47, 0xb7, 0x27, 0x91, 0x3f,
+    0x9e, 0x42, 0x0d, 0xca, 0x6f, 0x58, 0x32, 0xcb, 0xc4, 0xdf, 0xc0, 0x38,
+    0xcf, 0xd0, 0xe5, 0xfa, 0x80, 0xd7, 0x55, 0xd4, 0xf4, 0x11, 0xdc, 0xd9,
+    0xb5, 0xb4, 0x44, 0xb1, 0x28, 0x54, 0x0e, 0xbf, 0x6c, 0x4f, 0xce, 0x97,
+    0xc2, 0xc4, 0xef, 0x9f, 0x87, 0x46, 0xe9, 0x29, 0x6f, 0x4a, 0xd4, 0xce,
+    0x51, 0xbe, 0xb3, 0x1e, 0x03, 0xee, 0xe3, 0xa5, 0x2d, 0xc9, 0x67, 0xe9,
+    0x53, 0xcb, 0x7e, 0x2f, 0xc9, 0xd4, 0x17, 0xd9, 0x82, 0x77, 0xcd, 0x25,
+    0xbc, 0x89, 0xaf, 0x78, 0xbf, 0xc2, 0xa7, 0xf8, 0xec, 0x5d, 0xc9, 0xac,
+    0x38, 0x2f, 0xf6, 0x5f, 0x14, 0x35, 0x99, 0x78, 0x87, 0x64, 0x16, 0x3f,
+    0xae, 0xbc, 0xfc, 0x2d, 0xcc, 0x43, 0x76, 0x2e, 0xc2, 0xf9, 0x16, 0xdb,
+    0x77, 0x16, 0xf5, 0x9f, 0x38, 0xdf, 0xc4, 0xce, 0x08, 0x5b, 0xfa, 0xf5,
+    0x35, 0x78, 0xdf, 0x45, 0x51, 0xb7, 0x44, 0xa0, 0x47, 0x9d, 0x7e, 0xbe,
+    0xa8, 0xe1, 0xdd, 0x52, 0x87, 0x5a, 0x26, 0x46, 0x15, 0xfa, 0x28, 0xfc,
+    0xd0, 0x4f, 0x7f, 0xd7, 0x60, 0x50, 0x48, 0x8f, 0xd1, 0x1a, 0x7d, 0x8c,
+    0xaa, 0xc0, 0xab, 0x1a, 0x3e, 0x1e, 0x45, 0x5e, 0xbd, 0x46, 0xef, 0xc5,
+    0xb3, 0x76, 0x2b, 0x72, 0x3c, 0xd1, 0x91, 0xc2, 0x9f, 0xd0, 0x2d, 0x22,
+    0x76, 0x2a, 0xe9, 0x56, 0xd1, 0xdf, 0x83, 0xf7, 0x24, 0xf8, 0xa1, 0xde,
+    0x3b, 0x8e, 0x7a, 0xef, 0x29, 0xc4, 0xe9, 0x93, 0x90, 0xcf, 0xd6, 0x2d,
+    0x0e, 0x30, 0xc7, 0x67, 0x89, 0x43, 0x0e, 0x0f, 0x68, 0xab, 0xe9, 0x5b,
+    0xea, 0x7d, 0x94, 0x89, 0x57, 0xa0, 0x76, 0xb2, 0x79, 0xdc, 0x2d, 0xfa,
+    0x18, 0xb5, 0xab, 0x0a, 0xfd, 0x0b, 0xee, 0x26, 0xdc, 0x7f, 0xf4, 0x57,
+    0x73, 0x6f, 0x88, 0xef, 0x4c, 0xfc, 0x36, 0xbf, 0x5d, 0xac, 0x7f, 0x64,
+    0xdd, 0xe5, 0xc4, 0xf6, 0xb3, 0xa8, 0x2d, 0xfe, 0x15, 0x75, 0xef, 0xdc,
+    0xd1, 0x6a, 0x3a, 0xd2, 0x50, 0x4d, 0x7d, 0x46, 0x90, 0x5e, 0x8e, 0x4b,
+    0x54, 0x58, 0x67, 0x80, 0xfe, 0x8f, 0xd0, 0x38, 0x4f, 0x4b, 0xd7, 0xc8,
+    0xd0, 0x25, 0xc7, 0x72, 0xc7, 0xdc, 0x96, 0x68, 0x8f, 0xc7, 0xef, 0xd4,
+    0x22, 0xd0, 0x5f, 0x81, 0x61, 0x7e, 0xd3, 0x4a, 0xd8, 0xeb, 0x9f, 0xb9,
+    0x06, 0x33, 0xba, 0x24, 0xfb, 0x7b, 0x04, 0xe7, 0x89, 0xb6, 0x39, 0xde,
+    0xf7, 0x7d, 0xf1, 0x4e, 0x9c, 0x82, 0x21, 0x4f, 0x60, 0xbf, 0x9b, 0x14,
+    0xde, 0x0f, 0x55, 0xee, 0xdc, 0x46, 0x95, 0xbf, 0x33, 0x15, 0xb1, 0xff,
+    0xd1, 0x86, 0x6b, 0xdd, 0x37, 0x2b, 0xde, 0x95, 0x2a, 0xe2, 0xd9, 0x40,
+    0x6c, 0xda, 0xef, 0x20, 0xce, 0x43, 0x7d, 0xa0, 0xed, 0x29, 0xf0, 0xf7,
+    0x1c, 0x11, 0xd3, 0xd8, 0xeb, 0x98, 0xd8, 0xcb, 0x94, 0x98, 0xde, 0x03,
+    0xbf, 0xfe, 0x50, 0xec, 0x31, 0x29, 0xf6, 0x90, 0x80, 0xc7, 0xe7, 0x3f,
+    0xb8, 0xf3, 0xd5, 0x18, 0xcb, 0xf8, 0x9e, 0xd5, 0xc5, 0x6f, 0x13, 0x9d,
+    0x71, 0x3f, 0x59, 0x96, 0xe5, 0x80, 0x90, 0x8d, 0x6d, 0xc0, 0x7a, 0xfa,
+    0x47, 0x21, 0xef, 0xe4, 0xdc, 0xb9, 0xcf, 0x9f, 0x6e, 0xd0, 0x3d, 0xf3,
+    0xa8, 0x79, 0x1f, 0x5f, 0xe4, 0xef, 0x39, 0xba, 0xe7, 0x71, 0xc4, 0xca,
+    0x63, 0x0d, 0x75, 0x9e, 0x67, 0x16, 0x1b, 0x3d, 0x3f, 0x5d, 0xbc, 0x06,
+    0x3e, 0xa2, 0x62, 0x6d, 0x3d, 0xe2, 0xc1, 0x99, 0x5f, 0xf6, 0x7b, 0xcd,
+    0xf3, 0x74, 0x03, 0xe6, 0x03, 0xb6, 0x2d, 0xd8, 0x8f, 0x71, 0x67, 0xd0,
+    0x4f, 0x0d, 0xfe, 0xe6, 0x16, 0x53, 0x97, 0xf0, 0xa0, 0x57, 0x28, 0xa8,
+    0xfa, 0xe1, 0x5f, 0x93, 0xf0, 0xf9, 0xa3, 0x06, 0xcf, 0x05, 0x55, 0x99,
+    0x74, 0x8c, 0x63, 0xe6, 0x12, 0xce, 0x75, 0xc4, 0x08, 0x9a, 0x12, 0x25,
+    0xe8, 0x00, 0xee, 0x83, 0x79, 0x83, 0xe7, 0x82, 0xa6, 0x97, 0x9a, 0x31,
+    0x66, 0xb8, 0xd2, 0xf4, 0x53, 0x2c, 0x89, 0x3e, 0x29, 0x23, 0x2e, 0xd0,
+    0x47, 0x25, 0xaa, 0x34, 0xbc, 0xa8, 0x53, 0x0e, 0x94, 0xe3, 0xf4, 0x17,
+    0xe5, 0x24, 0x4d, 0x95, 0x5b, 0x69, 0xff, 0xf2, 0x37, 0x14, 0x51, 0x07,
+    0xb7, 0x12, 0xf8, 0x7f, 0xab, 0xb4, 0x59, 0xdd, 0xec, 0xf1, 0x41, 0x2f,
+    0x21, 0xaa, 0x14, 0xf5, 0xb1, 0x86, 0x18, 0xab, 0x43, 0x8c, 0x45, 0x44,
+    0x18, 0x35, 0x97, 0xdc, 0x7c, 0x22, 0x45, 0xb7, 0xdc, 0xc7, 0xeb, 0xf5,
+    0x78, 0xd7, 0x1a, 0xc0, 0x69, 0x04, 0xce, 0x51, 0x9c, 0x39, 0x0e, 0x1c,
+    0x0f, 0x5d, 0x1f, 0x63, 0x3e, 0x1f, 0xc2, 0x26, 0x2e, 0x1e, 0xc7, 0x8a,
+    0xcb, 0x8b, 0xf9, 0x70, 0x8c, 0x00, 0x3f, 0x60, 0xdf, 0x07, 0xe9, 0x19,
+    0x8f, 0xc8, 0x93, 0xb0, 0xdb, 0x8a, 0xef, 0xee, 0xaf, 0x39, 0xdf, 0xb4,
+    0x2b, 0x31, 0xef, 0x7e, 0x77, 0x46, 0x7c, 0x85, 0x0e, 0xef, 0xbc, 0x5c,
+    0x7b, 0xbd, 0xbc, 0x2b, 0x5d, 0x7a, 0xcf, 0xa9, 0x61, 0xdd, 0xf3, 0xac,
+    0xce, 0x7d, 0xaf, 0x57, 0xba, 0x75, 0xeb, 0xdd, 0x25, 0xe6, 0x13, 0x20,
+    0xed, 0xaa, 0xeb, 0xd1, 0xdf, 0xb1, 0xae, 0xad, 0x5a, 0xe7, 0xf7, 0x49,
+    0x9d, 0xb3, 0x0e, 0x1b, 0x23, 0xbe, 0xef, 0x2e, 0xa1, 0x9f, 0xa9, 0x73,
+    0x70, 0xb4, 0xab, 0xe0, 0xc4, 0x7f, 0x03, 0x8e, 0x9b, 0x23, 0x5c, 0x5c,
+    0xce, 0xfb, 0xfc, 0xbe, 0x84, 0x76, 0x26, 0xbd, 0x54, 0x88, 0xd8, 0x77,
+    0xb1, 0x1d, 0xe3, 0xc2, 0x87, 0x40, 0xa7, 0xd3, 0x75, 0xd3, 0x15, 0x97,
+    0x4c, 0xc4, 0x86, 0xba, 0xe9, 0x03, 0xe1, 0x97, 0xca, 0xa4, 0xe5, 0xdc,
+    0xbb, 0x67, 0xc4, 0xbe, 0x4f, 0x2d, 0x1e, 0xa2, 0x9a, 0x54, 0xe1, 0xc7,
+    0x1d, 0x37, 0x72, 0xde, 0xb1, 0x73, 0x10, 0xbf, 0xa5, 0x9e, 0x5c, 0x64,
+    0xfe, 0x1e, 0xba, 0x63, 0xd3, 0x96, 0x03, 0xb5, 0x52, 0x4c, 0x35, 0xa5,
+    0x4a, 0x35, 0x2c, 0xf1, 0x7e, 0x31, 0xcd, 0xa4, 0x77, 0xa1, 0xf7, 0x8d,
+    0x85, 0xb0, 0xf4, 0x91, 0x45, 0xeb, 0x78, 0x5d, 0x17, 0xb6, 0xbb, 0x32,
+    0xcf, 0xb8, 0xf9, 0x65, 0xb5, 0xec, 0xcc, 0xd7, 0xb2, 0xc2, 0xc8, 0x07,
+    0xea, 0x26, 0x2f, 0x85, 0xd7, 0x5d, 0x4d, 0x6e, 0xae, 0x4d, 0xcf, 0xcb,
+    0x8a, 0x13, 0x8b, 0xea, 0xa6, 0x96, 0x8e, 0x8e, 0x3d, 0x1d, 0x5a, 0x4b,
+    0x7b, 0x46, 0x8b, 0xed, 0x0b, 0x42, 0xf6, 0xef, 0x0c, 0xde, 0x9b, 0xcb,
+    0x6b, 0x83, 0xc3, 0x83, 0xe3, 0x41, 0x6a, 0x6f, 0x6b, 0x33, 0x1c, 0x90,
+    0xe1, 0xed, 0x2b, 0xe0, 0x26, 0x17, 0xce, 0xb4, 0xdd, 0x26, 0x40, 0x03,
+    0x59, 0x09, 0xf0, 0x32, 0xce, 0x1d, 0xcd, 0x1d, 0x37, 0x7d, 0xdb, 0x19,
+    0xe4, 0xf7, 0x0e, 0x6b, 0x63, 0xe3, 0xdd, 0xf9, 0xf1, 0xed, 0x5a, 0xdf,
+    0x60, 0xfe, 0xde, 0x07, 0xba, 0xf3, 0x39, 0x00, 0xc3, 0x83, 0x63, 0x03,
+    0xb9, 0x5e, 0xde, 0xd3, 0x5c, 0x4f, 0x85, 0x9f, 0xa3, 0x75, 0x39, 0xed,
+    0xe4, 0x0a, 0x98, 0xdb, 0xcb, 0x68, 0xe7, 0x56, 0x8c, 0x0f, 0xa0, 0x95,
+    0xd1, 0xa8, 0x8e, 0x0a, 0x09, 0xf4, 0xe7, 0xd1, 0x2e, 0xa2, 0x8d, 0xe5,
+    0xc6, 0xb5, 0xec, 0xd0, 0xf7, 0xb5, 0xc1, 0x5e, 0x2d, 0x97, 0xcf, 0x8f,
+    0xe4, 0x99, 0xb7, 0x33, 0x8e, 0xf5, 0xee, 0xd6, 0xfa, 0xb1, 0x3c, 0x3a,
+    0x34, 0x74, 0x79, 0x8d, 0xc2, 0x17, 0xb6, 0x51, 0x69, 0xff, 0x2d, 0x74,
+    0x36, 0x92, 0xa2, 0x17, 0x1f, 0xfd, 0x3a, 0x16, 0xc1, 0x62, 0x7c, 0x70,
+    0xb8, 0xff, 0x6b, 0x59, 0x5e, 0x16, 0xba, 0xd9, 0xad, 0xed, 0xed, 0x19,
+    0x19, 0xb1, 0x29, 0xfb, 0xf2, 0xb9, 0xfb, 0x34, 0x6d, 0x18, 0xa3, 0xc1,
+    0x61, 0x2d, 0xdf, 0x3d, 0xdc, 0x9f, 0xd3, 0x82, 0xc1, 0xee, 0x71, 0x2d,
+    0x36, 0xb6, 0x3b, 0xd6, 0xbb, 0x2d, 0x36, 0x16, 0xbf, 0x3e, 0xb8, 0x82,
+    0x2e, 0x3b, 0xba, 0x57, 0x10, 0x7c, 0x03, 0xbb, 0x6b, 0xdd, 0xc3, 0xbd,
+    0x5a, 0x6f, 0x6f, 0xfe, 0xf2, 0x44, 0xb6, 0x7b, 0x58, 0x70, 0xea, 0xc9,
+    0x69, 0x3f, 0xc8, 0xe5, 0x47, 0x1a, 0xb5, 0xec, 0x40, 0x2e, 0xfb, 0x7d,
+    0xad, 0x67, 0xa4, 0x3b, 0x8f, 0xc5, 0x91, 0xe1, 0xbe, 0xc1, 0xfe, 0xdf,
+    0xc2, 0x7b, 0x59, 0x9a, 0xc1, 0x31, 0x47, 0x9e, 0xf1, 0x5c, 0x3f, 0x0c,
+    0x37, 0x0e, 0xf3, 0x8d, 0x69, 0xe3, 0x03, 0x60, 0x8e, 0xed, 0x6d, 0x94,
+    0x91, 0xfc, 0x36, 0x67, 0x77, 0x31, 0xfe, 0x22, 0x53, 0x87, 0x67, 0x7b,
+    0x2e, 0x3f, 0x38, 0x3a, 0x70, 0x99, 0x35, 0x84, 0x04, 0xf7, 0x91, 0xbd,
+    0xe3, 0xda, 0x48, 0x9f, 0x7d, 0xda, 0xab, 0x08, 0x14, 0xec, 0x06, 0x7e,
+    0xe7, 0xe5, 0x63, 0x05, 0xef, 0x5d, 0x35, 0xbe, 0x7f, 0xd5, 0x38, 0x77,
+    0xc5, 0x58, 0x9c, 0x89, 0x49, 0xb8, 0xef, 0x76, 0x7a, 0x96, 0x9c, 0xed,
+    0x36, 0x36, 0xb2, 0x37, 0x9f, 0xcd, 0xed, 0xc6, 0x8e, 0x41, 0x16, 0x7e,
+    0xd5, 0x14, 0x11, 0x0c, 0xda, 0x09, 0x92, 0x7c, 0xae, 0xbf, 0xf3, 0xfe,
+    0xee, 0xa1, 0xbd, 0x39, 0xa6, 0x85, 0x5f, 0x75, 0x83, 0xff, 0x20, 0x36,
+    0xe9, 0x1d, 0xbc, 0x1f, 0x3c, 0x87, 0x06, 0xfb, 0x87, 0x3b, 0x6d, 0xc6,
+    0xbc, 0x6b, 0x67, 0x76, 0x24, 0x9f, 0xcf, 0x65, 0xd9, 0xc8, 0x14, 0x1b,
+    0xb3, 0x25, 0x68, 0x6e, 0xee, 0x10, 0xcc, 0xf3, 0xdd, 0xe3, 0xcc, 0xba,
+    0x37, 0x68, 0xcf, 0xb5, 0x77, 0xde, 0x7a, 0xfb, 0xed, 0x7b, 0xda, 0x5b,
+    0xef, 0xee, 0x84, 0xc3, 0x77, 0xb6, 0xed, 0xc9, 0xdc, 0x26, 0xd4, 0xcb,
+    0x1a, 0xa9, 0xaf, 0xaf, 0x07, 0xce, 0xbd, 0xf9, 0xa6, 0xdd, 0x4e, 0xd8,
+    0x00, 0xbe, 0x61, 0x05, 0xbc, 0x7d, 0x05, 0x6c, 0x2c, 0xc3, 0x4c, 0x0d,
+    0xe2, 0xdd, 0x2e, 0xdb, 0xcc, 0x4d, 0x6d, 0xb7, 0xa6, 0x3b, 0x9b, 0xf7,
+    0xdc, 0xde, 0x62, 0x63, 0xe0, 0x90, 0xa3, 0x5a, 0x7e, 0x9f, 0x36, 0x20,
+    0x5c, 0x00, 0x92, 0xf7, 0x40, 0xa2, 0xc1, 0x91, 0xe1, 0xdd, 0x1c, 0x67,
+    0x02, 0xf7, 0xa6, 0x36, 0xb8, 0xd5, 0x83, 0x59, 0xc8, 0xd8, 0xa8, 0x8d,
+    0xc0, 0x56, 0xdc, 0xf7, 0xc2, 0x5e, 0xb6, 0x22, 0x1d, 0x9c, 0xd6, 0xdf,
+    0x8d, 0x93, 0xfe, 0x12, 0x7c, 0xd2, 0xbf, 0x95, 0x0f, 0x64, 0xcd, 0x76,
+    0xf6, 0xf6, 0x0d, 0x76, 0x72, 0x88, 0x93, 0x6d, 0x0b, 0xcc, 0x75, 0x8e,
+    0x3f, 0x38, 0x2a, 0xec, 0x80, 0x22, 0x99, 0x8c, 0xbd, 0xf6, 0x33, 0xe4,
+    0x36, 0xce, 0xdf, 0x76, 0x59, 0x43, 0xc3, 0xfc, 0x3f, 0xbc, 0x1d, 0x36,
+    0xbc, 0x1f, 0xed, 0x6f, 0xb7, 0xd8, 0xf0, 0x8f, 0xf9, 0x8e, 0x68, 0xb0,
+    0xe1, 0x17, 0xd0, 0xda, 0xbe, 0x6a, 0xc3, 0x8d, 0x1e, 0x54, 0x01, 0xb5,
+    0x36, 0x7c, 0x97, 0x44, 0x74, 0xb2, 0xc2, 0xf9, 0xf4, 0xa8, 0x10, 0xbd,
+    0xaa, 0xd8, 0x70, 0xc0, 0x8f, 0x1c, 0x22, 0xdb, 0x70, 0x57, 0x05, 0xd1,
+    0x7d, 0x92, 0x0d, 0x2f, 0xd5, 0x10, 0x25, 0x3d, 0xce, 0x53, 0x08, 0x55,
+    0xc6, 0x61, 0xe7, 0x59, 0xc4, 0x02, 0xdd, 0xee, 0xc2, 0xd8, 0xb8, 0xc1,
+    0x85, 0x7f, 0x49, 0x74, 0xad, 0x0b, 0x9f, 0xf0, 0xd0, 0x1a, 0x17, 0x2e,
+    0xca, 0xe4, 0xa3, 0x30, 0x75, 0x48, 0xf6, 0x66, 0xb2, 0x03, 0x6b, 0x3f,
+    0x61, 0xd8, 0xc1, 0x79, 0x11, 0xaf, 0x3e, 0x50, 0xbc, 0x5d, 0xcd, 0x07,
+    0xc1, 0x4b, 0x10, 0x30, 0xff, 0xcc, 0x34, 0x5e, 0xda, 0xee, 0xe7, 0x81,
+    0x83, 0x61, 0xe4, 0xfd, 0x08, 0x7d, 0x52, 0x05, 0x39, 0x5f, 0x5b, 0xc7,
+    0x77, 0x87, 0x2d, 0x5b, 0x71, 0x03, 0x60, 0x1b, 0x67, 0x2e, 0xb6, 0x09,
+    0x70, 0x05, 0xfd, 0x83, 0x0f, 0xf2, 0x9f, 0xda, 0x0a, 0xd8, 0xfe, 0x17,
+    0xdc, 0xb9, 0xfe, 0x1d, 0xfc, 0x7f, 0x05, 0xfa, 0xb0, 0x12, 0x83, 0x8a,
+    0x6f, 0x08, 0x98, 0x7f, 0xc1, 0x3b, 0xb7, 0xa6, 0x39, 0x3d, 0xdd, 0xd1,
+    0xde, 0xa6, 0x35, 0x19, 0xdb, 0x6f, 0xf8, 0x9a, 0xb1, 0x73, 0xab, 0x61,
+    0x18, 0x3b, 0x9b, 0xb6, 0xf6, 0x37, 0x65, 0x77, 0x26, 0x9b, 0x76, 0x26,
+    0xb6, 0xf6, 0x0e, 0xe6, 0xc7, 0x1f, 0xd4, 0xe2, 0x7b, 0xb2, 0xe3, 0x5a,
+    0x53, 0x02, 0x48, 0x4d, 0x4d, 0xda, 0x56, 0x6d, 0xfb, 0x8e, 0xdd, 0xc6,
+    0xce, 0xdd, 0x89, 0x1b, 0x39, 0x88, 0xe3, 0xc3, 0x7b, 0x87, 0x86, 0xae,
+    0x87, 0xdd, 0xbb, 0x87, 0x39, 0x97, 0x20, 0x84, 0x44, 0x06, 0x1a, 0x1b,
+    0x19, 0xca, 0x05, 0xed, 0xef, 0x59, 0x97, 0x7f, 0xf4, 0xff, 0xfc, 0xe7,
+    0x49, 0x6d, 0xa8, 0xa6, 0xaa, 0x6a, 0xeb, 0xab, 0x80, 0xeb, 0xc4, 0xff,
+    0x61, 0x30, 0xb7, 0xb4, 0x21, 0x5c, 0x55, 0xad, 0x86, 0xaf, 0x98, 0x3b,
+    0xf9, 0xc5, 0xb9, 0xab, 0xf2, 0x3b, 0x7d, 0x15, 0xda, 0x97, 0xbf, 0x24,
+    0xed, 0xdc, 0x86, 0xaa, 0x2f, 0xd0, 0x1e, 0xda, 0x50, 0x5d, 0x55, 0x1d,
+    0xbe, 0x42, 0x3e, 0x3a, 0xfc, 0xc5, 0x39, 0xcf, 0x2c, 0xcf, 0xad, 0xa2,
+    0x3d, 0xf8, 0xc5, 0xb9, 0xef, 0xfd, 0xa0, 0x73, 0x0c, 0x79, 0xbd, 0x7b,
+    0xc8, 0xd9, 0x33, 0xba, 0x05, 0xf7, 0x26, 0x7e, 0x67, 0xaf, 0xa7, 0xc2,
+    0x85, 0xcd, 0x70, 0x3d, 0xb4, 0x43, 0x68, 0xb3, 0x86, 0x3d, 0xcf, 0xde,
+    0xc6, 0x2e, 0x5c, 0xe1, 0xf4, 0x41, 0xa7, 0xaf, 0x74, 0x7a, 0x84, 0x1a,
+    0x55, 0xad, 0xf2, 0x89, 0xff, 0xcb, 0xef, 0x7f, 0x01, 0xc0, 0x90, 0xc3,
+    0x63,
+};
+
+const firmware_blob_t firmware_blob_8f48ab74a25c1044 = {
+    blob_8f48ab74a25c1044_z, sizeof(blob_8f48ab74a25c1044_z), 8704, 0x937d3e17
+};
@@ -0,0 +1,394 @@
+/**
+ * Embedded Firmware blob 9b3417afb6e92596
+ * Used by: t21 SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 8796 bytes, 4543 compressed
+static const uint8_t blob_9b3417afb6e92596_z[] = {
+    0x78, 0xda, 0xd5, 0x59, 0x6b, 0x6c, 0x5c, 0xc7, 0x75, 0x3e, 0x7b, 0xf7,
+    0x92, 0x5c, 0xbe, 0x2f, 0xa9, 0x8d, 0xb4, 0xb2, 0x68, 0x65, 0x56, 0xbc,
+    0x4b, 0xae, 0x22, 0xca, 0x58, 0x52, 0x94, 0xb8, 0x22, 0x56, 0xc0, 0x7a,
+    0x77, 0xa9, 0x07, 0x4c, 0x49, 0x34, 0xcd, 0xc0, 0x72, 0x2a, 0x80, 0x8f,
+    0x5d, 0x4a, 0xa2, 0x4d, 0x91, 0xf4, 0x92, 0x4e, 0xe5, 0x94, 0x8d, 0x2f,
+    0x28, 0xda, 0x90, 0x9b, 0x05, 0xc9, 0xba, 0x6e, 0x2a, 0x18, 0x29, 0xb0,
+    0xd6, 0xcb, 0x7d, 0x10, 0x5c, 0x4a, 0x8a, 0x01, 0xff, 0xa8, 0x21, 0x41,
+    0x31, 0x12, 0xb5, 0xc8, 0x0f, 0x05, 0x15, 0x9a, 0xa0, 0x08, 0x1a, 0x35,
+    0x75, 0x5b, 0xff, 0x30, 0x20, 0x05, 0x30, 0x60, 0xb9, 0x96, 0x7d, 0xfb,
+    0x9d, 0x99, 0x7b, 0xc9, 0x95, 0xac, 0x20, 0xf2, 0x8f, 0xfe, 0xe8, 0x02,
+    0x17, 0x73, 0x66, 0xe6, 0xcc, 0x9c, 0x33, 0x67, 0xce, 0x73, 0xb6, 0xcc,
+    0xd2, 0xe2, 0x84, 0x9f, 0x46, 0x89, 0xf6, 0x32, 0x6b, 0x46, 0xc1, 0x03,
+    0x6a, 0xcc, 0x7e, 0xc5, 0x1b, 0xb3, 0xed, 0x74, 0xbb, 0x69, 0x24, 0x31,
+    0xa6, 0xe6, 0xe2, 0xe4, 0x8b, 0xe9, 0xf7, 0x7c, 0xdb, 0x69, 0xe0, 0x54,
+    0xdc, 0xa2, 0xf2, 0x18, 0x1d, 0x7b, 0x3d, 0xfe, 0xf7, 0xa5, 0xe4, 0xe3,
+    0xb9, 0x13, 0x94, 0x98, 0xaf, 0x26, 0xdd, 0x0c, 0x86, 0x89, 0xfc, 0xb4,
+    0x37, 0x47, 0x96, 0x16, 0x6b, 0xdf, 0x96, 0x30, 0x0d, 0x2a, 0x35, 0x83,
+    0x01, 0xa2, 0x2a, 0x2a, 0x37, 0x83, 0x3d, 0x71, 0xda, 0x48, 0x65, 0x26,
+    0xd1, 0x53, 0x39, 0x1f, 0x55, 0x7e, 0x43, 0xd2, 0x0b, 0x8f, 0x4c, 0x04,
+    0xc5, 0xdf, 0x91, 0x4e, 0xaf, 0x61, 0xec, 0xd5, 0x9c, 0x4e, 0xa9, 0x37,
+    0xc9, 0xfc, 0xe9, 0xb4, 0x5d, 0x7b, 0x3e, 0xe2, 0xa1, 0xb4, 0xf9, 0x89,
+    0x7d, 0xd4, 0x5f, 0x45, 0x09, 0x93, 0xac, 0xb2, 0x58, 0x24, 0xfa, 0xdb,
+    0x9c, 0x96, 0xd0, 0xb1, 0x57, 0x72, 0xc1, 0xa6, 0x74, 0xc4, 0xa2, 0x74,
+    0x3b, 0xe0, 0xbc, 0x4e, 0x7b, 0xf3, 0x44, 0xa9, 0x3c, 0xcf, 0xbf, 0x82,
+    0x71, 0x1e, 0x33, 0x69, 0x77, 0x3e, 0x4c, 0x5d, 0xe7, 0x7c, 0x74, 0xcb,
+    0xcb, 0x74, 0x98, 0x9f, 0x48, 0x34, 0x91, 0xf3, 0x53, 0x62, 0x81, 0xc7,
+    0x3c, 0x94, 0x88, 0x7c, 0x64, 0xbf, 0xdf, 0x5c, 0x41, 0x1a, 0x78, 0x5c,
+    0x2e, 0x88, 0x59, 0x7d, 0xda, 0x4b, 0xda, 0x5a, 0x3f, 0x5d, 0x29, 0x7c,
+    0xbf, 0x8a, 0xaa, 0xf8, 0x2c, 0x6a, 0x4d, 0x32, 0x47, 0x34, 0x81, 0xbd,
+    0x53, 0xb9, 0x01, 0xe0, 0xfa, 0xe9, 0xe4, 0xc2, 0x00, 0x68, 0x7c, 0x61,
+    0x0f, 0xf9, 0x81, 0x3b, 0x8f, 0xb5, 0xf3, 0xbc, 0x5f, 0x80, 0xde, 0x6f,
+    0xe6, 0xfd, 0x78, 0xfd, 0x77, 0xb1, 0x9e, 0x49, 0x7e, 0x61, 0xc7, 0x8d,
+    0x55, 0xba, 0x57, 0xe6, 0x09, 0xb4, 0x19, 0x8f, 0xf1, 0x6d, 0xd0, 0x67,
+    0x99, 0xb9, 0x6b, 0x0c, 0x4a, 0xe6, 0x2a, 0x09, 0xb8, 0x38, 0x6b, 0xd0,
+    0x18, 0x22, 0x5a, 0xa3, 0xd1, 0x6d, 0xdb, 0x2b, 0x79, 0xd3, 0x29, 0x9e,
+    0xf7, 0xe1, 0x4c, 0xf7, 0xd0, 0x17, 0x68, 0xbd, 0xe4, 0x05, 0x6f, 0x46,
+    0x8c, 0xcf, 0x39, 0x06, 0x5a, 0x91, 0xa8, 0xb6, 0x84, 0x6f, 0x6e, 0x1d,
+    0xc6, 0x19, 0xef, 0x6f, 0x81, 0xd7, 0x80, 0xd6, 0xe5, 0x2f, 0x68, 0x10,
+    0xb9, 0x3c, 0x32, 0x3f, 0x0c, 0xdf, 0x89, 0x26, 0x4c, 0xa6, 0x7f, 0x17,
+    0xf4, 0x09, 0xb4, 0x77, 0x81, 0x36, 0x95, 0x27, 0xcc, 0x0d, 0x34, 0x44,
+    0x9f, 0x78, 0xe2, 0x52, 0x5e, 0x55, 0x96, 0xb7, 0xbd, 0x5e, 0xe0, 0xde,
+    0xa3, 0xa9, 0x45, 0x5a, 0xd6, 0x62, 0x1f, 0x89, 0xf8, 0xe2, 0x87, 0xf8,
+    0x6e, 0xe1, 0xfb, 0x58, 0x24, 0x17, 0xc9, 0xf2, 0x9a, 0x7e, 0x91, 0x3c,
+    0xe7, 0xee, 0xef, 0xe3, 0xfd, 0x81, 0xf7, 0xa1, 0xd8, 0x93, 0xbb, 0x27,
+    0x76, 0x4b, 0x1d, 0x88, 0x47, 0xbb, 0x72, 0x6b, 0xe8, 0x16, 0xd5, 0xd1,
+    0x55, 0xf2, 0xd0, 0xab, 0x13, 0xb4, 0xac, 0xc7, 0xea, 0x81, 0x6f, 0x40,
+    0x27, 0x3e, 0x14, 0xaf, 0x01, 0xef, 0xd5, 0xdc, 0x96, 0xe8, 0x59, 0xba,
+    0x67, 0xdf, 0xf2, 0xb3, 0xcc, 0xbc, 0x34, 0xec, 0xdf, 0x12, 0xbe, 0x46,
+    0x77, 0xed, 0xbc, 0xec, 0x17, 0xdf, 0x9f, 0x2b, 0xab, 0x7f, 0xab, 0xa0,
+    0xaa, 0x9e, 0xe8, 0x77, 0xcc, 0x76, 0x47, 0xce, 0x7f, 0xe5, 0x53, 0xed,
+    0xed, 0x0a, 0xd5, 0xd2, 0x9d, 0x92, 0x38, 0x59, 0x7a, 0xec, 0x64, 0x25,
+    0x55, 0xfd, 0xa8, 0x7d, 0xd6, 0x74, 0xe1, 0x45, 0xc0, 0x56, 0xa9, 0x83,
+    0xe3, 0x8c, 0xbd, 0x87, 0xb1, 0x5f, 0x3e, 0x30, 0xf6, 0x01, 0xc6, 0x7e,
+    0xe0, 0xbb, 0x7f, 0xec, 0x06, 0xc6, 0xe6, 0x2a, 0xee, 0x1f, 0xfb, 0x75,
+    0xd1, 0xde, 0x1f, 0x03, 0x66, 0x79, 0xbb, 0x72, 0xee, 0x29, 0xf7, 0xc6,
+    0x82, 0xa7, 0xd2, 0xed, 0x2c, 0x0f, 0x3f, 0x25, 0x17, 0x9d, 0x16, 0x3a,
+    0xce, 0xba, 0x33, 0x60, 0xc8, 0x7d, 0x28, 0x95, 0x23, 0xdb, 0x1b, 0x33,
+    0x03, 0x27, 0xe9, 0x4f, 0x48, 0x8f, 0x19, 0xdf, 0x9e, 0x35, 0x43, 0x81,
+    0x0c, 0xc6, 0x15, 0xfe, 0x4d, 0xe0, 0x97, 0x29, 0x7c, 0xbf, 0xc2, 0x87,
+    0x2e, 0x3e, 0xaf, 0x4b, 0x39, 0xd0, 0x7b, 0xe9, 0x69, 0xc6, 0x55, 0xba,
+    0xb3, 0x5c, 0x90, 0x6b, 0xee, 0x7a, 0x63, 0xb4, 0x6c, 0x60, 0x9d, 0x36,
+    0xc7, 0x76, 0x2b, 0xf5, 0x0f, 0x3f, 0x83, 0x4a, 0xe6, 0x5c, 0x3e, 0xc3,
+    0xdb, 0x99, 0xcf, 0xd5, 0x7e, 0x3b, 0xfa, 0x54, 0xd4, 0x8f, 0x6f, 0x57,
+    0xe7, 0x28, 0xd6, 0xeb, 0x1a, 0x69, 0x23, 0x33, 0x06, 0xeb, 0x4a, 0x2d,
+    0xcd, 0x84, 0x4b, 0x29, 0x6e, 0xd4, 0x62, 0xac, 0x1a, 0x5f, 0x33, 0xcd,
+    0xf8, 0x99, 0xd7, 0x4a, 0x26, 0x43, 0x6c, 0xe7, 0x33, 0x06, 0xf7, 0x0d,
+    0xcc, 0x09, 0x67, 0xae, 0xc2, 0x99, 0x7b, 0x6d, 0x8f, 0x16, 0x6b, 0x60,
+    0x38, 0x97, 0x68, 0x37, 0x28, 0x91, 0x2b, 0x71, 0xc6, 0x6f, 0x01, 0xd6,
+    0x1c, 0xf8, 0x10, 0xe0, 0x13, 0x94, 0x84, 0xad, 0x64, 0x72, 0xd4, 0x95,
+    0x9c, 0x66, 0x1f, 0x10, 0x17, 0x3a, 0x69, 0xe2, 0xe4, 0x84, 0xb5, 0x45,
+    0xf5, 0xaf, 0xd6, 0x27, 0xa6, 0x37, 0xd0, 0x49, 0xe8, 0xe9, 0x00, 0x74,
+    0xca, 0x6b, 0xea, 0x38, 0x6b, 0x7d, 0x98, 0x57, 0x9f, 0x2f, 0x6c, 0xa0,
+    0x33, 0x52, 0x7f, 0x79, 0x3f, 0xd6, 0xb3, 0x07, 0x75, 0xf3, 0x18, 0x64,
+    0x78, 0x0b, 0xe7, 0x08, 0x8a, 0x19, 0x9a, 0x59, 0xe7, 0xa5, 0x00, 0x64,
+    0xd7, 0x00, 0x19, 0x12, 0x2d, 0x80, 0x9f, 0xb8, 0xc1, 0xfb, 0xd5, 0x53,
+    0xd2, 0xef, 0x01, 0xff, 0x65, 0xd8, 0xc3, 0x26, 0xa3, 0x8d, 0x3f, 0xf6,
+    0x07, 0x15, 0x65, 0x54, 0xe5, 0x21, 0xa3, 0x89, 0xf9, 0x8e, 0x5b, 0x06,
+    0x31, 0xcc, 0x67, 0x62, 0x98, 0xcf, 0xb4, 0x81, 0x7a, 0x40, 0x9b, 0xb4,
+    0xfa, 0x00, 0x49, 0xfa, 0x06, 0x9d, 0xc5, 0xdd, 0x9c, 0xe1, 0xfd, 0x21,
+    0xcf, 0x33, 0xf3, 0x01, 0x47, 0xa6, 0x02, 0xbc, 0x5c, 0xb7, 0x95, 0x2d,
+    0xa6, 0x3a, 0x13, 0x66, 0x98, 0x2e, 0x17, 0x04, 0x5d, 0x2c, 0x04, 0x4f,
+    0xe7, 0x29, 0x78, 0xca, 0xa2, 0x76, 0xf0, 0x13, 0xa1, 0x77, 0x0b, 0x2d,
+    0xf4, 0xe3, 0x82, 0x49, 0x97, 0xb0, 0x7e, 0xb9, 0x60, 0xdb, 0xba, 0xc9,
+    0x74, 0x71, 0x77, 0xa6, 0x16, 0x19, 0x9e, 0x08, 0x06, 0x7e, 0x01, 0x9b,
+    0xd9, 0x9d, 0xf3, 0xd2, 0x91, 0x3c, 0xeb, 0xc5, 0xff, 0xd8, 0x19, 0xbf,
+    0x4f, 0xfa, 0x49, 0x7f, 0x8c, 0xac, 0x6f, 0xc4, 0x82, 0x16, 0xfb, 0xe1,
+    0x7a, 0xf3, 0xe6, 0xce, 0x37, 0x9b, 0x42, 0x58, 0x77, 0x78, 0xfb, 0xbb,
+    0x4d, 0xc1, 0xe8, 0x10, 0xfc, 0xec, 0x7f, 0x2f, 0x3c, 0x4e, 0xff, 0xe5,
+    0xe8, 0xd3, 0xd1, 0x85, 0x0d, 0xf4, 0x9f, 0x38, 0x6b, 0xc2, 0xb4, 0xed,
+    0x84, 0xe9, 0xa1, 0x23, 0x0b, 0x6c, 0x9f, 0x1a, 0xa5, 0x17, 0x82, 0x91,
+    0x0f, 0x30, 0xff, 0x41, 0x4e, 0x0f, 0xc0, 0x17, 0x7d, 0x34, 0x2b, 0x75,
+    0xad, 0x0c, 0x32, 0xd0, 0x49, 0x5f, 0x2b, 0xe3, 0xc3, 0x6f, 0x74, 0xc4,
+    0x87, 0xd9, 0x76, 0x53, 0xea, 0xeb, 0x4f, 0x16, 0x2b, 0xc0, 0x17, 0xd1,
+    0xcf, 0x72, 0x7c, 0x5e, 0xcd, 0x28, 0xc9, 0x06, 0x45, 0x5e, 0x63, 0x7d,
+    0x0a, 0x86, 0xfb, 0x88, 0xf9, 0x66, 0x59, 0x31, 0x9d, 0xdf, 0xd8, 0x29,
+    0x3f, 0xf3, 0xc1, 0xfd, 0x6f, 0x19, 0x6b, 0xb4, 0x32, 0xc8, 0x5c, 0x33,
+    0xea, 0xb3, 0x1e, 0xac, 0xd7, 0x39, 0x7e, 0x04, 0x9e, 0x86, 0x0f, 0x38,
+    0xb2, 0x70, 0x13, 0x42, 0xe7, 0xbb, 0x83, 0x2c, 0xe6, 0x21, 0x8b, 0x79,
+    0xc8, 0x62, 0x1e, 0x72, 0x9a, 0x87, 0x3c, 0xe6, 0x21, 0xab, 0xf9, 0x06,
+    0x47, 0x96, 0x51, 0xe7, 0x5e, 0xe1, 0x5b, 0xe5, 0xbd, 0xf2, 0xfd, 0xf1,
+    0x9d, 0xd2, 0x86, 0x9e, 0x69, 0xaa, 0x49, 0x4c, 0x97, 0x52, 0xd2, 0xe0,
+    0xfb, 0xd5, 0x30, 0x5e, 0x8d, 0x7b, 0xe5, 0xfb, 0x72, 0xf9, 0xe1, 0xfb,
+    0xe4, 0x7b, 0xd5, 0x9c, 0xfe, 0xef, 0xbf, 0xc3, 0xfc, 0x43, 0xef, 0x90,
+    0xed, 0xb0, 0x8e, 0x66, 0x5a, 0xd8, 0x06, 0x3b, 0x70, 0x0e, 0x69, 0x87,
+    0xb8, 0xd3, 0xbe, 0x8e, 0x84, 0x69, 0x41, 0x67, 0x83, 0x22, 0x05, 0xd9,
+    0xcc, 0xc0, 0xe6, 0xe3, 0x4a, 0xdc, 0xe0, 0xb3, 0x85, 0x7a, 0x10, 0xe3,
+    0xc8, 0x98, 0x59, 0x67, 0x90, 0xe2, 0xbb, 0x27, 0x47, 0xb5, 0xda, 0xf7,
+    0x99, 0xef, 0x12, 0xf0, 0xca, 0x7c, 0x9a, 0xe0, 0xb3, 0x16, 0x3a, 0x07,
+    0x16, 0x0c, 0xe6, 0xd7, 0xe5, 0x93, 0x6d, 0x87, 0xc7, 0x5d, 0xfb, 0xbc,
+    0x54, 0x46, 0xbe, 0x80, 0x73, 0xfe, 0x3e, 0xec, 0xc3, 0x7b, 0xf0, 0xbe,
+    0x88, 0x01, 0xd2, 0x96, 0x6a, 0xc0, 0x93, 0x3a, 0x9f, 0xd7, 0xac, 0x95,
+    0x7b, 0xea, 0x66, 0xb9, 0x63, 0x67, 0xac, 0xd3, 0xbc, 0xf7, 0x83, 0xe7,
+    0x5e, 0xef, 0xd8, 0x0d, 0xd3, 0x64, 0x9c, 0xcf, 0x6c, 0x25, 0x9b, 0x35,
+    0xa4, 0xee, 0x83, 0x65, 0x72, 0x0c, 0xfb, 0x9c, 0xc3, 0xe7, 0xf2, 0x11,
+    0x73, 0xf8, 0xe0, 0x73, 0xb9, 0xf2, 0x64, 0x5a, 0x46, 0x11, 0x4e, 0x85,
+    0x83, 0xc3, 0x34, 0x99, 0xde, 0x83, 0x3e, 0xe6, 0x06, 0x64, 0x59, 0x09,
+    0xdf, 0xd2, 0x02, 0x59, 0x86, 0xa5, 0xde, 0xb3, 0x4d, 0xb0, 0xee, 0x5f,
+    0x2c, 0xc0, 0xdf, 0xf8, 0xe5, 0x9d, 0x3a, 0x3e, 0x6a, 0x1a, 0x3e, 0xaa,
+    0x0f, 0x34, 0x80, 0x3b, 0xef, 0x87, 0x9d, 0x6a, 0x81, 0x99, 0x09, 0xb2,
+    0xea, 0x62, 0x62, 0x67, 0x6b, 0x53, 0x70, 0xc1, 0x92, 0x72, 0x0d, 0x5a,
+    0x6c, 0x4b, 0x2f, 0x42, 0xcf, 0x1a, 0xdf, 0xf0, 0x92, 0xf9, 0x86, 0x8c,
+    0xa9, 0xd4, 0x97, 0xe3, 0x73, 0xa9, 0xb8, 0x12, 0xf7, 0x27, 0x84, 0x01,
+    0x5d, 0x6b, 0x7a, 0x83, 0xf7, 0x5d, 0xc0, 0x9e, 0x4a, 0x5f, 0xe3, 0xda,
+    0x2e, 0x67, 0x6f, 0x57, 0x26, 0x1c, 0xab, 0xb6, 0x88, 0x0c, 0x70, 0x2d,
+    0x7f, 0x63, 0x38, 0x49, 0xc1, 0x70, 0x0f, 0x35, 0x86, 0xcf, 0xd2, 0x06,
+    0x5a, 0x96, 0xf3, 0x9f, 0xdb, 0x89, 0x26, 0xe4, 0x50, 0x2d, 0xac, 0x33,
+    0x88, 0xd5, 0x86, 0x6d, 0x4f, 0x9a, 0x89, 0xd3, 0x5e, 0xd0, 0x26, 0x86,
+    0x9b, 0x6c, 0x9a, 0x6c, 0x63, 0x1a, 0xcb, 0xa0, 0x11, 0x8c, 0x90, 0xb2,
+    0x8b, 0xe8, 0x80, 0x06, 0xdc, 0xb5, 0x1c, 0xcb, 0xed, 0xab, 0x4a, 0x27,
+    0xef, 0xd8, 0xec, 0x17, 0x37, 0xcd, 0xb1, 0x3f, 0x43, 0x7e, 0xd0, 0xde,
+    0x0c, 0x6d, 0x30, 0xf3, 0x7d, 0xe0, 0x75, 0xd3, 0x1c, 0xdf, 0xad, 0x07,
+    0xe7, 0xe0, 0xb9, 0xd0, 0xe9, 0x21, 0x4d, 0x9e, 0x11, 0x3e, 0x2c, 0x94,
+    0x9f, 0x82, 0xb8, 0xdf, 0x5c, 0xf4, 0xe0, 0x1c, 0x55, 0x64, 0xce, 0x05,
+    0x8d, 0x6b, 0xa4, 0x23, 0x9e, 0x70, 0x6c, 0x31, 0xc5, 0x49, 0xc4, 0x00,
+    0xcb, 0xcf, 0xb6, 0xa9, 0x05, 0xba, 0xb2, 0x44, 0x7b, 0x64, 0x4c, 0x66,
+    0x5e, 0x6e, 0xee, 0x4c, 0x98, 0xdd, 0x2b, 0x67, 0x1e, 0x22, 0x3e, 0x2f,
+    0xe4, 0x0e, 0xfb, 0xba, 0x0c, 0xfb, 0xba, 0x04, 0xfb, 0xba, 0xb8, 0xa2,
+    0xeb, 0x11, 0x47, 0xc7, 0x04, 0x75, 0xe5, 0x6e, 0xdb, 0x7a, 0x2c, 0x0c,
+    0x7f, 0x73, 0x9b, 0x6d, 0x5f, 0x9c, 0x23, 0x41, 0xc8, 0x0d, 0x2c, 0x39,
+    0xb6, 0x28, 0x76, 0xce, 0x9a, 0xfd, 0xb8, 0xe7, 0x72, 0xf6, 0x05, 0x12,
+    0x5f, 0xf9, 0x72, 0x83, 0xd2, 0xf0, 0xad, 0x03, 0xd0, 0x23, 0xf6, 0x61,
+    0x19, 0xbf, 0x8d, 0x98, 0xc7, 0x3a, 0x62, 0xbf, 0x92, 0x36, 0xed, 0x2b,
+    0xd0, 0x77, 0x9c, 0x89, 0x96, 0xbd, 0xc0, 0x1f, 0x5a, 0x74, 0xe3, 0x3d,
+    0xdb, 0xd6, 0xa4, 0x93, 0x9b, 0x71, 0x4c, 0x63, 0x1b, 0xe3, 0xf5, 0x37,
+    0x48, 0x5b, 0xba, 0xea, 0xc4, 0xfd, 0x17, 0x31, 0xef, 0xf6, 0x3d, 0x45,
+    0xba, 0x56, 0x9c, 0xeb, 0x1c, 0xee, 0x4c, 0xe4, 0xd8, 0x37, 0xe0, 0xb6,
+    0xa7, 0xbf, 0x80, 0x8f, 0x83, 0x8d, 0xb5, 0xd4, 0x80, 0x17, 0xe6, 0x19,
+    0xf9, 0x4b, 0xcc, 0x82, 0x8c, 0x4f, 0x77, 0xa4, 0x55, 0xce, 0x05, 0x3c,
+    0xd7, 0x56, 0x79, 0x0f, 0x0d, 0xfb, 0x73, 0xeb, 0xc6, 0x10, 0xe4, 0x87,
+    0xf0, 0xaf, 0x25, 0x32, 0xfe, 0xde, 0x84, 0xec, 0x16, 0x3b, 0xce, 0x33,
+    0xcd, 0x02, 0xcb, 0xf0, 0x5f, 0x3c, 0xa5, 0xe6, 0xb9, 0x2a, 0x57, 0xb7,
+    0x38, 0xbf, 0x54, 0x6b, 0x11, 0xb9, 0x4c, 0xcf, 0x65, 0x37, 0x77, 0xf1,
+    0x9a, 0x6e, 0xbc, 0xb6, 0x8c, 0xe4, 0x62, 0x09, 0xfa, 0xa7, 0xd0, 0x3e,
+    0x86, 0x76, 0x16, 0x6d, 0xc0, 0x69, 0xaf, 0x1b, 0x5d, 0xb9, 0x95, 0x1c,
+    0x03, 0x74, 0x78, 0x7d, 0x4e, 0x24, 0xe1, 0x37, 0x54, 0xee, 0xc0, 0x3a,
+    0x33, 0x6d, 0xc8, 0xfc, 0x2b, 0x96, 0xe9, 0x4c, 0xe7, 0xca, 0xc9, 0xc9,
+    0x0f, 0xd0, 0x3f, 0x8c, 0x7e, 0x14, 0xb1, 0x53, 0x37, 0x52, 0x8b, 0x71,
+    0xb4, 0x0d, 0x68, 0x39, 0xdd, 0x8a, 0xe1, 0x0e, 0xd8, 0xbf, 0xd6, 0x42,
+    0xfe, 0x9e, 0xcb, 0x46, 0xac, 0x4e, 0xc5, 0xcd, 0xc5, 0x6a, 0xce, 0x25,
+    0x9d, 0xbd, 0x78, 0x6d, 0x8a, 0xe3, 0xee, 0xfa, 0xd9, 0x69, 0xf8, 0x76,
+    0x93, 0xd7, 0xa6, 0xb0, 0x8e, 0xd6, 0xa7, 0xa7, 0xfd, 0xc0, 0xe1, 0x75,
+    0x01, 0x83, 0x96, 0x1a, 0x8c, 0xd5, 0x7c, 0xe1, 0x0e, 0xe7, 0x0b, 0x45,
+    0xfd, 0x7b, 0xe8, 0x07, 0x8a, 0xfa, 0xbe, 0x1d, 0x5f, 0xcd, 0x27, 0xf8,
+    0x3c, 0xac, 0xcf, 0x38, 0xd3, 0x62, 0x0e, 0xb9, 0x64, 0x4e, 0xa4, 0x10,
+    0xff, 0x67, 0x71, 0x36, 0x4b, 0xfa, 0xa6, 0x9c, 0xe8, 0x92, 0xbe, 0x9c,
+    0xf7, 0xf0, 0xcb, 0xf5, 0x17, 0x0b, 0x6c, 0xdf, 0x86, 0x13, 0xab, 0x79,
+    0xdf, 0x00, 0x7c, 0xc3, 0xe1, 0xce, 0x4d, 0x73, 0x07, 0xc1, 0x13, 0x0a,
+    0x90, 0x25, 0x99, 0x1b, 0x01, 0x5f, 0x27, 0xef, 0x92, 0x26, 0xf3, 0x60,
+    0xef, 0x52, 0xa6, 0x73, 0x36, 0x77, 0x0c, 0x36, 0x2b, 0x33, 0x2d, 0x99,
+    0x7b, 0x29, 0xb9, 0xda, 0xf6, 0x50, 0x84, 0xf3, 0xeb, 0x3a, 0x3a, 0xdf,
+    0x4e, 0xfe, 0xf4, 0x34, 0x3d, 0xe6, 0xa5, 0x50, 0xf8, 0x0c, 0xbe, 0xb3,
+    0x24, 0x73, 0x22, 0xd0, 0x3c, 0xdc, 0xd9, 0x28, 0xcf, 0x10, 0x07, 0xbc,
+    0x97, 0x86, 0xb0, 0x76, 0x38, 0x67, 0xdb, 0xc9, 0x08, 0x6d, 0xf0, 0x3a,
+    0xeb, 0x12, 0xd3, 0x8c, 0x4f, 0xf5, 0x9a, 0x5c, 0xc3, 0xeb, 0xdd, 0x35,
+    0xdd, 0x58, 0xd3, 0xfd, 0x35, 0xd7, 0x1c, 0xc2, 0x9a, 0x9e, 0x47, 0x5e,
+    0xb3, 0x49, 0xae, 0xc9, 0x60, 0x0d, 0x9f, 0x49, 0xda, 0x30, 0x70, 0x79,
+    0xdc, 0x3d, 0xa7, 0x6d, 0x67, 0x22, 0x72, 0x7d, 0x23, 0xbc, 0x32, 0xce,
+    0x18, 0x82, 0xad, 0xca, 0x73, 0xc2, 0x37, 0x54, 0x41, 0x36, 0x7b, 0x1f,
+    0x11, 0xaf, 0xfb, 0x11, 0xf1, 0x7a, 0x1e, 0x11, 0x0f, 0x39, 0x4a, 0x2e,
+    0x08, 0xdf, 0x56, 0x05, 0xbb, 0x7d, 0x0b, 0x7a, 0xc9, 0x71, 0xf5, 0x7b,
+    0x74, 0x52, 0xde, 0xd1, 0x61, 0xb9, 0x07, 0xec, 0xb5, 0xc9, 0x4b, 0x8c,
+    0x43, 0x9d, 0x58, 0x6f, 0x20, 0x86, 0x36, 0xf0, 0xfa, 0xa4, 0x5c, 0xef,
+    0xda, 0x3a, 0xcb, 0xad, 0x4f, 0xca, 0x0b, 0xfa, 0x09, 0xef, 0x1b, 0x44,
+    0x2d, 0x48, 0x9d, 0x09, 0x99, 0xa7, 0x90, 0x5f, 0xa3, 0x10, 0xec, 0xb9,
+    0xaa, 0xc8, 0x37, 0x30, 0xfe, 0xde, 0xaf, 0x89, 0xdf, 0xfd, 0x35, 0xf1,
+    0x7b, 0xbe, 0x26, 0x3e, 0xdf, 0xe1, 0x54, 0x91, 0x7e, 0xd1, 0x46, 0x5e,
+    0x77, 0x5e, 0xad, 0xe3, 0x3b, 0xf7, 0x7f, 0x55, 0x4f, 0xac, 0x22, 0xdd,
+    0x7a, 0x14, 0xfc, 0x5c, 0x91, 0x5e, 0x3d, 0x0a, 0xfe, 0xe9, 0x1d, 0x1c,
+    0x5b, 0x1f, 0x1d, 0xff, 0x6f, 0xd8, 0x56, 0x1e, 0x01, 0xff, 0x9b, 0xce,
+    0x5d, 0xd7, 0x69, 0x9a, 0xc9, 0x72, 0xa8, 0x92, 0x35, 0x47, 0xbd, 0xaa,
+    0xc1, 0x76, 0xa4, 0x9a, 0xea, 0xbc, 0x3c, 0x4e, 0x4b, 0xee, 0xdc, 0xca,
+    0xb8, 0xe7, 0xe1, 0xe3, 0xac, 0xeb, 0x3c, 0xce, 0x3c, 0xa4, 0xa0, 0x77,
+    0xd7, 0xc1, 0x07, 0x6d, 0x29, 0x91, 0x36, 0x03, 0xbc, 0x25, 0xc6, 0x53,
+    0xf5, 0x08, 0xfc, 0x15, 0xe8, 0xc2, 0x5f, 0x20, 0x57, 0xb8, 0xb8, 0xe2,
+    0x87, 0x84, 0x13, 0x1f, 0x32, 0x9d, 0xaa, 0x1e, 0x08, 0xc0, 0xc7, 0xb0,
+    0x6f, 0x41, 0xc1, 0x52, 0x58, 0x0b, 0x7f, 0x1a, 0x3c, 0xc5, 0x35, 0xb0,
+    0x01, 0x9f, 0xa8, 0xc9, 0x73, 0xfe, 0x7a, 0x87, 0x8a, 0x95, 0x7b, 0xa9,
+    0x6b, 0x81, 0xc7, 0x60, 0x3f, 0x0b, 0xec, 0xc7, 0xaa, 0xe0, 0x17, 0xe3,
+    0xf0, 0x37, 0x06, 0xda, 0x73, 0xec, 0x77, 0xd0, 0xb2, 0x7f, 0xe6, 0xb9,
+    0xab, 0x46, 0x2a, 0xf7, 0xa5, 0xad, 0x74, 0xfb, 0x6d, 0x67, 0x2e, 0x03,
+    0xbe, 0x35, 0xe4, 0x08, 0x3d, 0xe8, 0x23, 0xd3, 0x35, 0x99, 0x37, 0xc6,
+    0x65, 0x5f, 0x6c, 0x3a, 0xeb, 0xc0, 0x0b, 0x78, 0x5d, 0x9e, 0x0f, 0x63,
+    0xac, 0x38, 0xd7, 0x64, 0xff, 0xc7, 0x3e, 0xd8, 0x67, 0x68, 0x73, 0x3e,
+    0xc7, 0xc7, 0xba, 0xf1, 0xe7, 0x0e, 0xf8, 0x7b, 0x9b, 0x63, 0x8e, 0xa1,
+    0x2d, 0xf9, 0x8a, 0xfc, 0x6f, 0x55, 0x87, 0x8a, 0x1f, 0x5e, 0xe8, 0xdc,
+    0xcf, 0x11, 0x57, 0xbe, 0xb4, 0xcf, 0x49, 0x7e, 0x7e, 0x5e, 0x14, 0x63,
+    0xc2, 0x12, 0xc7, 0x88, 0xe5, 0x1f, 0xb2, 0x3e, 0xda, 0xf1, 0x55, 0xff,
+    0xcd, 0xf2, 0x62, 0x59, 0xb1, 0xcc, 0xde, 0x43, 0x9d, 0xcc, 0x32, 0xfb,
+    0xe5, 0xba, 0x12, 0x19, 0x4f, 0x69, 0xf6, 0x7c, 0x7b, 0x50, 0x10, 0x35,
+    0x62, 0x3c, 0xd3, 0x39, 0xb4, 0xf8, 0x0e, 0x5a, 0xf6, 0xd1, 0x37, 0x90,
+    0x77, 0xf1, 0xf8, 0x1d, 0xe2, 0xf7, 0x07, 0x65, 0x07, 0x25, 0xe0, 0xc9,
+    0x7a, 0xa0, 0xff, 0xaf, 0x5c, 0x77, 0xc3, 0xd7, 0x6f, 0x2c, 0x57, 0xf7,
+    0x17, 0x77, 0x6a, 0x6e, 0xbe, 0xef, 0x06, 0xf8, 0x87, 0x01, 0xf8, 0x00,
+    0x81, 0x16, 0xd9, 0xd8, 0x12, 0xf2, 0x64, 0xf8, 0x77, 0xef, 0x12, 0xe7,
+    0x23, 0xa3, 0x68, 0x5b, 0xd0, 0x4e, 0xa0, 0x8d, 0xa0, 0x9d, 0x42, 0xcb,
+    0x6f, 0x2a, 0x90, 0xe9, 0x12, 0xd7, 0xdd, 0x61, 0xb4, 0x3a, 0x7c, 0x8b,
+    0x3d, 0xcf, 0xf9, 0xc6, 0x10, 0x31, 0xcd, 0x17, 0xee, 0xdb, 0x9b, 0x75,
+    0x84, 0x73, 0x9e, 0x64, 0x2e, 0xe0, 0xe0, 0x32, 0x0e, 0x91, 0x77, 0xee,
+    0x8a, 0xad, 0xc9, 0x35, 0xc8, 0x7e, 0x97, 0xfe, 0x01, 0xfa, 0xe4, 0x7f,
+    0x40, 0x87, 0xc8, 0x40, 0xdd, 0x25, 0x6b, 0xf5, 0x93, 0x32, 0x7e, 0xe9,
+    0xaa, 0xce, 0x47, 0x4e, 0x91, 0x94, 0x35, 0xfb, 0x67, 0x4e, 0xfd, 0xae,
+    0xea, 0xd0, 0x84, 0x99, 0x4a, 0xa8, 0x1a, 0x7e, 0xf7, 0xbe, 0xd9, 0x95,
+    0x7c, 0xe0, 0x17, 0xe0, 0x25, 0x68, 0xc5, 0xbd, 0xa9, 0x94, 0x1e, 0x3b,
+    0x01, 0x3a, 0xdc, 0xa7, 0x5e, 0x25, 0x7b, 0x96, 0x2b, 0xcb, 0xff, 0x70,
+    0xa7, 0xca, 0x8f, 0x54, 0x6e, 0xe3, 0x95, 0x7b, 0xdc, 0x88, 0xa6, 0xe5,
+    0x1e, 0xa0, 0x53, 0xe0, 0x5c, 0xcb, 0x0f, 0xff, 0x83, 0xfc, 0xbf, 0x70,
+    0xc4, 0xc9, 0x45, 0x3c, 0xf2, 0xad, 0x48, 0x47, 0xdd, 0x9d, 0x2c, 0xfc,
+    0x05, 0xbf, 0x6d, 0x74, 0xdc, 0xff, 0x4e, 0xc1, 0x79, 0x77, 0x88, 0xca,
+    0xcd, 0x0a, 0x2a, 0x33, 0xb9, 0xd6, 0x14, 0xd2, 0x0e, 0x96, 0x65, 0xed,
+    0xc9, 0x75, 0x69, 0x35, 0x55, 0x98, 0x13, 0x54, 0x89, 0x5a, 0x78, 0xb1,
+    0x39, 0x42, 0xd5, 0x66, 0x88, 0x6a, 0xcc, 0x49, 0xaa, 0xc5, 0x9e, 0x01,
+    0xf0, 0xb9, 0xde, 0x3c, 0x44, 0x86, 0x99, 0xa1, 0x3a, 0x73, 0x2b, 0x6a,
+    0x4d, 0xa2, 0x33, 0x56, 0x39, 0xed, 0x43, 0x41, 0x91, 0x0c, 0xf7, 0x93,
+    0x7a, 0xe3, 0x18, 0x84, 0xae, 0x73, 0xed, 0xf6, 0x47, 0xb4, 0x47, 0xca,
+    0xe0, 0x59, 0x59, 0x7f, 0xfc, 0x59, 0xde, 0x03, 0xdc, 0x6a, 0x7a, 0xca,
+    0x78, 0x11, 0xb8, 0x65, 0x0e, 0x6e, 0x39, 0xf5, 0xc8, 0xb6, 0x9b, 0x9e,
+    0x96, 0xb8, 0x8d, 0x12, 0xf7, 0x5a, 0x2e, 0x46, 0x07, 0x0d, 0x5f, 0xd4,
+    0xdb, 0xbc, 0x9b, 0x9e, 0x73, 0xea, 0xd6, 0x9f, 0x20, 0x97, 0xf9, 0x67,
+    0xe4, 0x32, 0xf9, 0xb3, 0xb5, 0x74, 0xa6, 0xb9, 0x96, 0x8e, 0x45, 0x2a,
+    0xc8, 0xbf, 0xf9, 0x59, 0x2a, 0x0d, 0x45, 0xc8, 0x17, 0xe2, 0x5a, 0xb6,
+    0x32, 0xe2, 0xf7, 0x68, 0xeb, 0xbd, 0x74, 0x57, 0xca, 0x7e, 0x77, 0x1e,
+    0x49, 0xa5, 0xb1, 0x25, 0x30, 0x83, 0x94, 0x7c, 0x7f, 0x9e, 0x5b, 0x7e,
+    0x53, 0x51, 0x35, 0x6f, 0xc2, 0xd4, 0x25, 0x9d, 0x24, 0x0a, 0x87, 0x93,
+    0xe0, 0x8b, 0xdf, 0x43, 0x92, 0xd6, 0x3d, 0xcc, 0xf3, 0x9c, 0x46, 0xe7,
+    0xcd, 0x7f, 0xe4, 0x5a, 0x34, 0xc2, 0xf9, 0xfa, 0x75, 0xe0, 0x3e, 0xa9,
+    0x33, 0x5d, 0xa2, 0x37, 0xf2, 0x8d, 0xc8, 0x1d, 0x19, 0xbf, 0x96, 0xce,
+    0x36, 0x3f, 0x46, 0x7b, 0x50, 0x0b, 0xdc, 0x22, 0xdb, 0x4e, 0xc3, 0x17,
+    0x10, 0xf1, 0x3b, 0x1e, 0xd1, 0x50, 0xbe, 0x3e, 0xc2, 0x9b, 0x5f, 0x28,
+    0x7c, 0x6a, 0x5f, 0xf5, 0x73, 0x5d, 0xa5, 0xde, 0x3c, 0x86, 0x40, 0x6b,
+    0x26, 0xcf, 0x6f, 0x19, 0x8a, 0xde, 0x90, 0xf5, 0xb9, 0x1d, 0x97, 0x67,
+    0xe3, 0x77, 0x14, 0xa6, 0xc9, 0xe7, 0x66, 0x7a, 0xcc, 0x77, 0x85, 0xd4,
+    0xbd, 0x87, 0xf3, 0x76, 0x46, 0xf2, 0x46, 0x1e, 0x75, 0x86, 0x39, 0x07,
+    0xe7, 0x8c, 0xb3, 0xff, 0xac, 0xf9, 0x96, 0xac, 0xdf, 0xce, 0x9b, 0x0f,
+    0xd6, 0xce, 0x41, 0x29, 0x69, 0x2b, 0xef, 0xe6, 0xf7, 0xb7, 0xbe, 0x7c,
+    0xbf, 0xd9, 0xf4, 0x9c, 0x2f, 0x84, 0x3d, 0x17, 0x0a, 0xc1, 0xb0, 0x45,
+    0xa6, 0xe7, 0x02, 0xfc, 0xcd, 0xb9, 0xe6, 0x06, 0xcf, 0x95, 0x42, 0x8b,
+    0xe7, 0x9d, 0x82, 0x07, 0xba, 0x63, 0x60, 0xee, 0x75, 0xe8, 0x95, 0x33,
+    0xbe, 0xf2, 0xae, 0x28, 0x3c, 0xab, 0x6f, 0x9f, 0xaf, 0x3b, 0x7a, 0x57,
+    0xac, 0x63, 0xb6, 0xad, 0xc5, 0x4c, 0x63, 0x06, 0xf5, 0x53, 0xdc, 0x2f,
+    0x58, 0x1f, 0x21, 0x45, 0x83, 0xdb, 0xa2, 0x71, 0xba, 0x03, 0x3b, 0xda,
+    0xa4, 0xe3, 0xbe, 0xd2, 0xe6, 0xca, 0x18, 0xea, 0x22, 0x0a, 0xea, 0x74,
+    0xaf, 0x78, 0x8c, 0xb9, 0x46, 0x6d, 0xfd, 0x25, 0xc6, 0x9a, 0xd1, 0x5e,
+    0x5b, 0xa7, 0x4b, 0x1e, 0x1a, 0x21, 0xa3, 0x5f, 0x49, 0x1e, 0x2e, 0x16,
+    0x2a, 0x89, 0x73, 0x45, 0xd4, 0x82, 0xe2, 0xcf, 0x71, 0x1f, 0x67, 0x22,
+    0x0d, 0xd0, 0x63, 0xb6, 0x31, 0x13, 0xfc, 0x09, 0xe8, 0x35, 0xe7, 0x8e,
+    0xc1, 0xd3, 0x57, 0x89, 0x7e, 0xa0, 0x53, 0x3d, 0xf4, 0x93, 0x6b, 0x45,
+    0xc3, 0xd3, 0x36, 0x57, 0x26, 0xdf, 0x01, 0xfc, 0xa6, 0x1e, 0xe8, 0xe3,
+    0x57, 0x09, 0x6a, 0x0e, 0xc0, 0x6b, 0x1a, 0xcf, 0x90, 0x69, 0x79, 0xb5,
+    0xd0, 0x42, 0x42, 0xb3, 0x6d, 0xbd, 0xad, 0x84, 0x54, 0x8e, 0xfa, 0x96,
+    0x13, 0x5f, 0x3e, 0xc1, 0xbd, 0xb1, 0x1e, 0x61, 0xfd, 0x92, 0x3a, 0xa7,
+    0xa6, 0xad, 0xc1, 0x6a, 0xd0, 0x9a, 0x17, 0xd8, 0xd3, 0xe7, 0xec, 0x79,
+    0x1b, 0x38, 0x7a, 0x60, 0xea, 0xa1, 0xfb, 0x42, 0x27, 0xea, 0xdd, 0x3d,
+    0xe1, 0x23, 0x35, 0xb5, 0x67, 0xd2, 0xc4, 0xfa, 0x25, 0xb9, 0x0f, 0xec,
+    0x07, 0x67, 0xf8, 0x4a, 0x0c, 0x0b, 0x13, 0xd7, 0xcc, 0xfc, 0xd6, 0x96,
+    0x40, 0x1e, 0xf8, 0x4e, 0x24, 0x08, 0x19, 0xf1, 0x5b, 0x3b, 0xe7, 0xb6,
+    0xec, 0xa3, 0x2b, 0x03, 0x3f, 0x23, 0x3e, 0x2b, 0xcb, 0xc4, 0xcd, 0x9d,
+    0x83, 0xd6, 0x55, 0xe2, 0xf7, 0x48, 0x9d, 0x2e, 0x44, 0x18, 0xb7, 0x32,
+    0x50, 0x8a, 0xa2, 0x26, 0xb9, 0x18, 0x3c, 0x95, 0x97, 0x6b, 0xa1, 0x53,
+    0x91, 0xca, 0x40, 0x89, 0xd6, 0xce, 0x63, 0x71, 0xf6, 0x1f, 0x8d, 0x6d,
+    0x95, 0x71, 0xaf, 0x96, 0xa2, 0xbd, 0xb2, 0x5f, 0x11, 0x2f, 0xd3, 0x02,
+    0x2b, 0x70, 0x89, 0x16, 0x8c, 0x12, 0xf1, 0x9b, 0x7f, 0x45, 0xb4, 0x54,
+    0xab, 0x08, 0x7b, 0xb5, 0x30, 0xed, 0x59, 0x8c, 0x62, 0x1e, 0x71, 0x12,
+    0x75, 0xc7, 0xa6, 0x36, 0xae, 0x87, 0xb9, 0x26, 0x07, 0x8e, 0xf6, 0xe3,
+    0x4a, 0xce, 0x7d, 0x4a, 0x4d, 0xe1, 0x8e, 0x8b, 0xb8, 0xe6, 0x8e, 0x6b,
+    0x18, 0x8f, 0x53, 0x6b, 0x5b, 0x39, 0x89, 0xfa, 0x06, 0x59, 0xd7, 0x5f,
+    0x9c, 0x77, 0xe7, 0xf9, 0xdc, 0xf2, 0x1d, 0x1b, 0xb6, 0x04, 0x5c, 0x1f,
+    0xfb, 0xdd, 0x87, 0xc5, 0x73, 0x7e, 0xcf, 0x56, 0xb1, 0xfc, 0xfe, 0x33,
+    0x9b, 0xf4, 0x74, 0x8e, 0xdf, 0xc3, 0xf8, 0x2e, 0xaa, 0xe0, 0xa7, 0x18,
+    0x8f, 0xdf, 0x34, 0xb8, 0xe6, 0x0b, 0xa3, 0x4e, 0x6e, 0x41, 0xfe, 0xf0,
+    0x3b, 0xf0, 0x10, 0xa1, 0xdd, 0xb9, 0x6f, 0x19, 0x75, 0xda, 0xa7, 0x90,
+    0xbf, 0x16, 0xa8, 0xcf, 0x32, 0xde, 0x83, 0xb9, 0x43, 0x00, 0xf8, 0x0d,
+    0xc0, 0x17, 0xc0, 0xfd, 0x9d, 0xc3, 0x8b, 0xee, 0xbc, 0xe3, 0xf3, 0x7f,
+    0x0a, 0xfc, 0x86, 0x28, 0xfd, 0x31, 0xe2, 0xc2, 0x00, 0x6a, 0xcf, 0x0a,
+    0xe8, 0x2c, 0xdb, 0xc2, 0x9f, 0x3a, 0x6f, 0xcc, 0xa5, 0x4e, 0x9f, 0x7d,
+    0x32, 0xfb, 0x63, 0x23, 0x3a, 0x7b, 0x5f, 0xdd, 0x58, 0xfc, 0x3f, 0x42,
+    0xaf, 0x33, 0x6e, 0xd0, 0x73, 0x39, 0x65, 0x4f, 0xe2, 0xa1, 0xf3, 0x81,
+    0x3f, 0x30, 0x2f, 0x7e, 0xcf, 0x3c, 0xcb, 0x87, 0x71, 0xf8, 0xbf, 0x0f,
+    0xd3, 0xc1, 0x61, 0xfd, 0x53, 0x32, 0x15, 0xf7, 0xc5, 0xfa, 0x5e, 0x65,
+    0xf7, 0x88, 0x09, 0xcf, 0xe5, 0xd0, 0x4a, 0xb9, 0x30, 0x8e, 0x70, 0x70,
+    0x38, 0x17, 0xf0, 0x3b, 0xf2, 0x66, 0xdc, 0xa0, 0x65, 0x11, 0xfb, 0x24,
+    0xce, 0xa3, 0x4c, 0xda, 0x34, 0x57, 0x7e, 0x37, 0x2e, 0xdf, 0xfc, 0x10,
+    0x1d, 0x67, 0x3e, 0xb7, 0x2d, 0xbf, 0x1b, 0x6f, 0x8b, 0x63, 0xa9, 0x6d,
+    0xab, 0xb7, 0xa9, 0x5f, 0x49, 0x9a, 0x97, 0x0a, 0xa7, 0xa9, 0x3e, 0x66,
+    0xfd, 0xb0, 0x77, 0x87, 0x80, 0xfd, 0xfa, 0x1d, 0xfb, 0x65, 0x3a, 0xbc,
+    0xb7, 0x87, 0x9e, 0x69, 0xda, 0x72, 0x6a, 0x8d, 0x16, 0x34, 0xe2, 0x5a,
+    0x25, 0xee, 0x8c, 0xe9, 0x40, 0x5f, 0xe8, 0x2f, 0x21, 0xe7, 0x46, 0xab,
+    0x4e, 0xfb, 0xcc, 0xa6, 0xb5, 0x3c, 0xaf, 0xec, 0xe7, 0x32, 0xf8, 0xbd,
+    0x74, 0x1f, 0xbd, 0x70, 0x51, 0x4e, 0xc5, 0xb2, 0x90, 0xbc, 0x62, 0xdf,
+    0x0b, 0xe0, 0xfd, 0x23, 0xaf, 0x6e, 0xda, 0xb6, 0xd1, 0x74, 0x0f, 0x7b,
+    0x3c, 0x98, 0xfb, 0xb4, 0x81, 0xbf, 0xc8, 0x4b, 0xea, 0xf9, 0xfe, 0x29,
+    0x96, 0xed, 0x01, 0x05, 0x8f, 0xe1, 0x0b, 0x6e, 0x57, 0xf0, 0x6b, 0xf8,
+    0xfe, 0x7a, 0x8b, 0x82, 0x7f, 0xc8, 0xf7, 0xd7, 0xac, 0xe0, 0xeb, 0x1c,
+    0xdb, 0x1e, 0x57, 0x70, 0x0b, 0x22, 0xd1, 0xa9, 0x35, 0x0a, 0x3e, 0xa4,
+    0x11, 0x7d, 0x50, 0xae, 0xe0, 0x65, 0x30, 0xf2, 0x5b, 0x5d, 0xc1, 0x3e,
+    0x38, 0xa4, 0xb8, 0x57, 0xc1, 0x03, 0xe5, 0x44, 0x2f, 0x6a, 0x0a, 0xbe,
+    0x0a, 0x6f, 0x11, 0xf5, 0x28, 0xd8, 0x0a, 0x11, 0xfd, 0x88, 0x9c, 0xbf,
+    0x13, 0xc0, 0xd0, 0x01, 0x17, 0x06, 0xe1, 0x66, 0x17, 0xfe, 0x77, 0x94,
+    0x60, 0x2e, 0x7c, 0xcd, 0x43, 0xd5, 0x2e, 0x3c, 0xeb, 0x85, 0x3e, 0xd6,
+    0x51, 0xaf, 0xa6, 0x88, 0x79, 0x1d, 0x58, 0xbc, 0xcd, 0xb0, 0x83, 0xf3,
+    0x4f, 0xa8, 0xa4, 0xb1, 0xe2, 0x76, 0x2d, 0x1f, 0xa4, 0x06, 0xfe, 0xa1,
+    0x5a, 0x0e, 0xc7, 0x13, 0xb5, 0x80, 0xd5, 0xdf, 0x21, 0xf4, 0x66, 0x1d,
+    0xee, 0xc3, 0x4f, 0x9f, 0xd7, 0x80, 0xcf, 0xff, 0x58, 0xcb, 0xf7, 0xac,
+    0x78, 0x9b, 0xdd, 0x08, 0x58, 0xe1, 0xe4, 0x43, 0x4d, 0x80, 0xcb, 0xe9,
+    0xdd, 0x52, 0xf0, 0xff, 0xd3, 0xad, 0x80, 0xe5, 0xdf, 0x86, 0x74, 0xeb,
+    0xe8, 0x76, 0xc0, 0xa5, 0xf4, 0x69, 0x25, 0x27, 0x00, 0xbb, 0x24, 0xcc,
+    0xbf, 0xae, 0xde, 0xde, 0x83, 0xbd, 0xa2, 0xab, 0x27, 0x29, 0x42, 0x27,
+    0x2a, 0xf8, 0xe5, 0x6e, 0xe4, 0xf8, 0x70, 0x56, 0x8c, 0x8c, 0x8d, 0x4c,
+    0x55, 0x50, 0x4f, 0x77, 0xb7, 0x03, 0x21, 0x1a, 0x76, 0x3f, 0xb5, 0x02,
+    0x3f, 0x93, 0xea, 0x7d, 0x72, 0xbf, 0xd3, 0x5b, 0x85, 0xc5, 0x38, 0xf2,
+    0x3c, 0xca, 0xbe, 0x34, 0x26, 0x8e, 0x8c, 0x64, 0x8f, 0xff, 0xf1, 0x60,
+    0x76, 0x18, 0xc0, 0xd8, 0xc8, 0xe4, 0xb1, 0xe1, 0x0c, 0xc6, 0x47, 0x8e,
+    0x0f, 0x1e, 0x1d, 0x16, 0xc3, 0x63, 0x53, 0xd9, 0x97, 0xc5, 0xc4, 0xf8,
+    0xc8, 0xd8, 0x54, 0xa7, 0x88, 0x9c, 0x50, 0x24, 0xc9, 0x05, 0xd2, 0x13,
+    0x83, 0x13, 0xe9, 0xac, 0x62, 0x24, 0x3d, 0x71, 0xbc, 0x08, 0x4e, 0xa7,
+    0xb3, 0x9d, 0x0a, 0x27, 0x34, 0x19, 0x66, 0xf4, 0xcd, 0xa2, 0x53, 0xad,
+    0x0a, 0x4d, 0xca, 0x8d, 0x0e, 0x75, 0x8a, 0xef, 0x0e, 0x8e, 0xbe, 0x34,
+    0xbc, 0x8b, 0x61, 0xf1, 0xbc, 0xd8, 0x25, 0x42, 0x19, 0xb9, 0xf7, 0xe4,
+    0xf0, 0x94, 0x48, 0x8f, 0xbe, 0x20, 0x46, 0x32, 0x62, 0x38, 0x9b, 0x1d,
+    0xcf, 0x4a, 0x3a, 0xaa, 0x1f, 0xca, 0x84, 0x43, 0x99, 0xcd, 0x9d, 0xe2,
+    0x28, 0x50, 0x26, 0x46, 0x47, 0x57, 0xe7, 0xd1, 0xe9, 0xcf, 0x0e, 0x4e,
+    0x0d, 0xcb, 0x5d, 0x5a, 0x44, 0x11, 0x98, 0xce, 0x64, 0x9d, 0xad, 0x43,
+    0x93, 0x8a, 0x42, 0x26, 0x93, 0x9d, 0x90, 0xab, 0x47, 0xc7, 0xd3, 0x2f,
+    0x38, 0x47, 0x4a, 0x3e, 0xdb, 0x0d, 0x2c, 0x07, 0x5e, 0x05, 0xe9, 0xc9,
+    0x22, 0x18, 0xeb, 0xfa, 0x47, 0xc6, 0xc6, 0xc6, 0xfb, 0x27, 0x8e, 0xbd,
+    0xdc, 0x2f, 0xc5, 0xf7, 0xc4, 0x13, 0x41, 0xd1, 0xda, 0xda, 0x29, 0x44,
+    0xe8, 0x10, 0xe6, 0xf7, 0xf7, 0x46, 0x84, 0x2b, 0xa2, 0xfd, 0xbd, 0xad,
+    0x45, 0x70, 0x5b, 0x11, 0xbc, 0x6d, 0x05, 0xfe, 0xce, 0xd3, 0xa0, 0x54,
+    0x24, 0xd3, 0xe3, 0xd9, 0xd6, 0x15, 0x62, 0xc7, 0xb3, 0x6d, 0x45, 0xf0,
+    0xb6, 0x22, 0xb8, 0x35, 0xb2, 0xca, 0x11, 0xaf, 0xd9, 0xb1, 0xad, 0xb8,
+    0x9f, 0x4a, 0xf5, 0x26, 0xfb, 0xbb, 0xf7, 0xf7, 0x76, 0x3a, 0xba, 0xe1,
+    0xf6, 0x5b, 0x04, 0xb8, 0x73, 0x06, 0x9f, 0xed, 0xee, 0xdf, 0x7f, 0x30,
+    0xd5, 0xd5, 0x5a, 0x4c, 0x7b, 0xdf, 0x81, 0x03, 0x07, 0xfb, 0xfb, 0x7a,
+    0x9f, 0xdc, 0x77, 0x60, 0xdf, 0x81, 0x3d, 0xfd, 0xc9, 0xbe, 0xde, 0x6e,
+    0xd1, 0xea, 0xee, 0xf1, 0x90, 0xb9, 0x36, 0x77, 0x2e, 0x3d, 0x38, 0x3a,
+    0x32, 0x24, 0x32, 0xe3, 0x63, 0xc3, 0x6a, 0xe4, 0x21, 0xb8, 0xdb, 0x5c,
+    0xdc, 0x89, 0x6f, 0x92, 0xd5, 0x22, 0xc8, 0xba, 0xee, 0xb4, 0xfc, 0xb5,
+    0xe3, 0x8b, 0x89, 0xd5, 0xbe, 0xfb, 0x59, 0xc0, 0x79, 0x0f, 0x5f, 0x0f,
+    0xe0, 0x29, 0x7c, 0x87, 0xf0, 0x0d, 0x70, 0xdb, 0x88, 0x16, 0x5f, 0x03,
+    0x3e, 0x13, 0x5f, 0x0b, 0x3e, 0x28, 0x43, 0x3f, 0xdf, 0xcd, 0xd4, 0xcb,
+    0x13, 0xc3, 0x7c, 0x96, 0x6f, 0x6f, 0x4d, 0x8c, 0x8f, 0x4f, 0x21, 0xee,
+    0x2a, 0x40, 0x3c, 0xd3, 0x03, 0x86, 0x23, 0xad, 0xdb, 0x9e, 0x88, 0x74,
+    0x6c, 0x8d, 0x44, 0x22, 0xdb, 0xda, 0xb6, 0x1e, 0xed, 0xc8, 0x74, 0xec,
+    0x4c, 0x67, 0x86, 0xb7, 0x66, 0x46, 0xb2, 0x53, 0x2f, 0x8b, 0x70, 0x6a,
+    0x38, 0x2d, 0x5a, 0xdb, 0x81, 0xd4, 0xb6, 0x4d, 0x6c, 0x15, 0xad, 0x1d,
+    0x9d, 0x6d, 0xdb, 0x3b, 0xdb, 0x22, 0x9b, 0xc1, 0x74, 0x78, 0xec, 0xa5,
+    0xd1, 0xd1, 0xcd, 0xb0, 0xa5, 0x41, 0x5c, 0xfc, 0x14, 0x5b, 0x47, 0x46,
+    0xa4, 0xc7, 0xc7, 0x26, 0xc7, 0x47, 0x87, 0xa5, 0xdc, 0x6c, 0xe7, 0x47,
+    0xff, 0xcf, 0x7f, 0xcf, 0x7f, 0xaf, 0x7f, 0x72, 0x38, 0x3b, 0x32, 0x38,
+    0xea, 0xf4, 0xad, 0xf5, 0x64, 0xc9, 0x7a, 0x23, 0x80, 0x3b, 0x00, 0xfc,
+    0x31, 0x5a, 0x42, 0xbb, 0xb7, 0x4d, 0x8d, 0x7b, 0x5a, 0x36, 0xd6, 0x50,
+    0x75, 0x8d, 0xfd, 0x38, 0xe0, 0x06, 0x7c, 0x1b, 0xfe, 0x0f, 0x78, 0xf2,
+    0x1c, 0xdb, 0x58, 0x5d, 0x5d, 0x53, 0x6b, 0xdc, 0x47, 0xe3, 0x9c, 0x92,
+    0xf9, 0x1f, 0xa2, 0xeb, 0x99, 0xda, 0x58, 0xc3, 0x6b, 0x5d, 0x9c, 0xc7,
+    0x48, 0xda, 0xaf, 0x33, 0x7b, 0x6c, 0x78, 0x74, 0xe4, 0x84, 0x84, 0x8e,
+    0x0f, 0xa6, 0x61, 0xcd, 0x0c, 0x8d, 0xa6, 0x33, 0xce, 0xec, 0x48, 0xdb,
+    0xa4, 0x03, 0x1d, 0x9f, 0x4c, 0xaf, 0x42, 0xad, 0x0a, 0x9a, 0x9c, 0x1c,
+    0x71, 0xc6, 0x26, 0x8f, 0xb8, 0xb3, 0xe9, 0x91, 0xe3, 0xee, 0xda, 0xc9,
+    0x89, 0x15, 0x1e, 0x4a, 0xe4, 0xff, 0x4c, 0x44, 0x65, 0x4e, 0xeb, 0xea,
+    0xca, 0xff, 0x02, 0xf5, 0x1f, 0x79, 0x75,
+};
+
+const firmware_blob_t firmware_blob_9b3417afb6e92596 = {
+    blob_9b3417afb6e92596_z, sizeof(blob_9b3417afb6e92596_z), 8796, 0x5a8c0eb2
+};
@@ -0,0 +1,449 @@
+/**
+ * Embedded Firmware blob a42e6f65c5610662
+ * Used by: t30 SPL, t30a SPL, t30nl SPL, t30x SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 9884 bytes, 5201 compressed
+static const uint8_t blob_a42e6f65c5610662_z[] = {
+    0x78, 0xda, 0xd5, 0x5a, 0x6f, 0x6c, 0x14, 0x57, 0x92, 0xaf, 0xee, 0x69,
+    0xff, 0xb7, 0x71, 0xdb, 0x74, 0x60, 0x00, 0x2f, 0xe9, 0xc6, 0x3d, 0xf6,
+    0xb0, 0x63, 0xa2, 0xb1, 0x71, 0x36, 0x8e, 0x19, 0xb8, 0xc9, 0xcc, 0x18,
+    0xcc, 0x86, 0x90, 0x89, 0xc3, 0x2a, 0x64, 0x37, 0x12, 0xc6, 0x33, 0x06,
+    0x3b, 0x31, 0x30, 0xd8, 0xce, 0x8a, 0xec, 0xf9, 0x92, 0x96, 0x71, 0x58,
+    0x92, 0x1d, 0xd9, 0xbe, 0x1c, 0xb7, 0x17, 0x45, 0x39, 0x69, 0x02, 0x06,
+    0x72, 0x89, 0x65, 0x43, 0xb2, 0x91, 0xf6, 0x43, 0x72, 0x58, 0x6c, 0xfe,
+    0xdd, 0x29, 0x3a, 0x65, 0xef, 0x56, 0xbb, 0xd1, 0x7d, 0xb8, 0xe3, 0x76,
+    0x73, 0x12, 0xba, 0x8b, 0x94, 0xac, 0x14, 0x29, 0xec, 0x85, 0xd0, 0xf7,
+    0xab, 0xf7, 0xba, 0xcd, 0x04, 0xbc, 0x5a, 0xf2, 0xe1, 0x3e, 0x9c, 0xa5,
+    0xd6, 0xab, 0xf7, 0x5e, 0x55, 0xbd, 0x7a, 0xf5, 0xaa, 0xea, 0x55, 0xbd,
+    0x71, 0x99, 0xa3, 0xc6, 0x09, 0x7f, 0x2a, 0x25, 0xda, 0xcb, 0x9c, 0x71,
+    0x09, 0xf7, 0xca, 0x31, 0xf7, 0xa9, 0x40, 0xcc, 0x75, 0x33, 0xed, 0xb6,
+    0x9e, 0xc4, 0x98, 0x9c, 0x8b, 0x53, 0x79, 0x4c, 0xbb, 0x5a, 0x7e, 0x27,
+    0xf5, 0x1e, 0x8f, 0x3b, 0x54, 0x11, 0xa3, 0x81, 0x67, 0xe2, 0xaf, 0x96,
+    0x52, 0x39, 0xcf, 0x1d, 0xa1, 0xc4, 0x54, 0x0d, 0x69, 0xb6, 0x15, 0x26,
+    0x32, 0xa8, 0x3b, 0x4f, 0x8e, 0x1a, 0x5b, 0xb8, 0x2b, 0x61, 0xeb, 0x54,
+    0x6a, 0x5b, 0x41, 0xa2, 0x6a, 0xaa, 0xb0, 0xad, 0x74, 0x9c, 0xd6, 0x52,
+    0x99, 0x4d, 0x74, 0x6f, 0xbe, 0x9c, 0xaa, 0x6e, 0x13, 0xeb, 0x85, 0x07,
+    0x73, 0x96, 0xf9, 0x0a, 0x69, 0x74, 0x0c, 0x63, 0x4f, 0xe7, 0x35, 0x4a,
+    0x9d, 0x20, 0xfb, 0xdd, 0x31, 0xb7, 0xf6, 0x74, 0x54, 0xa1, 0x8c, 0xfd,
+    0xb9, 0xbb, 0xdf, 0xa8, 0xa6, 0x84, 0x4d, 0x4e, 0x59, 0x2c, 0x17, 0xfb,
+    0x6d, 0x5e, 0x4d, 0x68, 0xe0, 0x95, 0x9c, 0x76, 0x29, 0x13, 0x75, 0x28,
+    0xd3, 0x0e, 0xb8, 0xa0, 0x51, 0x77, 0x81, 0x28, 0x55, 0xe0, 0xf9, 0xa7,
+    0x30, 0xce, 0x63, 0x36, 0x6d, 0x2d, 0x84, 0xa9, 0x6b, 0xa6, 0x9c, 0x2e,
+    0x05, 0x78, 0x1d, 0x96, 0x27, 0x17, 0x4b, 0xe4, 0x0d, 0x4a, 0x4c, 0xf3,
+    0x98, 0x42, 0x89, 0xe8, 0x65, 0xf7, 0xad, 0xe6, 0x4a, 0x52, 0x21, 0xe3,
+    0xb9, 0x79, 0x73, 0x42, 0x1b, 0x0b, 0x90, 0xba, 0xc2, 0xa0, 0x0b, 0xf3,
+    0x4f, 0x56, 0x53, 0x35, 0xef, 0x45, 0xd2, 0x24, 0xf3, 0x44, 0x39, 0xf0,
+    0x4e, 0xe5, 0x7b, 0x81, 0x6b, 0xd0, 0xd1, 0xe9, 0x5e, 0xac, 0xf1, 0x95,
+    0xdb, 0x67, 0x00, 0x77, 0x0a, 0xb4, 0x53, 0xcc, 0x2f, 0x48, 0x6f, 0x35,
+    0x33, 0x3f, 0xa6, 0xff, 0x21, 0xe8, 0x79, 0xc9, 0xaf, 0xdc, 0xb8, 0x7e,
+    0x7d, 0xdd, 0x0b, 0x53, 0x84, 0xb5, 0x19, 0x8f, 0xf1, 0x5d, 0xac, 0xcf,
+    0x3a, 0xf3, 0x69, 0x74, 0x4a, 0xe6, 0xab, 0x48, 0x8d, 0x45, 0xb1, 0x57,
+    0x4b, 0xef, 0x23, 0x5a, 0xae, 0xd2, 0xa7, 0x6e, 0x40, 0xc8, 0xa6, 0x51,
+    0xbc, 0x50, 0x8e, 0x3d, 0x5d, 0x45, 0xdf, 0x44, 0x1b, 0xa0, 0x00, 0x64,
+    0xd3, 0x63, 0xbc, 0xcf, 0x83, 0x58, 0x2b, 0x17, 0x53, 0xe7, 0xf0, 0x4d,
+    0xae, 0xc4, 0x38, 0xe3, 0xfd, 0x1d, 0xf0, 0x1a, 0xd0, 0xfa, 0xf2, 0x59,
+    0x3a, 0x91, 0x2f, 0x23, 0xcb, 0xc3, 0x70, 0x74, 0x73, 0xc2, 0xe6, 0xf5,
+    0xaf, 0x60, 0x7d, 0xc2, 0xda, 0x9b, 0xb1, 0x36, 0x55, 0x24, 0xec, 0x35,
+    0xd4, 0x47, 0x9f, 0x2b, 0x71, 0xa1, 0xaf, 0x6a, 0x27, 0xd0, 0x5e, 0x6f,
+    0x02, 0x8c, 0xa5, 0x66, 0xe9, 0x9c, 0x1a, 0xbb, 0x6c, 0xc6, 0x67, 0x3f,
+    0xc6, 0x77, 0x09, 0xdf, 0x27, 0x66, 0x72, 0x96, 0x9c, 0x80, 0x6d, 0x98,
+    0xc9, 0x19, 0x9f, 0x7f, 0x39, 0xf3, 0x07, 0xde, 0xc7, 0xe6, 0xb6, 0xfc,
+    0x55, 0x73, 0xab, 0xb0, 0x01, 0x27, 0xd6, 0x95, 0x5f, 0x4e, 0x97, 0xa8,
+    0x8e, 0x16, 0x48, 0xa1, 0xa7, 0x73, 0x74, 0x4e, 0x8b, 0xd5, 0x03, 0x5f,
+    0x87, 0x4d, 0x7c, 0x6c, 0x1e, 0x03, 0xde, 0xd3, 0xf9, 0x48, 0xc7, 0x29,
+    0xba, 0xea, 0x5e, 0x32, 0x58, 0x67, 0x01, 0xea, 0x37, 0x22, 0xe1, 0x8b,
+    0x74, 0xc5, 0x2d, 0x88, 0x7e, 0xf1, 0xf9, 0xb1, 0xae, 0xa6, 0x63, 0xdf,
+    0xb7, 0x59, 0x5f, 0xff, 0x56, 0x49, 0xd5, 0xac, 0x9b, 0x76, 0x4f, 0xd7,
+    0x7f, 0x53, 0x2e, 0xdb, 0x4f, 0x2b, 0x65, 0x4b, 0x9f, 0x95, 0xc4, 0xc9,
+    0xd1, 0x62, 0x47, 0xab, 0xa8, 0x3a, 0x7c, 0xf7, 0x84, 0xed, 0x94, 0xca,
+    0xf1, 0x5f, 0x7b, 0xed, 0x33, 0x1e, 0xfe, 0xa4, 0x8f, 0x0f, 0xb9, 0x5b,
+    0x28, 0x9d, 0xff, 0xa7, 0x32, 0xaa, 0xb6, 0xb0, 0xe7, 0xf1, 0x1f, 0xeb,
+    0xf0, 0x0b, 0x15, 0xfa, 0x54, 0xeb, 0x99, 0x0f, 0x39, 0x25, 0xb1, 0x0e,
+    0xf0, 0x99, 0xd8, 0x74, 0xda, 0x66, 0x9e, 0xa3, 0xb0, 0x6b, 0xd7, 0x25,
+    0x9d, 0x49, 0x6f, 0xb4, 0x83, 0x74, 0x45, 0x20, 0x66, 0x1d, 0xcf, 0xb4,
+    0x33, 0x4f, 0x83, 0x92, 0xb3, 0x5e, 0x0b, 0xfb, 0x66, 0xbb, 0xe9, 0x15,
+    0x34, 0xb0, 0xd7, 0x3c, 0xb9, 0x81, 0x98, 0x1d, 0x3c, 0x4a, 0x7f, 0x4e,
+    0x5a, 0x4c, 0xff, 0xde, 0x84, 0x1d, 0x0a, 0x66, 0x31, 0x2e, 0xf1, 0x7f,
+    0x05, 0xfc, 0x32, 0x89, 0x6f, 0x48, 0x7c, 0xd8, 0xe1, 0xa3, 0x9a, 0xd0,
+    0x01, 0xfd, 0x3c, 0x33, 0xc6, 0xb8, 0xd2, 0x6e, 0xce, 0xcd, 0x0b, 0x9a,
+    0x2b, 0x81, 0x18, 0x9d, 0xd3, 0x41, 0xa7, 0x4e, 0xb2, 0xcf, 0x0a, 0xdb,
+    0xc3, 0x9f, 0x4e, 0x25, 0x93, 0xbe, 0x1e, 0x52, 0x90, 0xdf, 0x28, 0xea,
+    0xa7, 0xd1, 0xa7, 0xa2, 0xfe, 0x23, 0x62, 0xfe, 0x66, 0x9b, 0x5e, 0x26,
+    0xec, 0xfe, 0xc2, 0xfc, 0x72, 0x1a, 0xd7, 0x79, 0xbd, 0x5a, 0x1a, 0x0f,
+    0x97, 0x52, 0x5c, 0xaf, 0xc5, 0x78, 0x0d, 0xbe, 0x0d, 0x34, 0x6e, 0xb0,
+    0xcc, 0xe5, 0x24, 0xf5, 0x51, 0x03, 0x3c, 0xee, 0x43, 0x83, 0x76, 0x93,
+    0x37, 0x57, 0xe5, 0xcd, 0xe9, 0xd0, 0x71, 0x85, 0x07, 0x4b, 0xbd, 0xa4,
+    0xf3, 0x25, 0x5e, 0xff, 0x12, 0x60, 0xd5, 0x83, 0x77, 0x03, 0x66, 0xfb,
+    0xb4, 0x3a, 0x3c, 0x5d, 0x75, 0xa9, 0x4f, 0xc2, 0x67, 0xed, 0x8b, 0xb7,
+    0xc3, 0x1b, 0x4c, 0x8d, 0x56, 0xd1, 0x38, 0xb1, 0x6d, 0xea, 0x88, 0x37,
+    0x6a, 0xb4, 0x2f, 0x67, 0x85, 0xdf, 0x21, 0x27, 0x52, 0xfa, 0xe4, 0x3f,
+    0xc3, 0x1e, 0x14, 0x7a, 0xd7, 0x5e, 0xa8, 0xd7, 0x81, 0x8f, 0xd8, 0x63,
+    0xc6, 0xc9, 0x0a, 0xf7, 0x92, 0x16, 0x2d, 0x55, 0x79, 0x8e, 0xf9, 0xc1,
+    0xa0, 0x74, 0xde, 0x27, 0xdb, 0xed, 0x8d, 0xfb, 0x65, 0x99, 0x06, 0xa0,
+    0xeb, 0x4b, 0xd8, 0xb7, 0x65, 0x8e, 0xd3, 0xf8, 0xca, 0x00, 0x05, 0xb1,
+    0xe7, 0x06, 0xec, 0x9f, 0x68, 0x3a, 0xcf, 0xfb, 0xe6, 0xd8, 0xa0, 0xc0,
+    0xd7, 0xe0, 0x7f, 0x86, 0x82, 0x3d, 0x2a, 0xe0, 0xb7, 0x0c, 0x63, 0x30,
+    0x87, 0xb6, 0x8a, 0x32, 0x5e, 0x5f, 0x6f, 0x8a, 0x3b, 0x3a, 0xad, 0xa1,
+    0x34, 0x7c, 0x09, 0x06, 0x14, 0xe4, 0x18, 0x4b, 0xd0, 0xdd, 0x29, 0x9c,
+    0xd7, 0x49, 0xe6, 0x85, 0x35, 0x4f, 0x4e, 0x05, 0xbd, 0x75, 0x4d, 0xac,
+    0xfb, 0xbe, 0x2b, 0x7d, 0x73, 0x62, 0x4b, 0xc2, 0xb6, 0xe9, 0xb5, 0x79,
+    0x93, 0xce, 0xcf, 0x5b, 0xd3, 0x05, 0xb2, 0x8e, 0x3b, 0xd4, 0x8e, 0xb5,
+    0xa3, 0xf4, 0xc6, 0x7c, 0x0b, 0xfd, 0x6c, 0x3e, 0x4c, 0xaf, 0x83, 0xfe,
+    0xdc, 0xbc, 0xeb, 0x6a, 0x76, 0x89, 0xd8, 0x47, 0x09, 0x6c, 0x14, 0x31,
+    0x23, 0xf8, 0x4b, 0xf8, 0xd0, 0xd6, 0x7c, 0x80, 0xf6, 0x15, 0xd8, 0x56,
+    0xfe, 0xc7, 0xcd, 0x1a, 0x6a, 0xb4, 0x3f, 0x47, 0x8e, 0x01, 0xdb, 0xbd,
+    0x2d, 0x66, 0x39, 0xbc, 0xd7, 0xe5, 0xb6, 0xb1, 0xe5, 0x44, 0x13, 0x54,
+    0xa6, 0x1f, 0xb9, 0xfb, 0x8d, 0x26, 0x55, 0x5f, 0x3e, 0x6c, 0x05, 0x1f,
+    0x80, 0x7e, 0xfb, 0xa6, 0xd7, 0x61, 0x5f, 0xac, 0x0f, 0xf8, 0xdf, 0xb4,
+    0xc6, 0x71, 0x3c, 0xda, 0x87, 0x98, 0xfc, 0xee, 0xf4, 0x6a, 0x7a, 0xc7,
+    0x60, 0xbd, 0xbb, 0x6e, 0x02, 0xfb, 0xdc, 0x37, 0xcd, 0xfe, 0xab, 0x52,
+    0x66, 0xda, 0x8a, 0xbe, 0x0d, 0xba, 0xb7, 0xf3, 0x5a, 0x10, 0xb1, 0xea,
+    0xf2, 0x84, 0xb0, 0xc7, 0x32, 0xd0, 0x81, 0x76, 0x85, 0xb8, 0x3f, 0xfe,
+    0x5d, 0xc3, 0xfd, 0x31, 0xd1, 0x6e, 0x0b, 0x9b, 0xfe, 0xc5, 0x6c, 0x25,
+    0xe4, 0x24, 0x7a, 0x2f, 0xcf, 0xfb, 0x57, 0xf5, 0x92, 0x61, 0xcb, 0x2c,
+    0xa8, 0x6c, 0x73, 0x56, 0x78, 0x17, 0xd6, 0x21, 0x9d, 0x75, 0xf6, 0x3b,
+    0x37, 0x65, 0xf0, 0xba, 0x0c, 0x7f, 0x5b, 0xaf, 0x57, 0x7f, 0xe3, 0xc6,
+    0x0d, 0xec, 0x7d, 0x0a, 0x7b, 0x9f, 0xc2, 0xde, 0xa7, 0xb0, 0xf7, 0x29,
+    0xe8, 0x66, 0x0a, 0xba, 0x99, 0x6a, 0xf0, 0x74, 0xd7, 0xe1, 0x9d, 0x19,
+    0x62, 0xab, 0x38, 0x33, 0x3e, 0x17, 0x3e, 0x2f, 0x5a, 0x93, 0x1e, 0xa3,
+    0x65, 0x89, 0xb1, 0x52, 0x4a, 0xea, 0x7c, 0x76, 0x2a, 0xc6, 0xab, 0x70,
+    0x5e, 0x7c, 0x4e, 0xea, 0xa2, 0x9d, 0x6a, 0xb6, 0x7f, 0x5e, 0x4b, 0x9f,
+    0x55, 0x61, 0xc9, 0xb3, 0x62, 0x9f, 0xa8, 0xa3, 0xf1, 0x16, 0xf6, 0x89,
+    0x24, 0xf4, 0x26, 0x7c, 0x10, 0x67, 0x77, 0x62, 0x53, 0xc2, 0x76, 0x60,
+    0x9b, 0x96, 0x99, 0x02, 0xf7, 0x71, 0xf8, 0x7b, 0x9c, 0x8a, 0x63, 0x0b,
+    0xef, 0x73, 0x7c, 0xa5, 0x4e, 0x52, 0xde, 0x74, 0x9e, 0x6a, 0xd9, 0xa6,
+    0x03, 0x38, 0xc7, 0xa4, 0xce, 0xf2, 0x45, 0xff, 0x88, 0x7c, 0xb5, 0xb0,
+    0xab, 0x62, 0x19, 0x11, 0xb0, 0xf5, 0xfa, 0x22, 0xdb, 0x7d, 0xad, 0x8c,
+    0xca, 0x7d, 0xdb, 0xdd, 0x05, 0xbe, 0xcc, 0x93, 0xd7, 0xe1, 0xbd, 0x2f,
+    0x13, 0x67, 0x22, 0x6d, 0x96, 0xd7, 0x58, 0x89, 0x35, 0x6a, 0x3d, 0xbe,
+    0x6c, 0xaf, 0xff, 0xe5, 0x4a, 0xdd, 0xf3, 0x9a, 0x03, 0x18, 0x9f, 0xc1,
+    0xe7, 0xf3, 0xed, 0xf2, 0xf8, 0x96, 0x62, 0xae, 0x46, 0xf0, 0x91, 0x76,
+    0xce, 0xb8, 0xcc, 0x43, 0x2f, 0xc2, 0xad, 0xf0, 0x70, 0x97, 0xf2, 0xa9,
+    0x0f, 0xa1, 0xaf, 0x2a, 0xc4, 0x8c, 0x16, 0xe8, 0x2b, 0x0c, 0x1b, 0xb6,
+    0x61, 0xc3, 0x26, 0x6c, 0xbc, 0x01, 0x36, 0x0e, 0x7f, 0x32, 0xc4, 0x79,
+    0x79, 0x31, 0xe8, 0x79, 0xc4, 0xa0, 0x1f, 0x80, 0x3f, 0x70, 0xa7, 0x0c,
+    0xf8, 0x96, 0x1a, 0x1c, 0x87, 0x0d, 0xd7, 0xc5, 0x7a, 0x37, 0xb7, 0x36,
+    0x59, 0xd3, 0x8e, 0xd0, 0x9d, 0xe5, 0xb0, 0x5f, 0x1c, 0x86, 0x9d, 0x34,
+    0x3e, 0x17, 0x20, 0xfb, 0x39, 0x71, 0x5f, 0xd2, 0xae, 0x3c, 0xef, 0x89,
+    0xf5, 0x56, 0x02, 0x9e, 0xcc, 0x6f, 0x16, 0xbc, 0xac, 0x70, 0x5c, 0xc5,
+    0x69, 0xe8, 0x01, 0x6a, 0x7a, 0xce, 0xd7, 0x5f, 0xc2, 0xd4, 0xc5, 0xfd,
+    0x13, 0x31, 0xb3, 0xb0, 0x77, 0xc7, 0x68, 0x0c, 0x27, 0x11, 0x23, 0xd2,
+    0xd4, 0x18, 0x3e, 0x05, 0x9f, 0x3d, 0x27, 0x70, 0xbe, 0x74, 0x13, 0xd0,
+    0x49, 0xa2, 0x85, 0xed, 0x81, 0xf5, 0xe7, 0xba, 0x23, 0x76, 0xe2, 0xf9,
+    0x00, 0xb1, 0xaf, 0x03, 0x6e, 0x72, 0x69, 0xa4, 0x8d, 0xd7, 0xf8, 0x80,
+    0xd7, 0x88, 0x92, 0xb4, 0xe5, 0x8e, 0x5e, 0x15, 0xb8, 0x2b, 0xf8, 0x7e,
+    0x76, 0x17, 0xd4, 0x18, 0xfb, 0xe7, 0x67, 0x6e, 0xa2, 0x5d, 0xa7, 0x75,
+    0x93, 0x1a, 0x62, 0x32, 0xee, 0xfc, 0xf6, 0x66, 0x9c, 0xb4, 0x5d, 0xd8,
+    0x85, 0x7b, 0x6d, 0xdd, 0x24, 0x9f, 0x93, 0x02, 0xf9, 0x79, 0x2e, 0xf4,
+    0x7c, 0x9f, 0x2a, 0xf6, 0x86, 0x98, 0x13, 0x2a, 0x8c, 0x42, 0xc5, 0x27,
+    0x66, 0x15, 0xc8, 0x5c, 0x4d, 0xf6, 0xa4, 0xa5, 0x5f, 0x24, 0x0d, 0xf7,
+    0x04, 0xc7, 0x41, 0xdb, 0x3c, 0x8a, 0xd8, 0xee, 0x18, 0xec, 0x4f, 0x6a,
+    0xb0, 0x6b, 0x98, 0x68, 0x9b, 0xb8, 0x67, 0x59, 0x16, 0x03, 0xb1, 0x63,
+    0x00, 0xf2, 0x48, 0xbf, 0xea, 0xa3, 0x0a, 0xc8, 0xc2, 0x7a, 0x94, 0xf7,
+    0x09, 0xdf, 0xc7, 0x5a, 0xec, 0x33, 0xcc, 0xff, 0x0a, 0xb4, 0x8c, 0xc3,
+    0xba, 0xe2, 0x79, 0x9c, 0x09, 0xfc, 0xea, 0x75, 0xf8, 0xd5, 0x6b, 0xf0,
+    0xab, 0xf3, 0x8b, 0xb6, 0x1e, 0xf5, 0x6c, 0xca, 0xa4, 0xae, 0x3c, 0x72,
+    0x91, 0x58, 0x18, 0xeb, 0x7f, 0xca, 0x39, 0x61, 0xf0, 0x14, 0x21, 0x0f,
+    0x99, 0xbd, 0x80, 0x3c, 0x83, 0xef, 0x2f, 0xe6, 0x1b, 0x46, 0xbf, 0x77,
+    0xf3, 0x84, 0x9d, 0x81, 0x1d, 0x54, 0xb0, 0xaf, 0x0b, 0xba, 0x04, 0x62,
+    0x78, 0x12, 0xb6, 0x90, 0x41, 0x8c, 0xef, 0x85, 0x9d, 0x71, 0xcc, 0xca,
+    0x1a, 0x2e, 0x78, 0xb1, 0x0d, 0xb9, 0x4f, 0x65, 0x6c, 0xf7, 0x02, 0x78,
+    0x60, 0xff, 0x74, 0x2e, 0x00, 0xfc, 0xbe, 0x59, 0xff, 0xbe, 0x67, 0x1f,
+    0x1b, 0xf1, 0x72, 0x33, 0xbe, 0xd7, 0xd8, 0xd7, 0x98, 0xfe, 0x43, 0x52,
+    0xe7, 0x16, 0xbc, 0x3b, 0xff, 0x30, 0xe6, 0xfd, 0xbe, 0x52, 0x64, 0x8b,
+    0xc5, 0xb9, 0xce, 0x8b, 0x5b, 0x12, 0x79, 0x8e, 0x0d, 0x71, 0x23, 0x31,
+    0xf6, 0x15, 0x62, 0x18, 0x7c, 0xad, 0x65, 0x19, 0x64, 0x91, 0x77, 0x7a,
+    0x20, 0xe6, 0xe0, 0x3c, 0x3e, 0xda, 0x94, 0x91, 0x39, 0x17, 0xf0, 0x7c,
+    0x9f, 0x65, 0x1e, 0xf2, 0xfe, 0xbf, 0x14, 0xf0, 0xf3, 0x1b, 0xe4, 0x87,
+    0x36, 0xe7, 0x01, 0x2c, 0x9b, 0xd6, 0x39, 0x61, 0x7f, 0x82, 0x5c, 0x80,
+    0xe5, 0x62, 0x5d, 0xfe, 0x5a, 0x29, 0xb5, 0x67, 0x3c, 0xb9, 0x64, 0x7e,
+    0x29, 0x69, 0x35, 0xbe, 0x1f, 0x5e, 0x97, 0xb9, 0x8b, 0x81, 0xf3, 0xf6,
+    0xef, 0x6c, 0x47, 0x4f, 0xce, 0x96, 0xa0, 0x7f, 0x1c, 0xed, 0x6a, 0xb4,
+    0x13, 0x68, 0x83, 0x5e, 0xfb, 0xbe, 0xde, 0x95, 0xf7, 0xfd, 0xa1, 0x1a,
+    0xeb, 0x30, 0x7d, 0xde, 0x4c, 0x22, 0x7e, 0xc8, 0xfc, 0x81, 0xed, 0x6b,
+    0x4c, 0x17, 0xf9, 0x57, 0x6c, 0x66, 0x4b, 0x06, 0xf7, 0xa9, 0x97, 0x23,
+    0xa0, 0xff, 0x22, 0xfa, 0x1d, 0x94, 0xcd, 0x6b, 0x7a, 0x6a, 0x36, 0x8e,
+    0xb6, 0x01, 0x2d, 0xa7, 0x5b, 0x31, 0x9c, 0x01, 0xc7, 0xf5, 0x5a, 0xe8,
+    0x5f, 0x79, 0x5d, 0x8f, 0xd5, 0x81, 0x07, 0xec, 0x6e, 0xb6, 0x86, 0x73,
+    0x49, 0x8f, 0x17, 0xd3, 0xa6, 0x40, 0x43, 0xab, 0x26, 0xc6, 0x10, 0xbb,
+    0x6d, 0xa6, 0x4d, 0x81, 0x8e, 0x56, 0x65, 0xc6, 0x0c, 0xe0, 0x30, 0x5d,
+    0x50, 0xa7, 0xb9, 0x06, 0xfd, 0x7a, 0xce, 0x60, 0x42, 0x3e, 0xa3, 0xa8,
+    0xdf, 0x82, 0x7e, 0xb0, 0xa8, 0xdf, 0xd1, 0x79, 0x73, 0x4e, 0xc1, 0xfb,
+    0x61, 0xdb, 0xc7, 0x9e, 0x66, 0xf3, 0xc8, 0x25, 0xf3, 0x66, 0x0a, 0xf7,
+    0xfe, 0x04, 0xf6, 0xe6, 0x88, 0xb8, 0x97, 0x37, 0xbb, 0x44, 0x2c, 0x67,
+    0x1e, 0x29, 0x41, 0x7f, 0x7e, 0x9e, 0x63, 0x80, 0xee, 0xdd, 0xc3, 0xcc,
+    0x37, 0x88, 0xf8, 0xf1, 0xe2, 0x96, 0x75, 0x93, 0xf7, 0x43, 0x26, 0xe4,
+    0x1d, 0x73, 0x22, 0x3f, 0x02, 0xbe, 0x46, 0x81, 0x39, 0x55, 0xe4, 0xc1,
+    0x81, 0xb9, 0x99, 0x2d, 0x13, 0xf9, 0x01, 0xf8, 0xb7, 0xc8, 0x20, 0x44,
+    0xfe, 0x25, 0xf5, 0xea, 0xba, 0x7d, 0x51, 0xce, 0xaf, 0xeb, 0xe8, 0x74,
+    0x3b, 0x19, 0x99, 0x31, 0x5a, 0x1d, 0xa0, 0x50, 0xf8, 0x24, 0xbe, 0x53,
+    0xc4, 0xbc, 0xb3, 0x58, 0xf3, 0xc5, 0x2d, 0x8d, 0x62, 0x0f, 0x39, 0xc0,
+    0xdd, 0xd4, 0x07, 0xda, 0xfe, 0xbc, 0xeb, 0x26, 0xa3, 0xb4, 0x26, 0xe0,
+    0xd1, 0x25, 0xc6, 0x18, 0x9f, 0xea, 0x55, 0x41, 0xc3, 0xf4, 0x3e, 0xcd,
+    0x18, 0x68, 0x76, 0x7c, 0x43, 0x9a, 0xe3, 0xa0, 0x49, 0xdf, 0x32, 0xcd,
+    0x3a, 0x41, 0x73, 0x02, 0x34, 0xbc, 0x27, 0xe1, 0xef, 0xc0, 0xe5, 0x71,
+    0x7f, 0x9f, 0xae, 0x9b, 0x8d, 0x0a, 0xfa, 0x46, 0x44, 0x6d, 0xec, 0x31,
+    0x64, 0xce, 0x90, 0xd8, 0x27, 0xfc, 0xb5, 0x1a, 0xba, 0xe9, 0xbe, 0x45,
+    0xbc, 0x1d, 0xb7, 0x88, 0x97, 0xbe, 0x45, 0x3c, 0xe4, 0x2a, 0x79, 0x0b,
+    0x71, 0xb0, 0x1a, 0x7e, 0xfb, 0x02, 0xec, 0x92, 0xef, 0xd7, 0x1f, 0xd1,
+    0x51, 0x71, 0x46, 0x8f, 0x08, 0x1e, 0xf0, 0xd7, 0xa6, 0x00, 0x31, 0x0e,
+    0x75, 0x82, 0x5e, 0x47, 0xf4, 0x6e, 0x60, 0xfa, 0xa4, 0xa0, 0xf7, 0x7d,
+    0x9d, 0xf5, 0xb6, 0x4b, 0xe8, 0x0b, 0xf6, 0x89, 0x48, 0x6d, 0xa1, 0x16,
+    0xa4, 0xce, 0x84, 0xc8, 0x43, 0xc8, 0x50, 0x29, 0x04, 0x7f, 0xae, 0x2e,
+    0x8a, 0x0d, 0x8c, 0xdf, 0xfd, 0x0d, 0xf1, 0x77, 0x7c, 0x43, 0xfc, 0xf4,
+    0x37, 0xc4, 0xe7, 0x33, 0x9c, 0x29, 0xb2, 0x2f, 0x5a, 0xcb, 0x74, 0xa7,
+    0x25, 0x1d, 0x9f, 0xb9, 0x71, 0xb3, 0x9d, 0x9c, 0x2b, 0xb2, 0xad, 0x5b,
+    0xc1, 0x7f, 0xb3, 0xc8, 0xae, 0x6e, 0x05, 0xff, 0x7d, 0xe0, 0xef, 0xfa,
+    0x06, 0xf8, 0x1f, 0x01, 0xff, 0x91, 0x5b, 0xc0, 0xbf, 0xdd, 0x3b, 0xeb,
+    0x3a, 0x55, 0xb5, 0x59, 0x0f, 0xd5, 0xa2, 0xee, 0xa8, 0x17, 0x31, 0xe2,
+    0x72, 0x67, 0xaa, 0xa9, 0x2e, 0xc0, 0xe3, 0x34, 0xe7, 0xcf, 0x2d, 0x8e,
+    0x2b, 0x4b, 0x8f, 0xb3, 0xad, 0xf3, 0xb8, 0x88, 0x11, 0xb0, 0xbb, 0x2b,
+    0x90, 0x83, 0x22, 0x25, 0xc2, 0x67, 0x80, 0x37, 0xe7, 0xdf, 0x6f, 0x8c,
+    0xc3, 0xeb, 0x22, 0x5e, 0x20, 0x9f, 0x38, 0xbf, 0x18, 0x87, 0x4c, 0xef,
+    0x7e, 0x98, 0xd9, 0x22, 0x73, 0xfd, 0x20, 0x62, 0x0c, 0xc7, 0x16, 0x14,
+    0x2b, 0xf3, 0x2b, 0x10, 0x4f, 0xad, 0xe3, 0x5c, 0x03, 0xeb, 0x88, 0x89,
+    0xaa, 0xd8, 0x67, 0xf5, 0x26, 0x79, 0xaf, 0x76, 0x53, 0xd7, 0x34, 0x8f,
+    0xc1, 0x7f, 0xa6, 0x39, 0x8e, 0x55, 0x23, 0x2e, 0xc6, 0x11, 0x6f, 0x74,
+    0xb4, 0x33, 0x1c, 0x77, 0xd0, 0x72, 0x7c, 0xe6, 0xb9, 0x05, 0x3d, 0x95,
+    0xbf, 0xe6, 0x4a, 0xdb, 0x7e, 0xc9, 0x9b, 0x9b, 0x81, 0xdc, 0x2a, 0xf2,
+    0x89, 0x34, 0xfa, 0x0f, 0x10, 0xd7, 0xe9, 0x17, 0xa6, 0x18, 0x97, 0x63,
+    0xb1, 0xed, 0xd1, 0x41, 0x16, 0xc8, 0x7a, 0x6e, 0x2a, 0x8c, 0xb1, 0xe2,
+    0x9c, 0x93, 0xe3, 0x1f, 0xc7, 0xe0, 0x72, 0x5d, 0x9d, 0x2c, 0xf7, 0x62,
+    0xac, 0x7f, 0xff, 0x98, 0x90, 0xef, 0x25, 0xbe, 0x73, 0x74, 0x75, 0xae,
+    0xbc, 0x28, 0xfe, 0xc6, 0x36, 0xc9, 0xfb, 0x23, 0x00, 0x9b, 0xfb, 0x00,
+    0xf7, 0xca, 0x35, 0x77, 0x46, 0xc8, 0xf3, 0x41, 0xd1, 0x1d, 0xb3, 0x5b,
+    0xe0, 0xe8, 0xb1, 0xc2, 0x12, 0xf4, 0x03, 0x9b, 0x6e, 0x8e, 0xdf, 0xac,
+    0x2f, 0xd6, 0x15, 0xeb, 0xec, 0xe7, 0xa8, 0xa3, 0x59, 0x67, 0xbf, 0x59,
+    0x59, 0x22, 0xee, 0x53, 0x9a, 0x38, 0xdd, 0xce, 0xf5, 0xf3, 0x6a, 0x8c,
+    0xcf, 0x6c, 0xe9, 0x9b, 0x3d, 0x8b, 0x96, 0x63, 0xb4, 0x5f, 0x57, 0x7f,
+    0x46, 0x5c, 0x27, 0x4a, 0x3f, 0x28, 0x81, 0x4c, 0xce, 0x0d, 0xfd, 0x7f,
+    0xe5, 0xba, 0x1c, 0xb1, 0x7e, 0x6d, 0x85, 0x3c, 0xbf, 0xb8, 0x57, 0x9f,
+    0xf3, 0x79, 0x37, 0x20, 0x3e, 0xf4, 0x22, 0x06, 0x20, 0xf7, 0xc8, 0x23,
+    0x73, 0x9b, 0xb3, 0xd1, 0x0e, 0xa0, 0x45, 0xee, 0x91, 0x1f, 0x42, 0xdb,
+    0x82, 0x36, 0x87, 0x16, 0x79, 0x74, 0x7e, 0x14, 0x2d, 0xbf, 0xa9, 0x40,
+    0xa7, 0x73, 0x5c, 0x7b, 0x87, 0xd1, 0x6a, 0x88, 0x2d, 0xee, 0x14, 0xe7,
+    0x1b, 0x7d, 0xc4, 0x6b, 0x3e, 0xf6, 0x35, 0xde, 0x6c, 0x23, 0x9c, 0xfb,
+    0x24, 0xf3, 0x41, 0x0f, 0x97, 0x71, 0x50, 0x11, 0x4d, 0x5e, 0x70, 0x55,
+    0x41, 0x83, 0xca, 0x60, 0xee, 0x4d, 0xd8, 0x93, 0x71, 0x83, 0x0d, 0x91,
+    0x9e, 0xb0, 0x49, 0xd4, 0xeb, 0x47, 0xc5, 0xfd, 0xa5, 0xc9, 0x5a, 0x1f,
+    0x39, 0x45, 0x52, 0xd4, 0xed, 0x7f, 0xf0, 0x6a, 0x78, 0xf9, 0x46, 0x92,
+    0xb0, 0x53, 0x09, 0x59, 0xc7, 0x6f, 0xdd, 0x3e, 0xb1, 0x98, 0x0f, 0xfc,
+    0x12, 0xb2, 0x58, 0x4e, 0x3c, 0x90, 0x4a, 0x69, 0xb1, 0x23, 0x58, 0x87,
+    0xfb, 0xd4, 0x23, 0x75, 0xcf, 0x7a, 0x65, 0xfd, 0xbf, 0xb8, 0x45, 0xe6,
+    0x47, 0x32, 0xb7, 0x09, 0x08, 0x1e, 0xfa, 0xe6, 0x8c, 0xe0, 0x81, 0x75,
+    0xe6, 0x39, 0xd7, 0x32, 0x10, 0x7f, 0xca, 0x01, 0xef, 0xf3, 0x72, 0x11,
+    0x45, 0xbc, 0x15, 0x69, 0x31, 0xe8, 0x6e, 0xfe, 0xaf, 0x70, 0x9e, 0x5a,
+    0x4c, 0xf2, 0x2c, 0xce, 0xcd, 0x43, 0x54, 0x61, 0x57, 0x52, 0xd9, 0x62,
+    0xdd, 0xc9, 0xf5, 0xa5, 0x5f, 0x6b, 0xd6, 0x50, 0xa5, 0x9d, 0xa3, 0x2a,
+    0xbb, 0x8c, 0x66, 0x9b, 0xa3, 0x54, 0x63, 0x87, 0x68, 0x99, 0x3d, 0x42,
+    0xb5, 0xe0, 0x19, 0x84, 0x9c, 0xab, 0xec, 0xdd, 0xa4, 0xdb, 0x59, 0xaa,
+    0xb3, 0x37, 0x50, 0x3d, 0x74, 0x70, 0xd2, 0xa9, 0xa0, 0xed, 0x7a, 0x13,
+    0x25, 0xc3, 0x7b, 0x48, 0xbe, 0x73, 0xec, 0x85, 0xad, 0x73, 0xed, 0xf6,
+    0x03, 0xda, 0x26, 0x74, 0xf0, 0x90, 0xa8, 0x6d, 0x9e, 0x2d, 0x28, 0xc0,
+    0xad, 0xa1, 0x7b, 0xf5, 0xc3, 0xc0, 0x2d, 0xf3, 0x70, 0x2b, 0x28, 0x2d,
+    0xda, 0x1d, 0xf4, 0x80, 0xc0, 0x6d, 0x14, 0xb8, 0x17, 0xf3, 0x31, 0xba,
+    0x5f, 0xef, 0x8e, 0x05, 0x9a, 0xb7, 0xd2, 0xc3, 0xde, 0x5b, 0xc8, 0x2f,
+    0x90, 0xcb, 0xfc, 0x0b, 0x72, 0x99, 0xc2, 0xa9, 0x5a, 0x3a, 0xd9, 0x5c,
+    0x4b, 0x03, 0xd1, 0x4a, 0x32, 0xd6, 0x3f, 0x44, 0xa5, 0xa1, 0x28, 0x95,
+    0x87, 0xb8, 0x56, 0xad, 0x8a, 0x1a, 0x8a, 0xba, 0x2a, 0x40, 0x57, 0x84,
+    0xee, 0xb7, 0x16, 0xb8, 0xe6, 0x8f, 0x04, 0xc7, 0x91, 0xbe, 0xdf, 0x57,
+    0xe0, 0x96, 0xdf, 0x55, 0x64, 0x4d, 0x9b, 0x10, 0x75, 0x0d, 0xf4, 0x87,
+    0xe2, 0xe2, 0x28, 0xe4, 0xe2, 0x37, 0x91, 0xa4, 0x73, 0x15, 0xf3, 0x3c,
+    0xa7, 0xd2, 0x69, 0xfb, 0x1f, 0x50, 0x23, 0x59, 0x51, 0xce, 0xed, 0xdf,
+    0x07, 0xee, 0x3d, 0x1a, 0xaf, 0x4b, 0xf4, 0x5c, 0xa1, 0x11, 0xb9, 0x23,
+    0xe3, 0xd7, 0xd2, 0xa9, 0xe6, 0xd5, 0xb4, 0x0d, 0x75, 0xc3, 0x25, 0x72,
+    0xdd, 0x0c, 0x62, 0x01, 0x11, 0xbf, 0xe3, 0xa1, 0xae, 0x2e, 0xd4, 0x47,
+    0x99, 0xf9, 0x99, 0xf9, 0x2f, 0xdc, 0x05, 0x83, 0x6b, 0x36, 0xf9, 0xd6,
+    0xd1, 0x87, 0xb5, 0xc6, 0x0b, 0xfc, 0xbe, 0x29, 0xd7, 0xeb, 0x73, 0xbe,
+    0x44, 0xad, 0xcb, 0x3b, 0xe3, 0x77, 0x12, 0x5e, 0x93, 0xf7, 0xcd, 0xeb,
+    0xb1, 0xdc, 0x95, 0xc2, 0xf6, 0x96, 0x96, 0xed, 0xa4, 0x90, 0x8d, 0x14,
+    0xb9, 0x87, 0x49, 0x0f, 0xe7, 0xa4, 0xc7, 0x7f, 0xc2, 0x7e, 0x41, 0xd4,
+    0x77, 0xa7, 0xed, 0x1b, 0x6b, 0x67, 0x4b, 0x68, 0xda, 0x29, 0xf8, 0x79,
+    0xfe, 0xa5, 0x6b, 0x6f, 0x35, 0xdb, 0xca, 0xe9, 0xf9, 0xb0, 0x72, 0x66,
+    0xde, 0x0a, 0x3b, 0x64, 0x2b, 0x67, 0x10, 0x6f, 0x66, 0x9a, 0x1b, 0x94,
+    0x0b, 0xf3, 0x2d, 0xca, 0xd9, 0x79, 0x05, 0xb6, 0xa3, 0x63, 0xee, 0x99,
+    0x6a, 0x7e, 0x77, 0x13, 0xe3, 0x8b, 0xef, 0x8a, 0xa6, 0x72, 0xfd, 0xed,
+    0xf3, 0x19, 0xcf, 0xee, 0x8a, 0x6d, 0xcc, 0x75, 0xd5, 0x98, 0xad, 0x8f,
+    0xa3, 0xd6, 0x8a, 0x1b, 0x26, 0xdb, 0x23, 0xb4, 0xa8, 0x73, 0x5b, 0x34,
+    0x4e, 0x9f, 0xc1, 0x8f, 0xd6, 0x69, 0x38, 0xaf, 0x8c, 0xbd, 0x38, 0x86,
+    0x1a, 0x8a, 0x2c, 0x8d, 0xae, 0x16, 0x8f, 0xb1, 0xd4, 0xa8, 0xb1, 0xaf,
+    0x61, 0xac, 0x19, 0xed, 0xc5, 0x95, 0x9a, 0x90, 0xa1, 0x11, 0x3a, 0xfa,
+    0x48, 0xc8, 0x70, 0x7e, 0xbe, 0x8a, 0x38, 0x57, 0x44, 0xbd, 0x68, 0xfe,
+    0x25, 0xce, 0xe3, 0x64, 0xb4, 0x01, 0x76, 0xcc, 0x3e, 0x66, 0x43, 0x3e,
+    0x13, 0x76, 0xcd, 0xb9, 0xa3, 0xf5, 0xfc, 0x02, 0xd1, 0x4f, 0x34, 0xaa,
+    0xe7, 0x77, 0x0f, 0xd4, 0x93, 0xba, 0xd2, 0x36, 0x59, 0x26, 0xde, 0x21,
+    0x0c, 0x5b, 0x0b, 0xee, 0xc2, 0xa8, 0x4a, 0xcd, 0x41, 0x44, 0x4d, 0xfd,
+    0x41, 0xb2, 0x9d, 0x80, 0x1a, 0x9a, 0x4e, 0xa8, 0xae, 0xab, 0xb5, 0x95,
+    0x90, 0xcc, 0x51, 0x5f, 0xf0, 0xee, 0x97, 0xcf, 0x71, 0x6e, 0x6c, 0x47,
+    0xa0, 0x9f, 0x93, 0xfb, 0x54, 0xd5, 0xe5, 0xa0, 0xc6, 0x5a, 0x53, 0x26,
+    0x78, 0x96, 0x7b, 0x3c, 0x3f, 0x05, 0x8e, 0x16, 0x1c, 0x5d, 0x92, 0x2f,
+    0x6c, 0xa2, 0xde, 0xe7, 0x89, 0x18, 0xa9, 0x4a, 0x9e, 0x49, 0x1b, 0xf4,
+    0x73, 0x82, 0x0f, 0xfc, 0x07, 0x7b, 0xb8, 0xe9, 0x0e, 0x0b, 0x13, 0xd7,
+    0xd5, 0xfc, 0xce, 0x96, 0x40, 0x1e, 0x78, 0x36, 0x6a, 0x41, 0x47, 0xfc,
+    0xd6, 0xce, 0xb9, 0x2d, 0xc7, 0xe8, 0xaa, 0xe0, 0x7b, 0xc4, 0x7b, 0x65,
+    0x9d, 0xf8, 0xb9, 0xb3, 0xe5, 0x2c, 0x10, 0xbf, 0x49, 0x6a, 0x74, 0x26,
+    0xca, 0xb8, 0x55, 0xc1, 0x52, 0x14, 0x35, 0xc9, 0x59, 0xeb, 0x78, 0x41,
+    0xd0, 0xc2, 0xa6, 0xa2, 0x55, 0xc1, 0x12, 0xb5, 0x9d, 0xc7, 0xe2, 0x1c,
+    0x3f, 0x1a, 0xdb, 0xaa, 0xe2, 0x01, 0xd4, 0xd0, 0xdd, 0xa2, 0x5f, 0x19,
+    0x2f, 0x53, 0x83, 0x8b, 0x70, 0x89, 0xca, 0xef, 0x69, 0xfc, 0xe6, 0x5f,
+    0xd9, 0x51, 0xaa, 0x56, 0x86, 0x03, 0x6a, 0x98, 0xb6, 0xcd, 0x76, 0x60,
+    0x1e, 0xf7, 0x24, 0xea, 0x8e, 0x75, 0x6d, 0x5c, 0x3b, 0x73, 0xdd, 0x0e,
+    0x1c, 0xf5, 0x67, 0x55, 0x9c, 0xfb, 0x94, 0xda, 0xa6, 0x3f, 0x6e, 0xc6,
+    0x55, 0x7f, 0x5c, 0xc5, 0x78, 0x9c, 0x5a, 0xdb, 0x2a, 0xc8, 0xac, 0x6f,
+    0x10, 0xb5, 0xff, 0xf9, 0x29, 0x7f, 0x9e, 0xf7, 0x2d, 0xde, 0xb1, 0xe1,
+    0x4b, 0xc0, 0x2d, 0xe7, 0xb8, 0xbb, 0xd4, 0x7d, 0xce, 0xef, 0x85, 0xf2,
+    0x2e, 0xff, 0xfa, 0x9e, 0x6d, 0x7a, 0x20, 0xcf, 0xef, 0x5f, 0x7c, 0x16,
+    0xd5, 0x88, 0x53, 0x8c, 0xc7, 0x6f, 0x1e, 0x5c, 0xf3, 0x71, 0x4d, 0xdb,
+    0x82, 0xfc, 0xe1, 0xf7, 0x90, 0x21, 0x8a, 0x1a, 0xf9, 0xdb, 0x7a, 0x9d,
+    0xfa, 0x05, 0xf4, 0xaf, 0x06, 0xeb, 0x87, 0x19, 0xef, 0xc6, 0xdc, 0x21,
+    0x08, 0xfc, 0x06, 0xe0, 0x9b, 0xc0, 0xfd, 0xbd, 0x27, 0x8b, 0xe6, 0xbd,
+    0xe3, 0xf3, 0x6f, 0x0a, 0x25, 0xd8, 0x97, 0x88, 0xc7, 0xb8, 0x17, 0x0a,
+    0xa8, 0x3d, 0x2b, 0x61, 0xb3, 0xec, 0x0b, 0x7f, 0xe1, 0xbd, 0x3b, 0x97,
+    0x7a, 0x7d, 0x8e, 0xc9, 0x1c, 0x8f, 0xd3, 0x88, 0xc7, 0xc5, 0x75, 0x63,
+    0xf1, 0xef, 0x08, 0x3d, 0xde, 0xb8, 0x4e, 0x0f, 0xe7, 0xa5, 0x3f, 0x99,
+    0x4b, 0xce, 0x07, 0xff, 0xc4, 0xbc, 0xf9, 0x47, 0xe6, 0x59, 0x3f, 0x8c,
+    0xc3, 0xbf, 0x7d, 0xd8, 0x1e, 0x0e, 0xdb, 0x9f, 0xd4, 0xa9, 0xf9, 0xb5,
+    0xbb, 0xbe, 0x47, 0xfa, 0x3d, 0xee, 0x84, 0x87, 0xf3, 0x68, 0x85, 0x5e,
+    0x18, 0xc7, 0xf4, 0x70, 0x38, 0x17, 0x30, 0x3c, 0x7d, 0x33, 0xae, 0xe5,
+    0x38, 0xe2, 0x5d, 0x8f, 0xf3, 0x28, 0x9b, 0xd6, 0x4d, 0x56, 0x5c, 0x89,
+    0x8b, 0x77, 0x3d, 0xdc, 0x8e, 0xe3, 0x5f, 0xba, 0x8e, 0xe1, 0xdf, 0xb7,
+    0xc5, 0x77, 0xa9, 0xff, 0x9e, 0xfe, 0x91, 0x58, 0xf3, 0xb5, 0xf9, 0xe7,
+    0xa9, 0x3e, 0xe6, 0xfc, 0xb4, 0xe7, 0x3b, 0x26, 0xfc, 0xd7, 0xf0, 0xfc,
+    0x97, 0xd7, 0x61, 0xde, 0x0a, 0x3d, 0xd8, 0x14, 0x39, 0xbe, 0x5c, 0xb5,
+    0xf4, 0xb8, 0x5a, 0x85, 0x33, 0xe3, 0x75, 0xf8, 0xad, 0xf7, 0xaf, 0xa1,
+    0xe7, 0x46, 0xa7, 0x4e, 0xfd, 0x83, 0x4b, 0x2b, 0x78, 0x5e, 0xfa, 0xcf,
+    0xeb, 0x90, 0xf7, 0xb5, 0xaf, 0xad, 0x17, 0x2e, 0xca, 0xa9, 0x58, 0x17,
+    0x42, 0x56, 0xf0, 0x3d, 0x03, 0xd9, 0x2f, 0x07, 0x34, 0xdb, 0x75, 0xf5,
+    0xa6, 0xab, 0xe0, 0x71, 0xd3, 0x9b, 0xc2, 0x52, 0x7f, 0xce, 0xaa, 0x58,
+    0x7a, 0xe3, 0xdd, 0xcd, 0x56, 0x7c, 0x81, 0xac, 0x6e, 0x87, 0xfe, 0x8c,
+    0x2e, 0x19, 0x56, 0xb0, 0x40, 0x11, 0xfd, 0x0c, 0x7d, 0x17, 0xf6, 0x60,
+    0xea, 0x17, 0x73, 0xe5, 0xec, 0xf9, 0xf0, 0xd2, 0x46, 0x13, 0x96, 0x6e,
+    0x3e, 0x43, 0x5a, 0xb0, 0x8b, 0xb4, 0xf8, 0x56, 0x51, 0x17, 0x69, 0xdd,
+    0xdb, 0xc5, 0x6b, 0xc1, 0x1a, 0xca, 0xe2, 0x0e, 0x71, 0x10, 0xb3, 0xca,
+    0x5a, 0xd5, 0x96, 0x0a, 0xaa, 0x4f, 0x43, 0xa8, 0xdd, 0x5c, 0x18, 0x55,
+    0xa1, 0x36, 0xed, 0x57, 0xf8, 0xfe, 0x50, 0xa3, 0xdb, 0x0e, 0x47, 0x76,
+    0x9f, 0x59, 0xc4, 0xad, 0xa2, 0xde, 0xba, 0xc6, 0xe0, 0x19, 0xf8, 0xd7,
+    0xcb, 0x14, 0x09, 0xbe, 0x0c, 0xfb, 0x12, 0xf7, 0x5a, 0x28, 0x82, 0x31,
+    0x0d, 0xf7, 0x2a, 0xcf, 0x5d, 0x43, 0x9f, 0xe7, 0x19, 0x76, 0xdd, 0xf5,
+    0xad, 0x3e, 0xad, 0xb8, 0x9b, 0xd2, 0xfc, 0x74, 0x56, 0x49, 0xa1, 0xee,
+    0xed, 0x4a, 0x3d, 0xbf, 0xa5, 0x77, 0xbc, 0x97, 0x8b, 0xa4, 0x9b, 0x15,
+    0x1f, 0xa7, 0x8c, 0xe2, 0x75, 0x56, 0x77, 0x58, 0x89, 0xc4, 0xc3, 0x7c,
+    0xc7, 0xdc, 0xe6, 0xba, 0xef, 0xd8, 0x91, 0x8e, 0x66, 0xe5, 0x9a, 0xfb,
+    0xae, 0x5d, 0x15, 0x7e, 0xcf, 0xab, 0x6d, 0x4e, 0x8a, 0xd8, 0xe1, 0xbf,
+    0xdd, 0x44, 0xf4, 0xb3, 0xb8, 0x0d, 0x11, 0xeb, 0xe3, 0x97, 0x73, 0xdb,
+    0x41, 0x23, 0xc6, 0xc2, 0xff, 0x09, 0x79, 0x0a, 0x86, 0x25, 0xde, 0xdd,
+    0x8e, 0x51, 0xdc, 0xab, 0xcb, 0xfd, 0x77, 0x12, 0xe9, 0x1b, 0x0b, 0x86,
+    0xa9, 0xab, 0x87, 0x79, 0x6c, 0x0d, 0x6d, 0xc5, 0xfa, 0x0b, 0x54, 0x8f,
+    0x38, 0xc3, 0x63, 0x4f, 0x7a, 0x77, 0x47, 0x23, 0xf6, 0xa1, 0xb6, 0x97,
+    0x0b, 0x1d, 0x71, 0x6e, 0xb3, 0x86, 0xce, 0x08, 0x3c, 0xd5, 0x86, 0xbe,
+    0xa0, 0x2b, 0xbd, 0x17, 0x8c, 0xb2, 0xd5, 0x14, 0x32, 0x27, 0xa4, 0xbe,
+    0xd2, 0xfb, 0x0f, 0x47, 0x7a, 0x9f, 0x25, 0x1f, 0xaf, 0x1c, 0xc9, 0x25,
+    0xaf, 0x65, 0x99, 0xc7, 0x21, 0xd3, 0x71, 0x21, 0x93, 0xeb, 0xf6, 0x85,
+    0x22, 0xe1, 0x67, 0xe9, 0x65, 0x92, 0xbf, 0x39, 0x35, 0x9a, 0xcf, 0x7a,
+    0x7a, 0x3a, 0x26, 0x65, 0x28, 0x3e, 0x87, 0xee, 0x41, 0x4f, 0x4f, 0x7c,
+    0x0e, 0xac, 0x27, 0x89, 0x83, 0x1c, 0xe6, 0x06, 0x3d, 0x75, 0x85, 0xa4,
+    0x9e, 0xbe, 0x1b, 0xaa, 0x0a, 0x6f, 0x53, 0x7c, 0x3d, 0xf9, 0x7b, 0x65,
+    0x3d, 0xf8, 0xf7, 0xa7, 0xf4, 0x51, 0xd5, 0x6e, 0xd4, 0xbb, 0xa9, 0x34,
+    0xb8, 0x95, 0xb4, 0x8e, 0x32, 0x25, 0xd4, 0xb1, 0x9f, 0x4a, 0xd3, 0x5d,
+    0xa4, 0x36, 0x94, 0x41, 0xf6, 0xa4, 0xf2, 0xb9, 0xd2, 0x4b, 0xa5, 0xa8,
+    0x85, 0x5d, 0xf7, 0xbf, 0xa3, 0x5a, 0xb8, 0x44, 0x09, 0x85, 0x31, 0x37,
+    0x5a, 0x42, 0xf5, 0x03, 0x90, 0xad, 0x9b, 0x93, 0xa6, 0x0a, 0xc8, 0x76,
+    0x87, 0xdc, 0x73, 0xef, 0xab, 0x87, 0x23, 0xb9, 0x16, 0xc5, 0xa7, 0xab,
+    0xa4, 0x85, 0x3a, 0x2d, 0x5a, 0xaa, 0x58, 0xdd, 0xcd, 0x0a, 0x9f, 0x2d,
+    0x62, 0x10, 0xe4, 0x3b, 0x19, 0x8a, 0xa4, 0x5b, 0x14, 0xdc, 0xa9, 0x42,
+    0x1f, 0xd7, 0xd0, 0xe7, 0xf9, 0xc6, 0xee, 0x16, 0xc5, 0x75, 0x4f, 0x47,
+    0xd7, 0x50, 0xa3, 0xa0, 0xad, 0xef, 0x15, 0x0f, 0xc3, 0x44, 0x43, 0x35,
+    0xb0, 0xc1, 0xd3, 0x0a, 0xeb, 0x42, 0xdd, 0xfd, 0x93, 0xc3, 0x91, 0x81,
+    0x57, 0xc9, 0xc7, 0xa9, 0xa4, 0x82, 0xd4, 0x69, 0xf8, 0x2c, 0x6c, 0xf0,
+    0xac, 0x67, 0x83, 0xcf, 0xc2, 0x06, 0x5f, 0xc5, 0x9d, 0x2d, 0x73, 0xbb,
+    0x6b, 0xe8, 0xf3, 0xbc, 0xd4, 0x43, 0x42, 0x69, 0x0c, 0xbf, 0x4a, 0xab,
+    0x70, 0xc6, 0x3a, 0xee, 0x8f, 0x48, 0xf7, 0x59, 0x40, 0xe6, 0x6d, 0x6c,
+    0x8f, 0x71, 0x3a, 0xab, 0xfb, 0xfa, 0xf1, 0x75, 0xa3, 0xc5, 0xbb, 0x61,
+    0xbb, 0x7d, 0xd0, 0x47, 0xbf, 0x38, 0x7b, 0xd8, 0x86, 0xc2, 0x3a, 0x2f,
+    0x45, 0x6d, 0xad, 0x41, 0x0f, 0x6c, 0x0b, 0xf0, 0x0f, 0xf8, 0x51, 0x8a,
+    0xd4, 0x6c, 0x89, 0xb4, 0x03, 0x96, 0xd9, 0x80, 0xcc, 0xfa, 0xb8, 0x22,
+    0xde, 0xf4, 0x4d, 0xb6, 0x83, 0xd4, 0x22, 0x6d, 0xa5, 0x6f, 0x07, 0x50,
+    0x5e, 0x24, 0xdd, 0x4d, 0x52, 0x27, 0x19, 0xe8, 0x24, 0x45, 0xd7, 0x75,
+    0x92, 0x09, 0xf1, 0x7c, 0xa3, 0xd0, 0x3b, 0xeb, 0xc4, 0xb3, 0xc9, 0x62,
+    0x3b, 0x0b, 0x3f, 0xad, 0xf0, 0xef, 0x50, 0xd2, 0xce, 0x5e, 0x21, 0x1f,
+    0x67, 0x91, 0x3f, 0xfb, 0xa5, 0xfe, 0xb2, 0x88, 0xfb, 0xae, 0x9b, 0x0d,
+    0x45, 0xf4, 0x57, 0x98, 0xbf, 0xa7, 0x93, 0xac, 0xf0, 0x4b, 0x7e, 0xdf,
+    0x68, 0x0c, 0xbf, 0x42, 0x3b, 0x10, 0xff, 0x44, 0x3c, 0x30, 0x35, 0x25,
+    0x12, 0x3d, 0x46, 0x7f, 0xef, 0x2e, 0x08, 0x3c, 0xce, 0x2f, 0xde, 0xe4,
+    0x3c, 0x2f, 0xc8, 0x34, 0x7d, 0xa1, 0x87, 0x18, 0x86, 0xfd, 0xb6, 0x61,
+    0x2e, 0xfa, 0xb8, 0xfc, 0x29, 0xed, 0x5e, 0xb6, 0xa1, 0x9d, 0x12, 0x3e,
+    0xc8, 0xeb, 0xde, 0x29, 0xe1, 0x63, 0xf8, 0xfe, 0x36, 0x22, 0xe1, 0x9f,
+    0xf2, 0x5d, 0xd2, 0x2c, 0xe1, 0xf7, 0xd9, 0x64, 0xbe, 0x25, 0xe1, 0x16,
+    0x64, 0xc5, 0xc7, 0x97, 0x4b, 0x78, 0xb7, 0x4a, 0xf4, 0x76, 0x85, 0xf7,
+    0xf3, 0x1c, 0x0c, 0xf9, 0xb7, 0x9a, 0x84, 0xcb, 0x91, 0x1c, 0xc5, 0x03,
+    0x12, 0xee, 0xad, 0x20, 0x3a, 0xac, 0x4a, 0x78, 0x01, 0x99, 0x4b, 0x87,
+    0x22, 0x61, 0x27, 0x84, 0x5a, 0xca, 0xfb, 0x69, 0x8f, 0x05, 0xda, 0xe9,
+    0xc3, 0x58, 0xb8, 0xd9, 0x87, 0xff, 0x03, 0xb5, 0xa1, 0x0f, 0x5f, 0x54,
+    0xa8, 0xc6, 0x87, 0x27, 0x02, 0xd0, 0x51, 0x1d, 0xf5, 0xa8, 0x72, 0xb1,
+    0x80, 0x07, 0x9b, 0x2f, 0x31, 0xec, 0xe1, 0xfc, 0x63, 0x39, 0xe0, 0x1a,
+    0xfa, 0xb4, 0x96, 0xc4, 0x2f, 0x11, 0x2a, 0x60, 0x51, 0x23, 0x26, 0x6a,
+    0x01, 0xcb, 0x9f, 0x71, 0xe9, 0x44, 0x1d, 0x62, 0x8a, 0x41, 0x5f, 0x2e,
+    0x83, 0x9c, 0xbf, 0x5b, 0xc1, 0x77, 0x8e, 0x94, 0x6d, 0x62, 0x2d, 0x60,
+    0x89, 0x53, 0x08, 0x35, 0x01, 0xae, 0xa0, 0x37, 0x4a, 0x21, 0xff, 0xbb,
+    0x1b, 0x00, 0x8b, 0x7f, 0x61, 0xa0, 0x4b, 0xfb, 0xef, 0x04, 0x5c, 0x4a,
+    0x5f, 0x54, 0x71, 0x31, 0xb2, 0x59, 0xc0, 0xfc, 0xd7, 0xd5, 0xd3, 0x73,
+    0x7f, 0x8f, 0xd9, 0x95, 0x4e, 0x9a, 0xd1, 0x23, 0xa1, 0x23, 0x95, 0xd4,
+    0x3f, 0x3c, 0x7c, 0x68, 0xd8, 0x0c, 0x8d, 0x98, 0xa1, 0x2c, 0x65, 0x72,
+    0x7b, 0x73, 0x19, 0x74, 0x30, 0x0c, 0xf8, 0x40, 0x11, 0x9c, 0xc9, 0x0c,
+    0x77, 0x0a, 0x90, 0x42, 0x23, 0x61, 0x26, 0x5c, 0x6f, 0x76, 0x4a, 0xfa,
+    0xd0, 0x48, 0x27, 0x73, 0xda, 0xdd, 0x69, 0xfe, 0x70, 0xef, 0xd0, 0xe3,
+    0xfd, 0x9b, 0x19, 0x36, 0x1f, 0x35, 0x37, 0x83, 0x1f, 0xa3, 0xd3, 0x48,
+    0xff, 0xa8, 0x99, 0x19, 0x7a, 0xcc, 0x1c, 0xcc, 0x9a, 0x62, 0x29, 0x1e,
+    0xf4, 0xfa, 0xa1, 0x6c, 0x38, 0x94, 0x5d, 0xdf, 0x69, 0xee, 0x07, 0x4a,
+    0x6e, 0x68, 0xe8, 0xfa, 0x3c, 0x3a, 0x7b, 0x86, 0xf7, 0x8e, 0xf6, 0x0b,
+    0x2e, 0x2d, 0x66, 0x11, 0x98, 0xc9, 0x0e, 0x7b, 0xac, 0x33, 0xb9, 0xdc,
+    0xc8, 0xb0, 0xd8, 0x83, 0x27, 0x88, 0x90, 0x4d, 0xae, 0x9a, 0xcd, 0x0e,
+    0xe7, 0x04, 0xc7, 0xa1, 0x43, 0x99, 0xc7, 0xbc, 0x7d, 0x26, 0x1f, 0xda,
+    0x01, 0x4a, 0x0f, 0xbe, 0x0e, 0xd2, 0x3d, 0x45, 0x30, 0xe8, 0xf6, 0x0c,
+    0x1e, 0x3c, 0x78, 0x68, 0x4f, 0x6e, 0xe0, 0x09, 0x00, 0x83, 0xa3, 0xe6,
+    0x1d, 0x77, 0x58, 0x66, 0x6b, 0x6b, 0xa7, 0x69, 0x86, 0x76, 0x63, 0xfe,
+    0xbe, 0x9e, 0xa8, 0xd9, 0xe9, 0x21, 0xdf, 0xd7, 0xd3, 0x5a, 0x04, 0xb7,
+    0x15, 0xc1, 0x1b, 0x17, 0xe1, 0xef, 0x3f, 0x80, 0x95, 0xfc, 0x0e, 0xfe,
+    0x0e, 0x0c, 0xb7, 0x2e, 0x2e, 0x76, 0x60, 0xb8, 0xad, 0x08, 0xde, 0x58,
+    0x04, 0xb7, 0x46, 0xaf, 0x4b, 0xc4, 0x34, 0xdf, 0xd9, 0x58, 0xdc, 0x4f,
+    0xa5, 0x7a, 0x92, 0x7b, 0x76, 0xdc, 0xd7, 0xd3, 0x29, 0x8f, 0x66, 0xb1,
+    0xdf, 0x62, 0x42, 0x3a, 0x6f, 0xf0, 0xa1, 0x1d, 0x7b, 0xee, 0xbb, 0x3f,
+    0xd5, 0xd5, 0x5a, 0xbc, 0xf6, 0xf6, 0x9d, 0x3b, 0xef, 0xdf, 0xb3, 0xab,
+    0xe7, 0x9e, 0xed, 0x3b, 0xb7, 0xef, 0xdc, 0xb6, 0x27, 0xb9, 0xab, 0x67,
+    0x87, 0xd9, 0xea, 0xf3, 0x58, 0x62, 0xae, 0xcd, 0x9f, 0xcb, 0xec, 0x1d,
+    0x1a, 0xec, 0x33, 0xb3, 0x87, 0x0e, 0xf6, 0xcb, 0x91, 0x25, 0x70, 0x37,
+    0xfa, 0xb8, 0x7d, 0x87, 0xf6, 0x0e, 0x67, 0x85, 0xe2, 0xf6, 0xec, 0xe3,
+    0x35, 0x07, 0x6e, 0x27, 0x67, 0x97, 0x49, 0xce, 0x87, 0x5e, 0xcb, 0x5f,
+    0x35, 0x3e, 0xc3, 0xbc, 0xde, 0xf7, 0xbf, 0x23, 0xc0, 0x59, 0xc0, 0x17,
+    0x06, 0x1c, 0xc5, 0xd7, 0x81, 0x2f, 0x8e, 0x6f, 0x77, 0x23, 0x39, 0xbd,
+    0xf8, 0x1a, 0xf0, 0xd9, 0xf8, 0x5a, 0xf0, 0xc1, 0x60, 0xf6, 0xf0, 0x59,
+    0x8d, 0x3e, 0x91, 0xeb, 0xe7, 0x75, 0xbe, 0xb7, 0x21, 0x71, 0xe8, 0xd0,
+    0x28, 0xf2, 0x76, 0x09, 0x98, 0x0f, 0xa6, 0xb1, 0x81, 0x68, 0xeb, 0xc6,
+    0x3b, 0xa2, 0x77, 0x6d, 0x88, 0x46, 0xa3, 0x1b, 0xdb, 0x36, 0xec, 0xbf,
+    0x2b, 0x7b, 0xd7, 0xdd, 0x99, 0x6c, 0xff, 0x86, 0xec, 0xe0, 0xf0, 0xe8,
+    0x13, 0x66, 0x38, 0xd5, 0x9f, 0x31, 0x5b, 0xdb, 0x81, 0xd4, 0xb6, 0xd1,
+    0xdc, 0x60, 0xb6, 0xde, 0xd5, 0xd9, 0x76, 0x67, 0x67, 0xf4, 0xee, 0xf5,
+    0xd8, 0x44, 0xf8, 0xe0, 0xe3, 0x43, 0x43, 0xeb, 0x51, 0x99, 0xee, 0x85,
+    0x21, 0x8c, 0x9a, 0xfb, 0x06, 0x0f, 0x66, 0xcd, 0xcc, 0xa1, 0x83, 0x23,
+    0x87, 0x86, 0xfa, 0x2b, 0x65, 0xfc, 0x92, 0x7f, 0xf4, 0xff, 0xfc, 0xef,
+    0xd1, 0x1f, 0xed, 0x19, 0xe9, 0x1f, 0x1e, 0xdc, 0x3b, 0xb4, 0x98, 0xf6,
+    0x91, 0x23, 0xde, 0x2b, 0x82, 0xe4, 0xa4, 0x01, 0x7f, 0x82, 0x16, 0x97,
+    0x9a, 0xd3, 0xdd, 0x26, 0xc7, 0x95, 0x96, 0xb5, 0xcb, 0xa8, 0x66, 0x99,
+    0xfb, 0x2d, 0xc0, 0x0d, 0xf8, 0xd6, 0xfc, 0x1f, 0xc8, 0xa4, 0x0c, 0xac,
+    0xad, 0xa9, 0x59, 0x56, 0xab, 0x7f, 0x6d, 0x8d, 0x19, 0xa9, 0xf3, 0x3f,
+    0xb5, 0xae, 0x32, 0xba, 0x76, 0x19, 0xd3, 0xfa, 0x38, 0xab, 0x49, 0xf8,
+    0xb3, 0x37, 0x3b, 0xd0, 0x3f, 0x34, 0x78, 0x44, 0x40, 0x07, 0xf6, 0x66,
+    0xe0, 0xdd, 0x0c, 0x0d, 0x65, 0xb2, 0xde, 0xec, 0x60, 0xdb, 0x88, 0x07,
+    0x1d, 0x18, 0xc9, 0x5c, 0x87, 0x5a, 0x25, 0x34, 0x32, 0x32, 0xe8, 0x8d,
+    0x8d, 0xec, 0xf3, 0x67, 0x33, 0x83, 0x07, 0x7c, 0xda, 0x91, 0xdc, 0xa2,
+    0x0c, 0xa8, 0x7d, 0x09, 0xa1, 0x1a, 0xf9, 0x93, 0x6c, 0x7d, 0x5b, 0xf9,
+    0x5f, 0x4b, 0x13, 0x52, 0x99,
+};
+
+const firmware_blob_t firmware_blob_a42e6f65c5610662 = {
+    blob_a42e6f65c5610662_z, sizeof(blob_a42e6f65c5610662_z), 9884, 0x4a17905f
+};
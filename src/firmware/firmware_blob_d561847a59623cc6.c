@@ -0,0 +1,457 @@
+/**
+ * Embedded Firmware blob d561847a59623cc6
+ * Used by: t31 SPL, t31a SPL, t31nl SPL, t31x SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 10092 bytes, 5304 compressed
+static const uint8_t blob_d561847a59623cc6_z[] = {
+    0x78, 0xda, 0xd5, 0x5a, 0x6f, 0x70, 0x5c, 0xd5, 0x75, 0x3f, 0xef, 0xed,
+    0x93, 0xb4, 0xfa, 0x67, 0x3d, 0xc9, 0x8b, 0xbd, 0xb6, 0x15, 0xe7, 0xad,
+    0xf5, 0x56, 0x5a, 0xb3, 0x32, 0xb3, 0x92, 0x45, 0x10, 0x62, 0x85, 0x97,
+    0xdd, 0x95, 0x2d, 0x07, 0xd9, 0xac, 0x85, 0x52, 0x4c, 0x92, 0x8e, 0x64,
+    0xed, 0x0a, 0x4b, 0x20, 0xdb, 0x6b, 0x49, 0xa4, 0x26, 0x51, 0xe1, 0x55,
+    0x16, 0xae, 0x42, 0x76, 0x24, 0x95, 0x21, 0x19, 0x93, 0x49, 0x67, 0x16,
+    0xff, 0x25, 0xa0, 0x4a, 0x36, 0x7f, 0x3a, 0x7c, 0x80, 0x5a, 0xe3, 0x10,
+    0xa0, 0x4c, 0xa6, 0x43, 0xa7, 0x4c, 0xc3, 0xb7, 0xba, 0x84, 0xb6, 0x4c,
+    0xcb, 0xd4, 0x7c, 0xf0, 0x0c, 0x4e, 0x31, 0x7e, 0xfd, 0x9d, 0x7b, 0xdf,
+    0x93, 0xd7, 0xb6, 0x32, 0x31, 0x1f, 0xfa, 0xa1, 0x9a, 0x79, 0x73, 0xcf,
+    0xbd, 0xf7, 0x9c, 0x7b, 0xcf, 0x3d, 0xf7, 0xfc, 0xbd, 0xab, 0x12, 0x4b,
+    0x8d, 0x11, 0xfe, 0x54, 0x8a, 0xb7, 0x94, 0x58, 0x13, 0x12, 0xee, 0x93,
+    0x63, 0xf6, 0x53, 0x9e, 0xa8, 0x6d, 0xa7, 0x5b, 0x4c, 0x3d, 0x81, 0x31,
+    0x39, 0x17, 0x23, 0x6f, 0x54, 0xbb, 0xe2, 0xbd, 0x93, 0xfa, 0xa6, 0x62,
+    0x16, 0x95, 0x46, 0x69, 0xf0, 0xc7, 0xb1, 0x97, 0x8b, 0xc9, 0xcb, 0x73,
+    0x87, 0x28, 0x3e, 0x53, 0x49, 0x9a, 0x19, 0x08, 0x11, 0xf9, 0xa8, 0x33,
+    0x47, 0x96, 0x1a, 0xa5, 0xd6, 0xb8, 0xa9, 0x53, 0xb1, 0x19, 0xf0, 0x13,
+    0x55, 0x50, 0xa9, 0x19, 0x48, 0xc5, 0x68, 0x3d, 0x95, 0x98, 0x44, 0xf7,
+    0xe7, 0xbc, 0x54, 0x7e, 0x9b, 0xd8, 0x2f, 0x34, 0x94, 0x0d, 0x18, 0x2f,
+    0x91, 0x46, 0x47, 0x30, 0xf6, 0x74, 0x4e, 0xa3, 0xe4, 0x73, 0x64, 0xbe,
+    0x33, 0x6e, 0x57, 0x9d, 0x8c, 0x28, 0x94, 0x36, 0x2f, 0xd9, 0x7b, 0x7d,
+    0x15, 0x14, 0x37, 0xc9, 0x2a, 0x89, 0xc6, 0xda, 0x3f, 0xce, 0xa9, 0x71,
+    0x0d, 0x6b, 0x25, 0x66, 0x6d, 0x4a, 0x47, 0x2c, 0x4a, 0xb7, 0x00, 0xce,
+    0x6b, 0xd4, 0x99, 0x27, 0x4a, 0xe6, 0x79, 0xfe, 0x29, 0x8c, 0xf3, 0x98,
+    0x49, 0x5b, 0xf3, 0x21, 0xea, 0x38, 0xe1, 0xa5, 0x0b, 0x1e, 0xde, 0x87,
+    0xf9, 0x89, 0xb5, 0xc7, 0x73, 0x3e, 0x8a, 0xcf, 0xf2, 0x98, 0x42, 0xf1,
+    0xc8, 0xa7, 0xf6, 0x5b, 0x0d, 0x65, 0xa4, 0x82, 0xc7, 0x33, 0x0b, 0xc6,
+    0xa4, 0x36, 0xee, 0x21, 0x75, 0x95, 0x8f, 0xce, 0x2d, 0x4c, 0x57, 0x50,
+    0x05, 0x9f, 0x45, 0xd2, 0x24, 0x72, 0x44, 0x59, 0xac, 0x9d, 0xcc, 0xf5,
+    0x01, 0xd7, 0x47, 0x87, 0x67, 0xfb, 0xb0, 0xc7, 0x57, 0x76, 0xbf, 0x0f,
+    0xb8, 0x33, 0xa0, 0x9d, 0xe1, 0xf5, 0xfc, 0xf4, 0x56, 0x03, 0xaf, 0xc7,
+    0xf4, 0x47, 0x40, 0xcf, 0x5b, 0x7e, 0x65, 0xc7, 0xf4, 0x6b, 0xfb, 0x9e,
+    0x9b, 0x21, 0xec, 0xcd, 0x78, 0x8c, 0x6f, 0x63, 0x7f, 0x96, 0x99, 0x4b,
+    0xa3, 0x53, 0x22, 0x57, 0x4e, 0x6a, 0x34, 0x82, 0xb3, 0x06, 0xf4, 0x7e,
+    0xa2, 0x95, 0x2a, 0x5d, 0xb4, 0x3d, 0x82, 0x37, 0x8d, 0x62, 0x79, 0x2f,
+    0xce, 0x74, 0x05, 0x7d, 0x03, 0xad, 0x87, 0x3c, 0xe0, 0x4d, 0x8f, 0xf2,
+    0x39, 0x9f, 0xc4, 0x5e, 0xb1, 0x76, 0x75, 0x1e, 0xdf, 0xf4, 0x6a, 0x8c,
+    0x33, 0xde, 0x2f, 0x81, 0x57, 0x8b, 0xd6, 0xe5, 0x2f, 0xa0, 0x13, 0xb9,
+    0x3c, 0x32, 0x3f, 0x42, 0x26, 0xf7, 0xc6, 0x4d, 0xde, 0xff, 0x32, 0xf6,
+    0x27, 0xec, 0xdd, 0x8e, 0xbd, 0xa9, 0x34, 0x6e, 0xae, 0xa3, 0x7e, 0xba,
+    0xa4, 0xc4, 0x84, 0xbc, 0x2a, 0x2c, 0x4f, 0x4b, 0x8d, 0x41, 0x94, 0x6a,
+    0x4f, 0xce, 0xd1, 0x19, 0x35, 0xfa, 0xa9, 0x11, 0x9b, 0xfb, 0x04, 0xdf,
+    0x05, 0x7c, 0x9f, 0x19, 0x89, 0x39, 0xb2, 0x3c, 0xa6, 0xcf, 0x48, 0x9c,
+    0x70, 0xd7, 0xf7, 0xf2, 0xfa, 0xc0, 0xfb, 0xc4, 0xd8, 0x96, 0xbb, 0x62,
+    0x6c, 0x15, 0x3a, 0x90, 0x6a, 0xef, 0xc8, 0xad, 0xa4, 0x0b, 0x54, 0x4d,
+    0x8b, 0xa4, 0xd0, 0xd3, 0x59, 0x3a, 0xa3, 0x45, 0x6b, 0x80, 0xaf, 0x43,
+    0x27, 0x3e, 0x31, 0x8e, 0x00, 0xef, 0xe9, 0x5c, 0xb8, 0xf5, 0x38, 0x5d,
+    0xb1, 0x2f, 0xf8, 0x58, 0x66, 0x1e, 0x1a, 0xf0, 0x85, 0x43, 0xe7, 0xe9,
+    0xb2, 0x9d, 0x17, 0xfd, 0xc2, 0xfb, 0x63, 0x59, 0xf5, 0xb5, 0x7f, 0xd7,
+    0x64, 0x79, 0x5d, 0x2a, 0xa3, 0x0a, 0x96, 0x4d, 0xd2, 0x91, 0xf5, 0xdf,
+    0x78, 0x65, 0x5b, 0x54, 0x2e, 0x5b, 0xfa, 0xbc, 0x28, 0x46, 0x96, 0x16,
+    0x7d, 0x1e, 0xfd, 0xc1, 0xbb, 0x27, 0x4d, 0x17, 0x3e, 0x04, 0xd8, 0x2a,
+    0x76, 0x70, 0x9c, 0xb1, 0x49, 0x8c, 0xfd, 0xf7, 0x0d, 0x63, 0xb3, 0x18,
+    0x7b, 0xc1, 0x7b, 0xfd, 0xd8, 0x2f, 0x30, 0x76, 0xa2, 0xec, 0xfa, 0xb1,
+    0x17, 0x79, 0x6d, 0x9c, 0xb9, 0x91, 0x52, 0xb9, 0x7f, 0x2f, 0xa1, 0x8a,
+    0x00, 0xe4, 0x35, 0xf1, 0x97, 0x3a, 0x6c, 0x8a, 0xef, 0xc2, 0x53, 0x43,
+    0x56, 0x51, 0x94, 0x71, 0xdf, 0x00, 0x5e, 0x2a, 0x7a, 0xd2, 0x64, 0x9a,
+    0x2c, 0x6c, 0xc2, 0xb6, 0x49, 0x97, 0x76, 0x93, 0x98, 0xe1, 0xf9, 0xb7,
+    0x31, 0xef, 0xa5, 0x81, 0x1c, 0xcf, 0x07, 0x22, 0xb1, 0xa5, 0xf5, 0x3f,
+    0xc4, 0xf8, 0x8d, 0x7a, 0x16, 0x2b, 0xf6, 0x44, 0x95, 0x5d, 0x69, 0xb1,
+    0xaf, 0x8f, 0x12, 0x73, 0x4e, 0x0b, 0xfb, 0x61, 0xbd, 0xec, 0x13, 0xeb,
+    0xc2, 0x1e, 0x72, 0xf4, 0x53, 0x4f, 0xd4, 0xf4, 0x1f, 0xa6, 0x1f, 0x3d,
+    0xaa, 0x45, 0xf5, 0xef, 0x4c, 0x9a, 0x41, 0x7f, 0x06, 0xe3, 0x12, 0xff,
+    0x43, 0xe0, 0x97, 0x48, 0x7c, 0x9f, 0x8b, 0x7f, 0x89, 0x3c, 0xd1, 0x8b,
+    0x2f, 0xc1, 0xe6, 0x41, 0x53, 0xee, 0xd0, 0xb0, 0xcc, 0x99, 0x4e, 0xea,
+    0xe8, 0x99, 0x05, 0x41, 0x7f, 0xd9, 0x13, 0xa5, 0x33, 0x3a, 0xd6, 0x50,
+    0xa7, 0xd9, 0x3f, 0x08, 0x3d, 0xc7, 0x9f, 0x4e, 0x45, 0xd3, 0x2e, 0xdf,
+    0x7a, 0x1b, 0xf3, 0x7d, 0xad, 0x5f, 0x8b, 0x3e, 0x15, 0xf4, 0x43, 0x6d,
+    0x37, 0x9f, 0x8b, 0xf7, 0x5a, 0x21, 0x6c, 0xec, 0xdc, 0xc2, 0x4a, 0x9a,
+    0xd0, 0x79, 0xbf, 0x2a, 0x9a, 0x08, 0x15, 0x53, 0x4c, 0xaf, 0xc2, 0x78,
+    0x25, 0xbe, 0xdb, 0x69, 0xc2, 0xc7, 0xfc, 0x7b, 0x49, 0xca, 0xaf, 0x12,
+    0x78, 0xdc, 0x87, 0xc4, 0xcd, 0x3a, 0x67, 0xae, 0xdc, 0x99, 0xd3, 0x71,
+    0x27, 0xa5, 0x0e, 0x2c, 0x65, 0x94, 0xca, 0x15, 0x39, 0xfd, 0x0b, 0x80,
+    0x55, 0x07, 0xde, 0x0d, 0x98, 0x6d, 0x41, 0x0d, 0xc2, 0x5c, 0xc3, 0xc5,
+    0x4f, 0xc2, 0x4e, 0x73, 0x81, 0x56, 0xa2, 0x35, 0x34, 0x41, 0xac, 0xff,
+    0x1f, 0x43, 0xc7, 0x74, 0xf8, 0xb5, 0x80, 0x81, 0x7b, 0xa9, 0x29, 0x7e,
+    0x32, 0x10, 0xea, 0x13, 0x63, 0x8c, 0xc3, 0x63, 0xdc, 0x5f, 0xc4, 0xb8,
+    0x3b, 0x06, 0x85, 0xd5, 0xf9, 0x6c, 0x6c, 0x17, 0x37, 0x9e, 0x91, 0xf9,
+    0x18, 0x84, 0xec, 0x2f, 0xe0, 0xac, 0x01, 0x63, 0x82, 0x26, 0x56, 0x7b,
+    0xc8, 0x8f, 0x73, 0xd6, 0xe2, 0xcc, 0x44, 0xb3, 0x39, 0x3e, 0x2b, 0xfb,
+    0x1e, 0x05, 0xfa, 0x03, 0xfb, 0xf6, 0x29, 0x38, 0x97, 0x82, 0xf5, 0x56,
+    0x60, 0x0c, 0x2a, 0xd3, 0x6c, 0x42, 0xc7, 0x14, 0xd2, 0xeb, 0x63, 0x96,
+    0x4e, 0xeb, 0x28, 0x05, 0x5b, 0x25, 0xb5, 0xc6, 0xcf, 0x3e, 0x9c, 0x20,
+    0xaf, 0xe3, 0xb8, 0xa3, 0x63, 0xbc, 0x16, 0xf6, 0x3c, 0x36, 0xe3, 0x77,
+    0xf6, 0x35, 0xb0, 0xef, 0x7b, 0xb6, 0xb4, 0xfd, 0x9e, 0x2d, 0x71, 0xd3,
+    0xa4, 0x57, 0x16, 0x0c, 0x3a, 0xbb, 0x10, 0x98, 0xcd, 0x53, 0x60, 0xca,
+    0xa2, 0x16, 0xec, 0x1d, 0xa1, 0xd7, 0x17, 0x1a, 0xe9, 0xb5, 0x85, 0x10,
+    0xbd, 0x0a, 0xfa, 0x33, 0x0b, 0xb6, 0xad, 0x99, 0x45, 0xe2, 0x1c, 0x45,
+    0xd0, 0x4b, 0xf8, 0x24, 0xff, 0x3f, 0xc2, 0x46, 0xb7, 0xe6, 0x3c, 0xf4,
+    0x48, 0x9e, 0xfd, 0xc5, 0xff, 0xd8, 0x19, 0x9f, 0x1a, 0x19, 0xc8, 0x92,
+    0xe5, 0x83, 0x7e, 0xdf, 0x16, 0x0d, 0x58, 0x7c, 0xd6, 0x95, 0xe6, 0x27,
+    0xf7, 0x3e, 0x57, 0x0f, 0x51, 0xe9, 0xc9, 0xb6, 0xd7, 0xeb, 0x55, 0x7d,
+    0xe5, 0x48, 0xc0, 0xbf, 0x0b, 0x12, 0xee, 0x9f, 0xdd, 0x80, 0x73, 0xb1,
+    0x3c, 0x60, 0xdf, 0xb3, 0x1a, 0xc7, 0x89, 0x48, 0x3f, 0x7c, 0xfe, 0x3b,
+    0xb3, 0x6b, 0xe9, 0xd7, 0x38, 0x63, 0x1c, 0xf6, 0x10, 0xc7, 0x39, 0x1f,
+    0x99, 0x65, 0xff, 0xa0, 0x52, 0x7a, 0x36, 0x10, 0x79, 0x1b, 0x74, 0x6f,
+    0xe7, 0x34, 0x3f, 0x7c, 0xe1, 0xa7, 0x93, 0xe3, 0xac, 0x83, 0x25, 0xa0,
+    0x03, 0xed, 0x2a, 0x11, 0x9f, 0xfe, 0x45, 0x43, 0x7c, 0x9a, 0x84, 0xae,
+    0xb2, 0x4e, 0xff, 0x6a, 0xae, 0x0c, 0x7c, 0x12, 0xbd, 0x9b, 0xe3, 0xf3,
+    0xab, 0x7a, 0xd1, 0x48, 0xc0, 0xc8, 0xab, 0xc2, 0x96, 0x42, 0x3d, 0xd8,
+    0x87, 0x74, 0x96, 0xd9, 0xef, 0xec, 0xa4, 0x8f, 0xf7, 0x65, 0xf8, 0x76,
+    0xbd, 0x46, 0xfd, 0xad, 0x1d, 0xf3, 0xe1, 0xec, 0x33, 0x38, 0xfb, 0x0c,
+    0xce, 0x3e, 0x83, 0xb3, 0xcf, 0x40, 0x36, 0x33, 0x90, 0xcd, 0x4c, 0xad,
+    0x23, 0xbb, 0x56, 0xe7, 0xce, 0x58, 0x27, 0xf8, 0xce, 0xf8, 0x5e, 0xf8,
+    0xbe, 0x68, 0x5d, 0x6a, 0x9c, 0x56, 0xc4, 0xc7, 0x8b, 0x29, 0xa1, 0xf3,
+    0xdd, 0xb1, 0xbd, 0x97, 0xe3, 0xbe, 0xf8, 0x9e, 0xd4, 0x25, 0xdd, 0xd4,
+    0x4c, 0xf7, 0xbe, 0x96, 0xbf, 0xab, 0xfc, 0xb2, 0x77, 0xc5, 0x76, 0x50,
+    0x4d, 0x13, 0x8d, 0x6c, 0x07, 0x09, 0xc8, 0x4d, 0xd8, 0x1d, 0xee, 0xae,
+    0x2f, 0x1a, 0x37, 0x2d, 0x43, 0x83, 0xce, 0x25, 0xb1, 0xfa, 0x04, 0xec,
+    0x3d, 0x46, 0xae, 0x6e, 0xb3, 0xff, 0xe1, 0x73, 0x4e, 0xac, 0xd6, 0x49,
+    0xf2, 0x9b, 0xca, 0x51, 0x95, 0xfa, 0x24, 0xf3, 0x5b, 0x04, 0x1e, 0x99,
+    0xbf, 0xc8, 0x1f, 0xe0, 0xaf, 0x0a, 0x7a, 0x55, 0xc8, 0x23, 0x02, 0x82,
+    0x5e, 0x53, 0xa0, 0xbb, 0xef, 0x97, 0x90, 0xd7, 0xd5, 0xdd, 0x1e, 0xac,
+    0xcb, 0x6b, 0xf2, 0x3e, 0x7c, 0xf6, 0x15, 0xe2, 0x4e, 0xa4, 0xce, 0xf2,
+    0x1e, 0xab, 0xb1, 0x47, 0x95, 0xb3, 0x2e, 0xeb, 0xeb, 0x7f, 0xda, 0x52,
+    0xf6, 0xbc, 0xe7, 0x20, 0xc6, 0x4f, 0xe0, 0x73, 0xd7, 0xfd, 0x53, 0x67,
+    0xdd, 0x62, 0xcc, 0x55, 0x8a, 0x75, 0xa4, 0x9e, 0x33, 0x2e, 0xaf, 0xa1,
+    0x17, 0xe0, 0x9a, 0x0e, 0xee, 0x72, 0x36, 0xf5, 0x01, 0xe4, 0x55, 0x0e,
+    0x3f, 0xd1, 0x08, 0x79, 0x85, 0xa0, 0xc3, 0x26, 0x74, 0xd8, 0x80, 0x8e,
+    0xd7, 0x42, 0xc7, 0x61, 0x4f, 0x3e, 0x71, 0x5f, 0x8e, 0xdf, 0xc9, 0xc0,
+    0xef, 0x7c, 0x0f, 0xeb, 0x03, 0x77, 0xc6, 0x07, 0xdb, 0x52, 0xfd, 0x13,
+    0xd0, 0xe1, 0xea, 0x68, 0xe4, 0xde, 0xa6, 0xfa, 0xc0, 0xac, 0x25, 0x64,
+    0x17, 0xb0, 0xd8, 0x2e, 0x0e, 0x42, 0x4f, 0xea, 0x9e, 0xf5, 0x90, 0xf9,
+    0xac, 0x88, 0xc7, 0xd4, 0x93, 0xe3, 0x33, 0x89, 0x18, 0x83, 0x35, 0x79,
+    0xbd, 0x43, 0x58, 0x2b, 0x10, 0x8a, 0xa9, 0xb8, 0x0d, 0xdd, 0x43, 0xf5,
+    0xcf, 0xba, 0xf2, 0x8b, 0x1b, 0xba, 0x88, 0x6f, 0x61, 0x23, 0x03, 0x7d,
+    0xb7, 0x7c, 0x75, 0xa1, 0x04, 0x7c, 0x44, 0x8a, 0xea, 0x42, 0xc7, 0x61,
+    0xb3, 0x67, 0x04, 0xce, 0x97, 0x76, 0x1c, 0x32, 0x89, 0x37, 0xb2, 0x3e,
+    0xb0, 0xfc, 0x6c, 0x7b, 0xd4, 0x8c, 0x1f, 0xf5, 0x10, 0xdb, 0x3a, 0xe0,
+    0x7a, 0x9b, 0x46, 0x9b, 0x79, 0x8f, 0xa3, 0xbc, 0x47, 0x84, 0xa4, 0x2e,
+    0xb7, 0xf6, 0xa9, 0xc0, 0x5d, 0xc5, 0xf1, 0xdf, 0x5e, 0x54, 0xa3, 0x6c,
+    0x9f, 0x9f, 0xdb, 0xf1, 0x16, 0x9d, 0x36, 0x4c, 0x6b, 0xf0, 0xc3, 0xc8,
+    0x29, 0x5a, 0x1a, 0x70, 0xd3, 0x66, 0xbe, 0x07, 0x71, 0x73, 0xc3, 0x34,
+    0xdf, 0x93, 0x02, 0xfe, 0x79, 0x2e, 0x78, 0xb4, 0x5f, 0x15, 0x67, 0x83,
+    0xcf, 0x09, 0xe6, 0xc7, 0x20, 0xe2, 0xe7, 0xe6, 0x14, 0xf0, 0x5c, 0x41,
+    0xe6, 0x74, 0x40, 0x3f, 0x4f, 0x1a, 0x7c, 0x3e, 0xc7, 0x00, 0xd3, 0x38,
+    0x0c, 0x7f, 0x6e, 0xf9, 0xd8, 0x9e, 0x54, 0x7f, 0xc7, 0x08, 0xd1, 0x36,
+    0x99, 0xcb, 0x81, 0x97, 0x4f, 0x90, 0x33, 0xb4, 0x80, 0x1f, 0x69, 0x57,
+    0xfd, 0x54, 0x0a, 0x5e, 0x58, 0x8e, 0x32, 0x9e, 0x70, 0xbc, 0xd7, 0xa2,
+    0x6f, 0x62, 0xfe, 0x43, 0xd0, 0x3e, 0xef, 0xc4, 0x61, 0x9e, 0xc7, 0x9d,
+    0xc0, 0xae, 0x5e, 0x85, 0x5d, 0xbd, 0x02, 0xbb, 0x3a, 0xbb, 0xa4, 0xeb,
+    0x11, 0x47, 0xa7, 0x0c, 0xea, 0xc8, 0x5d, 0xb4, 0xb5, 0x68, 0x08, 0x7e,
+    0xe5, 0x22, 0xdb, 0xb4, 0x71, 0x82, 0x0c, 0x42, 0xce, 0x61, 0x89, 0xb1,
+    0xb9, 0xc8, 0xbd, 0x93, 0xe6, 0x8f, 0x70, 0xff, 0xa5, 0x6c, 0xe3, 0x02,
+    0x3f, 0x9e, 0xe3, 0xb8, 0xa9, 0x53, 0x1a, 0xfe, 0xbc, 0x0f, 0xfa, 0xc5,
+    0xbe, 0x2a, 0xe3, 0xb3, 0x6d, 0x4f, 0x94, 0x75, 0xc7, 0x7e, 0x2a, 0x6d,
+    0xda, 0xe7, 0x3c, 0x26, 0xc7, 0x26, 0x3a, 0xe3, 0x01, 0x7e, 0xff, 0x9c,
+    0x9b, 0x47, 0xb0, 0x6d, 0x8d, 0x3a, 0x39, 0x1f, 0xc7, 0x30, 0xb6, 0x31,
+    0xa6, 0xff, 0x80, 0xd4, 0xf9, 0x0f, 0x9c, 0x5c, 0xe2, 0x20, 0xe6, 0xdd,
+    0xbe, 0x52, 0xa0, 0x83, 0x85, 0x39, 0xd4, 0xf0, 0x96, 0x78, 0x8e, 0x7d,
+    0x42, 0xcc, 0x17, 0x1f, 0xff, 0x0a, 0xbe, 0x0b, 0x36, 0xd6, 0xb8, 0x02,
+    0xbc, 0x30, 0xcf, 0xc8, 0x8b, 0xa2, 0x16, 0xee, 0xe1, 0x44, 0x34, 0x2d,
+    0x73, 0x39, 0xe0, 0xb9, 0xb6, 0xca, 0x6b, 0xa8, 0x58, 0x9f, 0x5b, 0x37,
+    0x6f, 0x42, 0xde, 0x69, 0x72, 0x9e, 0xc0, 0xbc, 0x7d, 0x00, 0xf9, 0xbd,
+    0x81, 0x3c, 0x81, 0xf9, 0x62, 0x19, 0xfe, 0xb3, 0x52, 0x6c, 0xbe, 0xe6,
+    0xf0, 0x25, 0xf3, 0x56, 0x49, 0xab, 0x71, 0x5c, 0x78, 0x55, 0xe6, 0x44,
+    0x3e, 0xdc, 0xb3, 0x1b, 0x9f, 0x2d, 0x3d, 0x31, 0x57, 0x84, 0xfe, 0x14,
+    0xda, 0xb5, 0x68, 0x27, 0xd1, 0xfa, 0x9d, 0xf6, 0x3d, 0xbd, 0x23, 0xe7,
+    0xda, 0xc1, 0x47, 0xd8, 0x87, 0xe9, 0x73, 0x46, 0x02, 0x7e, 0x43, 0xe6,
+    0x0d, 0xac, 0x57, 0xe3, 0xba, 0xc8, 0xeb, 0xa2, 0x63, 0x5b, 0xd2, 0x88,
+    0x9d, 0x4e, 0x6e, 0x80, 0xfe, 0x30, 0xfa, 0xad, 0x94, 0xc9, 0x69, 0x7a,
+    0x72, 0x2e, 0x86, 0xb6, 0x16, 0x2d, 0xa7, 0x71, 0x51, 0xdc, 0x01, 0xfb,
+    0xf3, 0x2a, 0xc8, 0x5f, 0x79, 0x55, 0x8f, 0x56, 0x63, 0x0d, 0xe8, 0xdb,
+    0x5c, 0x25, 0xe7, 0xa8, 0xce, 0x5a, 0x4c, 0x9b, 0x04, 0x0d, 0xad, 0x99,
+    0x1c, 0x87, 0xcf, 0x36, 0x99, 0x36, 0x09, 0x3a, 0x5a, 0x93, 0x1e, 0xf7,
+    0x01, 0x87, 0xe9, 0xfc, 0x3a, 0xcd, 0xd7, 0xea, 0xd7, 0xf2, 0x83, 0xcf,
+    0x38, 0x3f, 0x28, 0xe8, 0x5f, 0x46, 0xdf, 0x5f, 0xd0, 0xd7, 0xee, 0xb9,
+    0x39, 0x7f, 0xe0, 0xf3, 0xb0, 0xce, 0xe3, 0x4c, 0x73, 0x39, 0xe4, 0xa8,
+    0x39, 0x23, 0x89, 0x18, 0x3f, 0x89, 0xb3, 0x59, 0xc2, 0xdf, 0xe5, 0x8c,
+    0x0e, 0xe1, 0xc3, 0x79, 0x0d, 0x5d, 0xd0, 0x9f, 0x5d, 0x60, 0xdb, 0xd7,
+    0x9d, 0xf8, 0xcb, 0xeb, 0xfa, 0xe1, 0x37, 0x86, 0xb7, 0x6c, 0x98, 0x7e,
+    0x00, 0x3c, 0x21, 0xc7, 0x98, 0xe7, 0x58, 0xc7, 0xf8, 0x1a, 0x79, 0xe6,
+    0x9d, 0x9c, 0x6e, 0x7e, 0x6c, 0xcb, 0x64, 0x6e, 0x10, 0x76, 0x2d, 0xb2,
+    0x26, 0x91, 0x77, 0x49, 0xb9, 0xda, 0x76, 0x7f, 0x84, 0xf3, 0xf6, 0x6a,
+    0x3a, 0xd9, 0x42, 0xbe, 0xf4, 0x38, 0xad, 0xf5, 0x50, 0x30, 0x74, 0x0c,
+    0xdf, 0x71, 0xe2, 0xb5, 0x23, 0xd8, 0x73, 0x78, 0x4b, 0x9d, 0x38, 0x43,
+    0x14, 0x70, 0x27, 0xf5, 0xe7, 0x38, 0xe7, 0xb3, 0xed, 0x44, 0x84, 0xd6,
+    0x79, 0x1c, 0xba, 0xf8, 0x38, 0xe3, 0x53, 0x8d, 0x2a, 0x68, 0x98, 0xde,
+    0xa5, 0xe9, 0x04, 0x4d, 0xd7, 0xd7, 0xa4, 0xe9, 0x01, 0x4d, 0xea, 0x96,
+    0x69, 0x36, 0x08, 0x9a, 0xbe, 0x7b, 0x38, 0x17, 0xed, 0x90, 0xb9, 0x28,
+    0x70, 0x79, 0xdc, 0x3d, 0xa7, 0x6d, 0x67, 0x22, 0x82, 0xbe, 0x0e, 0xde,
+    0x1a, 0x67, 0x0c, 0xc2, 0x56, 0xc5, 0x39, 0xe1, 0x3f, 0x2a, 0x20, 0x9b,
+    0xce, 0x5b, 0xc4, 0xeb, 0xba, 0x45, 0xbc, 0xd4, 0x2d, 0xe2, 0x79, 0x39,
+    0x67, 0x83, 0xff, 0xab, 0x80, 0xdd, 0xfe, 0x1c, 0x7a, 0xc9, 0x71, 0xf5,
+    0x87, 0x74, 0x58, 0xdc, 0xd1, 0xf7, 0xc5, 0x1a, 0xb0, 0xd7, 0x7a, 0x0f,
+    0x31, 0x0e, 0xb5, 0x81, 0x5e, 0x87, 0xd7, 0xae, 0x65, 0xfa, 0x84, 0xa0,
+    0x77, 0x6d, 0x9d, 0xe5, 0xd6, 0x23, 0xe4, 0x05, 0xfd, 0x84, 0x87, 0x0e,
+    0xa0, 0xc6, 0xa4, 0xb6, 0xb8, 0xc8, 0x3f, 0xc8, 0xa7, 0x52, 0x10, 0xf6,
+    0x5c, 0x51, 0xe0, 0x1b, 0x18, 0xbf, 0xf3, 0x6b, 0xe2, 0x77, 0x7d, 0x4d,
+    0xfc, 0xd4, 0xd7, 0xc4, 0xe7, 0x3b, 0xcc, 0x16, 0xe8, 0x17, 0xad, 0x67,
+    0xba, 0x93, 0x92, 0x8e, 0xef, 0xdc, 0x77, 0xb3, 0x9e, 0x8c, 0x17, 0xe8,
+    0xd6, 0xad, 0xe0, 0x4f, 0x15, 0xe8, 0xd5, 0xad, 0xe0, 0x3f, 0x07, 0xfc,
+    0x9e, 0xaf, 0x81, 0x7f, 0x02, 0xf8, 0xdf, 0xbf, 0x05, 0xfc, 0x6f, 0x3a,
+    0x77, 0x5d, 0xad, 0xaa, 0x26, 0xcb, 0xa1, 0x42, 0xd4, 0x18, 0x35, 0xc2,
+    0x47, 0xbc, 0x76, 0x4f, 0xb2, 0xbe, 0xda, 0xc3, 0xe3, 0x34, 0xef, 0xce,
+    0x2d, 0x8d, 0x2b, 0xcb, 0x8f, 0xb3, 0xae, 0xf3, 0x38, 0xf3, 0x90, 0x84,
+    0xde, 0xbd, 0x0d, 0x3e, 0x28, 0x5c, 0x24, 0x6c, 0x06, 0x78, 0xf3, 0x6e,
+    0x5c, 0x63, 0x1c, 0xde, 0x17, 0xfe, 0x02, 0x79, 0xc4, 0xd9, 0x25, 0x3f,
+    0x64, 0x38, 0xf1, 0x61, 0x6c, 0x8b, 0xcc, 0xf1, 0xfd, 0xf0, 0x31, 0xec,
+    0x5b, 0x50, 0x98, 0x2c, 0xac, 0x82, 0x3f, 0x0d, 0x4c, 0x71, 0x6d, 0xa7,
+    0xc3, 0x27, 0xaa, 0xe2, 0x9c, 0x1f, 0xdd, 0x23, 0xe3, 0x69, 0x27, 0x75,
+    0xcc, 0xf2, 0x18, 0xec, 0x67, 0x96, 0xfd, 0x58, 0x05, 0xfc, 0x62, 0x0c,
+    0xfe, 0x46, 0x47, 0x7b, 0x82, 0xfd, 0x0e, 0x5a, 0xf6, 0xcf, 0x3c, 0xb7,
+    0xa8, 0x27, 0x73, 0x57, 0x6d, 0xa9, 0xdb, 0x2f, 0x38, 0x73, 0x63, 0xe0,
+    0x5b, 0x45, 0x1e, 0x91, 0x42, 0x7f, 0x17, 0x71, 0xfd, 0x7f, 0x6e, 0x86,
+    0x71, 0xd9, 0x17, 0x9b, 0x0e, 0x1d, 0x78, 0x01, 0xaf, 0x67, 0x66, 0x42,
+    0x18, 0x2b, 0xcc, 0x35, 0xd9, 0xff, 0xb1, 0x0f, 0xf6, 0xea, 0xea, 0xb4,
+    0xd7, 0xf1, 0xb1, 0x6e, 0xfc, 0xf9, 0x0c, 0xfc, 0xbd, 0xc0, 0x31, 0x47,
+    0x57, 0xe7, 0xbd, 0x05, 0xfe, 0xd7, 0x1b, 0x95, 0xf1, 0xc3, 0x03, 0x9d,
+    0xfb, 0x0d, 0xe2, 0xca, 0x55, 0xfb, 0x84, 0xe0, 0xe7, 0x37, 0x05, 0x31,
+    0xc6, 0x14, 0x38, 0x7a, 0x34, 0xbf, 0x0c, 0x7d, 0x4b, 0xf4, 0x66, 0xff,
+    0xcd, 0xf2, 0x62, 0x59, 0xb1, 0xcc, 0xfe, 0x01, 0xb5, 0x37, 0xcb, 0xec,
+    0xb7, 0xab, 0x8b, 0x44, 0x3c, 0xa5, 0xc9, 0x93, 0x2d, 0x5c, 0x5b, 0x37,
+    0x63, 0x7c, 0x6c, 0x4b, 0xff, 0xdc, 0x5b, 0x68, 0xd9, 0x47, 0xbb, 0x35,
+    0xf7, 0xe7, 0xc4, 0x35, 0xa1, 0xb4, 0x83, 0x22, 0xf0, 0x64, 0xdd, 0xd0,
+    0xff, 0x9c, 0x6b, 0x79, 0xf8, 0xfa, 0x96, 0x52, 0x79, 0x7f, 0x7f, 0xe2,
+    0xd4, 0xf1, 0x7c, 0xdf, 0xb5, 0xf0, 0x0f, 0x7d, 0xf0, 0x01, 0x06, 0x5a,
+    0x64, 0x6c, 0xf3, 0x26, 0xda, 0x41, 0xb4, 0x9c, 0x8f, 0x0c, 0xa3, 0x6d,
+    0x44, 0x9b, 0x45, 0x8b, 0xfc, 0x39, 0x37, 0x86, 0x96, 0xdf, 0x6a, 0x20,
+    0xd3, 0x79, 0xae, 0xb9, 0x43, 0x68, 0x35, 0xf8, 0x16, 0x7b, 0x86, 0xf3,
+    0x8d, 0x7e, 0xe2, 0x3d, 0xff, 0xe2, 0xba, 0xb5, 0x59, 0x47, 0x38, 0xe7,
+    0x49, 0xe4, 0xfc, 0x0e, 0x2e, 0xe3, 0xa0, 0x12, 0x9a, 0x3e, 0x67, 0xab,
+    0x82, 0x06, 0x15, 0xc1, 0xfc, 0x9b, 0xd0, 0x27, 0xdf, 0x0d, 0x3a, 0x44,
+    0x7a, 0xdc, 0x24, 0x51, 0xa7, 0x1f, 0x16, 0xf1, 0x4b, 0x93, 0x35, 0x3e,
+    0x72, 0x8a, 0x04, 0xd7, 0xf1, 0xb9, 0xdf, 0x3b, 0xb5, 0xbb, 0x7c, 0x7b,
+    0x89, 0x9b, 0xc9, 0xb8, 0x26, 0xf2, 0x81, 0xad, 0xdb, 0x27, 0x97, 0xf2,
+    0x81, 0xff, 0x00, 0x2f, 0x01, 0x2b, 0xe6, 0x49, 0x26, 0x91, 0xaf, 0x62,
+    0x1f, 0xee, 0x53, 0xb7, 0x94, 0x3d, 0xcb, 0x95, 0xe5, 0x3f, 0xbc, 0x45,
+    0xe6, 0x47, 0x32, 0xb7, 0xf1, 0x88, 0x35, 0x2e, 0xb4, 0xa7, 0xc5, 0x1a,
+    0xd8, 0x67, 0x81, 0x73, 0x2d, 0x1f, 0xfc, 0x8f, 0x17, 0xf0, 0x0f, 0x9c,
+    0x5c, 0x44, 0x11, 0x6f, 0x50, 0x5a, 0x14, 0xb2, 0x5b, 0xf8, 0x25, 0xee,
+    0xf3, 0x03, 0xe7, 0x3e, 0x0b, 0x73, 0xf2, 0x20, 0x95, 0x9a, 0x65, 0x54,
+    0xb2, 0x54, 0x6f, 0x72, 0x5d, 0xe9, 0xd6, 0x98, 0x95, 0x54, 0x66, 0x66,
+    0xa9, 0x1c, 0x29, 0xf5, 0x5c, 0x43, 0x84, 0x2a, 0xcd, 0x20, 0xad, 0x30,
+    0x47, 0xa9, 0x0a, 0x6b, 0xfa, 0xc1, 0xe7, 0x1a, 0x73, 0x37, 0xe9, 0x66,
+    0x86, 0xaa, 0xcd, 0x4d, 0x54, 0x03, 0x19, 0x1c, 0xb3, 0x4a, 0x69, 0xbb,
+    0x5e, 0x4f, 0x89, 0x50, 0x2f, 0xc9, 0xf7, 0x8d, 0x3d, 0xd0, 0x75, 0xae,
+    0xd9, 0xbe, 0x47, 0xdb, 0x84, 0x0c, 0x1e, 0x12, 0x35, 0xcd, 0x33, 0x79,
+    0x05, 0xb8, 0x95, 0x74, 0xbf, 0x7e, 0x10, 0xb8, 0x25, 0x0e, 0x6e, 0x29,
+    0xa5, 0x44, 0xdb, 0x45, 0xbb, 0x04, 0x6e, 0x9d, 0xc0, 0x3d, 0x9f, 0x8b,
+    0xd2, 0x03, 0xba, 0xaf, 0xdd, 0xd3, 0xb0, 0x95, 0x1e, 0x76, 0xde, 0x40,
+    0x7e, 0x85, 0x5c, 0xe6, 0x9f, 0x90, 0xcb, 0xe4, 0x8f, 0x57, 0xd1, 0xb1,
+    0x86, 0x2a, 0x1a, 0x8c, 0x94, 0x91, 0x6f, 0xe3, 0x43, 0x54, 0x1c, 0x8c,
+    0x90, 0x37, 0xc8, 0x35, 0x6a, 0x79, 0xc4, 0xa7, 0xa8, 0x6b, 0x3c, 0x74,
+    0x59, 0xc8, 0x7e, 0x6b, 0x9e, 0x6b, 0xfd, 0xb0, 0x7f, 0x02, 0x69, 0xfb,
+    0x8e, 0x3c, 0xb7, 0xfc, 0x9e, 0x22, 0x6b, 0xd9, 0xb8, 0xa8, 0x67, 0x20,
+    0x3f, 0x14, 0x15, 0x87, 0xc1, 0x17, 0xbf, 0x7f, 0x24, 0xac, 0x2b, 0x98,
+    0xe7, 0x39, 0x95, 0x4e, 0x9a, 0x7f, 0x8f, 0xda, 0x28, 0x10, 0xe1, 0x9c,
+    0xfe, 0x3d, 0xe0, 0xde, 0xa7, 0xf1, 0xbe, 0x44, 0xcf, 0xe6, 0xeb, 0x90,
+    0x3b, 0x32, 0x7e, 0x15, 0x1d, 0x6f, 0x58, 0x4b, 0xdb, 0x50, 0x2f, 0x5c,
+    0x20, 0xdb, 0x4e, 0xc3, 0x17, 0x10, 0xf1, 0xfb, 0x20, 0xea, 0xe9, 0x7c,
+    0x4d, 0x84, 0x17, 0x3f, 0xb5, 0xf0, 0x85, 0xbd, 0xe8, 0xe3, 0x5a, 0x4d,
+    0xbe, 0x6b, 0xf4, 0x63, 0xaf, 0x89, 0x3c, 0xbf, 0x9b, 0xca, 0xfd, 0xfa,
+    0xad, 0x2f, 0x51, 0xe3, 0xf2, 0xc9, 0xf8, 0x4d, 0x84, 0xf7, 0xe4, 0x73,
+    0xf3, 0x7e, 0xcc, 0x77, 0x99, 0xd0, 0xbd, 0xe5, 0x79, 0x3b, 0x26, 0x78,
+    0x23, 0x45, 0x9e, 0x61, 0xda, 0xc1, 0x39, 0xe6, 0xac, 0x3f, 0x69, 0xfe,
+    0x5c, 0xd4, 0x75, 0x27, 0xcd, 0x1b, 0x6b, 0xe6, 0x80, 0x90, 0xb4, 0x95,
+    0x77, 0xf3, 0xfb, 0x0b, 0x57, 0xdf, 0x6a, 0x30, 0x95, 0x93, 0x0b, 0x21,
+    0xe5, 0xd4, 0x42, 0x20, 0x64, 0x91, 0xa9, 0x9c, 0x82, 0xbf, 0x39, 0xd1,
+    0x50, 0xab, 0x9c, 0x5b, 0x68, 0x54, 0x4e, 0x2f, 0xac, 0xe6, 0xb7, 0x22,
+    0xcc, 0x3d, 0xcf, 0x6f, 0x2c, 0x72, 0x7c, 0xe9, 0xbd, 0xd2, 0x50, 0xae,
+    0xbd, 0xa9, 0x3e, 0xef, 0xe8, 0x5d, 0xa1, 0x8e, 0xd9, 0xb6, 0x1a, 0x35,
+    0xf5, 0x09, 0xd4, 0x58, 0x31, 0x9f, 0xc1, 0xfa, 0x08, 0x29, 0xea, 0xdc,
+    0x16, 0x8c, 0xd3, 0xe7, 0xb0, 0xa3, 0x0d, 0x1a, 0xee, 0x2b, 0x6d, 0x2e,
+    0x8d, 0xa1, 0x76, 0xa2, 0x80, 0x46, 0x57, 0x0a, 0xc7, 0x98, 0x6b, 0xd4,
+    0xd6, 0x57, 0x31, 0xd6, 0x80, 0xf6, 0xfc, 0x6a, 0x4d, 0xf0, 0x50, 0x07,
+    0x19, 0x7d, 0x24, 0x78, 0x38, 0xbb, 0x50, 0x4e, 0x9c, 0x2b, 0xa2, 0x4e,
+    0x34, 0xfe, 0x0a, 0xf7, 0x71, 0x2c, 0x52, 0x0b, 0x3d, 0x66, 0x1b, 0x33,
+    0xc1, 0x9f, 0x01, 0xbd, 0xe6, 0xdc, 0x31, 0x70, 0x74, 0x91, 0xe8, 0x27,
+    0x1a, 0xd5, 0xf0, 0x7b, 0x07, 0xea, 0x48, 0x5d, 0x69, 0x9e, 0x2e, 0x11,
+    0xef, 0x0f, 0x3e, 0x53, 0xf3, 0xf7, 0x60, 0x54, 0xa5, 0x06, 0x3f, 0xbc,
+    0xa6, 0xfe, 0x20, 0x99, 0x96, 0x47, 0x0d, 0xce, 0xc6, 0x55, 0xdb, 0xd6,
+    0x9a, 0x8b, 0x48, 0xe6, 0xa8, 0x67, 0x9c, 0xf8, 0x72, 0x09, 0xf7, 0xc6,
+    0x7a, 0x04, 0xfa, 0x79, 0x79, 0x4e, 0x55, 0x5d, 0x09, 0x6a, 0xec, 0x35,
+    0x63, 0x60, 0x4d, 0xaf, 0xb3, 0xe6, 0x45, 0xe0, 0x68, 0xfe, 0xb1, 0x65,
+    0xd7, 0x85, 0x4e, 0xd4, 0xb8, 0x6b, 0xc2, 0x47, 0xaa, 0x72, 0xcd, 0x84,
+    0x09, 0xfa, 0x79, 0xb1, 0x0e, 0xec, 0x07, 0x67, 0xb8, 0x29, 0x86, 0x85,
+    0x88, 0xeb, 0x69, 0x7e, 0x53, 0x8b, 0x23, 0x0f, 0x3c, 0x1d, 0x09, 0x40,
+    0x46, 0xfc, 0x86, 0xcf, 0xb9, 0x2d, 0xfb, 0xe8, 0x72, 0xff, 0xbb, 0xc4,
+    0x67, 0x65, 0x99, 0xb8, 0xb9, 0x73, 0xc0, 0x5a, 0x24, 0x7e, 0x8b, 0xd4,
+    0xe8, 0x54, 0x84, 0x71, 0xcb, 0xfd, 0xc5, 0x28, 0x6a, 0x12, 0x73, 0x81,
+    0xa9, 0xbc, 0xa0, 0x85, 0x4e, 0x45, 0xca, 0xfd, 0x45, 0x6a, 0x0b, 0x8f,
+    0xc5, 0xd8, 0x7f, 0xd4, 0x35, 0x97, 0xc7, 0x3c, 0xa8, 0x9d, 0x3b, 0x45,
+    0xbf, 0x2c, 0x56, 0xa2, 0xfa, 0x97, 0xe0, 0x22, 0x55, 0xbc, 0xad, 0x85,
+    0x00, 0xb7, 0x16, 0xab, 0x65, 0x21, 0x8f, 0x1a, 0xa2, 0x6d, 0x73, 0xad,
+    0x98, 0x47, 0x9c, 0x44, 0xdd, 0xb1, 0xa1, 0x99, 0x6b, 0x66, 0xae, 0xd7,
+    0x81, 0xa3, 0xbe, 0x5f, 0xce, 0xb9, 0x4f, 0xb1, 0x19, 0xa3, 0xa6, 0xe6,
+    0x52, 0x32, 0x6a, 0x6a, 0x45, 0x6d, 0x7f, 0x76, 0x26, 0x60, 0xc4, 0x54,
+    0x9e, 0xe7, 0xf3, 0x89, 0x77, 0x70, 0xd8, 0x0c, 0x70, 0xbd, 0xec, 0x5f,
+    0x97, 0x8b, 0xdb, 0xfc, 0x06, 0x28, 0x63, 0xf6, 0xf5, 0x67, 0x33, 0x69,
+    0x57, 0x8e, 0xdf, 0xb7, 0x58, 0xe6, 0x15, 0xf0, 0x47, 0x8c, 0xc7, 0x6f,
+    0x1a, 0x5c, 0xdb, 0x85, 0x50, 0x33, 0x37, 0x22, 0x4f, 0x28, 0x81, 0x7e,
+    0x46, 0x50, 0x03, 0xdf, 0xae, 0x57, 0xab, 0x5f, 0x40, 0xce, 0xaa, 0xbf,
+    0x66, 0x84, 0xf1, 0x6e, 0xcc, 0x11, 0xfc, 0xc0, 0xaf, 0x05, 0xbe, 0x01,
+    0x5c, 0xd0, 0x08, 0x5e, 0x34, 0xe7, 0x77, 0x00, 0xfe, 0x4d, 0xa2, 0x08,
+    0xe7, 0x12, 0x7e, 0x17, 0xfe, 0x3f, 0x8b, 0x1a, 0xb3, 0x0c, 0xba, 0xc9,
+    0x3a, 0xff, 0xe7, 0xce, 0xfb, 0x74, 0xb1, 0xd3, 0x67, 0xdf, 0xcb, 0x7e,
+    0xb7, 0xb6, 0x7d, 0xf2, 0xba, 0xfa, 0xb0, 0xf0, 0x77, 0x88, 0x7e, 0x67,
+    0x5c, 0xa7, 0x87, 0x73, 0xd2, 0x6e, 0x8c, 0x65, 0xe7, 0xfd, 0x7f, 0x64,
+    0xde, 0xf8, 0x03, 0xf3, 0x2c, 0x1f, 0xc6, 0xe1, 0xdf, 0x4e, 0x4c, 0x07,
+    0x87, 0xf5, 0x4c, 0xca, 0xd4, 0xb8, 0x2e, 0xa6, 0xf7, 0x4b, 0xfb, 0x86,
+    0xef, 0x7f, 0x38, 0x87, 0x56, 0xc8, 0x85, 0x71, 0x0c, 0x07, 0x87, 0x63,
+    0xbe, 0xcf, 0x91, 0x37, 0xe3, 0x06, 0x2c, 0x4b, 0xbc, 0xdb, 0x71, 0xbe,
+    0x64, 0xd2, 0x86, 0xe9, 0xd2, 0xcb, 0x31, 0xf1, 0x6e, 0x87, 0x28, 0x38,
+    0xf1, 0xa5, 0x6d, 0xf9, 0xdc, 0xb8, 0x5a, 0x18, 0x33, 0xdd, 0x37, 0xf5,
+    0x8f, 0xc4, 0x9e, 0xaf, 0x2c, 0x1c, 0xa5, 0x9a, 0xa8, 0xf5, 0xb3, 0xee,
+    0x6f, 0x19, 0xb0, 0x53, 0x9f, 0x63, 0xa7, 0xbc, 0x0f, 0xaf, 0xad, 0xd0,
+    0x83, 0xf5, 0xe1, 0xa9, 0x95, 0x6a, 0x40, 0x8f, 0xa9, 0xe5, 0xb8, 0x33,
+    0xde, 0x87, 0xdf, 0x72, 0x7f, 0x0a, 0x39, 0xd7, 0x59, 0xd5, 0xea, 0xef,
+    0x6d, 0x5a, 0xc5, 0xf3, 0xd2, 0x4e, 0x5e, 0x05, 0xbf, 0xaf, 0x5c, 0xb7,
+    0x5f, 0xa8, 0x20, 0x77, 0x62, 0x59, 0x08, 0x5e, 0xb1, 0xee, 0xdf, 0x82,
+    0xf7, 0x4f, 0x3d, 0x9a, 0x69, 0xdb, 0x7a, 0xfd, 0x15, 0xac, 0x71, 0xd3,
+    0xdb, 0xc1, 0x72, 0x7f, 0xd6, 0x9a, 0xe8, 0xec, 0xe6, 0xbb, 0x1b, 0x02,
+    0xb1, 0x45, 0x0a, 0x74, 0x5a, 0xb4, 0x85, 0x2e, 0xf8, 0x02, 0xfe, 0x3c,
+    0x85, 0xf5, 0x53, 0xf4, 0x6d, 0xe8, 0x83, 0xa1, 0x9f, 0xcf, 0x7a, 0xd9,
+    0xc2, 0x61, 0x8d, 0x75, 0x86, 0x4a, 0xc5, 0xc6, 0x8f, 0x49, 0xf3, 0x77,
+    0x90, 0x16, 0xdb, 0x2a, 0xea, 0x1f, 0xad, 0x73, 0xbb, 0x78, 0x15, 0x58,
+    0x47, 0x19, 0xc4, 0x0a, 0x0b, 0xbe, 0xa9, 0xa4, 0x49, 0x6d, 0x2c, 0xa5,
+    0x9a, 0x14, 0x98, 0xda, 0xcd, 0x05, 0x50, 0x39, 0x6a, 0xd0, 0x01, 0x85,
+    0xe3, 0x84, 0x1a, 0xd9, 0x76, 0x30, 0xbc, 0xfb, 0xd4, 0x12, 0x6e, 0x39,
+    0xf5, 0x55, 0xd7, 0xf9, 0x4f, 0xc1, 0x8e, 0x5e, 0xa4, 0xb0, 0xff, 0x45,
+    0xe8, 0x97, 0x88, 0x5f, 0xc1, 0x30, 0xc6, 0x34, 0xc4, 0x4f, 0x9e, 0xbb,
+    0x8a, 0x3e, 0xcf, 0x33, 0x6c, 0xdb, 0x1b, 0x9b, 0x5c, 0x5a, 0x11, 0x83,
+    0x52, 0xfc, 0x34, 0x56, 0x46, 0xc1, 0xce, 0xed, 0x4a, 0x0d, 0xec, 0x55,
+    0x6d, 0x7d, 0x37, 0x1b, 0x4e, 0x35, 0x28, 0x2e, 0x4e, 0x09, 0xc5, 0xaa,
+    0x03, 0x9d, 0x21, 0x25, 0x1c, 0x0b, 0x71, 0x2c, 0xb9, 0xcd, 0xb6, 0x7f,
+    0x6d, 0x86, 0x5b, 0x1b, 0x94, 0xab, 0xf6, 0x3b, 0x66, 0x79, 0xe8, 0x5d,
+    0xa7, 0x86, 0x39, 0x26, 0x7c, 0x84, 0xfb, 0x46, 0x13, 0xd6, 0x4f, 0x23,
+    0xea, 0xc1, 0xa7, 0xc7, 0x3e, 0xcd, 0x6e, 0x07, 0x8d, 0x18, 0x0b, 0xfd,
+    0x1b, 0xf8, 0xc9, 0xfb, 0x02, 0xe2, 0x5d, 0xed, 0x08, 0xc5, 0x9c, 0xfa,
+    0xdb, 0x7d, 0x0f, 0x91, 0xb6, 0xb1, 0xe8, 0x33, 0x74, 0xf5, 0x20, 0x8f,
+    0xad, 0xa3, 0xad, 0xd8, 0x7f, 0x91, 0x6a, 0xe0, 0x4f, 0x78, 0xec, 0x49,
+    0x27, 0x46, 0xd4, 0xe1, 0x1c, 0x6a, 0x8b, 0x57, 0xc8, 0x88, 0x73, 0x98,
+    0x75, 0x74, 0x4a, 0xe0, 0xa9, 0x26, 0xe4, 0x05, 0x59, 0xe9, 0x7d, 0x58,
+    0x28, 0x53, 0x41, 0x41, 0x63, 0x52, 0xca, 0x2b, 0xb5, 0xf7, 0x60, 0xb8,
+    0xef, 0x19, 0x72, 0xf1, 0xbc, 0x48, 0x22, 0x79, 0xaf, 0x80, 0x31, 0x05,
+    0x9e, 0xa6, 0x04, 0x4f, 0xa8, 0xfb, 0x83, 0xe1, 0xd0, 0x33, 0xf4, 0x22,
+    0xc9, 0xdf, 0xac, 0xea, 0x8c, 0x67, 0x1c, 0x39, 0x1d, 0x91, 0x3c, 0x14,
+    0xde, 0x43, 0xe7, 0x90, 0x23, 0x27, 0xbe, 0x07, 0x96, 0x93, 0xc4, 0x41,
+    0xae, 0x72, 0x83, 0x9c, 0x3a, 0x82, 0x52, 0x4e, 0xdf, 0x0e, 0x96, 0x87,
+    0xb6, 0x29, 0xae, 0x9c, 0xdc, 0xb3, 0xb2, 0x1c, 0xdc, 0x38, 0x29, 0x6d,
+    0x54, 0x35, 0xeb, 0xf4, 0x4e, 0x2a, 0xf6, 0x6f, 0x25, 0xad, 0xb5, 0x44,
+    0x09, 0xb6, 0xee, 0xa5, 0xe2, 0x54, 0x07, 0xa9, 0xb5, 0x25, 0xe0, 0x3d,
+    0xa1, 0x5c, 0x52, 0xfa, 0xa8, 0x18, 0x35, 0xaf, 0x6d, 0xff, 0x57, 0x44,
+    0x0b, 0x15, 0x29, 0xc1, 0x10, 0xe6, 0xc6, 0x8a, 0xa8, 0x66, 0x10, 0xbc,
+    0x75, 0x72, 0x72, 0x54, 0x0a, 0xde, 0xee, 0x90, 0x67, 0xee, 0x7b, 0xf9,
+    0x60, 0x38, 0xdb, 0xa8, 0xb8, 0x74, 0x65, 0xb4, 0x58, 0xad, 0x45, 0x8a,
+    0x95, 0x40, 0x67, 0x83, 0xc2, 0x77, 0x0b, 0x1f, 0x04, 0xfe, 0x8e, 0x05,
+    0xc3, 0xa9, 0x46, 0x05, 0xb1, 0x53, 0xc8, 0xe3, 0x2a, 0xfa, 0x3c, 0x5f,
+    0xd7, 0xd9, 0xa8, 0xd8, 0xf6, 0xc9, 0xc8, 0x3a, 0xaa, 0x13, 0xb4, 0x35,
+    0x7d, 0xe2, 0xe1, 0x17, 0xc9, 0x70, 0x25, 0x74, 0xf0, 0xa4, 0xc2, 0xb2,
+    0x50, 0x77, 0xff, 0xe4, 0x60, 0x78, 0xf0, 0x65, 0x72, 0x71, 0xca, 0x28,
+    0x2f, 0x65, 0x1a, 0x3a, 0x0d, 0x1d, 0x3c, 0xed, 0xe8, 0xe0, 0x33, 0xd0,
+    0xc1, 0x97, 0x11, 0x9b, 0x65, 0x0e, 0x77, 0x15, 0x7d, 0x9e, 0x97, 0x72,
+    0x88, 0x2b, 0x75, 0xa1, 0x97, 0x69, 0x0d, 0xee, 0x58, 0x47, 0x9c, 0x08,
+    0x77, 0x9e, 0x06, 0x64, 0xdc, 0xc6, 0xfa, 0x18, 0xa3, 0xd3, 0xba, 0x2b,
+    0x1f, 0x57, 0x36, 0x5a, 0xac, 0x13, 0xba, 0xdb, 0x0f, 0x79, 0x0c, 0x88,
+    0xbb, 0x87, 0x6e, 0x28, 0x2c, 0xf3, 0x62, 0xd4, 0xd0, 0x1a, 0xe4, 0xc0,
+    0xba, 0x00, 0xfb, 0x80, 0x1d, 0x25, 0x49, 0xcd, 0x14, 0x49, 0x3d, 0x60,
+    0x9e, 0x7d, 0xe0, 0x59, 0x9f, 0x50, 0xc4, 0x9b, 0xbd, 0xc1, 0x7a, 0x90,
+    0x5c, 0xa2, 0x2d, 0x73, 0xf5, 0x00, 0xc2, 0x0b, 0xa7, 0x3a, 0x49, 0xca,
+    0x24, 0x0d, 0x99, 0x24, 0xe9, 0x9a, 0x4c, 0xd2, 0x41, 0x9e, 0xaf, 0x13,
+    0x72, 0x67, 0x99, 0x38, 0x3a, 0x59, 0xa8, 0x67, 0xa1, 0xa7, 0x15, 0xfe,
+    0x8d, 0x49, 0xea, 0xd9, 0x4b, 0xe4, 0xe2, 0x2c, 0xad, 0xcf, 0x76, 0xa9,
+    0xbf, 0x28, 0xfc, 0xbe, 0x6d, 0x67, 0x82, 0x61, 0xfd, 0x25, 0x5e, 0xdf,
+    0x91, 0x49, 0x46, 0xd8, 0x25, 0xbf, 0x63, 0xd4, 0x85, 0x5e, 0xa2, 0x2e,
+    0xf8, 0x3f, 0xe1, 0x0f, 0x0c, 0x4d, 0x09, 0x47, 0x8e, 0xd0, 0xdf, 0xd9,
+    0x8b, 0x02, 0x8f, 0xf3, 0x88, 0x37, 0x39, 0x9f, 0xf3, 0x33, 0x4d, 0x7f,
+    0xf0, 0x21, 0x86, 0xa1, 0xbf, 0xcd, 0x98, 0x8b, 0x3c, 0x2e, 0x7f, 0x1e,
+    0xbb, 0x9f, 0x75, 0x68, 0xa7, 0x84, 0xf7, 0xf3, 0xbe, 0x77, 0x4a, 0xf8,
+    0x08, 0xbe, 0xbf, 0x0e, 0x4b, 0xf8, 0x67, 0x1c, 0x4b, 0x1a, 0x24, 0xfc,
+    0x1e, 0xab, 0xcc, 0x37, 0x24, 0xdc, 0x88, 0xec, 0x77, 0x6a, 0xa5, 0x84,
+    0x77, 0xab, 0x44, 0x6f, 0x97, 0x3a, 0x3f, 0xb9, 0x41, 0x91, 0x3f, 0xd6,
+    0x24, 0xec, 0x45, 0x12, 0x14, 0xf3, 0x48, 0xb8, 0xaf, 0x94, 0xe8, 0xa0,
+    0x2a, 0xe1, 0x45, 0x64, 0x28, 0xad, 0x8a, 0x84, 0xad, 0x20, 0xd1, 0x2f,
+    0x9c, 0x9f, 0xeb, 0x98, 0xa1, 0x9d, 0x2e, 0x8c, 0x8d, 0x1b, 0x5c, 0xf8,
+    0x5f, 0x89, 0xd6, 0xba, 0xf0, 0x79, 0x85, 0x2a, 0x5d, 0x78, 0xd2, 0x03,
+    0x19, 0x55, 0x53, 0xb7, 0x2a, 0x37, 0xf3, 0x38, 0xb0, 0xf1, 0x02, 0xc3,
+    0x0e, 0xce, 0xfb, 0x5e, 0xc0, 0x95, 0x74, 0xb1, 0x8a, 0xc4, 0x2f, 0x0d,
+    0x2a, 0x60, 0xf1, 0x7f, 0x0d, 0xf1, 0x2a, 0xc0, 0xf2, 0x67, 0x5d, 0x7a,
+    0xae, 0x1a, 0x3e, 0xc5, 0x47, 0x5f, 0xae, 0x00, 0x9f, 0xbf, 0x5b, 0xc5,
+    0x31, 0x47, 0xf2, 0x36, 0xb9, 0x1e, 0xb0, 0xc4, 0xc9, 0x07, 0xeb, 0x01,
+    0x97, 0xd2, 0xeb, 0xc5, 0xe0, 0xff, 0x9d, 0x4d, 0x80, 0xc5, 0xbf, 0x40,
+    0xd0, 0x85, 0xbd, 0x77, 0x02, 0x2e, 0xa6, 0x2f, 0xca, 0xb9, 0xe8, 0x68,
+    0x17, 0x30, 0xff, 0x75, 0x74, 0x77, 0x3f, 0xd0, 0x6d, 0x74, 0xa4, 0x12,
+    0x46, 0xe4, 0x50, 0xf0, 0x50, 0x19, 0xf5, 0x0c, 0xed, 0x1b, 0x18, 0x31,
+    0x86, 0xf6, 0x0f, 0x8d, 0x95, 0x51, 0xaa, 0xab, 0xcb, 0x81, 0x90, 0x81,
+    0x77, 0xdd, 0xbf, 0x04, 0x3f, 0x98, 0xec, 0xbe, 0x6f, 0x87, 0xd3, 0xbb,
+    0x06, 0x1b, 0x07, 0x1e, 0xc3, 0xe4, 0xc0, 0xc8, 0xc8, 0x81, 0x11, 0x23,
+    0x38, 0x6a, 0x04, 0x33, 0x94, 0xc9, 0x00, 0xca, 0x18, 0xed, 0xed, 0xf7,
+    0xa2, 0xc1, 0xdc, 0xc8, 0xe3, 0xfb, 0x8d, 0x47, 0x86, 0x46, 0xf6, 0xfd,
+    0xd9, 0x9e, 0x91, 0x01, 0x00, 0xfb, 0x87, 0x46, 0x07, 0x07, 0x78, 0x7c,
+    0x68, 0xdf, 0x9e, 0xbd, 0x03, 0xc6, 0xc0, 0xfe, 0xb1, 0x91, 0x27, 0x8c,
+    0xec, 0x81, 0xa1, 0xfd, 0x63, 0x6d, 0x0e, 0x33, 0xac, 0x03, 0x0e, 0x90,
+    0xce, 0xee, 0xc9, 0xa6, 0xb1, 0x1c, 0x77, 0xd2, 0xd9, 0x7d, 0x05, 0x70,
+    0x3a, 0x3d, 0xd2, 0x26, 0x71, 0x82, 0xa3, 0x21, 0x46, 0xdf, 0x68, 0xb4,
+    0x49, 0xaa, 0xe0, 0xa8, 0x58, 0x68, 0x77, 0x9b, 0xf1, 0x83, 0x3d, 0xc3,
+    0x8f, 0x0f, 0xb4, 0x33, 0x6c, 0x3c, 0x6a, 0xb4, 0x4b, 0x6e, 0x88, 0x46,
+    0x07, 0xc6, 0x8c, 0xf4, 0xf0, 0x63, 0xc6, 0x50, 0xc6, 0x10, 0x6c, 0x8b,
+    0x7d, 0x64, 0x3f, 0x98, 0x09, 0x05, 0x33, 0x1b, 0xdb, 0x8c, 0xbd, 0x40,
+    0xc9, 0x0e, 0x0f, 0x5f, 0x9b, 0x47, 0xa7, 0x77, 0x64, 0xcf, 0xd8, 0x80,
+    0x58, 0xa5, 0xd1, 0x28, 0x00, 0xd3, 0x38, 0xad, 0x5c, 0x3a, 0x9d, 0xcd,
+    0x8e, 0x8e, 0x88, 0x23, 0xb4, 0x2d, 0x9d, 0x43, 0x48, 0x04, 0x10, 0x64,
+    0x92, 0x15, 0x2b, 0x0e, 0x1f, 0x48, 0x3f, 0xe6, 0x1c, 0x33, 0xf1, 0x50,
+    0x17, 0x28, 0x1d, 0xf8, 0x1a, 0x48, 0xf7, 0x15, 0xc0, 0xa0, 0xeb, 0x1d,
+    0xda, 0xbf, 0xff, 0x40, 0x6f, 0x76, 0xf0, 0x89, 0x5e, 0x21, 0xee, 0x3b,
+    0xee, 0x08, 0x18, 0x4d, 0x4d, 0x6d, 0x86, 0x11, 0xdc, 0x8d, 0xf9, 0x1d,
+    0xdd, 0x11, 0xc3, 0x15, 0xdb, 0x8e, 0xee, 0xa6, 0x02, 0xb8, 0xb9, 0x00,
+    0xde, 0xbc, 0x04, 0x7f, 0x77, 0x17, 0x76, 0x2a, 0x90, 0xf3, 0xbe, 0x91,
+    0xa6, 0xa5, 0xcd, 0xf6, 0x8d, 0x34, 0x17, 0xc0, 0x9b, 0x0b, 0xe0, 0xa6,
+    0xc8, 0x35, 0x8e, 0x98, 0xe6, 0x5b, 0x9b, 0x0b, 0xfb, 0xc9, 0x64, 0x77,
+    0xa2, 0xb7, 0x6b, 0x47, 0x77, 0x9b, 0xbc, 0x9a, 0xa5, 0x7e, 0xa3, 0x01,
+    0xee, 0x9c, 0xc1, 0x87, 0xba, 0x7a, 0x77, 0x3c, 0x90, 0xec, 0x68, 0x2a,
+    0xdc, 0x7b, 0xfb, 0xce, 0x9d, 0x0f, 0xf4, 0xf6, 0x74, 0xdf, 0xb7, 0x7d,
+    0xe7, 0xf6, 0x9d, 0xdb, 0x7a, 0x13, 0x3d, 0xdd, 0x5d, 0x46, 0x93, 0xbb,
+    0xc6, 0x32, 0x73, 0xcd, 0xee, 0x5c, 0x7a, 0xcf, 0xf0, 0x50, 0xbf, 0x91,
+    0x39, 0xb0, 0x7f, 0x40, 0x8e, 0x2c, 0x83, 0xbb, 0xd9, 0xc5, 0xed, 0x3f,
+    0xb0, 0x67, 0x24, 0x23, 0x04, 0xd7, 0xfb, 0x88, 0xf0, 0x11, 0xdf, 0x24,
+    0xeb, 0x35, 0x83, 0xac, 0x88, 0x21, 0x5b, 0xfe, 0x86, 0xf1, 0x8d, 0x15,
+    0xf4, 0xdd, 0xef, 0x23, 0xe0, 0x1a, 0x68, 0xa7, 0xf0, 0xcd, 0xe2, 0x3b,
+    0x8a, 0x2f, 0x8f, 0xef, 0x4c, 0x1d, 0x59, 0x6f, 0xe0, 0x1b, 0xc3, 0x37,
+    0x8e, 0x6f, 0x12, 0x1f, 0x14, 0xa6, 0x97, 0xef, 0x6a, 0xec, 0x89, 0xec,
+    0x00, 0xef, 0xf3, 0x9d, 0x4d, 0xf1, 0x03, 0x07, 0xc6, 0x50, 0x2b, 0x48,
+    0xc0, 0x78, 0x30, 0x85, 0x03, 0x44, 0x9a, 0x36, 0xdf, 0x11, 0xb9, 0x6b,
+    0x53, 0x24, 0x12, 0xd9, 0xdc, 0xbc, 0x69, 0xef, 0x5d, 0x99, 0xbb, 0xee,
+    0x4e, 0x67, 0x06, 0x36, 0x65, 0x86, 0x46, 0xc6, 0x9e, 0x30, 0x42, 0xc9,
+    0x81, 0xb4, 0xd1, 0xd4, 0x02, 0xa4, 0xe6, 0xcd, 0xc6, 0x26, 0xa3, 0xe9,
+    0xae, 0xb6, 0xe6, 0x96, 0xb6, 0x3b, 0x5b, 0x37, 0xe2, 0x10, 0xa1, 0xfd,
+    0x8f, 0x0f, 0x0f, 0x6f, 0x84, 0x2d, 0xee, 0x81, 0x22, 0x8c, 0xb1, 0x05,
+    0x65, 0x8c, 0xf4, 0x81, 0xfd, 0xa3, 0x07, 0x86, 0x07, 0xca, 0xa4, 0x2f,
+    0xbd, 0xf6, 0x47, 0xff, 0xcf, 0xff, 0x1e, 0xfd, 0x61, 0xef, 0xe8, 0xc0,
+    0xc8, 0xd0, 0x9e, 0xe1, 0xa5, 0x34, 0x94, 0x2c, 0xf1, 0x4e, 0xe2, 0x27,
+    0x2b, 0x05, 0xf8, 0x33, 0xb4, 0x08, 0xb2, 0xd6, 0x54, 0xb3, 0x1c, 0x57,
+    0x1a, 0xd7, 0xaf, 0xa0, 0xca, 0x15, 0xf6, 0x37, 0x00, 0xd7, 0xe2, 0x5b,
+    0xf7, 0x7f, 0xc0, 0x93, 0x32, 0xb8, 0xbe, 0xb2, 0x72, 0x45, 0x95, 0x7e,
+    0xdd, 0x1e, 0x27, 0xa4, 0xdc, 0xff, 0xd8, 0xbe, 0xca, 0xd8, 0xfa, 0x15,
+    0x4c, 0xeb, 0xe2, 0xac, 0x25, 0x61, 0xd3, 0xce, 0xec, 0xe0, 0xc0, 0xf0,
+    0xd0, 0x21, 0x01, 0xed, 0xdb, 0x93, 0x86, 0x85, 0x8b, 0x17, 0xba, 0x74,
+    0xc6, 0x99, 0x1d, 0x6a, 0x1e, 0x75, 0xa0, 0x7d, 0xa3, 0xe9, 0x6b, 0x50,
+    0x93, 0x84, 0x46, 0x47, 0x87, 0x9c, 0xb1, 0xd1, 0x47, 0xdc, 0xd9, 0xf4,
+    0xd0, 0x3e, 0x97, 0x76, 0x34, 0xbb, 0xc4, 0x03, 0x6a, 0x6e, 0x42, 0xe8,
+    0x40, 0x3e, 0x27, 0x5b, 0x57, 0x57, 0xfe, 0x17, 0x5d, 0x8b, 0x94, 0x53,
+};
+
+const firmware_blob_t firmware_blob_d561847a59623cc6 = {
+    blob_d561847a59623cc6_z, sizeof(blob_d561847a59623cc6_z), 10092, 0xa7295a5f
+};
@@ -0,0 +1,417 @@
+/**
+ * Embedded Firmware blob f6506cc6c259ba17
+ * Used by: a1_nt_a SPL
+ * Auto-generated - DO NOT EDIT
+ */
+
+#include "firmware_registry.h"
+
+// 8704 bytes, 4821 compressed
+static const uint8_t blob_f6506cc6c259ba17_z[] = {
+    0x78, 0xda, 0xdd, 0x59, 0x6b, 0x70, 0x1c, 0x55, 0x76, 0x3e, 0xd3, 0xdd,
+    0xf3, 0xd0, 0x68, 0x2c, 0xf5, 0x48, 0x63, 0xef, 0x80, 0xb5, 0x4e, 0x0b,
+    0xf7, 0x58, 0x83, 0x2d, 0xaf, 0xdb, 0x62, 0x8c, 0xc7, 0xde, 0xde, 0x6c,
+    0x33, 0x23, 0x83, 0x00, 0x2d, 0x56, 0xc4, 0x92, 0xc0, 0x86, 0x94, 0x1e,
+    0xa3, 0xd1, 0x63, 0x57, 0x48, 0x62, 0x24, 0x83, 0xd9, 0x78, 0x93, 0x89,
+    0x34, 0x38, 0x4e, 0xd5, 0xc4, 0x12, 0x94, 0x6b, 0xe3, 0x22, 0x4e, 0x95,
+    0xd6, 0x46, 0x2c, 0x5b, 0x99, 0x48, 0x06, 0x6f, 0x52, 0xfb, 0x87, 0x42,
+    0x65, 0x8c, 0x21, 0x84, 0x1f, 0xae, 0x84, 0x4a, 0xa8, 0x94, 0x43, 0x79,
+    0x79, 0x7a, 0xb7, 0x9c, 0x00, 0xc1, 0xbc, 0x1f, 0x9d, 0xef, 0xdc, 0xee,
+    0x96, 0x65, 0xe1, 0xdd, 0xe5, 0x77, 0xa6, 0xea, 0xea, 0x9e, 0x7b, 0xef,
+    0x39, 0xe7, 0x9e, 0x7b, 0x5e, 0xf7, 0xdc, 0x96, 0x45, 0x21, 0x53, 0xf9,
+    0x2c, 0xb4, 0x8d, 0xba, 0x0f, 0x58, 0x34, 0x18, 0xb2, 0x8a, 0x54, 0x65,
+    0x26, 0xac, 0x2a, 0x1f, 0x0d, 0x1e, 0xb0, 0xaa, 0x02, 0x14, 0x22, 0xfe,
+    0x15, 0x25, 0xf3, 0xbc, 0xfd, 0x54, 0x53, 0x8c, 0x9e, 0x5e, 0x18, 0x0c,
+    0x53, 0xe4, 0xcc, 0xf6, 0xef, 0xe9, 0x7b, 0xa9, 0x75, 0x7a, 0xc4, 0x27,
+    0x9b, 0x74, 0x7d, 0x4e, 0x27, 0x9a, 0xaa, 0xf0, 0xf8, 0xc2, 0x16, 0x8c,
+    0xa3, 0x39, 0x5d, 0x71, 0xc7, 0xff, 0xf1, 0x35, 0x8c, 0x4b, 0xb9, 0x54,
+    0x48, 0x8c, 0xb3, 0xd3, 0x3e, 0x52, 0x74, 0x1f, 0x49, 0xa6, 0x4a, 0x7d,
+    0x62, 0x4c, 0x27, 0x33, 0xa9, 0x53, 0xd5, 0x14, 0x89, 0x51, 0x6f, 0x85,
+    0x8e, 0x4b, 0x66, 0x9a, 0xb2, 0xe5, 0xa7, 0x6d, 0x45, 0xd7, 0xe3, 0x7d,
+    0x04, 0xb8, 0xa2, 0x68, 0x56, 0xe5, 0x22, 0xe6, 0x82, 0x94, 0x4b, 0xf5,
+    0x05, 0x29, 0x02, 0xb8, 0x12, 0x02, 0xbe, 0x90, 0xe9, 0x1d, 0xbf, 0x45,
+    0x45, 0xc5, 0x7c, 0x08, 0xe3, 0x99, 0xad, 0x25, 0xdd, 0x83, 0x67, 0x01,
+    0xbf, 0x19, 0x76, 0x71, 0xdc, 0xb9, 0xca, 0xb2, 0xf5, 0x5f, 0x00, 0x7e,
+    0x25, 0x78, 0xf9, 0xfa, 0xa9, 0x65, 0xeb, 0x67, 0x00, 0xdf, 0xb9, 0x62,
+    0xfd, 0xec, 0xb2, 0xf5, 0xf3, 0x80, 0x7f, 0x15, 0x72, 0xd6, 0xa1, 0x8f,
+    0x69, 0x9e, 0xbf, 0x88, 0x39, 0xac, 0x85, 0xe2, 0xf4, 0x54, 0x13, 0x9f,
+    0xe3, 0x30, 0x64, 0x6e, 0xd4, 0x26, 0x81, 0x31, 0x59, 0x9e, 0xfc, 0x3d,
+    0x99, 0x24, 0x9c, 0xbb, 0x9e, 0xfa, 0x54, 0x9b, 0x32, 0x86, 0x0c, 0x38,
+    0x0e, 0xd8, 0xd1, 0x45, 0x46, 0x0f, 0x02, 0xb6, 0x54, 0x89, 0x2e, 0x6c,
+    0x09, 0x40, 0x77, 0xa7, 0xf5, 0xb5, 0x74, 0x92, 0x2e, 0xfa, 0x2c, 0x28,
+    0xfe, 0x9c, 0x5c, 0xa7, 0x12, 0xed, 0xbf, 0xc9, 0x6f, 0x52, 0x79, 0x2e,
+    0xb5, 0x96, 0x8e, 0x8a, 0xf9, 0x8f, 0x6d, 0x52, 0x79, 0x6f, 0xa6, 0x8d,
+    0x99, 0x8a, 0xc9, 0xb4, 0x74, 0xb6, 0x84, 0xf5, 0x49, 0xb1, 0xfe, 0xee,
+    0xb2, 0xf5, 0x47, 0xbe, 0x29, 0x3b, 0xeb, 0x2f, 0xe4, 0xb0, 0xde, 0x2b,
+    0xd6, 0x7f, 0xe5, 0xae, 0xb3, 0x4d, 0x8f, 0xef, 0xc8, 0xe8, 0xb6, 0x1d,
+    0xd0, 0x63, 0x14, 0xd4, 0x43, 0xc0, 0xff, 0xc8, 0xce, 0x96, 0xab, 0xa9,
+    0x3f, 0x26, 0x59, 0x03, 0x63, 0x09, 0x83, 0xcf, 0x57, 0x05, 0x19, 0xc3,
+    0xb0, 0x67, 0xb5, 0x4e, 0xc7, 0x23, 0xe6, 0x46, 0xf5, 0x59, 0x0a, 0x92,
+    0x15, 0x93, 0xd4, 0x7f, 0x1e, 0x63, 0xf9, 0x98, 0x4d, 0x63, 0x5c, 0xf1,
+    0x7d, 0x66, 0xb7, 0x95, 0xdf, 0x06, 0x5f, 0x99, 0x06, 0x67, 0x1b, 0xe3,
+    0xad, 0x24, 0xd3, 0xc0, 0x4c, 0x02, 0xbb, 0x34, 0x5a, 0xbd, 0xa4, 0x50,
+    0xe8, 0xa1, 0x5a, 0x0a, 0xae, 0x16, 0x7b, 0xd2, 0xe0, 0xcc, 0x2a, 0x0a,
+    0xaf, 0x66, 0xd9, 0x6c, 0x3b, 0x03, 0xde, 0x03, 0x33, 0x12, 0xe5, 0x66,
+    0x1a, 0xd3, 0x17, 0xb0, 0x76, 0xbe, 0xac, 0xa8, 0xbd, 0xe8, 0x42, 0x3f,
+    0x4a, 0xa8, 0x6d, 0x18, 0xbf, 0x5a, 0x79, 0x0d, 0x3c, 0x7d, 0x74, 0x5a,
+    0xe8, 0xe9, 0xbf, 0xed, 0x5b, 0x63, 0xcc, 0xef, 0x15, 0x77, 0x8e, 0xf5,
+    0x4c, 0xd0, 0x33, 0xeb, 0x91, 0xd6, 0xf6, 0xee, 0xa3, 0x9a, 0xdc, 0x3e,
+    0x3f, 0x74, 0xc9, 0xba, 0x0e, 0x0b, 0xfd, 0x66, 0x75, 0x96, 0x91, 0xe5,
+    0x60, 0xf8, 0xc2, 0x16, 0xe0, 0x47, 0x33, 0xd0, 0x6f, 0x16, 0x7a, 0xe8,
+    0x5e, 0xa6, 0x5f, 0xc9, 0xfc, 0x84, 0x75, 0x52, 0xce, 0xa4, 0xea, 0x68,
+    0xb2, 0xb9, 0x9e, 0x2c, 0xa1, 0x9f, 0xa2, 0xaa, 0x08, 0xfb, 0xc7, 0x5a,
+    0x4a, 0xba, 0x67, 0xcb, 0x10, 0x59, 0xe2, 0x14, 0x4c, 0x23, 0xce, 0x0f,
+    0x1a, 0x96, 0xc3, 0xa4, 0x0c, 0xec, 0x2c, 0x11, 0xcb, 0x12, 0x75, 0x65,
+    0x90, 0xd1, 0x33, 0xae, 0x27, 0x43, 0x2d, 0x6c, 0xcf, 0x72, 0x30, 0x2d,
+    0xd3, 0xad, 0x94, 0xc3, 0x39, 0x4f, 0xa6, 0xfc, 0x3f, 0x2c, 0x4b, 0x6d,
+    0x76, 0x9f, 0x87, 0xcf, 0x72, 0x5f, 0xe4, 0x39, 0xc8, 0x3e, 0xef, 0xc5,
+    0x23, 0x70, 0x17, 0x81, 0x7b, 0xde, 0xb3, 0x25, 0xc6, 0x67, 0x30, 0x7e,
+    0xdd, 0x1d, 0x1f, 0xc6, 0xfe, 0xdf, 0x75, 0x71, 0x3f, 0xc7, 0xdc, 0x11,
+    0x8c, 0x63, 0xa6, 0x2b, 0xf3, 0xd9, 0x4c, 0xea, 0x91, 0x6f, 0xba, 0xf0,
+    0x0b, 0x99, 0x14, 0xf3, 0x17, 0x30, 0xf8, 0x47, 0x68, 0x32, 0xa9, 0xc0,
+    0xbe, 0x1f, 0xd8, 0x93, 0x9e, 0xbf, 0x87, 0xee, 0xc6, 0xf9, 0x25, 0xca,
+    0x34, 0x4b, 0xd0, 0x4b, 0x8c, 0x24, 0xbd, 0x98, 0xf4, 0x93, 0x14, 0x9f,
+    0x1c, 0xa3, 0x62, 0xc8, 0x9c, 0x49, 0x87, 0x12, 0x8d, 0xea, 0x20, 0xce,
+    0x7d, 0xd3, 0x0c, 0x1d, 0x97, 0xcd, 0xc6, 0xf4, 0x6b, 0xb0, 0x7d, 0x76,
+    0x86, 0xe8, 0xcd, 0xf2, 0xff, 0xda, 0x9c, 0x07, 0x7a, 0x9b, 0xe1, 0x2f,
+    0x6a, 0x31, 0x2e, 0x0b, 0x7f, 0x2b, 0xb7, 0x64, 0xf4, 0xc6, 0x38, 0x6c,
+    0x4c, 0xb9, 0xb2, 0x9f, 0xba, 0x63, 0x99, 0x0e, 0x3f, 0x25, 0x92, 0x45,
+    0x2f, 0xce, 0x42, 0x63, 0xd8, 0x6b, 0x2d, 0xe5, 0xa1, 0x97, 0x59, 0x62,
+    0x17, 0xd8, 0xd4, 0xb1, 0xd1, 0x27, 0x93, 0xb5, 0x7a, 0xbd, 0x3a, 0x44,
+    0x8d, 0xea, 0x31, 0x5a, 0xaf, 0xde, 0x4c, 0x6b, 0x69, 0x97, 0x58, 0xff,
+    0xc8, 0x9e, 0x82, 0x5c, 0xb9, 0xe6, 0x55, 0xd4, 0xad, 0xb2, 0xfe, 0x32,
+    0xd0, 0x3a, 0xfb, 0x14, 0xc7, 0x58, 0x8c, 0x64, 0x5d, 0x4a, 0x4e, 0x8d,
+    0x35, 0xc6, 0x1f, 0x87, 0x42, 0xf2, 0x65, 0x19, 0x63, 0x25, 0x7e, 0x8c,
+    0x6c, 0xe4, 0x91, 0x00, 0x91, 0xda, 0x04, 0x79, 0x18, 0xf7, 0x7d, 0xbb,
+    0x18, 0x63, 0x7c, 0x7b, 0x51, 0x36, 0xdf, 0xb1, 0x73, 0x29, 0x3d, 0xde,
+    0x4f, 0x09, 0xf8, 0xe0, 0x12, 0xbd, 0xf6, 0x38, 0x94, 0x38, 0x05, 0x1f,
+    0xf3, 0x83, 0x3e, 0x2f, 0xd6, 0xd8, 0x2f, 0x7d, 0x34, 0x35, 0xc3, 0x3a,
+    0xe7, 0xb3, 0x40, 0x67, 0x65, 0x25, 0xb9, 0x0b, 0xf3, 0xbd, 0x65, 0x5d,
+    0xdd, 0x05, 0x7d, 0x5b, 0x31, 0xcf, 0xee, 0x9e, 0x6d, 0x0c, 0xf8, 0xa9,
+    0x6d, 0x2b, 0xc8, 0x6f, 0xbb, 0xca, 0xf6, 0xb7, 0x4b, 0x22, 0xbf, 0xf1,
+    0x99, 0x31, 0x5f, 0x99, 0x49, 0x97, 0x74, 0xcc, 0x57, 0xfe, 0x0c, 0xf6,
+    0x8a, 0x60, 0x1f, 0x07, 0x3f, 0x53, 0xf6, 0xf2, 0xa5, 0x0a, 0x5d, 0x45,
+    0x5c, 0x5f, 0x0a, 0xe2, 0xac, 0xec, 0x5b, 0x01, 0xce, 0x25, 0x9f, 0xca,
+    0x3a, 0xeb, 0xdc, 0x40, 0xee, 0xf4, 0xf6, 0xb2, 0xbf, 0x90, 0x75, 0xf6,
+    0x65, 0x5d, 0xcd, 0x0a, 0xbb, 0xdb, 0x9f, 0xcb, 0x7a, 0x2d, 0x21, 0x07,
+    0x64, 0x72, 0xfa, 0xd5, 0x34, 0x25, 0xfc, 0x6d, 0x2f, 0x65, 0xa6, 0x7f,
+    0xe4, 0x0b, 0x98, 0xd6, 0x5e, 0xc4, 0x10, 0xf6, 0xd9, 0x68, 0xec, 0xa7,
+    0xba, 0x24, 0x91, 0xe7, 0x8f, 0xb5, 0xb4, 0xa8, 0xd6, 0xc5, 0x39, 0x00,
+    0x82, 0x26, 0x15, 0x91, 0x7b, 0x20, 0x27, 0xe7, 0xfe, 0xf6, 0xd4, 0x5b,
+    0xfa, 0xf7, 0x28, 0xa0, 0x1f, 0x69, 0x99, 0xd3, 0xf9, 0x1e, 0x10, 0x79,
+    0x15, 0xf6, 0xe2, 0x1c, 0xf8, 0x6b, 0x5b, 0x12, 0xb1, 0xc6, 0xf9, 0x6f,
+    0x1d, 0x05, 0xcc, 0x62, 0xe9, 0x34, 0xfc, 0xfb, 0x98, 0xe0, 0xa7, 0x5a,
+    0xcc, 0xfb, 0x46, 0xc0, 0x8b, 0xc4, 0x76, 0xda, 0xa4, 0x4a, 0x6c, 0xd3,
+    0xd8, 0xfa, 0xf4, 0xe3, 0xd4, 0x98, 0x84, 0x4d, 0xd1, 0x5b, 0x46, 0x10,
+    0x3e, 0x24, 0xe9, 0xdf, 0xa6, 0x10, 0xec, 0xff, 0x8c, 0xa0, 0x63, 0x99,
+    0xa4, 0xb6, 0xfc, 0x98, 0x42, 0x1b, 0x44, 0xbe, 0x78, 0xb6, 0xea, 0x67,
+    0xcd, 0x32, 0x69, 0x22, 0x8f, 0x7c, 0x60, 0xb7, 0xc5, 0x1a, 0x8d, 0xe7,
+    0xa0, 0x0f, 0xd8, 0x09, 0x32, 0x79, 0xb2, 0xab, 0x69, 0xa2, 0xf5, 0x74,
+    0x4e, 0xe8, 0xdf, 0x9b, 0x4b, 0xa4, 0xbb, 0xc1, 0x3b, 0xa0, 0xf3, 0xde,
+    0x6b, 0xe9, 0x26, 0xcc, 0x9d, 0x13, 0x32, 0x41, 0x61, 0x51, 0x07, 0xef,
+    0x4d, 0x17, 0xdf, 0x59, 0xb3, 0x6b, 0x1f, 0x33, 0x12, 0xd8, 0x5b, 0xf9,
+    0xfc, 0xd9, 0x7d, 0xb8, 0x77, 0x0c, 0xa6, 0x2b, 0xfd, 0xed, 0xae, 0x7d,
+    0x0b, 0x88, 0x13, 0x5f, 0x28, 0xa3, 0x2b, 0x9d, 0x6f, 0xec, 0xdb, 0x88,
+    0x7c, 0x10, 0x44, 0x86, 0x38, 0xf5, 0xfd, 0xfc, 0x3e, 0xcb, 0x08, 0x80,
+    0xe6, 0xb4, 0x61, 0xc1, 0xa7, 0x3c, 0x1a, 0x9e, 0x77, 0xe2, 0x7e, 0x96,
+    0xfe, 0xcb, 0xee, 0x17, 0xb6, 0xfb, 0x77, 0xb6, 0x07, 0x62, 0xe2, 0x15,
+    0xd1, 0xbf, 0xa5, 0x9f, 0x81, 0x4e, 0x39, 0x17, 0x68, 0xf4, 0xc4, 0x02,
+    0x15, 0xa3, 0x22, 0x27, 0x34, 0xd0, 0xf1, 0x85, 0xf3, 0x3b, 0x8c, 0x0d,
+    0x0a, 0x49, 0xf3, 0x6c, 0x7f, 0x2f, 0x67, 0x9d, 0xdf, 0x71, 0xcd, 0x3c,
+    0xc7, 0x2f, 0xc7, 0xae, 0x02, 0x7f, 0x08, 0x61, 0x9d, 0x63, 0x98, 0xe3,
+    0xb7, 0x19, 0xb6, 0x48, 0xd2, 0x89, 0x05, 0x9d, 0x9e, 0x5c, 0x88, 0x21,
+    0xa6, 0x22, 0x2e, 0x6d, 0x08, 0x78, 0x2a, 0xc6, 0xbc, 0x37, 0x8f, 0xd9,
+    0xee, 0x6c, 0x53, 0x05, 0xf1, 0x10, 0xa2, 0x1b, 0xcb, 0x1c, 0x8f, 0xfb,
+    0x52, 0xb8, 0x43, 0xe8, 0xe8, 0x02, 0xdb, 0xb8, 0xd3, 0x27, 0xc1, 0xd7,
+    0x8e, 0x2e, 0x1c, 0x69, 0x79, 0x8b, 0xef, 0xb2, 0xc8, 0xeb, 0xb0, 0xad,
+    0x06, 0x07, 0x61, 0xba, 0x10, 0x75, 0x96, 0x21, 0xd3, 0xc1, 0xb5, 0xd4,
+    0xc9, 0x77, 0x88, 0xa4, 0xc2, 0x3f, 0xfe, 0x01, 0xbc, 0xeb, 0x44, 0x6e,
+    0x95, 0xf5, 0x30, 0xe2, 0x42, 0x52, 0x3b, 0xc7, 0x1c, 0xb9, 0x33, 0xd3,
+    0x0a, 0xf0, 0x21, 0xf3, 0x65, 0xf8, 0x95, 0x15, 0xf8, 0x2c, 0x93, 0x42,
+    0xfe, 0x83, 0x4c, 0xc7, 0xb2, 0xee, 0xa5, 0x1b, 0xa7, 0x3d, 0x9f, 0xe1,
+    0xf3, 0xb2, 0x0f, 0x46, 0xe8, 0x99, 0x8a, 0x83, 0x97, 0x2b, 0x7b, 0xf6,
+    0x64, 0x1e, 0x2a, 0xf6, 0x79, 0xdf, 0x8f, 0xf3, 0xff, 0x32, 0xb3, 0x74,
+    0x2f, 0xf2, 0xfc, 0xc7, 0x36, 0xe7, 0xb0, 0x4c, 0xf3, 0x11, 0xce, 0xe1,
+    0x38, 0x5f, 0x18, 0x3e, 0xa5, 0x01, 0x17, 0x19, 0x0b, 0x77, 0xae, 0x34,
+    0xdf, 0x80, 0x26, 0x01, 0x46, 0x1e, 0x9b, 0xa7, 0xe3, 0x75, 0x9c, 0x6f,
+    0x0f, 0xd2, 0x1d, 0xa8, 0x51, 0x7e, 0x91, 0xd9, 0x97, 0x40, 0xcc, 0x60,
+    0x3c, 0xbf, 0x17, 0x77, 0xff, 0xf9, 0x1d, 0xfa, 0xc1, 0x5f, 0xdb, 0x32,
+    0x7c, 0x3a, 0xab, 0x1a, 0x0a, 0xec, 0xfe, 0x07, 0x19, 0xe8, 0x26, 0x33,
+    0xcf, 0xf1, 0xa6, 0x22, 0xce, 0x71, 0x57, 0x1a, 0x88, 0x73, 0x61, 0x57,
+    0xc6, 0x57, 0x48, 0x59, 0xc2, 0xb7, 0x02, 0x90, 0x0b, 0x78, 0x4c, 0xc3,
+    0x75, 0x4d, 0xec, 0x0a, 0xf8, 0x21, 0x17, 0x3f, 0x08, 0x7c, 0xf8, 0x76,
+    0x8a, 0xf1, 0x1b, 0x80, 0xdb, 0x70, 0x05, 0xdc, 0xc8, 0x32, 0xde, 0x67,
+    0x82, 0x2e, 0xef, 0xbb, 0x32, 0x38, 0x4f, 0x6f, 0x25, 0xbe, 0x02, 0x9f,
+    0xd7, 0x38, 0x0f, 0x11, 0x72, 0x8d, 0xae, 0xb6, 0xd2, 0x9f, 0x92, 0x62,
+    0xaa, 0x77, 0x94, 0xf4, 0x04, 0x60, 0xcc, 0x57, 0x4a, 0x58, 0x93, 0x81,
+    0xdf, 0xe1, 0xcb, 0xa4, 0x00, 0x57, 0x2e, 0x60, 0x5c, 0xeb, 0xd0, 0xc7,
+    0x9c, 0xfb, 0x19, 0xb4, 0x8f, 0x20, 0xe6, 0x8f, 0x2b, 0xae, 0x4e, 0x76,
+    0xb9, 0x74, 0x93, 0xe5, 0xcf, 0x20, 0x03, 0xe7, 0x15, 0xdc, 0x05, 0xa0,
+    0x9d, 0xac, 0x3c, 0x13, 0xa0, 0x48, 0x0d, 0x72, 0x51, 0x2d, 0x1a, 0xc3,
+    0x09, 0x94, 0x8f, 0xaa, 0x07, 0xcf, 0x58, 0x08, 0x2e, 0x17, 0x3e, 0x6c,
+    0x89, 0x5c, 0x87, 0x38, 0x94, 0x12, 0x86, 0x25, 0x25, 0x92, 0x9a, 0xc4,
+    0x7e, 0x26, 0x6a, 0xad, 0xeb, 0x4a, 0x3a, 0xdb, 0x17, 0xf6, 0x3c, 0xc8,
+    0xf5, 0x62, 0x04, 0x76, 0xa6, 0x62, 0x40, 0xe4, 0x1d, 0xd8, 0x5b, 0x72,
+    0xf2, 0x55, 0x76, 0x3a, 0x96, 0x3a, 0xad, 0x37, 0xa4, 0xe6, 0xf4, 0xba,
+    0x19, 0xce, 0xab, 0x0f, 0x57, 0x98, 0xdf, 0x5a, 0xba, 0x46, 0x62, 0xbb,
+    0xeb, 0xa9, 0x92, 0x5e, 0x77, 0x80, 0x88, 0xf9, 0x29, 0x74, 0x6f, 0x05,
+    0xf1, 0x30, 0x8d, 0x78, 0x98, 0x46, 0x3c, 0x4c, 0x23, 0xb6, 0xa6, 0x11,
+    0x53, 0xd3, 0x7c, 0xff, 0x72, 0x3c, 0x1a, 0x5c, 0x9f, 0x2d, 0xcb, 0x6b,
+    0x63, 0xc8, 0x69, 0xef, 0xba, 0x39, 0x8d, 0xe9, 0xad, 0xeb, 0x1c, 0x9f,
+    0x6f, 0x47, 0x8c, 0x32, 0xcd, 0x57, 0xc1, 0xfd, 0x8e, 0x8b, 0xdb, 0x8d,
+    0x58, 0x72, 0x64, 0x87, 0xce, 0x71, 0xbe, 0xa4, 0x2f, 0x08, 0xdc, 0xd3,
+    0x02, 0xf7, 0x10, 0x70, 0x7b, 0x81, 0xc7, 0xbe, 0xe7, 0x3b, 0x21, 0x99,
+    0x8a, 0x9a, 0x2d, 0x37, 0x69, 0xc8, 0x66, 0x54, 0x32, 0x36, 0xe0, 0x2e,
+    0xc0, 0xb8, 0x92, 0xc6, 0x1c, 0x6a, 0x86, 0x74, 0xd0, 0x9d, 0xc3, 0xb8,
+    0xe2, 0xd5, 0x0e, 0x01, 0xd0, 0x9d, 0x43, 0xbe, 0xf0, 0x53, 0xb6, 0xb9,
+    0x01, 0xf1, 0x1e, 0x17, 0xb1, 0xfe, 0xc4, 0x42, 0x04, 0xf7, 0x81, 0x8a,
+    0x9c, 0xc1, 0xf7, 0x9b, 0x8f, 0xa2, 0x7a, 0x0d, 0x7c, 0x84, 0xe5, 0xfd,
+    0x4f, 0x5f, 0x40, 0x7f, 0x79, 0xdb, 0xdc, 0x52, 0xcd, 0x5a, 0x86, 0x8e,
+    0xfe, 0x86, 0x9c, 0xda, 0xc0, 0x0f, 0x5c, 0xdc, 0xd1, 0x6a, 0x00, 0xfd,
+    0x7b, 0x2c, 0x3b, 0x74, 0x27, 0x81, 0x96, 0xe3, 0x36, 0x81, 0x03, 0xed,
+    0x3e, 0xa1, 0x9a, 0xb2, 0xf0, 0xd1, 0x5d, 0x65, 0x61, 0x3f, 0xcd, 0xa9,
+    0x83, 0x13, 0x49, 0x4b, 0xe8, 0xf8, 0x10, 0x78, 0xbd, 0x23, 0x6a, 0x78,
+    0x69, 0xfe, 0xf6, 0x08, 0x45, 0xf8, 0x8e, 0x2a, 0xae, 0x18, 0x7b, 0x67,
+    0x24, 0xdb, 0xaf, 0xbf, 0x83, 0xfa, 0x52, 0xc7, 0xdd, 0x19, 0xc6, 0xdd,
+    0xcb, 0xe7, 0x4c, 0xa9, 0xad, 0xf0, 0xb9, 0x52, 0x0a, 0x7d, 0x85, 0x00,
+    0xeb, 0xda, 0x83, 0xb4, 0x0a, 0x63, 0xc0, 0x95, 0x06, 0x31, 0xde, 0x0f,
+    0x5b, 0x95, 0x52, 0x80, 0x2b, 0x31, 0x55, 0xdc, 0x9b, 0x3a, 0xdf, 0xcb,
+    0xd5, 0xa0, 0xc7, 0xb8, 0x12, 0xc7, 0x5c, 0x5c, 0xb5, 0x2a, 0xed, 0xd1,
+    0x6c, 0x99, 0xf9, 0xa2, 0xaf, 0xd4, 0x62, 0x7f, 0x2b, 0x83, 0x7a, 0xf2,
+    0x84, 0xdf, 0x2c, 0x46, 0x8f, 0x21, 0x57, 0xe5, 0x8c, 0x3f, 0x74, 0x73,
+    0x1f, 0xdf, 0xf3, 0x9f, 0xd8, 0xad, 0x02, 0x66, 0xb9, 0xaa, 0x70, 0x6e,
+    0xd2, 0xb2, 0x15, 0x9f, 0xd7, 0x9f, 0x90, 0x4d, 0x45, 0xeb, 0xc5, 0x1d,
+    0x7f, 0x29, 0x8e, 0x76, 0xe0, 0x1c, 0x2d, 0x5c, 0x57, 0xde, 0x22, 0x99,
+    0xac, 0x8f, 0x6d, 0xb7, 0x70, 0xfc, 0xd3, 0xfc, 0x45, 0x9f, 0x82, 0xfb,
+    0xa6, 0x4e, 0xe7, 0xfc, 0xcb, 0x38, 0x8c, 0xab, 0x52, 0x9d, 0x80, 0xc3,
+    0xc0, 0x1f, 0xa2, 0x96, 0x3a, 0xe4, 0x40, 0xfd, 0xf7, 0xe9, 0x9a, 0xba,
+    0xdd, 0xe0, 0xfb, 0x11, 0x69, 0x6b, 0x76, 0xfb, 0x03, 0xba, 0x5f, 0xd4,
+    0xfc, 0xb4, 0x44, 0x83, 0x7a, 0xc2, 0x9c, 0x2a, 0xcd, 0xa5, 0x58, 0xaf,
+    0x71, 0xf2, 0xcf, 0xb3, 0x5e, 0x5f, 0x84, 0x5e, 0x79, 0x9d, 0x71, 0x57,
+    0xe2, 0x4f, 0x05, 0x24, 0x61, 0xcb, 0xa9, 0x80, 0x5f, 0x7f, 0x19, 0x78,
+    0x9c, 0xcb, 0x1e, 0x72, 0xdf, 0x41, 0xbf, 0x91, 0xa6, 0xd7, 0xa5, 0xe9,
+    0xf5, 0xeb, 0xaf, 0x7f, 0x45, 0x9a, 0xfb, 0x7d, 0x90, 0x8b, 0x1c, 0xbf,
+    0xf1, 0xe4, 0x7a, 0x67, 0x99, 0x5c, 0x9b, 0x71, 0x5c, 0xee, 0xe7, 0x91,
+    0x2f, 0x58, 0x97, 0x9e, 0x7f, 0x3d, 0x0e, 0x9c, 0xed, 0x2e, 0x0f, 0xce,
+    0x49, 0xae, 0x2e, 0x63, 0x71, 0x1a, 0xd3, 0x91, 0x09, 0x4c, 0x99, 0xb6,
+    0x6e, 0x88, 0x23, 0x36, 0x99, 0x4f, 0x9f, 0xfb, 0x06, 0x9c, 0x2a, 0x22,
+    0xef, 0xb9, 0x7a, 0x64, 0x9e, 0x53, 0xd0, 0xdb, 0x65, 0xe3, 0xee, 0xcb,
+    0xc7, 0xf7, 0xfb, 0x40, 0x83, 0x3a, 0xc0, 0x9b, 0x3b, 0x50, 0x0f, 0xfb,
+    0x50, 0x74, 0x9e, 0xf9, 0xf1, 0x38, 0x0b, 0x1f, 0x66, 0x3c, 0x9e, 0xf3,
+    0xce, 0xc3, 0x30, 0xe3, 0x79, 0x63, 0xfc, 0x51, 0xd5, 0x20, 0x72, 0x64,
+    0x40, 0x36, 0x79, 0xbf, 0x29, 0xca, 0x09, 0xbd, 0x38, 0x4d, 0x9e, 0xa7,
+    0x38, 0xcf, 0xf3, 0x9c, 0x2c, 0xe6, 0x18, 0x77, 0x37, 0xce, 0x19, 0x0a,
+    0xe6, 0x70, 0x8e, 0x6c, 0xa5, 0x2a, 0x24, 0x9b, 0xd5, 0x4a, 0x4e, 0x6f,
+    0x03, 0x1c, 0x90, 0x65, 0x33, 0x00, 0xb8, 0x03, 0xf0, 0x9a, 0x3a, 0xf8,
+    0x90, 0x9a, 0xd3, 0xef, 0xe4, 0x37, 0x6b, 0x51, 0x36, 0x6f, 0xef, 0xc8,
+    0xe9, 0xdd, 0x80, 0xcf, 0x69, 0x32, 0xe7, 0xb7, 0x0a, 0x59, 0x32, 0x62,
+    0x24, 0x5b, 0x79, 0xb8, 0x28, 0xa7, 0x54, 0x62, 0x9f, 0x03, 0x4f, 0xf8,
+    0x70, 0x48, 0xe5, 0xf7, 0x0b, 0x72, 0xbb, 0xba, 0xdc, 0x87, 0x15, 0x13,
+    0xef, 0x25, 0xf1, 0x2e, 0x2b, 0x45, 0xa7, 0x10, 0x2b, 0x39, 0x63, 0x88,
+    0x06, 0xd4, 0x52, 0xf4, 0x41, 0xdd, 0xf1, 0xe5, 0x1b, 0x5d, 0x5f, 0x56,
+    0xc1, 0x43, 0x3a, 0xf8, 0x05, 0xf2, 0x32, 0xdb, 0x81, 0x73, 0x33, 0xc6,
+    0xc2, 0x66, 0x0d, 0xdb, 0x4a, 0xfa, 0x70, 0x9d, 0xff, 0xe0, 0x58, 0x5d,
+    0xe0, 0x20, 0xaf, 0xa5, 0x31, 0x5e, 0xd4, 0x9e, 0xdb, 0xc7, 0x6b, 0x32,
+    0x9d, 0x36, 0x26, 0xb0, 0xb6, 0xd7, 0x5d, 0xbb, 0x7b, 0xc5, 0x5a, 0x73,
+    0xbd, 0xff, 0xa0, 0x51, 0xef, 0xac, 0x15, 0x57, 0xac, 0xa5, 0xb0, 0x96,
+    0x76, 0xd7, 0x1e, 0x5d, 0xb1, 0x76, 0xb2, 0x9b, 0x63, 0x45, 0x36, 0xff,
+    0x02, 0x36, 0x4a, 0xe3, 0xce, 0x50, 0x65, 0xc9, 0xac, 0xa9, 0xcd, 0xe8,
+    0x21, 0x4d, 0x9a, 0x0f, 0xe0, 0xde, 0x52, 0xfc, 0xb8, 0x9b, 0x01, 0x87,
+    0xab, 0x71, 0xf6, 0x2a, 0xc4, 0x13, 0x60, 0x82, 0x4d, 0x23, 0xab, 0x70,
+    0x4f, 0x02, 0xae, 0xab, 0x97, 0x4c, 0x09, 0xb5, 0x4e, 0x1c, 0xf0, 0xc3,
+    0xc7, 0x25, 0xe8, 0xa9, 0xb7, 0x12, 0x8d, 0x4a, 0x66, 0x14, 0x73, 0x7d,
+    0x98, 0xab, 0x47, 0x7d, 0x32, 0xc8, 0x34, 0x1a, 0xea, 0xe3, 0x48, 0x46,
+    0xe7, 0xba, 0x97, 0x6b, 0xc6, 0x24, 0x75, 0x57, 0x5e, 0x06, 0x3c, 0xcc,
+    0x6b, 0xab, 0xa5, 0x79, 0x0b, 0xad, 0x88, 0xb6, 0x88, 0x56, 0x83, 0x75,
+    0x65, 0x35, 0xcd, 0x87, 0xa0, 0xe3, 0x56, 0xf4, 0x25, 0xb4, 0x53, 0x68,
+    0x8b, 0x31, 0x69, 0xfe, 0x14, 0xda, 0xf3, 0x68, 0x2f, 0xa2, 0xf1, 0xbb,
+    0x26, 0x04, 0xfc, 0x08, 0x5a, 0x1b, 0x5a, 0x3b, 0xda, 0x01, 0xb4, 0xf2,
+    0x6a, 0x79, 0xfe, 0x79, 0xf4, 0x2f, 0xa2, 0x47, 0xde, 0x9d, 0x46, 0xde,
+    0x9d, 0x46, 0xde, 0xc5, 0x7d, 0x75, 0x7c, 0xfa, 0x6c, 0x88, 0x42, 0x9a,
+    0xb8, 0x4f, 0xfc, 0xe6, 0xdc, 0x17, 0xa4, 0x3e, 0x8f, 0x7c, 0xfb, 0xc8,
+    0xd2, 0x3d, 0x3a, 0x57, 0xf6, 0x62, 0xe3, 0x33, 0xc4, 0x46, 0x7a, 0xd9,
+    0x9b, 0x9b, 0x54, 0xf6, 0x61, 0xfe, 0xa6, 0xe1, 0xd4, 0xf4, 0x0a, 0x60,
+    0xd4, 0x3f, 0x7a, 0xa3, 0xa8, 0x3f, 0xb2, 0xe5, 0x8f, 0xed, 0xee, 0xa5,
+    0xf7, 0x03, 0xbf, 0xc9, 0x5b, 0x33, 0x4e, 0xfd, 0x7d, 0xe3, 0xcd, 0xa2,
+    0xd6, 0x5e, 0xf8, 0xe3, 0x30, 0x72, 0x72, 0xd2, 0x92, 0x5b, 0x5b, 0x15,
+    0x73, 0x2f, 0x1d, 0xad, 0xf0, 0x98, 0x3a, 0x9d, 0x3a, 0x9c, 0xe0, 0x7b,
+    0xe7, 0x76, 0x38, 0xef, 0x01, 0xae, 0xc5, 0x39, 0xa7, 0xaf, 0xc2, 0x9b,
+    0x22, 0x11, 0xe7, 0xb7, 0x7c, 0x9b, 0xa8, 0xf9, 0xce, 0x6f, 0xe3, 0x5c,
+    0xa6, 0xe8, 0xfc, 0xbe, 0x4f, 0xb4, 0x59, 0x20, 0x0e, 0xeb, 0xeb, 0xe0,
+    0x6f, 0x44, 0xb7, 0x42, 0x8e, 0x41, 0x51, 0x5f, 0x4b, 0xda, 0x0b, 0xa8,
+    0xe5, 0x76, 0x1d, 0x6a, 0x8c, 0xff, 0x15, 0xe4, 0xeb, 0x63, 0xf9, 0xca,
+    0xa4, 0x97, 0xf6, 0xd9, 0xb5, 0x39, 0x83, 0xdf, 0xde, 0x17, 0xed, 0xe7,
+    0x50, 0x67, 0xf2, 0x7d, 0x17, 0x34, 0x3b, 0xd2, 0x6f, 0x96, 0xa5, 0x8c,
+    0x1f, 0x6f, 0xab, 0x39, 0x23, 0x42, 0x27, 0x67, 0x6c, 0xdc, 0x5f, 0xa8,
+    0x73, 0x8d, 0x22, 0xea, 0x04, 0x8c, 0x67, 0x15, 0x7a, 0x7e, 0x96, 0xe8,
+    0xd9, 0xd9, 0x8e, 0xf4, 0x1b, 0xe5, 0x3f, 0x47, 0x5e, 0x88, 0xd0, 0xd1,
+    0x59, 0x9d, 0x1e, 0x9d, 0x4d, 0xd2, 0xb1, 0x47, 0x97, 0xde, 0x48, 0x90,
+    0xab, 0x23, 0x9d, 0x29, 0xc7, 0x28, 0x33, 0xc3, 0x73, 0x9c, 0x3f, 0xf8,
+    0xcc, 0x5c, 0xbf, 0xf1, 0xfd, 0xc6, 0xe7, 0x96, 0x69, 0x32, 0x96, 0x28,
+    0x16, 0xa9, 0x0e, 0xb1, 0xbc, 0x8a, 0xe3, 0x5c, 0xd0, 0xe0, 0x7e, 0x20,
+    0xb5, 0x85, 0x68, 0x0c, 0xfc, 0x5b, 0xcb, 0xdd, 0xb0, 0x73, 0x8c, 0x26,
+    0x67, 0xba, 0x45, 0xfe, 0xc9, 0xc6, 0x58, 0x27, 0x6c, 0x2b, 0x4f, 0x1f,
+    0xde, 0x37, 0xac, 0xb0, 0x9b, 0x0f, 0x44, 0xbe, 0x07, 0x1f, 0xc6, 0xe3,
+    0xfd, 0xc9, 0xdd, 0xdf, 0xd3, 0x5d, 0x35, 0xf1, 0xfb, 0x2a, 0xc7, 0xb5,
+    0x5f, 0x99, 0x69, 0x59, 0x16, 0x61, 0xa7, 0x7a, 0x89, 0xde, 0xb6, 0x65,
+    0x61, 0x0f, 0xbc, 0x97, 0x67, 0x51, 0x9b, 0xcd, 0x72, 0x7d, 0xa4, 0xa1,
+    0xe7, 0xbb, 0x18, 0x4f, 0x03, 0x33, 0x02, 0x58, 0xc2, 0x3e, 0x1d, 0x69,
+    0x69, 0x1e, 0xed, 0xe0, 0xd7, 0x48, 0xd4, 0x70, 0xb3, 0x3f, 0x03, 0x5e,
+    0x03, 0x7a, 0x4f, 0x36, 0xaf, 0x36, 0x11, 0xdf, 0x8e, 0x8a, 0xce, 0x5b,
+    0xbc, 0xb8, 0x23, 0x23, 0xce, 0xc7, 0x77, 0x74, 0x77, 0x1a, 0xf9, 0xe3,
+    0x49, 0xd4, 0xa0, 0xfc, 0x86, 0x25, 0xab, 0x42, 0xfc, 0x0d, 0x8c, 0xf3,
+    0x0c, 0x5d, 0xaa, 0x0f, 0x78, 0x5d, 0x45, 0x4d, 0x1f, 0xc3, 0x9d, 0x5d,
+    0x4f, 0x8b, 0x94, 0x88, 0x43, 0xe5, 0xf0, 0xcb, 0xee, 0xf4, 0x5c, 0x39,
+    0x4a, 0xfc, 0xfe, 0x79, 0x70, 0x8c, 0x9e, 0xf4, 0x9b, 0xa2, 0x76, 0x8e,
+    0xf3, 0x9d, 0xf5, 0x28, 0x70, 0x1f, 0x2b, 0x6f, 0x4a, 0x3f, 0x43, 0x9f,
+    0xd9, 0xce, 0x7b, 0x49, 0xa6, 0xfe, 0xd8, 0x26, 0xbc, 0x6b, 0x3e, 0xc2,
+    0x9b, 0xf8, 0xb2, 0xf7, 0x2b, 0x7c, 0x8a, 0xcf, 0x3e, 0x96, 0xce, 0x89,
+    0xf3, 0x62, 0xff, 0x05, 0x51, 0x93, 0x89, 0x77, 0x48, 0x76, 0xe1, 0x93,
+    0xea, 0x4b, 0xdf, 0xc2, 0xc4, 0x9d, 0x0a, 0xbf, 0xc7, 0xf9, 0x16, 0x3a,
+    0xb6, 0x97, 0xf4, 0x9f, 0xb8, 0xdf, 0xc4, 0x5e, 0x16, 0xb6, 0x0c, 0xea,
+    0xab, 0xf0, 0xbe, 0x8b, 0xa3, 0x6e, 0x89, 0x41, 0x8f, 0x3a, 0xfd, 0x7c,
+    0x41, 0xc3, 0xbb, 0xa5, 0x01, 0xb5, 0x4c, 0x82, 0xaa, 0xf4, 0x31, 0xf8,
+    0x61, 0x90, 0xfe, 0xbe, 0xc9, 0xa0, 0x88, 0x9e, 0xa0, 0x55, 0xfa, 0x38,
+    0xd5, 0x80, 0x57, 0x2d, 0x7c, 0x3c, 0x8e, 0xbc, 0x7a, 0x95, 0xde, 0x87,
+    0x67, 0xed, 0x66, 0xe4, 0x78, 0xa2, 0xa3, 0xc5, 0x3f, 0xa1, 0x9b, 0x44,
+    0xec, 0x54, 0xd3, 0xcd, 0xa2, 0xbf, 0x1b, 0xef, 0x49, 0xf0, 0x43, 0xbd,
+    0x77, 0x02, 0xf5, 0xde, 0x93, 0x88, 0xd3, 0x27, 0x20, 0x9f, 0xa3, 0x5b,
+    0x1c, 0x60, 0x96, 0xcf, 0x92, 0x84, 0x1c, 0x3e, 0xd0, 0xd6, 0xd2, 0x2d,
+    0xea, 0xbd, 0x94, 0x4d, 0x56, 0xa1, 0x76, 0x72, 0x78, 0xdc, 0x25, 0xfa,
+    0x04, 0x75, 0xa8, 0x0a, 0xfd, 0x2b, 0xee, 0x26, 0xdc, 0x7f, 0xf4, 0xd7,
+    0xb3, 0x6f, 0x88, 0xef, 0x4c, 0xfc, 0x36, 0xbf, 0x4d, 0xac, 0x7f, 0x6c,
+    0xdf, 0xe9, 0xc6, 0xf6, 0x33, 0xa8, 0x2f, 0xfe, 0x0d, 0x75, 0xef, 0xec,
+    0xb1, 0x5a, 0x3a, 0xda, 0x54, 0x4b, 0xfd, 0x46, 0x98, 0x5e, 0x4a, 0x4a,
+    0x54, 0x5c, 0x63, 0x80, 0xfe, 0x8f, 0xd0, 0x38, 0x4f, 0x4b, 0x57, 0xc9,
+    0xd0, 0x25, 0xc7, 0x72, 0xe7, 0xec, 0xa6, 0x78, 0xaf, 0x2f, 0xe8, 0xd6,
+    0x23, 0xd0, 0x5f, 0x91, 0x61, 0x7e, 0xd3, 0x4a, 0xd8, 0xeb, 0x5f, 0xb8,
+    0x06, 0x33, 0xba, 0x25, 0xe7, 0x7b, 0x04, 0xe7, 0x89, 0xf6, 0x59, 0xde,
+    0xf7, 0x7d, 0xf1, 0x4e, 0x9c, 0x82, 0x21, 0x4f, 0x62, 0xbf, 0x1b, 0x14,
+    0xde, 0x0f, 0x55, 0xee, 0xec, 0x7a, 0x95, 0xbf, 0x33, 0x95, 0xb0, 0xff,
+    0xb1, 0xa6, 0xab, 0xbd, 0x37, 0x2b, 0xde, 0x95, 0x2a, 0xe2, 0xd9, 0x40,
+    0x6c, 0x3a, 0xef, 0x20, 0xce, 0x43, 0xfd, 0xa0, 0xed, 0x2d, 0xf2, 0xf7,
+    0x1c, 0x11, 0xd3, 0xd8, 0xeb, 0xb8, 0xd8, 0xcb, 0x92, 0x98, 0xde, 0x07,
+    0xbf, 0xfe, 0x50, 0xec, 0x31, 0x29, 0xf6, 0x90, 0x80, 0xc7, 0xe7, 0x3f,
+    0xb4, 0xfd, 0xd5, 0x04, 0xcb, 0xf8, 0x9e, 0xdd, 0xcd, 0x6f, 0x13, 0x9d,
+    0x71, 0x3f, 0x5d, 0x92, 0xe5, 0x80, 0x90, 0x8d, 0x6d, 0xc0, 0x7a, 0xfa,
+    0x27, 0x21, 0xef, 0xe4, 0xec, 0xb9, 0x2f, 0x9e, 0x6a, 0xd2, 0x7d, 0x73,
+    0xa8, 0x79, 0x1f, 0x5b, 0xe0, 0xef, 0x39, 0xba, 0xef, 0x31, 0xc4, 0xca,
+    0xa3, 0x4d, 0x0d, 0xbe, 0xa7, 0x17, 0x9a, 0x7d, 0x3f, 0x5d, 0xb8, 0x0a,
+    0x3e, 0xa2, 0x62, 0x6d, 0x2d, 0xe2, 0xc1, 0x9d, 0x5f, 0xf2, 0x7b, 0xcd,
+    0xf7, 0x54, 0x13, 0xe6, 0x43, 0x8e, 0x2d, 0xd8, 0x8f, 0x71, 0x67, 0xd0,
+    0x4f, 0x0d, 0xfe, 0xe6, 0x96, 0x50, 0x17, 0xf1, 0xa0, 0x57, 0x28, 0xac,
+    0x06, 0xe1, 0x5f, 0x93, 0xf0, 0xf9, 0x63, 0x06, 0xcf, 0x85, 0x55, 0x99,
+    0x74, 0x8c, 0x13, 0xd6, 0x22, 0xce, 0x75, 0xd4, 0x08, 0x5b, 0x12, 0xa5,
+    0xe8, 0x00, 0xee, 0x83, 0x39, 0x83, 0xe7, 0xc2, 0x96, 0x9f, 0x5a, 0x31,
+    0x66, 0xb8, 0xda, 0x0a, 0x52, 0x22, 0x8d, 0x3e, 0x2d, 0x23, 0x2e, 0xd0,
+    0xc7, 0x25, 0xaa, 0x36, 0xfc, 0xa8, 0x53, 0x0e, 0x54, 0x92, 0xf4, 0x97,
+    0x95, 0x34, 0x4d, 0x55, 0xda, 0x68, 0xff, 0xd2, 0x37, 0x14, 0x51, 0x07,
+    0xb7, 0x11, 0xf8, 0xdf, 0x52, 0xde, 0xa8, 0x6e, 0xf4, 0x05, 0xa0, 0x97,
+    0x08, 0x55, 0x8b, 0xfa, 0x58, 0x43, 0x8c, 0x35, 0x20, 0xc6, 0x62, 0x22,
+    0x8c, 0x5a, 0xcb, 0x5e, 0x3e, 0x91, 0xe2, 0x9b, 0xee, 0xe5, 0xf5, 0x46,
+    0xbc, 0x6b, 0x0d, 0xe0, 0x34, 0x03, 0xe7, 0x18, 0xce, 0x9c, 0x04, 0x8e,
+    0x8f, 0xae, 0x4d, 0x30, 0x9f, 0x0f, 0x61, 0x13, 0x0f, 0x8f, 0x63, 0xc5,
+    0xe3, 0xc5, 0x7c, 0x38, 0x46, 0x80, 0x1f, 0x72, 0xee, 0x83, 0xcc, 0xb4,
+    0x4f, 0xe4, 0x49, 0xd8, 0x6d, 0xd9, 0x77, 0xf7, 0xd7, 0xdc, 0x6f, 0xda,
+    0xd5, 0x98, 0xf7, 0xbe, 0x3b, 0x23, 0xbe, 0x22, 0x47, 0xb6, 0x5f, 0xaa,
+    0xbd, 0x5e, 0xdf, 0x91, 0x29, 0xbf, 0xe7, 0xd6, 0xb0, 0xde, 0x79, 0x56,
+    0xe6, 0xbe, 0xd7, 0xab, 0xbd, 0xba, 0xf5, 0xae, 0x32, 0xf3, 0x09, 0x91,
+    0x76, 0xc5, 0xf5, 0xf8, 0xef, 0x58, 0xd7, 0x56, 0xac, 0xf3, 0xfb, 0xa4,
+    0xc1, 0x5d, 0x87, 0x8d, 0x11, 0xdf, 0x77, 0x95, 0xd1, 0x4f, 0x37, 0xb8,
+    0x38, 0xda, 0x15, 0x70, 0x92, 0xbf, 0x01, 0xc7, 0xcb, 0x11, 0x1e, 0x2e,
+    0xe7, 0x7d, 0x7e, 0x5f, 0x42, 0x3b, 0x93, 0x7e, 0x2a, 0xc6, 0x9c, 0xbb,
+    0xd8, 0x89, 0x71, 0xe1, 0x43, 0xa0, 0xd3, 0xe9, 0x9a, 0x83, 0x55, 0x1f,
+    0x59, 0x88, 0x0d, 0x75, 0xc3, 0x07, 0xc2, 0x2f, 0x95, 0x49, 0xdb, 0xbd,
+    0x77, 0x5f, 0x16, 0xfb, 0x3e, 0xb9, 0x70, 0x98, 0xea, 0xcc, 0xe2, 0x8f,
+    0x3b, 0xaf, 0xe7, 0xbc, 0xe3, 0xe4, 0x20, 0x7e, 0x4b, 0x3d, 0xb1, 0xc0,
+    0xfc, 0x7d, 0x74, 0xfb, 0x86, 0x4d, 0x07, 0xea, 0xa5, 0x84, 0x6a, 0x49,
+    0xd5, 0x6a, 0x54, 0xe2, 0xfd, 0x12, 0x9a, 0x45, 0xef, 0x42, 0xef, 0xeb,
+    0x8b, 0x51, 0xe9, 0x63, 0x9b, 0xd6, 0xf0, 0xba, 0x2e, 0x6c, 0x77, 0x79,
+    0x9e, 0xf1, 0xf2, 0xcb, 0x4a, 0xd9, 0x99, 0xaf, 0x6d, 0x47, 0x91, 0x0f,
+    0xd4, 0x0d, 0x7e, 0x8a, 0xae, 0xb9, 0x92, 0xdc, 0x5c, 0x9b, 0x9e, 0x97,
+    0x15, 0x37, 0x16, 0xd5, 0x0d, 0xbb, 0x3a, 0x3b, 0x77, 0x77, 0x6a, 0xbb,
+    0x3a, 0xb2, 0x5a, 0x62, 0x6f, 0x18, 0xb2, 0x7f, 0x77, 0xe8, 0x9e, 0x7c,
+    0x41, 0x1b, 0x1a, 0x19, 0x9a, 0x08, 0x53, 0x47, 0x7b, 0xbb, 0xe1, 0x82,
+    0x0c, 0x6f, 0x5d, 0x06, 0xb7, 0x78, 0x70, 0xb6, 0xfd, 0x56, 0x01, 0x1a,
+    0xc8, 0x4a, 0x80, 0x97, 0x70, 0x6e, 0x6f, 0xed, 0xbc, 0xe1, 0x3b, 0xee,
+    0xa0, 0xb0, 0x67, 0x44, 0x1b, 0x9f, 0xe8, 0x29, 0x4c, 0x6c, 0xd5, 0xfa,
+    0x87, 0x0a, 0xf7, 0xdc, 0xdf, 0x53, 0xc8, 0x03, 0x18, 0x19, 0x1a, 0x1f,
+    0xcc, 0xf7, 0xf1, 0x9e, 0xd6, 0x5a, 0x2a, 0xfe, 0x1c, 0xad, 0xdb, 0x6d,
+    0xa7, 0x96, 0xc1, 0xdc, 0x5e, 0x42, 0x3b, 0xb7, 0x6c, 0x7c, 0x00, 0xad,
+    0x82, 0x46, 0x0d, 0x54, 0x4c, 0xa1, 0x3f, 0x8f, 0x76, 0x11, 0x6d, 0x3c,
+    0x3f, 0xa1, 0xe5, 0x86, 0x7f, 0xa0, 0x0d, 0xf5, 0x69, 0xf9, 0x42, 0x61,
+    0xb4, 0xc0, 0xbc, 0xdd, 0x71, 0xa2, 0x6f, 0xa7, 0x36, 0x80, 0xe5, 0xb1,
+    0xe1, 0xe1, 0x4b, 0x6b, 0x14, 0xbd, 0xb0, 0x85, 0xca, 0xfb, 0x6f, 0xa2,
+    0xb3, 0x31, 0x93, 0x5e, 0x78, 0xe4, 0x9b, 0x58, 0x04, 0x8b, 0x89, 0xa1,
+    0x91, 0x81, 0x6f, 0xe4, 0x78, 0x59, 0xe8, 0x66, 0xa7, 0xb6, 0xa7, 0x77,
+    0x74, 0xd4, 0xa1, 0xec, 0x2f, 0xe4, 0xef, 0xd5, 0xb4, 0x11, 0x8c, 0x86,
+    0x46, 0xb4, 0x42, 0xcf, 0xc8, 0x40, 0x5e, 0x0b, 0x87, 0x7b, 0x26, 0xb4,
+    0xc4, 0xf8, 0xce, 0x44, 0xdf, 0x96, 0xc4, 0x78, 0xf2, 0xda, 0xf0, 0x32,
+    0xba, 0xdc, 0xd8, 0x1e, 0x41, 0xf0, 0x2d, 0xec, 0xae, 0xf5, 0x8c, 0xf4,
+    0x69, 0x7d, 0x7d, 0x85, 0x4b, 0x13, 0xb9, 0x9e, 0x11, 0xc1, 0xa9, 0x37,
+    0xaf, 0xfd, 0x30, 0x5f, 0x18, 0x6d, 0xd6, 0x72, 0x83, 0xf9, 0xdc, 0x0f,
+    0xb4, 0xde, 0xd1, 0x9e, 0x02, 0x16, 0x47, 0x47, 0xfa, 0x87, 0x06, 0x7e,
+    0x0b, 0xef, 0x25, 0x69, 0x86, 0xc6, 0x5d, 0x79, 0x26, 0xf2, 0x03, 0x30,
+    0xdc, 0x04, 0xcc, 0x37, 0xae, 0x4d, 0x0c, 0x82, 0x39, 0xb6, 0x77, 0x50,
+    0x46, 0x0b, 0x5b, 0xdc, 0xdd, 0xc5, 0xf8, 0xcb, 0x4c, 0x5d, 0x9e, 0x1d,
+    0xf9, 0xc2, 0xd0, 0xd8, 0xe0, 0x25, 0xd6, 0x10, 0x12, 0xdc, 0x47, 0xf7,
+    0x4c, 0x68, 0xa3, 0xfd, 0xce, 0x69, 0xaf, 0x20, 0x50, 0xb8, 0x07, 0xf8,
+    0x5d, 0x97, 0x8e, 0x15, 0xbe, 0x67, 0xc5, 0xf8, 0xbe, 0x15, 0xe3, 0xfc,
+    0x65, 0x63, 0x71, 0x26, 0x26, 0xe1, 0xbe, 0xc7, 0xed, 0x59, 0x72, 0xb6,
+    0xdb, 0xf8, 0xe8, 0x9e, 0x42, 0x2e, 0xbf, 0x13, 0x3b, 0x86, 0x59, 0xf8,
+    0x15, 0x53, 0x44, 0x30, 0x68, 0x17, 0x48, 0x0a, 0xf9, 0x81, 0xae, 0xfb,
+    0x7a, 0x86, 0xf7, 0xe4, 0x99, 0x16, 0x7e, 0xd5, 0x03, 0xfe, 0x43, 0xd8,
+    0xa4, 0x6f, 0xe8, 0x3e, 0xf0, 0x1c, 0x1e, 0x1a, 0x18, 0xe9, 0x72, 0x18,
+    0xf3, 0xae, 0x5d, 0xb9, 0xd1, 0x42, 0x21, 0x9f, 0x63, 0x23, 0x53, 0x62,
+    0xdc, 0x91, 0xa0, 0xb5, 0xb5, 0x53, 0x30, 0x2f, 0xf4, 0x4c, 0x30, 0xeb,
+    0xbe, 0xb0, 0x33, 0xd7, 0xd1, 0x75, 0xf3, 0x6d, 0xb7, 0xed, 0xee, 0x68,
+    0xbb, 0xab, 0x0b, 0x0e, 0xdf, 0xd5, 0xbe, 0x3b, 0x7b, 0xab, 0x50, 0x2f,
+    0x6b, 0xa4, 0xb1, 0xb1, 0x11, 0x38, 0xf7, 0x14, 0x5a, 0x76, 0xba, 0x61,
+    0x03, 0xf8, 0xba, 0x65, 0xf0, 0xd6, 0x65, 0xb0, 0xb1, 0x04, 0x33, 0x35,
+    0x88, 0x77, 0x7a, 0x6c, 0xb3, 0x37, 0xb4, 0xdf, 0x9c, 0xe9, 0x6a, 0xdd,
+    0x7d, 0xdb, 0x2e, 0x07, 0x03, 0x87, 0x1c, 0xd3, 0x0a, 0x7b, 0xb5, 0x41,
+    0xe1, 0x02, 0x90, 0xbc, 0x17, 0x12, 0x0d, 0x8d, 0x8e, 0xec, 0xe4, 0x38,
+    0x13, 0xb8, 0x37, 0xb4, 0xc3, 0xad, 0x1e, 0xc8, 0x41, 0xc6, 0x66, 0x6d,
+    0x14, 0xb6, 0xe2, 0xbe, 0x0f, 0xf6, 0x72, 0x14, 0xe9, 0xe2, 0xb4, 0xfd,
+    0x6e, 0x9c, 0xcc, 0x57, 0xe0, 0x93, 0xf9, 0xad, 0x7c, 0x20, 0x6b, 0xae,
+    0xab, 0xaf, 0x7f, 0xa8, 0x8b, 0x43, 0x9c, 0x1c, 0x5b, 0x60, 0xae, 0x6b,
+    0xe2, 0x81, 0x31, 0x61, 0x07, 0x14, 0xc9, 0x64, 0xec, 0x71, 0x9e, 0x21,
+    0xb7, 0x72, 0xfe, 0x76, 0xca, 0x1a, 0x1a, 0xe1, 0xff, 0xe1, 0x6d, 0x73,
+    0xe0, 0xfd, 0x68, 0x7f, 0xb7, 0xc9, 0x81, 0x7f, 0xcc, 0x77, 0x44, 0x93,
+    0x03, 0x3f, 0x8f, 0xd6, 0xfe, 0x75, 0x07, 0x6e, 0xf6, 0xa1, 0x0a, 0xa8,
+    0x77, 0xe0, 0x3b, 0x25, 0xa2, 0x53, 0x55, 0xee, 0xa7, 0x47, 0x85, 0xe8,
+    0x55, 0xc5, 0x81, 0x43, 0x41, 0xe4, 0x10, 0xd9, 0x81, 0xbb, 0xab, 0x88,
+    0xee, 0x95, 0x1c, 0x78, 0xb1, 0x8e, 0x28, 0xed, 0x73, 0x9f, 0x42, 0xa8,
+    0x32, 0x8e, 0xb8, 0xcf, 0x22, 0x16, 0xe8, 0x36, 0x0f, 0xc6, 0xc6, 0x4d,
+    0x1e, 0xfc, 0x4b, 0xa2, 0xab, 0x3d, 0xf8, 0xa4, 0x8f, 0x56, 0x79, 0x70,
+    0x49, 0xa6, 0x00, 0x45, 0xa9, 0x53, 0x72, 0x36, 0x93, 0x5d, 0x58, 0xfb,
+    0x09, 0xc3, 0x2e, 0xce, 0x0b, 0x78, 0xf5, 0x81, 0xe2, 0xed, 0x5a, 0x3e,
+    0x08, 0x5e, 0x82, 0x80, 0xf9, 0x67, 0x65, 0xf0, 0xd2, 0xf6, 0x3e, 0x0f,
+    0x1c, 0x8a, 0x22, 0xef, 0xc7, 0xe8, 0xd3, 0x1a, 0xc8, 0xf9, 0xda, 0x1a,
+    0xbe, 0x3b, 0x1c, 0xd9, 0x4a, 0xeb, 0x00, 0x3b, 0x38, 0xb3, 0x89, 0x0d,
+    0x80, 0xab, 0xe8, 0x1f, 0x03, 0x90, 0xff, 0xf4, 0x66, 0xc0, 0xce, 0xbf,
+    0xe0, 0xce, 0x0d, 0x6c, 0xe3, 0xff, 0x2b, 0xd0, 0x87, 0xd5, 0x18, 0x54,
+    0x7d, 0x4b, 0xc0, 0xfc, 0x0b, 0xdf, 0xb1, 0x39, 0xc3, 0xe9, 0xe9, 0xf6,
+    0x8e, 0x76, 0xad, 0xc5, 0xd8, 0x7a, 0xdd, 0x37, 0x8c, 0xed, 0x9b, 0x0d,
+    0xc3, 0xd8, 0xde, 0xb2, 0x79, 0xa0, 0x25, 0xb7, 0x3d, 0xdd, 0xb2, 0x3d,
+    0xb5, 0xb9, 0x6f, 0xa8, 0x30, 0xf1, 0x80, 0x96, 0xbc, 0x61, 0xcf, 0x80,
+    0x66, 0xa4, 0x81, 0xd4, 0xd2, 0xa2, 0x6d, 0xd6, 0xb6, 0x5e, 0xbf, 0x73,
+    0xdb, 0xb6, 0x9d, 0xc6, 0x75, 0x1c, 0xc4, 0xc9, 0x91, 0x3d, 0xc3, 0xc3,
+    0xd7, 0xc2, 0xee, 0x3d, 0x23, 0x9c, 0x4b, 0x10, 0x42, 0x22, 0x03, 0x8d,
+    0x8f, 0x0e, 0xe7, 0xc3, 0xce, 0x37, 0x2d, 0xdc, 0x6c, 0x78, 0x08, 0xfb,
+    0xc4, 0xbf, 0x31, 0x9c, 0x9f, 0x8f, 0xfe, 0x7f, 0xfc, 0x7c, 0xe6, 0xba,
+    0x5a, 0xaa, 0xa9, 0xb5, 0xbf, 0x0e, 0xb8, 0x41, 0xfc, 0x5f, 0x06, 0x73,
+    0x8b, 0xeb, 0xa2, 0x35, 0xb5, 0x6a, 0xf4, 0xb2, 0xb9, 0x53, 0x5f, 0x9e,
+    0xbb, 0x22, 0xbf, 0x33, 0x57, 0xa0, 0x7d, 0xe9, 0x2b, 0xd2, 0xce, 0xae,
+    0xab, 0xf9, 0x12, 0xed, 0xe1, 0x75, 0xb5, 0x35, 0xb5, 0xd1, 0xcb, 0xe4,
+    0xa3, 0x23, 0x5f, 0x9e, 0xf3, 0xcd, 0xf0, 0xdc, 0x0a, 0xda, 0x43, 0x5f,
+    0x9e, 0xfb, 0xfe, 0x0f, 0xbb, 0xc6, 0x91, 0xe7, 0x7b, 0x86, 0xdd, 0x3d,
+    0xe3, 0x9b, 0x70, 0x8f, 0xe2, 0x77, 0xf6, 0x5a, 0x2a, 0x5e, 0xd8, 0x08,
+    0x57, 0x44, 0x3b, 0x8c, 0x36, 0x63, 0x38, 0xf3, 0xec, 0x7d, 0xec, 0xd2,
+    0x55, 0x6e, 0x1f, 0x76, 0xfb, 0x6a, 0xb7, 0x47, 0xe8, 0x51, 0x8d, 0xeb,
+    0x23, 0x5f, 0xe5, 0xf7, 0x7f, 0x4f, 0xda, 0xac, 0xd6,
+};
+
+const firmware_blob_t firmware_blob_f6506cc6c259ba17 = {
+    blob_f6506cc6c259ba17_z, sizeof(blob_f6506cc6c259ba17_z), 8704, 0xbcaa923d
+};
@@ -5,75 +5,160 @@
 
 #include "firmware_database.h"
 #include "firmware_registry.h"
+#include <stdio.h>
 #include <string.h>
 #include <strings.h>
 #include <stdlib.h>
+#include <pthread.h>
+#include <zlib.h>
+
+// Unique embedded binaries
+static const firmware_blob_t *const firmware_blobs[] = {
+    &firmware_blob_8f48ab74a25c1044,  // 0: a1_n_ne_x SPL
+    &firmware_blob_807e5b315a2800fc,  // 1: a1_n_ne_x U-Boot
+    &firmware_blob_f6506cc6c259ba17,  // 2: a1_nt_a SPL
+    &firmware_blob_fdf4c9d3c1f5da60,  // 3: a1_nt_a U-Boot
+    &firmware_blob_4d44e7a7f8bdb039,  // 4: t20 SPL
+    &firmware_blob_c4a83ff0e1c53e00,  // 5: t20 U-Boot
+    &firmware_blob_9b3417afb6e92596,  // 6: t21 SPL
+    &firmware_blob_6cfa451dcb73344b,  // 7: t21 U-Boot
+    &firmware_blob_41bb22eec9116297,  // 8: t23 SPL
+    &firmware_blob_bae4c6a734315cab,  // 9: t23 U-Boot
+    &firmware_blob_a42e6f65c5610662,  // 10: t30 SPL, t30a SPL, t30nl SPL, t30x SPL
+    &firmware_blob_e668537d2f63b8a5,  // 11: t30 U-Boot, t30a U-Boot, t30nl U-Boot, t30x U-Boot
+    &firmware_blob_d561847a59623cc6,  // 12: t31 SPL, t31a SPL, t31nl SPL, t31x SPL
+    &firmware_blob_17ba263b188e37f6,  // 13: t31 U-Boot, t31a U-Boot, t31nl U-Boot, t31x U-Boot
+    &firmware_blob_059f775304941425,  // 14: t40 SPL
+    &firmware_blob_738817dbb6ddf36c,  // 15: t40 U-Boot
+    &firmware_blob_00a13d16d567453d,  // 16: t41 SPL
+    &firmware_blob_e718457ce727017e,  // 17: t41 U-Boot
+};
 
 // Firmware registry table
 typedef struct {
     const char *processor;
-    const uint8_t* (*get_spl)(size_t *size);
-    const uint8_t* (*get_uboot)(size_t *size);
+    uint16_t spl_blob;
+    uint16_t uboot_blob;
 } firmware_registry_entry_t;
 
 static const firmware_registry_entry_t firmware_registry[] = {
-    {"a1_n_ne_x", firmware_a1_n_ne_x_get_spl, firmware_a1_n_ne_x_get_uboot},
-    {"a1_nt_a", firmware_a1_nt_a_get_spl, firmware_a1_nt_a_get_uboot},
-    {"t20", firmware_t20_get_spl, firmware_t20_get_uboot},
-    {"t21", firmware_t21_get_spl, firmware_t21_get_uboot},
-    {"t23", firmware_t23_get_spl, firmware_t23_get_uboot},
-    {"t30", firmware_t30_get_spl, firmware_t30_get_uboot},
-    {"t30a", firmware_t30a_get_spl, firmware_t30a_get_uboot},
-    {"t30nl", firmware_t30nl_get_spl, firmware_t30nl_get_uboot},
-    {"t30x", firmware_t30x_get_spl, firmware_t30x_get_uboot},
-    {"t31", firmware_t31_get_spl, firmware_t31_get_uboot},
-    {"t31a", firmware_t31a_get_spl, firmware_t31a_get_uboot},
-    {"t31nl", firmware_t31nl_get_spl, firmware_t31nl_get_uboot},
-    {"t31x", firmware_t31x_get_spl, firmware_t31x_get_uboot},
-    {"t40", firmware_t40_get_spl, firmware_t40_get_uboot},
-    {"t41", firmware_t41_get_spl, firmware_t41_get_uboot},
+    {"a1_n_ne_x", 0, 1},
+    {"a1_nt_a", 2, 3},
+    {"t20", 4, 5},
+    {"t21", 6, 7},
+    {"t23", 8, 9},
+    {"t30", 10, 11},
+    {"t30a", 10, 11},
+    {"t30nl", 10, 11},
+    {"t30x", 10, 11},
+    {"t31", 12, 13},
+    {"t31a", 12, 13},
+    {"t31nl", 12, 13},
+    {"t31x", 12, 13},
+    {"t40", 14, 15},
+    {"t41", 16, 17},
 };
 
+#define FIRMWARE_COUNT (sizeof(firmware_registry) / sizeof(firmware_registry[0]))
+#define FIRMWARE_BLOB_COUNT (sizeof(firmware_blobs) / sizeof(firmware_blobs[0]))
+
+static pthread_mutex_t firmware_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Inflated blobs, filled on first use and kept for the life of the process.
+// Variants sharing a binary share the inflated copy too.
+static uint8_t *firmware_inflated[FIRMWARE_BLOB_COUNT];
+
+// Inflate one blob (caller holds firmware_lock); NULL if it is corrupt
+static const uint8_t* firmware_blob_inflate(uint16_t index) {
+    if (firmware_inflated[index]) {
+        return firmware_inflated[index];
+    }
+
+    const firmware_blob_t *blob = firmware_blobs[index];
+    uint8_t *data = malloc(blob->size);
+    if (!data) {
+        return NULL;
+    }
+
+    uLongf size = (uLongf)blob->size;
+    if (uncompress(data, &size, blob->data, (uLong)blob->compressed_size) != Z_OK ||
+        size != blob->size ||
+        crc32(0L, data, (uInt)size) != blob->crc32) {
+        free(data);
+        return NULL;
+    }
+
+    firmware_inflated[index] = data;
+    return data;
+}
+
 const firmware_binary_t* firmware_get(const char *processor) {
     if (!processor) return NULL;
 
-    static firmware_binary_t result;
+    // One result slot per registry entry, filled once under the lock, so
+    // concurrent callers (parallel device workers) never see a slot that is
+    // being filled.
+    static firmware_binary_t results[FIRMWARE_COUNT];
+    static int filled[FIRMWARE_COUNT];
 
-    for (size_t i = 0; i < sizeof(firmware_registry) / sizeof(firmware_registry[0]); i++) {
+    for (size_t i = 0; i < FIRMWARE_COUNT; i++) {
         if (strcasecmp(firmware_registry[i].processor, processor) == 0) {
-            result.processor = firmware_registry[i].processor;
-            result.spl_data = firmware_registry[i].get_spl(&result.spl_size);
-            result.uboot_data = firmware_registry[i].get_uboot(&result.uboot_size);
-            return &result;
+            const firmware_binary_t *result = &results[i];
+            pthread_mutex_lock(&firmware_lock);
+            if (!filled[i]) {
+                const firmware_registry_entry_t *entry = &firmware_registry[i];
+                const uint8_t *spl = firmware_blob_inflate(entry->spl_blob);
+                const uint8_t *uboot = spl ? firmware_blob_inflate(entry->uboot_blob) : NULL;
+                if (spl && uboot) {
+                    results[i].processor = entry->processor;
+                    results[i].spl_data = spl;
+                    results[i].spl_size = firmware_blobs[entry->spl_blob]->size;
+                    results[i].uboot_data = uboot;
+                    results[i].uboot_size = firmware_blobs[entry->uboot_blob]->size;
+                    filled[i] = 1;
+                } else {
+                    fprintf(stderr, "Error: embedded firmware for %s is corrupt or out of memory\n",
+                            entry->processor);
+                    result = NULL;
+                }
+            }
+            pthread_mutex_unlock(&firmware_lock);
+            return result;
         }
     }
 
     return NULL;
 }
 
+// Names and sizes only: listing must not inflate every binary. The data
+// pointers are NULL; use firmware_get() for the binaries themselves.
+static firmware_binary_t firmware_list_entries[FIRMWARE_COUNT];
+static pthread_once_t firmware_list_once = PTHREAD_ONCE_INIT;
+
+static void firmware_list_init(void) {
+    for (size_t i = 0; i < FIRMWARE_COUNT; i++) {
+        firmware_list_entries[i].processor = firmware_registry[i].processor;
+        firmware_list_entries[i].spl_size = firmware_blobs[firmware_registry[i].spl_blob]->size;
+        firmware_list_entries[i].uboot_size = firmware_blobs[firmware_registry[i].uboot_blob]->size;
+    }
+}
+
 const firmware_binary_t* firmware_list(size_t *count) {
     if (count) {
-        *count = sizeof(firmware_registry) / sizeof(firmware_registry[0]);
+        *count = FIRMWARE_COUNT;
     }
 
-    // Build array of firmware_binary_t on first call
-    static firmware_binary_t *list = NULL;
-    static size_t list_size = 0;
+    pthread_once(&firmware_list_once, firmware_list_init);
+    return firmware_list_entries;
+}
 
-    if (!list) {
-        list_size = sizeof(firmware_registry) / sizeof(firmware_registry[0]);
-        list = malloc(list_size * sizeof(firmware_binary_t));
+int firmware_available(const char *processor) {
+    if (!processor) return 0;
 
-        for (size_t i = 0; i < list_size; i++) {
-            list[i].processor = firmware_registry[i].processor;
-            list[i].spl_data = firmware_registry[i].get_spl(&list[i].spl_size);
-            list[i].uboot_data = firmware_registry[i].get_uboot(&list[i].uboot_size);
+    for (size_t i = 0; i < FIRMWARE_COUNT; i++) {
+        if (strcasecmp(firmware_registry[i].processor, processor) == 0) {
+            return 1;
         }
     }
-
-    return list;
-}
-
-int firmware_available(const char *processor) {
-    return firmware_get(processor) != NULL;
+    return 0;
 }
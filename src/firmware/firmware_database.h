@@ -4,6 +4,7 @@
  * This module provides access to embedded SPL and U-Boot binaries for all
  * supported Ingenic processors. The binaries are compiled directly into the
  * executable, eliminating the need to distribute separate firmware files.
+ * They are stored zlib-compressed and inflated on first use.
  * 
  * Source: references/cloner-2.5.43-ubuntu_thingino/firmwares/
  */
@@ -27,7 +28,10 @@ typedef struct {
 
 /**
  * Get firmware binaries for a specific processor
- * 
+ *
+ * The first call for a processor decompresses its binaries; the result is
+ * cached and shared by later callers. Thread-safe.
+ *
  * @param processor Processor name (e.g., "t31x", "t41", "a1")
  * @return Pointer to firmware_binary_t structure, or NULL if not found
  */
@@ -35,7 +39,10 @@ const firmware_binary_t* firmware_get(const char *processor);
 
 /**
  * List all available firmware binaries
- * 
+ *
+ * Entries carry the processor name and binary sizes only; spl_data and
+ * uboot_data are NULL. Use firmware_get() to load a processor's binaries.
+ *
  * @param count Output parameter for number of firmwares
  * @return Pointer to array of firmware_binary_t structures
  */
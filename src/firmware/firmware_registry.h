@@ -9,35 +9,31 @@
 #include <stdint.h>
 #include <stddef.h>
 
-const uint8_t* firmware_a1_n_ne_x_get_spl(size_t *size);
-const uint8_t* firmware_a1_n_ne_x_get_uboot(size_t *size);
-const uint8_t* firmware_a1_nt_a_get_spl(size_t *size);
-const uint8_t* firmware_a1_nt_a_get_uboot(size_t *size);
-const uint8_t* firmware_t20_get_spl(size_t *size);
-const uint8_t* firmware_t20_get_uboot(size_t *size);
-const uint8_t* firmware_t21_get_spl(size_t *size);
-const uint8_t* firmware_t21_get_uboot(size_t *size);
-const uint8_t* firmware_t23_get_spl(size_t *size);
-const uint8_t* firmware_t23_get_uboot(size_t *size);
-const uint8_t* firmware_t30_get_spl(size_t *size);
-const uint8_t* firmware_t30_get_uboot(size_t *size);
-const uint8_t* firmware_t30a_get_spl(size_t *size);
-const uint8_t* firmware_t30a_get_uboot(size_t *size);
-const uint8_t* firmware_t30nl_get_spl(size_t *size);
-const uint8_t* firmware_t30nl_get_uboot(size_t *size);
-const uint8_t* firmware_t30x_get_spl(size_t *size);
-const uint8_t* firmware_t30x_get_uboot(size_t *size);
-const uint8_t* firmware_t31_get_spl(size_t *size);
-const uint8_t* firmware_t31_get_uboot(size_t *size);
-const uint8_t* firmware_t31a_get_spl(size_t *size);
-const uint8_t* firmware_t31a_get_uboot(size_t *size);
-const uint8_t* firmware_t31nl_get_spl(size_t *size);
-const uint8_t* firmware_t31nl_get_uboot(size_t *size);
-const uint8_t* firmware_t31x_get_spl(size_t *size);
-const uint8_t* firmware_t31x_get_uboot(size_t *size);
-const uint8_t* firmware_t40_get_spl(size_t *size);
-const uint8_t* firmware_t40_get_uboot(size_t *size);
-const uint8_t* firmware_t41_get_spl(size_t *size);
-const uint8_t* firmware_t41_get_uboot(size_t *size);
+// zlib-compressed embedded binary
+typedef struct {
+    const uint8_t *data;
+    size_t compressed_size;
+    size_t size;          // Size after decompression
+    uint32_t crc32;       // CRC32 of the decompressed data
+} firmware_blob_t;
+
+extern const firmware_blob_t firmware_blob_8f48ab74a25c1044;
+extern const firmware_blob_t firmware_blob_807e5b315a2800fc;
+extern const firmware_blob_t firmware_blob_f6506cc6c259ba17;
+extern const firmware_blob_t firmware_blob_fdf4c9d3c1f5da60;
+extern const firmware_blob_t firmware_blob_4d44e7a7f8bdb039;
+extern const firmware_blob_t firmware_blob_c4a83ff0e1c53e00;
+extern const firmware_blob_t firmware_blob_9b3417afb6e92596;
+extern const firmware_blob_t firmware_blob_6cfa451dcb73344b;
+extern const firmware_blob_t firmware_blob_41bb22eec9116297;
+extern const firmware_blob_t firmware_blob_bae4c6a734315cab;
+extern const firmware_blob_t firmware_blob_a42e6f65c5610662;
+extern const firmware_blob_t firmware_blob_e668537d2f63b8a5;
+extern const firmware_blob_t firmware_blob_d561847a59623cc6;
+extern const firmware_blob_t firmware_blob_17ba263b188e37f6;
+extern const firmware_blob_t firmware_blob_059f775304941425;
+extern const firmware_blob_t firmware_blob_738817dbb6ddf36c;
+extern const firmware_blob_t firmware_blob_00a13d16d567453d;
+extern const firmware_blob_t firmware_blob_e718457ce727017e;
 
 #endif // FIRMWARE_REGISTRY_H